@@ -0,0 +1,50 @@
+/* Host stand-ins for the board: registers, libwispbase, libmsp cycles
+ *
+ * Each simulated device runs on its own thread, so the registers are
+ * per-thread, and the cycle counter counts the CPU time of the thread.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include <msp430.h>
+#include <libmsp/cycles.h>
+#include <libwispbase/wisp-base.h>
+
+#define HOST_PORT_REGS_DEF(port) \
+    _Thread_local volatile uint8_t P ## port ## DIR; \
+    _Thread_local volatile uint8_t P ## port ## OUT; \
+    _Thread_local volatile uint8_t P ## port ## IN; \
+    _Thread_local volatile uint8_t P ## port ## SEL0; \
+    _Thread_local volatile uint8_t P ## port ## SEL1; \
+    _Thread_local volatile uint8_t P ## port ## REN;
+
+HOST_PORT_REGS_DEF(1)
+HOST_PORT_REGS_DEF(2)
+HOST_PORT_REGS_DEF(3)
+HOST_PORT_REGS_DEF(4)
+HOST_PORT_REGS_DEF(J)
+
+static _Thread_local uint64_t cycles_start_ns;
+
+static uint64_t thread_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void WISP_init(void)
+{
+}
+
+/** @brief Count in nanoseconds of thread CPU time (not MCU cycles) */
+void msp_cycles_start()
+{
+    cycles_start_ns = thread_ns();
+}
+
+uint32_t msp_cycles()
+{
+    return (uint32_t)(thread_ns() - cycles_start_ns);
+}
@@ -0,0 +1,12 @@
+#ifndef HOST_WISP_BASE_H
+#define HOST_WISP_BASE_H
+
+/* Host stand-in for libwispbase (LIBCHAIN_HOST build) */
+
+#include <stdint.h>
+
+#define USRBANK_SIZE 32
+
+void WISP_init(void);
+
+#endif // HOST_WISP_BASE_H
@@ -0,0 +1,40 @@
+#ifndef HOST_MSP430_H
+#define HOST_MSP430_H
+
+/* Host stand-in for the MSP430 device header (LIBCHAIN_HOST build)
+ *
+ * Only what the benchmarks touch in init() and in tasks: the GPIO registers,
+ * which are plain per-device (per-thread) variables, and the intrinsics.
+ */
+
+#include <stdint.h>
+
+#define HOST_PORT_REGS(port) \
+    extern _Thread_local volatile uint8_t P ## port ## DIR; \
+    extern _Thread_local volatile uint8_t P ## port ## OUT; \
+    extern _Thread_local volatile uint8_t P ## port ## IN; \
+    extern _Thread_local volatile uint8_t P ## port ## SEL0; \
+    extern _Thread_local volatile uint8_t P ## port ## SEL1; \
+    extern _Thread_local volatile uint8_t P ## port ## REN;
+
+HOST_PORT_REGS(1)
+HOST_PORT_REGS(2)
+HOST_PORT_REGS(3)
+HOST_PORT_REGS(4)
+HOST_PORT_REGS(J)
+
+#define BIT0 0x0001
+#define BIT1 0x0002
+#define BIT2 0x0004
+#define BIT3 0x0008
+#define BIT4 0x0010
+#define BIT5 0x0020
+#define BIT6 0x0040
+#define BIT7 0x0080
+
+#define __enable_interrupt()
+#define __disable_interrupt()
+#define __no_operation()
+#define __delay_cycles(n)
+
+#endif // HOST_MSP430_H
@@ -0,0 +1,16 @@
+#include "chain.h"
+
+/* Non-intermittent baseline: see baseline.h */
+
+chain_time_t chain_time = 0;
+const task_t *chain_next_task = TASK_REF(_entry_task);
+
+/** @brief Entry point: run tasks one after another until power is lost */
+int main() {
+    _init();
+
+    while (1)
+        chain_next_task->func();
+
+    return 0;
+}
@@ -9,17 +9,22 @@
 #endif
 
 #include "chain.h"
+#include "profile.h"
+#include "waste.h"
+#include "failures.h"
+#include "host.h"
 
 /* Dummy types for offset calculations */
 struct _void_type_t {
     void * x;
-};
+} VAR_ALIGN;
 typedef struct _void_type_t void_type_t;
 
 __nv chain_time_t volatile curtime = 0;
 
 /* To update the context, fill-in the unused one and flip the pointer to it */
 __nv context_t context_1 = {0};
+#ifndef LIBCHAIN_HOST
 __nv context_t context_0 = {
     .task = TASK_REF(_entry_task),
     .time = 0,
@@ -27,6 +32,12 @@ __nv context_t context_0 = {
 };
 
 __nv context_t * volatile curctx = &context_0;
+#else // LIBCHAIN_HOST
+// Addresses of per-thread variables are not link-time constants, so the
+// initial context is filled in on the first boot (see chain_boot).
+__nv context_t context_0 = {0};
+__nv context_t * volatile curctx = NULL;
+#endif // LIBCHAIN_HOST
 
 // for internal instrumentation purposes
 __nv volatile unsigned _numBoots = 0;
@@ -38,6 +49,10 @@ void task_prologue()
 {
     task_t *curtask = curctx->task;
 
+    PROF_RD(PROF_SYM_CURCTX, 1);
+    PROF_RD(prof_ctx_sym(curctx), 2); // task, time
+    PROF_RD(PROF_SYM_TASK_LAST_EXEC, 1);
+
     // Swaps of the self-channel buffer happen on transitions, not restarts.
     // We detect transitions by comparing the current time with a timestamp.
     if (curctx->time != curtask->last_execute_time) {
@@ -53,12 +68,24 @@ void task_prologue()
         while ((i = curtask->num_dirty_self_fields) > 0) {
             self_field_meta_t *self_field = dirty_self_fields[--i];
 
+            HOST_TICK(1);
+
+            PROF_RD(PROF_SYM_TASK_NUM_DIRTY, 1);
+            PROF_RD(PROF_SYM_TASK_DIRTY_LIST, 1);
+            PROF_RD(PROF_SYM_SELF_IDX_PAIR, 1);
+
             if (self_field->idx_pair & SELF_CHAN_IDX_BIT_DIRTY_CURRENT) {
                 // Atomically: swap AND clear the dirty bit (by "moving" it over to MSB)
+#ifndef LIBCHAIN_HOST
                 __asm__ volatile (
                     "SWPB %[idx_pair]\n"
                     : [idx_pair]  "=m" (self_field->idx_pair)
                 );
+#else // LIBCHAIN_HOST
+                self_field->idx_pair = ((self_field->idx_pair & 0x00ff) << 8) |
+                                       ((self_field->idx_pair & 0xff00) >> 8);
+#endif // LIBCHAIN_HOST
+                PROF_WR(PROF_SYM_SELF_IDX_PAIR, 1);
             }
 
             // Trade-off: either we do one FRAM write after each element, or
@@ -66,9 +93,12 @@ void task_prologue()
             // forward progress if we reboot in the middle of this loop.
             // We opt for making progress.
             curtask->num_dirty_self_fields = i;
+            PROF_WR(PROF_SYM_TASK_NUM_DIRTY, 1);
         }
+        PROF_RD(PROF_SYM_TASK_NUM_DIRTY, 1);
 
         curtask->last_execute_time = curctx->time;
+        PROF_WR(PROF_SYM_TASK_LAST_EXEC, 1);
     } else {
         // In this case, swapping that needed to take place after the last
         // transition has run to completion (even if it was restarted) [because
@@ -76,6 +106,7 @@ void task_prologue()
         // because of a restart. We must clear any state that the incomplete
         // execution of the task might have changed.
         curtask->num_dirty_self_fields = 0;
+        PROF_WR(PROF_SYM_TASK_NUM_DIRTY, 1);
     }
 }
 
@@ -127,21 +158,35 @@ void transition_to(task_t *next_task)
     //       Probably need to write a custom entry point in asm, and
     //       use it instead of the C runtime one.
 
+    HOST_TICK(1);
+    FAILURES_CHECK_COMMIT();
+    WASTE_COMMIT();
+
     next_ctx = curctx->next_ctx;
     next_ctx->task = next_task;
     next_ctx->time = curctx->time + 1;
 
     next_ctx->next_ctx = curctx;
+
+    PROF_RD(PROF_SYM_CURCTX, 1);
+    PROF_RD(prof_ctx_sym(curctx), 2); // next_ctx, time
+    PROF_WR(prof_ctx_sym(next_ctx), 3); // task, time, next_ctx
+
     curctx = next_ctx;
+    PROF_WR(PROF_SYM_CURCTX, 1);
 
     task_prologue();
 
+#ifndef LIBCHAIN_HOST
     __asm__ volatile ( // volatile because output operands unused by C
         "mov #0x2400, r1\n"
         "br %[ntask]\n"
         :
         : [ntask] "r" (next_task->func)
     );
+#else // LIBCHAIN_HOST
+    chain_host_jump(next_task);
+#endif // LIBCHAIN_HOST
 
     // Alternative:
     // task-function prologue:
@@ -167,10 +212,17 @@ void *chan_in(const char *field_name, size_t var_size, int count, ...)
 
     var_meta_t *var;
     var_meta_t *latest_var = NULL;
+#ifdef LIBCHAIN_ENABLE_PROFILING
+    uint8_t *latest_chan = NULL;
+#endif
 
     LIBCHAIN_PRINTF("[%u] %s: in: '%s':", curctx->time,
                     curctx->task->name, field_name);
 
+    HOST_TICK(1);
+    WASTE_CHECKPOINT();
+    FAILURES_CHECK();
+
     va_start(ap, count);
 
     for (i = 0; i < count; ++i) {
@@ -182,12 +234,15 @@ void *chan_in(const char *field_name, size_t var_size, int count, ...)
                                     offsetof(CH_TYPE(_sb, _db, _void_type_t), meta));
         uint8_t *field = chan_data + field_offset;
 
+        PROF_RD(prof_chan_sym(chan, field_name), 1); // chan type
+
         switch (chan_meta->type) {
             case CHAN_TYPE_SELF: {
                 self_field_meta_t *self_field = (self_field_meta_t *)field;
 
                 unsigned var_offset =
                     (self_field->idx_pair & SELF_CHAN_IDX_BIT_CURRENT) ? var_size : 0;
+                PROF_RD(prof_chan_sym(chan, field_name), 1); // idx_pair
 
                 var = (var_meta_t *)(field +
                         offsetof(SELF_FIELD_TYPE(void_type_t), var) + var_offset);
@@ -199,13 +254,22 @@ void *chan_in(const char *field_name, size_t var_size, int count, ...)
                         offsetof(FIELD_TYPE(void_type_t), var));
         }
 
+        PROF_RD(prof_chan_sym(chan, field_name), 1); // timestamp
+
         if (var->timestamp > latest_update) {
             latest_update = var->timestamp;
             latest_var = var;
+#ifdef LIBCHAIN_ENABLE_PROFILING
+            latest_chan = chan;
+#endif
         }
     }
     va_end(ap);
 
+    // The caller dereferences the returned pointer to read the value
+    PROF_RD(prof_chan_sym(latest_chan, field_name),
+            PROF_WORDS(var_size - sizeof(var_meta_t)));
+
     uint8_t *value = (uint8_t *)latest_var + offsetof(VAR_TYPE(void_type_t), value);
 
 
@@ -232,6 +296,10 @@ void chan_out(const char *field_name, const void *value,
     int i;
     var_meta_t *var;
 
+    HOST_TICK(1);
+    WASTE_CHECKPOINT();
+    FAILURES_CHECK();
+
     va_start(ap, count);
 
     for (i = 0; i < count; ++i) {
@@ -243,6 +311,8 @@ void chan_out(const char *field_name, const void *value,
                                     offsetof(CH_TYPE(_sb, _db, _void_type_t), meta));
         uint8_t *field = chan_data + field_offset;
 
+        PROF_RD(prof_chan_sym(chan, field_name), 1); // chan type
+
         switch (chan_meta->type) {
             case CHAN_TYPE_SELF: {
                 self_field_meta_t *self_field = (self_field_meta_t *)field;
@@ -269,6 +339,12 @@ void chan_out(const char *field_name, const void *value,
                 self_field->idx_pair |= SELF_CHAN_IDX_BIT_DIRTY_CURRENT;
                 curtask->dirty_self_fields[curtask->num_dirty_self_fields++] = self_field;
 
+                PROF_RD(prof_chan_sym(chan, field_name), 3); // idx_pair
+                PROF_WR(prof_chan_sym(chan, field_name), 2); // idx_pair
+                PROF_RD(PROF_SYM_TASK_NUM_DIRTY, 1);
+                PROF_WR(PROF_SYM_TASK_NUM_DIRTY, 1);
+                PROF_WR(PROF_SYM_TASK_DIRTY_LIST, 1);
+
                 break;
             }
             default:
@@ -280,16 +356,41 @@ void chan_out(const char *field_name, const void *value,
         var->timestamp = curctx->time;
         void *var_value = (uint8_t *)var + offsetof(VAR_TYPE(void_type_t), value);
         memcpy(var_value, value, var_size - sizeof(var_meta_t));
+
+        PROF_WR(prof_chan_sym(chan, field_name),
+                1 + PROF_WORDS(var_size - sizeof(var_meta_t))); // timestamp, value
     }
 
     va_end(ap);
 }
 
-/** @brief Entry point upon reboot */
+/** @brief Entry point upon reboot
+ *  @details On the host, the fleet harness calls this on each simulated boot.
+ */
+#ifndef LIBCHAIN_HOST
 int main() {
+#else // LIBCHAIN_HOST
+int chain_boot() {
+    if (!curctx) { // first boot of this device
+        context_0.task = TASK_REF(_entry_task);
+        context_0.next_ctx = &context_1;
+        curctx = &context_0;
+    }
+#endif // LIBCHAIN_HOST
     _init();
 
     _numBoots++;
+    PROF_RD(PROF_SYM_NUM_BOOTS, 1);
+    PROF_WR(PROF_SYM_NUM_BOOTS, 1);
+
+    FAILURES_BOOT();
+
+    // Every boot but the first resumes an attempt cut off by a power failure
+    // (the prologue cannot tell: it takes the same branch on every call after
+    // the one in transition_to)
+    if (_numBoots > 1)
+        WASTE_RESTART();
+    WASTE_BOOT();
 
     // Resume execution at the last task that started but did not finish
 
@@ -300,11 +401,15 @@ int main() {
 
     task_prologue();
 
+#ifndef LIBCHAIN_HOST
     __asm__ volatile ( // volatile because output operands unused by C
         "br %[nt]\n"
         : /* no outputs */
         : [nt] "r" (curctx->task->func)
     );
+#else // LIBCHAIN_HOST
+    chain_host_jump(curctx->task);
+#endif // LIBCHAIN_HOST
 
     return 0; // TODO: write our own entry point and get rid of this
 }
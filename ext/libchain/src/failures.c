@@ -0,0 +1,115 @@
+#include <msp430.h>
+#include <stdio.h>
+
+#include "chain.h"
+#include "host.h"
+#include "waste.h"
+#include "failures.h"
+
+#ifndef LIBCHAIN_FAILURE_LOG_SIZE
+#define LIBCHAIN_FAILURE_LOG_SIZE 64
+#endif
+
+extern __nv volatile unsigned _numBoots;
+
+#if defined(LIBCHAIN_RECORD_FAILURES)
+
+__nv chain_failure_t failure_log[LIBCHAIN_FAILURE_LOG_SIZE];
+__nv const char *failure_task_names[LIBCHAIN_FAILURE_LOG_SIZE];
+__nv unsigned failure_log_len = 0;
+__nv unsigned failure_log_dropped = 0;
+
+/** @brief Log where the previous boot ended
+ *  @details Called on boot before the prologue, so the attempt counter still
+ *           holds the cycles of the interrupted attempt.
+ */
+void failures_boot()
+{
+    chain_failure_t *entry;
+
+    if (_numBoots <= 1) // first boot after programming
+        return;
+
+    if (failure_log_len == LIBCHAIN_FAILURE_LOG_SIZE) {
+        failure_log_dropped++;
+        return;
+    }
+
+    // Entry is filled before the length is bumped, so that a reboot in
+    // between does not log a partial entry.
+    entry = &failure_log[failure_log_len];
+    entry->task = curctx->task->idx;
+    entry->time = curctx->time;
+    entry->cycles = waste_checkpointed_cycles();
+    failure_task_names[failure_log_len] = curctx->task->name;
+    failure_log_len++;
+}
+
+/** @brief Print the log as a schedule file for LIBCHAIN_FAILURE_SCHEDULE */
+void chain_failures_report()
+{
+    unsigned i;
+
+    printf("/* failure schedule: { task, time, cycles } */\r\n");
+    for (i = 0; i < failure_log_len; ++i) {
+        chain_failure_t *entry = &failure_log[i];
+        printf("{ %u, %u, " FMT_U32 " }, /* %s */\r\n", entry->task,
+               entry->time, entry->cycles, failure_task_names[i]);
+    }
+    if (failure_log_dropped)
+        printf("/* log full: %u failures not recorded */\r\n",
+               failure_log_dropped);
+}
+
+#elif defined(LIBCHAIN_REPLAY_FAILURES)
+
+static const chain_failure_t failure_schedule[] = {
+#include LIBCHAIN_FAILURE_SCHEDULE
+};
+
+#define FAILURE_SCHEDULE_LEN (sizeof(failure_schedule) / sizeof(failure_schedule[0]))
+
+// Index of the next failure to inject
+__nv unsigned failure_next = 0;
+__nv unsigned failure_injected = 0;
+
+/** @brief Skip failures that are in the logical past */
+void failures_boot()
+{
+    while (failure_next < FAILURE_SCHEDULE_LEN &&
+           failure_schedule[failure_next].time < curctx->time)
+        failure_next++;
+}
+
+void failures_check(int committing)
+{
+    const chain_failure_t *entry;
+
+    if (failure_next == FAILURE_SCHEDULE_LEN)
+        return;
+
+    entry = &failure_schedule[failure_next];
+    if (entry->time != curctx->time || entry->task != curctx->task->idx)
+        return;
+
+    if (!committing && waste_attempt_cycles() < entry->cycles)
+        return;
+
+    // Advance first, so that the failure is injected exactly once
+    failure_next++;
+    failure_injected++;
+
+#ifndef LIBCHAIN_HOST
+    PMMCTL0 = PMMPW | PMMSWBOR;
+#else // LIBCHAIN_HOST
+    chain_host_power_fail();
+#endif // LIBCHAIN_HOST
+}
+
+void chain_failures_report()
+{
+    printf("failures injected: %u of %u\r\n",
+           failure_injected, (unsigned)FAILURE_SCHEDULE_LEN);
+}
+
+#endif // LIBCHAIN_*_FAILURES
@@ -0,0 +1,41 @@
+#ifndef FAILURES_H
+#define FAILURES_H
+
+/* Record and replay of power failure points (internal to libchain)
+ *
+ * A failure point is identified by the task, the logical time, and the
+ * cycles the task had executed since it (re)started, as counted by the
+ * re-execution accounting (see waste.h), which these modes enable.
+ *
+ * LIBCHAIN_RECORD_FAILURES: on every reboot, log the point where the previous
+ * boot ended, as of the last checkpoint (channel access or transition). The
+ * report prints the log in the format of a schedule file for replay.
+ *
+ * LIBCHAIN_REPLAY_FAILURES: on continuous power, reset the MCU (software BOR)
+ * at each point from the schedule file LIBCHAIN_FAILURE_SCHEDULE. The reset
+ * fires at the first checkpoint at or past the cycle offset, or at the
+ * transition if the task finishes before reaching the offset, so that the
+ * logical sequence of failures is the same even if the code got faster.
+ *
+ * On the host, the offsets are energy ticks of the simulated device (see
+ * host.h) instead of cycles, and the reset is a power failure of the device.
+ * Replay there runs the fleet on continuous power (-c).
+ */
+
+#if defined(LIBCHAIN_RECORD_FAILURES) || defined(LIBCHAIN_REPLAY_FAILURES)
+void failures_boot();
+#define FAILURES_BOOT() failures_boot()
+#else // !LIBCHAIN_*_FAILURES
+#define FAILURES_BOOT()
+#endif // !LIBCHAIN_*_FAILURES
+
+#if defined(LIBCHAIN_REPLAY_FAILURES)
+void failures_check(int committing);
+#define FAILURES_CHECK() failures_check(0)
+#define FAILURES_CHECK_COMMIT() failures_check(1)
+#else // !LIBCHAIN_REPLAY_FAILURES
+#define FAILURES_CHECK()
+#define FAILURES_CHECK_COMMIT()
+#endif // !LIBCHAIN_REPLAY_FAILURES
+
+#endif // FAILURES_H
@@ -0,0 +1,404 @@
+/* Fleet simulation on the host (LIBCHAIN_HOST)
+ *
+ * Runs many independent instances of a Chain application, each one a
+ * simulated intermittently-powered device, spread over a pool of worker
+ * threads. Each instance executes on a fresh thread, so it starts from a
+ * pristine copy of the non-volatile memory image (see libmsp/mem.h), and
+ * nothing persistent is shared between instances.
+ *
+ * Energy model: the runtime charges one tick per operation (channel access,
+ * transition, dirty field commit). The computation of the tasks between
+ * operations is not charged, so a task costs the same energy however long it
+ * computes. Each boot gets a budget of ticks drawn uniformly from [min, max];
+ * when it runs out, the device loses power, recharges for a fixed number of
+ * ticks, and reboots. An instance completes when it transitions to one of the
+ * done tasks, and is reported stuck after too many boots, ticks, or seconds
+ * of wall time. Only the latter two bound a run on continuous power, and
+ * only the wall time bounds tasks that compute long between operations (it
+ * is checked at operations).
+ *
+ * The reports of the runtime instrumentation (see CHAIN_REPORT) are printed
+ * once, for instance 0, when it completes or gets stuck.
+ *
+ * Usage: <app> [-n instances] [-j threads] [-e min:max] [-r recharge]
+ *              [-d task[,task...]] [-s seed] [-m max_boots] [-t max_ticks]
+ *              [-w max_seconds] [-c]
+ */
+
+#include <pthread.h>
+#include <setjmp.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chain.h"
+#include "host.h"
+
+#define FLEET_MAX_DONE_TASKS 8
+
+/* Runtime operations between checks of the wall time limit (-w) */
+#define FLEET_CLOCK_PERIOD 256
+
+/* Budget per boot when running on continuous power (-c) */
+#define FLEET_CONT_POWER_TICKS UINT64_MAX
+
+typedef enum {
+    JMP_BOOT = 0, // from setjmp
+    JMP_TASK,
+    JMP_POWER_FAIL,
+    JMP_DONE,
+    JMP_STUCK,
+} fleet_jmp_t;
+
+typedef struct {
+    unsigned instances;
+    unsigned threads;
+    uint64_t energy_min;
+    uint64_t energy_max;
+    uint64_t recharge;
+    const char *done_tasks[FLEET_MAX_DONE_TASKS];
+    unsigned num_done_tasks;
+    uint64_t seed;
+    unsigned max_boots;
+    uint64_t max_ticks;
+    unsigned max_seconds;
+    int cont_power;
+} fleet_config_t;
+
+typedef struct {
+    uint64_t ticks;     // simulated time to completion: on + recharge ticks
+    uint64_t boots;
+    uint64_t wall_ns;
+    int done_task;      // index into done_tasks, -1 if stuck
+} fleet_result_t;
+
+/* State of the instance running on this thread */
+typedef struct {
+    unsigned id;
+    uint64_t rng;
+    uint64_t budget;    // ticks left in the current boot
+    uint64_t on_ticks;
+    unsigned boots;
+    unsigned ops;       // runtime operations, for FLEET_CLOCK_PERIOD
+    uint64_t start_ns;
+    task_t *next_task;
+    int done_task;
+    jmp_buf env;
+    fleet_result_t *result;
+} fleet_instance_t;
+
+static fleet_config_t config = {
+    .instances = 1000,
+    .threads = 0, // number of cores
+    .energy_min = 50,
+    .energy_max = 500,
+    .recharge = 1000,
+    .seed = 1,
+    .max_boots = 100000,
+    .max_ticks = 100000000,
+    .max_seconds = 60,
+};
+
+static fleet_result_t *results;
+static atomic_uint next_instance;
+
+static _Thread_local fleet_instance_t *self;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/** @brief Whether the instance ran out of wall time (checked periodically,
+ *         since reading the clock costs more than the operation itself) */
+static int fleet_timed_out(fleet_instance_t *inst)
+{
+    if (!config.max_seconds || ++inst->ops % FLEET_CLOCK_PERIOD)
+        return 0;
+    return now_ns() - inst->start_ns > config.max_seconds * 1000000000ull;
+}
+
+/** @brief Per-instance PRNG (xorshift64*), so that the fleet is reproducible */
+static uint64_t fleet_rand(fleet_instance_t *inst)
+{
+    inst->rng ^= inst->rng >> 12;
+    inst->rng ^= inst->rng << 25;
+    inst->rng ^= inst->rng >> 27;
+    return inst->rng * 0x2545f4914f6cdd1dull;
+}
+
+static uint64_t fleet_energy(fleet_instance_t *inst)
+{
+    if (config.cont_power)
+        return FLEET_CONT_POWER_TICKS;
+    return config.energy_min +
+        fleet_rand(inst) % (config.energy_max - config.energy_min + 1);
+}
+
+void chain_host_tick(unsigned cost)
+{
+    fleet_instance_t *inst = self;
+
+    if (inst->on_ticks + cost > config.max_ticks || fleet_timed_out(inst))
+        longjmp(inst->env, JMP_STUCK);
+    if (inst->budget <= cost) {
+        inst->on_ticks += inst->budget;
+        inst->budget = 0;
+        longjmp(inst->env, JMP_POWER_FAIL);
+    }
+    inst->budget -= cost;
+    inst->on_ticks += cost;
+}
+
+/** @brief Energy ticks the instance has used so far, over all boots */
+uint32_t chain_host_ticks()
+{
+    return self->on_ticks;
+}
+
+/** @brief Cut the power of the instance now (for injected failures) */
+void chain_host_power_fail()
+{
+    longjmp(self->env, JMP_POWER_FAIL);
+}
+
+void chain_host_jump(task_t *task)
+{
+    fleet_instance_t *inst = self;
+    unsigned i;
+
+    for (i = 0; i < config.num_done_tasks; ++i) {
+        if (!strcmp(task->name, config.done_tasks[i])) {
+            inst->done_task = i;
+            longjmp(inst->env, JMP_DONE);
+        }
+    }
+
+    inst->next_task = task;
+    longjmp(inst->env, JMP_TASK);
+}
+
+static void *fleet_instance(void *arg)
+{
+    fleet_instance_t *inst = arg;
+
+    self = inst;
+    inst->start_ns = now_ns();
+    inst->rng = (config.seed + inst->id) * 0x9e3779b97f4a7c15ull | 1;
+    inst->done_task = -1;
+
+    switch ((fleet_jmp_t)setjmp(inst->env)) {
+        case JMP_POWER_FAIL:
+            if (inst->boots >= config.max_boots)
+                break;
+            // fall through: reboot
+        case JMP_BOOT:
+            inst->boots++;
+            inst->budget = fleet_energy(inst);
+            chain_boot(); // does not return
+            break;
+        case JMP_TASK:
+            inst->next_task->func(); // does not return
+            break;
+        case JMP_DONE:
+        case JMP_STUCK:
+            break;
+    }
+
+    if (inst->id == 0)
+        _CHAIN_REPORT();
+
+    inst->result->ticks = inst->on_ticks + (inst->boots - 1) * config.recharge;
+    inst->result->boots = inst->boots;
+    inst->result->done_task = inst->done_task;
+    inst->result->wall_ns = now_ns() - inst->start_ns;
+    return NULL;
+}
+
+/** @brief Take instances off the shared counter until none are left */
+static void *fleet_worker(void *arg)
+{
+    fleet_instance_t inst;
+    pthread_t thread;
+    unsigned id;
+
+    while ((id = atomic_fetch_add(&next_instance, 1)) < config.instances) {
+        memset(&inst, 0, sizeof(inst));
+        inst.id = id;
+        inst.result = &results[id];
+
+        // A new thread for each instance gets a fresh copy of the
+        // thread-local (i.e. non-volatile) memory image.
+        if (pthread_create(&thread, NULL, fleet_instance, &inst)) {
+            perror("pthread_create");
+            exit(1);
+        }
+        pthread_join(thread, NULL);
+    }
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void print_dist(const char *name, uint64_t *vals, unsigned n)
+{
+    if (!n) {
+        printf("%-12s -\n", name);
+        return;
+    }
+    qsort(vals, n, sizeof(*vals), cmp_u64);
+    printf("%-12s p50 %llu p90 %llu p99 %llu max %llu\n", name,
+           (unsigned long long)vals[n * 50 / 100],
+           (unsigned long long)vals[n * 90 / 100],
+           (unsigned long long)vals[n * 99 / 100],
+           (unsigned long long)vals[n - 1]);
+}
+
+static void fleet_report(uint64_t wall_ns)
+{
+    uint64_t *ticks = malloc(config.instances * sizeof(uint64_t));
+    uint64_t *boots = malloc(config.instances * sizeof(uint64_t));
+    uint64_t *walls = malloc(config.instances * sizeof(uint64_t));
+    unsigned done_count[FLEET_MAX_DONE_TASKS] = {0};
+    unsigned i, n = 0, stuck = 0;
+
+    for (i = 0; i < config.instances; ++i) {
+        fleet_result_t *r = &results[i];
+        if (r->done_task < 0) {
+            ++stuck;
+            continue;
+        }
+        ++done_count[r->done_task];
+        ticks[n] = r->ticks;
+        boots[n] = r->boots;
+        walls[n] = r->wall_ns;
+        ++n;
+    }
+
+    printf("instances %u threads %u wall %.3f s (%.0f instances/s)\n",
+           config.instances, config.threads, wall_ns / 1e9,
+           config.instances / (wall_ns / 1e9));
+    if (config.cont_power)
+        printf("energy continuous\n");
+    else
+        printf("energy %llu:%llu recharge %llu ticks\n",
+               (unsigned long long)config.energy_min,
+               (unsigned long long)config.energy_max,
+               (unsigned long long)config.recharge);
+
+    print_dist("ticks", ticks, n);
+    print_dist("boots", boots, n);
+    print_dist("wall_ns", walls, n);
+
+    for (i = 0; i < config.num_done_tasks; ++i)
+        printf("done %s %u\n", config.done_tasks[i], done_count[i]);
+    printf("stuck %u\n", stuck);
+
+    free(ticks);
+    free(boots);
+    free(walls);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "usage: %s [-n instances] [-j threads] [-e min:max] [-r recharge]\n"
+        "          [-d task[,task...]] [-s seed] [-m max_boots] [-t max_ticks]\n"
+        "          [-w max_seconds] [-c]\n"
+        "  -n  number of devices to simulate (%u)\n"
+        "  -j  worker threads (number of cores)\n"
+        "  -e  energy per boot, in runtime operations: channel accesses and\n"
+        "      transitions, not task computation (%llu:%llu)\n"
+        "  -r  recharge time after a power failure, in ticks (%llu)\n"
+        "  -d  tasks that mark completion (required)\n"
+        "  -s  seed for the energy of each boot (%llu)\n"
+        "  -m  boots after which an instance is reported stuck (%u)\n"
+        "  -t  ticks after which an instance is reported stuck (%llu)\n"
+        "  -w  wall time after which an instance is reported stuck, in seconds,\n"
+        "      0 for no limit (%u)\n"
+        "  -c  continuous power\n",
+        prog, config.instances,
+        (unsigned long long)config.energy_min,
+        (unsigned long long)config.energy_max,
+        (unsigned long long)config.recharge,
+        (unsigned long long)config.seed, config.max_boots,
+        (unsigned long long)config.max_ticks, config.max_seconds);
+    exit(2);
+}
+
+static void parse_done_tasks(char *list)
+{
+    char *tok;
+
+    for (tok = strtok(list, ","); tok; tok = strtok(NULL, ",")) {
+        if (config.num_done_tasks == FLEET_MAX_DONE_TASKS) {
+            fprintf(stderr, "too many done tasks (max %u)\n",
+                    FLEET_MAX_DONE_TASKS);
+            exit(2);
+        }
+        config.done_tasks[config.num_done_tasks++] = tok;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t *workers;
+    uint64_t start;
+    unsigned i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:j:e:r:d:s:m:t:w:c")) != -1) {
+        switch (opt) {
+            case 'n': config.instances = strtoul(optarg, NULL, 0); break;
+            case 'j': config.threads = strtoul(optarg, NULL, 0); break;
+            case 'e':
+                if (sscanf(optarg, "%llu:%llu",
+                           (unsigned long long *)&config.energy_min,
+                           (unsigned long long *)&config.energy_max) != 2 ||
+                    !config.energy_min ||
+                    config.energy_min > config.energy_max)
+                    usage(argv[0]);
+                break;
+            case 'r': config.recharge = strtoull(optarg, NULL, 0); break;
+            case 'd': parse_done_tasks(optarg); break;
+            case 's': config.seed = strtoull(optarg, NULL, 0); break;
+            case 'm': config.max_boots = strtoul(optarg, NULL, 0); break;
+            case 't': config.max_ticks = strtoull(optarg, NULL, 0); break;
+            case 'w': config.max_seconds = strtoul(optarg, NULL, 0); break;
+            case 'c': config.cont_power = 1; break;
+            default: usage(argv[0]);
+        }
+    }
+    if (!config.num_done_tasks || !config.instances)
+        usage(argv[0]);
+
+    if (!config.threads)
+        config.threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (config.threads > config.instances)
+        config.threads = config.instances;
+
+    results = calloc(config.instances, sizeof(fleet_result_t));
+    workers = malloc(config.threads * sizeof(pthread_t));
+
+    start = now_ns();
+    for (i = 0; i < config.threads; ++i)
+        pthread_create(&workers[i], NULL, fleet_worker, NULL);
+    for (i = 0; i < config.threads; ++i)
+        pthread_join(workers[i], NULL);
+
+    fleet_report(now_ns() - start);
+
+    free(workers);
+    free(results);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#ifndef HOST_H
+#define HOST_H
+
+/* Host port of the runtime (internal to libchain)
+ *
+ * With LIBCHAIN_HOST, the runtime is built for the host machine, where
+ * fleet.c runs many simulated devices, one per thread. Each device has its
+ * own non-volatile memory (see libmsp/mem.h), so the context (curctx,
+ * context_0/1), the tasks and the channels are per instance.
+ *
+ * The runtime calls HOST_TICK to charge energy for its operations; when the
+ * energy of the current boot runs out, the device loses power and reboots.
+ * Instead of resetting the stack pointer and branching to the task function,
+ * transitions and boots jump back to a trampoline in fleet.c.
+ *
+ * The waste accounting and the failure schedules count these ticks instead of
+ * cycles, so that a schedule recorded on the host replays exactly.
+ */
+
+#ifdef LIBCHAIN_HOST
+
+#include <stdint.h>
+
+void chain_host_tick(unsigned cost);
+uint32_t chain_host_ticks();
+void chain_host_jump(task_t *task) __attribute__((noreturn));
+void chain_host_power_fail() __attribute__((noreturn));
+int chain_boot();
+
+#define HOST_TICK(cost) chain_host_tick(cost)
+
+// Unsigned 32-bit value (uint32_t) in the reports of the runtime
+#define FMT_U32 "%u"
+
+#else // !LIBCHAIN_HOST
+
+#define HOST_TICK(cost)
+
+// libmspprintf, the console printf of the device, has no %lu
+#define FMT_U32 "%n"
+
+#endif // !LIBCHAIN_HOST
+
+#endif // HOST_H
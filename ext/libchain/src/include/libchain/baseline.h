@@ -0,0 +1,210 @@
+#ifndef BASELINE_H
+#define BASELINE_H
+
+/* Non-intermittent baseline (LIBCHAIN_BASELINE)
+ *
+ * Maps the Chain constructs onto plain C, so that the same application source
+ * can be built without the runtime to measure the runtime overhead:
+ *   * channels are ordinary globals in SRAM: no channel metadata, no double
+ *     buffering of self-channel fields, no dirty list
+ *   * CHAN_IN/CHAN_OUT are inline loads and stores (no varargs calls)
+ *   * TRANSITION_TO returns to a trampoline loop that calls the next task
+ *   * task_prologue does nothing
+ *
+ * Each field keeps one word of logical time in SRAM: CHAN_IN from several
+ * channels must still pick the most recently written one (e.g. self channel
+ * vs. the channel from the predecessor) for the program to mean the same
+ * thing. It is a plain store on write and a compare on read.
+ *
+ * The state is volatile, so a baseline build starts over on every reboot; it
+ * is meant to be run on continuous power.
+ */
+
+typedef void (task_func_t)(void);
+typedef unsigned chain_time_t;
+typedef unsigned task_idx_t;
+
+typedef struct {
+    task_func_t *func;
+    task_idx_t idx;
+} task_t;
+
+typedef struct _var_meta_t {
+    chain_time_t timestamp;
+} var_meta_t;
+
+/** @brief Logical time, ticks at task boundaries */
+extern chain_time_t chain_time;
+
+/** @brief Task to run when the current one returns to the trampoline */
+extern const task_t *chain_next_task;
+
+#define VAR_TYPE(type) \
+    struct { \
+        var_meta_t meta; \
+        type value; \
+    } \
+
+#define FIELD_TYPE(type) \
+    struct { \
+        VAR_TYPE(type) var; \
+    }
+
+#define SELF_FIELD_TYPE(type) FIELD_TYPE(type)
+
+#define CH_TYPE(src, dest, type) \
+    struct _ch_type_ ## src ## _ ## dest ## _ ## type { \
+        struct type data; \
+    }
+
+#define CHAN_FIELD(type, name)                  FIELD_TYPE(type) name
+#define CHAN_FIELD_ARRAY(type, name, size)      FIELD_TYPE(type) name[size]
+#define SELF_CHAN_FIELD(type, name)             SELF_FIELD_TYPE(type) name
+#define SELF_CHAN_FIELD_ARRAY(type, name, size) SELF_FIELD_TYPE(type) name[size]
+
+#define TASK_SYM_NAME(func) _task_ ## func
+
+#define TASK(idx, func) \
+    void func(); \
+    const task_t TASK_SYM_NAME(func) = { func, idx };
+
+#define TASK_REF(func) &TASK_SYM_NAME(func)
+
+extern void init();
+
+extern const task_t TASK_SYM_NAME(_entry_task);
+
+#define ENTRY_TASK(task) \
+    TASK(0, _entry_task) \
+    void _entry_task() { TRANSITION_TO(task); }
+
+void _init();
+
+#define INIT_FUNC(func) void _init() { func(); }
+
+#define task_prologue()
+
+/* Self-channel fields are not double-buffered, so zero-init is enough and the
+ * application's FIELD_INIT_<type> initializers are not used. */
+#define SELF_FIELD_INITIALIZER {}
+#define SELF_FIELD_ARRAY_INITIALIZER(count) {}
+
+#define CHANNEL(src, dest, type) \
+    CH_TYPE(src, dest, type) _ch_ ## src ## _ ## dest
+
+#define SELF_CHANNEL(task, type) \
+    CH_TYPE(task, task, type) _ch_ ## task ## _ ## task
+
+#define CALL_CHANNEL(callee, type) \
+    CH_TYPE(caller, callee, type) _ch_call_ ## callee
+#define RET_CHANNEL(callee, type) \
+    CH_TYPE(caller, callee, type) _ch_ret_ ## callee
+#define RETURN_CHANNEL(callee, type) \
+    CH_TYPE(caller, callee, type) _ch_ret_ ## callee
+
+#define MULTICAST_CHANNEL(type, name, src, dest, ...) \
+    CH_TYPE(src, name, type) _ch_mc_ ## src ## _ ## name
+
+#define CH(src, dest) (&_ch_ ## src ## _ ## dest)
+#define SELF_CH(tsk)  CH(tsk, tsk)
+#define SELF_IN_CH(tsk)  CH(tsk, tsk)
+#define SELF_OUT_CH(tsk) CH(tsk, tsk)
+#define CALL_CH(callee)  (&_ch_call_ ## callee)
+#define RET_CH(callee)  (&_ch_ret_ ## callee)
+#define MC_IN_CH(name, src, dest)         (&_ch_mc_ ## src ## _ ## name)
+#define MC_OUT_CH(name, src, dest, ...)   (&_ch_mc_ ## src ## _ ## name)
+
+/** @brief Internal macros for direct access to a field in a channel */
+#define CHAN_VAR(chan, field) ((chan)->data.field.var)
+
+#define CHAN_IN_LATEST(field, chan) \
+    if (CHAN_VAR(chan, field).meta.timestamp > _latest_time) { \
+        _latest_time = CHAN_VAR(chan, field).meta.timestamp; \
+        _latest = &CHAN_VAR(chan, field).value; \
+    }
+
+#define CHAN_IN1(type, field, chan0) \
+    ((type *)&CHAN_VAR(chan0, field).value)
+#define CHAN_IN2(type, field, chan0, chan1) \
+    ({ \
+        type *_latest = &CHAN_VAR(chan0, field).value; \
+        chain_time_t _latest_time = CHAN_VAR(chan0, field).meta.timestamp; \
+        CHAN_IN_LATEST(field, chan1) \
+        _latest; \
+    })
+#define CHAN_IN3(type, field, chan0, chan1, chan2) \
+    ({ \
+        type *_latest = &CHAN_VAR(chan0, field).value; \
+        chain_time_t _latest_time = CHAN_VAR(chan0, field).meta.timestamp; \
+        CHAN_IN_LATEST(field, chan1) \
+        CHAN_IN_LATEST(field, chan2) \
+        _latest; \
+    })
+#define CHAN_IN4(type, field, chan0, chan1, chan2, chan3) \
+    ({ \
+        type *_latest = &CHAN_VAR(chan0, field).value; \
+        chain_time_t _latest_time = CHAN_VAR(chan0, field).meta.timestamp; \
+        CHAN_IN_LATEST(field, chan1) \
+        CHAN_IN_LATEST(field, chan2) \
+        CHAN_IN_LATEST(field, chan3) \
+        _latest; \
+    })
+#define CHAN_IN5(type, field, chan0, chan1, chan2, chan3, chan4) \
+    ({ \
+        type *_latest = &CHAN_VAR(chan0, field).value; \
+        chain_time_t _latest_time = CHAN_VAR(chan0, field).meta.timestamp; \
+        CHAN_IN_LATEST(field, chan1) \
+        CHAN_IN_LATEST(field, chan2) \
+        CHAN_IN_LATEST(field, chan3) \
+        CHAN_IN_LATEST(field, chan4) \
+        _latest; \
+    })
+
+#define CHAN_OUT_ONE(type, field, val, chan) \
+    CHAN_VAR(chan, field).meta.timestamp = chain_time; \
+    CHAN_VAR(chan, field).value = (val);
+
+#define CHAN_OUT1(type, field, val, chan0) \
+    do { \
+        CHAN_OUT_ONE(type, field, val, chan0) \
+    } while (0)
+#define CHAN_OUT2(type, field, val, chan0, chan1) \
+    do { \
+        CHAN_OUT_ONE(type, field, val, chan0) \
+        CHAN_OUT_ONE(type, field, val, chan1) \
+    } while (0)
+#define CHAN_OUT3(type, field, val, chan0, chan1, chan2) \
+    do { \
+        CHAN_OUT_ONE(type, field, val, chan0) \
+        CHAN_OUT_ONE(type, field, val, chan1) \
+        CHAN_OUT_ONE(type, field, val, chan2) \
+    } while (0)
+#define CHAN_OUT4(type, field, val, chan0, chan1, chan2, chan3) \
+    do { \
+        CHAN_OUT_ONE(type, field, val, chan0) \
+        CHAN_OUT_ONE(type, field, val, chan1) \
+        CHAN_OUT_ONE(type, field, val, chan2) \
+        CHAN_OUT_ONE(type, field, val, chan3) \
+    } while (0)
+#define CHAN_OUT5(type, field, val, chan0, chan1, chan2, chan3, chan4) \
+    do { \
+        CHAN_OUT_ONE(type, field, val, chan0) \
+        CHAN_OUT_ONE(type, field, val, chan1) \
+        CHAN_OUT_ONE(type, field, val, chan2) \
+        CHAN_OUT_ONE(type, field, val, chan3) \
+        CHAN_OUT_ONE(type, field, val, chan4) \
+    } while (0)
+
+/** @brief Transfer control to the given task
+ *  @details Returns from the current task function to the trampoline in
+ *           main, which then calls the next task. So, like in Chain, nothing
+ *           after TRANSITION_TO in a task executes.
+ */
+#define TRANSITION_TO(task) \
+    do { \
+        chain_next_task = TASK_REF(task); \
+        ++chain_time; \
+        return; \
+    } while (0)
+
+#endif // BASELINE_H
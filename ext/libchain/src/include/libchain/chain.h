@@ -8,6 +8,10 @@
 
 #include "repeat.h"
 
+#ifdef LIBCHAIN_BASELINE
+#include "baseline.h"
+#else // !LIBCHAIN_BASELINE
+
 #define TASK_NAME_SIZE 32
 #define CHAN_NAME_SIZE 32
 
@@ -38,9 +42,22 @@ typedef struct _chan_meta_t {
     chan_diag_t diag;
 } chan_meta_t;
 
+/** @brief Alignment of channel variables
+ *  @details The runtime locates values in channels through offsets computed
+ *           on a dummy value type (see chain.c), so the offsets must not
+ *           depend on the alignment of the actual value type. On the MSP430,
+ *           no type is aligned beyond a word. On the host, all variables are
+ *           aligned to the largest alignment instead.
+ */
+#ifdef LIBCHAIN_HOST
+#define VAR_ALIGN __attribute__((aligned(__BIGGEST_ALIGNMENT__)))
+#else
+#define VAR_ALIGN
+#endif
+
 typedef struct _var_meta_t {
     chain_time_t timestamp;
-} var_meta_t;
+} VAR_ALIGN var_meta_t;
 
 typedef struct _self_field_meta_t {
     // Single word (two bytes) value that contains
@@ -128,7 +145,7 @@ typedef struct _context_t {
     struct _context_t *next_ctx;
 } context_t;
 
-extern context_t * volatile curctx;
+extern __nv context_t * volatile curctx;
 
 /** @brief Internal macro for constructing name of task symbol */
 #define TASK_SYM_NAME(func) _task_ ## func
@@ -172,7 +189,7 @@ extern void init();
  *        not constrained, and the whole thing is less magical when reading app
  *        code, but slightly more verbose.
  */
-extern task_t TASK_SYM_NAME(_entry_task);
+extern __nv task_t TASK_SYM_NAME(_entry_task);
 
 /** @brief Declare the first task of the application
  *  @details This macro defines a function with a special name that is
@@ -267,9 +284,9 @@ void chan_out(const char *field_name, const void *value,
  *  @details Conceptually, the channel is between the specified source and
  *           destinations only. The arbitrary name exists only to simplify referring
  *           to the channel: to avoid having to list all sources and destinations
- *           every time. However, access control is not currently enforced.
- *           Declarations of sources and destinations is necessary for perform
- *           compile-time checks planned for the future.
+ *           every time. However, access control is not enforced at run time.
+ *           The build checks the source (tools/check_graph.sh), but not the
+ *           destinations, which this macro does not keep.
  */
 #define MULTICAST_CHANNEL(type, name, src, dest, ...) \
     __nv CH_TYPE(src, name, type) _ch_mc_ ## src ## _ ## name = \
@@ -389,4 +406,80 @@ void chan_out(const char *field_name, const void *value,
  *  */
 #define TRANSITION_TO(task) transition_to(TASK_REF(task))
 
+#endif // !LIBCHAIN_BASELINE
+
+/** @brief FRAM access profile
+ *  @details Built with LIBCHAIN_ENABLE_PROFILING, the runtime counts the
+ *           words of FRAM it reads and writes per task and per persistent
+ *           symbol (context, task_t fields, channel fields). The report
+ *           prints the table to the console; reset clears the counters.
+ */
+#if defined(LIBCHAIN_ENABLE_PROFILING) && !defined(LIBCHAIN_BASELINE)
+void chain_prof_report();
+void chain_prof_reset();
+#define CHAIN_PROF_REPORT() chain_prof_report()
+#else // !LIBCHAIN_ENABLE_PROFILING
+#define CHAIN_PROF_REPORT()
+#endif // !LIBCHAIN_ENABLE_PROFILING
+
+/** @brief Re-execution waste accounting
+ *  @details Built with LIBCHAIN_ENABLE_WASTE, the runtime splits the cycles
+ *           spent in each task into useful ones (the execution reached
+ *           a transition) and wasted ones (the execution was aborted by a
+ *           power failure and the task restarted). Uses the libmsp cycle
+ *           counter, so the application must enable interrupts; on the
+ *           host, the energy ticks of the fleet simulation.
+ */
+#if defined(LIBCHAIN_ENABLE_WASTE) && !defined(LIBCHAIN_BASELINE)
+void chain_waste_report();
+void chain_waste_reset();
+#define CHAIN_WASTE_REPORT() chain_waste_report()
+#else // !LIBCHAIN_ENABLE_WASTE
+#define CHAIN_WASTE_REPORT()
+#endif // !LIBCHAIN_ENABLE_WASTE
+
+/** @brief Record and replay of power failure points
+ *  @details Built with LIBCHAIN_RECORD_FAILURES, the runtime logs where each
+ *           boot ended (task, logical time, cycles into the task), and the
+ *           report prints the log as a schedule file. Built with
+ *           LIBCHAIN_REPLAY_FAILURES, it resets the MCU at the points listed
+ *           in the schedule file LIBCHAIN_FAILURE_SCHEDULE, which contains
+ *           one initializer per line: { task idx, time, cycles },
+ *           On the host, cycles are energy ticks, and the reset is a power
+ *           failure of the simulated device.
+ */
+#ifndef LIBCHAIN_BASELINE
+typedef struct {
+    task_idx_t task;
+    chain_time_t time;
+    uint32_t cycles;
+} chain_failure_t;
+#endif // !LIBCHAIN_BASELINE
+
+#if (defined(LIBCHAIN_RECORD_FAILURES) || defined(LIBCHAIN_REPLAY_FAILURES)) && \
+    !defined(LIBCHAIN_BASELINE)
+void chain_failures_report();
+#define CHAIN_FAILURES_REPORT() chain_failures_report()
+#else // !LIBCHAIN_*_FAILURES
+#define CHAIN_FAILURES_REPORT()
+#endif // !LIBCHAIN_*_FAILURES
+
+/** @brief Print the reports of all enabled runtime instrumentation
+ *  @details On the host, the fleet harness prints them once, for the first
+ *           instance, after its final transition (see fleet.c), so the
+ *           application's call is a no-op.
+ */
+#define _CHAIN_REPORT() \
+    do { \
+        CHAIN_PROF_REPORT(); \
+        CHAIN_WASTE_REPORT(); \
+        CHAIN_FAILURES_REPORT(); \
+    } while (0)
+
+#ifndef LIBCHAIN_HOST
+#define CHAIN_REPORT() _CHAIN_REPORT()
+#else // LIBCHAIN_HOST
+#define CHAIN_REPORT()
+#endif // LIBCHAIN_HOST
+
 #endif // CHAIN_H
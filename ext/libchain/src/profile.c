@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chain.h"
+#include "profile.h"
+
+#ifndef LIBCHAIN_PROF_MAX_TASKS
+#define LIBCHAIN_PROF_MAX_TASKS 16
+#endif
+
+#ifndef LIBCHAIN_PROF_MAX_SYMS
+#define LIBCHAIN_PROF_MAX_SYMS 32
+#endif
+
+/* Dummy type for offset calculations */
+struct _prof_void_type_t {
+    void * x;
+};
+
+typedef struct {
+    uint32_t rd;
+    uint32_t wr;
+} prof_count_t;
+
+typedef struct {
+    const void *chan;       // NULL for runtime (non-channel) symbols
+    const char *name;       // field name as passed to CHAN_IN/CHAN_OUT
+} prof_sym_t;
+
+static const char * const prof_fixed_sym_names[PROF_SYM_FIXED_COUNT] = {
+    [PROF_SYM_OTHER]            = "(other)",
+    [PROF_SYM_CURCTX]           = "curctx",
+    [PROF_SYM_CONTEXT_0]        = "context_0",
+    [PROF_SYM_CONTEXT_1]        = "context_1",
+    [PROF_SYM_TASK_DIRTY_LIST]  = "task.dirty_self_fields",
+    [PROF_SYM_TASK_NUM_DIRTY]   = "task.num_dirty_self_fields",
+    [PROF_SYM_TASK_LAST_EXEC]   = "task.last_execute_time",
+    [PROF_SYM_SELF_IDX_PAIR]    = "self_field.idx_pair (swap)",
+    [PROF_SYM_NUM_BOOTS]        = "_numBoots",
+};
+
+// The counters live in FRAM so that they accumulate across reboots
+__nv prof_sym_t prof_syms[LIBCHAIN_PROF_MAX_SYMS];
+__nv unsigned prof_num_syms = PROF_SYM_FIXED_COUNT;
+__nv const char *prof_task_names[LIBCHAIN_PROF_MAX_TASKS];
+__nv prof_count_t prof_counts[LIBCHAIN_PROF_MAX_TASKS][LIBCHAIN_PROF_MAX_SYMS];
+__nv uint32_t prof_dropped = 0;
+
+extern __nv context_t context_0;
+extern __nv context_t context_1;
+
+/** @brief Compare field names up to the array subscript
+ *  @details Field names are stringified expressions, e.g. 'vals[i]' and
+ *           'vals[k]', so elements of an array field are aggregated.
+ */
+static int prof_name_eq(const char *a, const char *b)
+{
+    while (*a && *a != '[' && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return (*a == '\0' || *a == '[') && (*b == '\0' || *b == '[');
+}
+
+static void prof_print_sym(unsigned sym)
+{
+    const char *name;
+    const chan_meta_t *meta;
+
+    if (sym < PROF_SYM_FIXED_COUNT) {
+        printf("%s", prof_fixed_sym_names[sym]);
+        return;
+    }
+
+    // A read of a field that no channel has written (chan_in found no
+    // timestamp) has no channel
+    if (prof_syms[sym].chan) {
+        meta = (const chan_meta_t *)((const uint8_t *)prof_syms[sym].chan +
+                offsetof(CH_TYPE(_sp, _dp, _prof_void_type_t), meta));
+        printf("%s->%s:", meta->diag.source_name, meta->diag.dest_name);
+    } else {
+        printf("-:");
+    }
+
+    for (name = prof_syms[sym].name; *name && *name != '['; ++name)
+        putchar(*name);
+}
+
+unsigned prof_chan_sym(const void *chan, const char *field_name)
+{
+    unsigned i;
+
+    for (i = PROF_SYM_FIXED_COUNT; i < prof_num_syms; ++i) {
+        if (prof_syms[i].chan == chan && prof_name_eq(prof_syms[i].name, field_name))
+            return i;
+    }
+
+    if (prof_num_syms == LIBCHAIN_PROF_MAX_SYMS)
+        return PROF_SYM_OTHER;
+
+    // Entry is filled before the count is bumped, so a reboot in between
+    // only leaves an unused (overwritable) entry.
+    prof_syms[i].chan = chan;
+    prof_syms[i].name = field_name;
+    prof_num_syms = i + 1;
+    return i;
+}
+
+unsigned prof_ctx_sym(const void *ctx)
+{
+    return ctx == &context_0 ? PROF_SYM_CONTEXT_0 : PROF_SYM_CONTEXT_1;
+}
+
+void prof_access(unsigned sym, unsigned rd_words, unsigned wr_words)
+{
+    task_t *task = curctx->task;
+
+    if (task->idx >= LIBCHAIN_PROF_MAX_TASKS) {
+        prof_dropped += rd_words + wr_words;
+        return;
+    }
+
+    prof_task_names[task->idx] = task->name;
+    prof_counts[task->idx][sym].rd += rd_words;
+    prof_counts[task->idx][sym].wr += wr_words;
+}
+
+/** @brief Print the heat table: one line per (task, symbol) pair with traffic
+ *  @details Counts are in 16-bit words of FRAM. Channel fields are named
+ *           'source->dest:field'. A per-symbol total over all tasks follows.
+ *           The console printf (libmspprintf) takes %n for an unsigned 32-bit
+ *           value; it has no %lu.
+ */
+void chain_prof_report()
+{
+    unsigned t, s;
+    uint32_t rd, wr;
+
+    printf("FRAM profile (words): task symbol rd wr\r\n");
+    for (t = 0; t < LIBCHAIN_PROF_MAX_TASKS; ++t) {
+        if (!prof_task_names[t])
+            continue;
+
+        for (s = 0; s < prof_num_syms; ++s) {
+            prof_count_t *count = &prof_counts[t][s];
+            if (!count->rd && !count->wr)
+                continue;
+
+            printf("%s ", prof_task_names[t]);
+            prof_print_sym(s);
+            printf(" %n %n\r\n", (unsigned long)count->rd, (unsigned long)count->wr);
+        }
+    }
+
+    printf("FRAM profile totals (words): symbol rd wr\r\n");
+    for (s = 0; s < prof_num_syms; ++s) {
+        rd = wr = 0;
+        for (t = 0; t < LIBCHAIN_PROF_MAX_TASKS; ++t) {
+            rd += prof_counts[t][s].rd;
+            wr += prof_counts[t][s].wr;
+        }
+        if (!rd && !wr)
+            continue;
+
+        prof_print_sym(s);
+        printf(" %n %n\r\n", (unsigned long)rd, (unsigned long)wr);
+    }
+
+    if (prof_dropped)
+        printf("(tasks with idx >= %u: %n words)\r\n",
+               LIBCHAIN_PROF_MAX_TASKS, (unsigned long)prof_dropped);
+}
+
+void chain_prof_reset()
+{
+    memset(prof_counts, 0, sizeof(prof_counts));
+    memset(prof_task_names, 0, sizeof(prof_task_names));
+    prof_num_syms = PROF_SYM_FIXED_COUNT;
+    prof_dropped = 0;
+}
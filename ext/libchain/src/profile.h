@@ -0,0 +1,49 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/* FRAM access profiler (internal to libchain)
+ *
+ * Counts the 16-bit words of non-volatile memory that the runtime reads and
+ * writes, per task and per persistent symbol: the context pointer, the two
+ * context buffers, the fields of each task_t, and each channel field.
+ *
+ * Enabled with LIBCHAIN_ENABLE_PROFILING. When disabled, the hooks expand to
+ * nothing, so the arguments (which may contain lookups) are not evaluated.
+ */
+
+#ifdef LIBCHAIN_ENABLE_PROFILING
+
+#include <stddef.h>
+
+/* Symbols that are not channel fields have fixed indexes */
+typedef enum {
+    PROF_SYM_OTHER = 0, // overflow bucket when the symbol table is full
+    PROF_SYM_CURCTX,
+    PROF_SYM_CONTEXT_0,
+    PROF_SYM_CONTEXT_1,
+    PROF_SYM_TASK_DIRTY_LIST,
+    PROF_SYM_TASK_NUM_DIRTY,
+    PROF_SYM_TASK_LAST_EXEC,
+    PROF_SYM_SELF_IDX_PAIR,
+    PROF_SYM_NUM_BOOTS,
+
+    PROF_SYM_FIXED_COUNT,
+} prof_sym_idx_t;
+
+#define PROF_WORDS(bytes) (((bytes) + 1) / 2)
+
+void prof_access(unsigned sym, unsigned rd_words, unsigned wr_words);
+unsigned prof_chan_sym(const void *chan, const char *field_name);
+unsigned prof_ctx_sym(const void *ctx);
+
+#define PROF_RD(sym, words) prof_access(sym, words, 0)
+#define PROF_WR(sym, words) prof_access(sym, 0, words)
+
+#else // !LIBCHAIN_ENABLE_PROFILING
+
+#define PROF_RD(sym, words)
+#define PROF_WR(sym, words)
+
+#endif // !LIBCHAIN_ENABLE_PROFILING
+
+#endif // PROFILE_H
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chain.h"
+#include "host.h"
+#include "waste.h"
+
+#ifndef LIBCHAIN_WASTE_MAX_TASKS
+#define LIBCHAIN_WASTE_MAX_TASKS 32
+#endif
+
+typedef struct {
+    uint32_t useful;
+    uint32_t wasted;
+    unsigned restarts;
+} waste_count_t;
+
+__nv waste_count_t waste_counts[LIBCHAIN_WASTE_MAX_TASKS];
+__nv const char *waste_task_names[LIBCHAIN_WASTE_MAX_TASKS];
+
+// Cycles of the current (not yet committed) execution of the current task,
+// up to the most recent checkpoint
+__nv uint32_t waste_attempt = 0;
+
+// Counter value at the most recent checkpoint in this boot (in SRAM, of
+// which each simulated device on the host has its own)
+#ifndef LIBCHAIN_HOST
+static uint32_t waste_mark;
+#else // LIBCHAIN_HOST
+static _Thread_local uint32_t waste_mark;
+#endif // LIBCHAIN_HOST
+
+static waste_count_t *waste_count(task_t *task)
+{
+    unsigned idx = task->idx;
+
+    if (idx >= LIBCHAIN_WASTE_MAX_TASKS)
+        idx = LIBCHAIN_WASTE_MAX_TASKS - 1;
+
+    waste_task_names[idx] = task->name;
+    return &waste_counts[idx];
+}
+
+/** @brief Start counting at boot (after the application's init function) */
+void waste_boot()
+{
+    LIBCHAIN_CYCLES_START();
+    waste_mark = LIBCHAIN_CYCLES();
+}
+
+void waste_checkpoint()
+{
+    uint32_t now = LIBCHAIN_CYCLES();
+
+    waste_attempt += now - waste_mark;
+    waste_mark = now;
+}
+
+/** @brief Cycles of the current attempt up to now */
+uint32_t waste_attempt_cycles()
+{
+    return waste_attempt + (LIBCHAIN_CYCLES() - waste_mark);
+}
+
+/** @brief Cycles of the current attempt up to the most recent checkpoint
+ *  @details Unlike waste_attempt_cycles, valid on boot before waste_boot.
+ */
+uint32_t waste_checkpointed_cycles()
+{
+    return waste_attempt;
+}
+
+/** @brief The current task is about to transition: its attempt was useful */
+void waste_commit()
+{
+    waste_count_t *count = waste_count(curctx->task);
+
+    waste_checkpoint();
+
+    // A reboot between these two statements counts the attempt twice, which
+    // is rare enough to not be worth a commit protocol.
+    count->useful += waste_attempt;
+    waste_attempt = 0;
+}
+
+/** @brief The device rebooted into the current task: its last attempt was
+ *         wasted (called on boot, before waste_boot)
+ */
+void waste_restart()
+{
+    waste_count_t *count = waste_count(curctx->task);
+
+    count->wasted += waste_attempt;
+    count->restarts++;
+    waste_attempt = 0;
+}
+
+/** @brief Print useful and wasted cycles per task and in total */
+void chain_waste_report()
+{
+    unsigned t;
+    uint32_t useful = 0, wasted = 0;
+    unsigned restarts = 0;
+
+#ifndef LIBCHAIN_HOST
+    printf("Re-execution (cycles): task useful wasted restarts\r\n");
+#else // LIBCHAIN_HOST
+    printf("Re-execution (ticks): task useful wasted restarts\r\n");
+#endif // LIBCHAIN_HOST
+    for (t = 0; t < LIBCHAIN_WASTE_MAX_TASKS; ++t) {
+        waste_count_t *count = &waste_counts[t];
+
+        if (!waste_task_names[t])
+            continue;
+
+        printf("%s " FMT_U32 " " FMT_U32 " %u\r\n", waste_task_names[t],
+               count->useful, count->wasted, count->restarts);
+
+        useful += count->useful;
+        wasted += count->wasted;
+        restarts += count->restarts;
+    }
+    printf("total " FMT_U32 " " FMT_U32 " %u\r\n",
+           useful, wasted, restarts);
+}
+
+void chain_waste_reset()
+{
+    memset(waste_counts, 0, sizeof(waste_counts));
+    memset(waste_task_names, 0, sizeof(waste_task_names));
+    waste_attempt = 0;
+}
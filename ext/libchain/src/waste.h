@@ -0,0 +1,58 @@
+#ifndef WASTE_H
+#define WASTE_H
+
+/* Re-execution waste accounting (internal to libchain)
+ *
+ * Splits the cycles spent in each task into useful cycles (executions that
+ * reached a transition) and wasted cycles (executions aborted by a power
+ * failure and restarted).
+ *
+ * The cycles of the current execution attempt are accumulated in FRAM at
+ * checkpoints (channel accesses and transitions). On a restart, the attempt
+ * is charged as waste. Cycles between the last checkpoint and the power
+ * failure cannot be observed, so waste is a lower bound.
+ *
+ * Enabled with LIBCHAIN_ENABLE_WASTE. The cycle counter is the libmsp timer,
+ * or on the host, the energy ticks of the simulated device (see host.h); to
+ * use another source (e.g. a simulator's cycle counter), define
+ * LIBCHAIN_CYCLES() and LIBCHAIN_CYCLES_START().
+ */
+
+#ifdef LIBCHAIN_ENABLE_WASTE
+
+#include <stdint.h>
+
+#ifndef LIBCHAIN_CYCLES
+#ifdef LIBCHAIN_HOST
+uint32_t chain_host_ticks();
+#define LIBCHAIN_CYCLES() chain_host_ticks()
+#define LIBCHAIN_CYCLES_START()
+#else // !LIBCHAIN_HOST
+#include <libmsp/cycles.h>
+#define LIBCHAIN_CYCLES() msp_cycles()
+#define LIBCHAIN_CYCLES_START() msp_cycles_start()
+#endif // !LIBCHAIN_HOST
+#endif // LIBCHAIN_CYCLES
+
+void waste_boot();
+void waste_checkpoint();
+void waste_commit();
+void waste_restart();
+uint32_t waste_attempt_cycles();
+uint32_t waste_checkpointed_cycles();
+
+#define WASTE_BOOT() waste_boot()
+#define WASTE_CHECKPOINT() waste_checkpoint()
+#define WASTE_COMMIT() waste_commit()
+#define WASTE_RESTART() waste_restart()
+
+#else // !LIBCHAIN_ENABLE_WASTE
+
+#define WASTE_BOOT()
+#define WASTE_CHECKPOINT()
+#define WASTE_COMMIT()
+#define WASTE_RESTART()
+
+#endif // !LIBCHAIN_ENABLE_WASTE
+
+#endif // WASTE_H
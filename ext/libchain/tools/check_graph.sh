@@ -0,0 +1,683 @@
+#! /bin/bash
+#
+# Check the task graph of a Chain application against its channel
+# declarations, at build time
+#
+# Reads the application as the preprocessor leaves it (cc -E), so that tasks
+# and channel accesses generated by macros are checked too, and reports:
+#
+#   * a CHAN_IN from a channel that does not lead into the task, or a
+#     CHAN_OUT into a channel that does not lead out of it (channel accesses
+#     in helper functions count against every task that calls them)
+#   * a self channel whose FIELD_INIT_<type> leaves a self field without its
+#     SELF_FIELD_INITIALIZER, or initializes a field array with
+#     SELF_FIELD_ARRAY_INITIALIZER of another size than the array
+#   * a task that can mark more self-channel fields dirty in one execution
+#     than the runtime has room for (MAX_DIRTY_SELF_FIELDS)
+#
+# The dirty count of a task is the most CHAN_OUTs into self channels on any
+# path from its start to a TRANSITION_TO, with conditions taken both ways. A
+# loop that can write a self channel and then iterate again has no static
+# bound: it is reported as a warning, and the bound is left to the task.
+#
+# Multicast channels do not keep their destinations past the preprocessor, so
+# a CHAN_IN from one is not checked.
+#
+# Exits with 1 if there are errors.
+#
+# Usage: cc -E [cflags] main.c | ./check_graph.sh
+
+awk '
+    function is_ident(t) { return t ~ /^[A-Za-z_]/ }
+    function max(a, b) { return a > b ? a : b }
+
+    function tokenize(s) {
+        ntok = 0
+        while (s != "") {
+            if (match(s, /^[ \t\r]+/)) {
+                s = substr(s, RLENGTH + 1)
+                continue
+            }
+            if (!match(s, /^[A-Za-z_][A-Za-z0-9_]*/) &&
+                !match(s, /^[0-9][0-9A-Za-z_.]*/) &&
+                !match(s, /^"([^"\\]|\\.)*"/) &&
+                !match(s, /^\047([^\047\\]|\\.)*\047/) &&
+                !match(s, /^(->|\+\+|--|<<=|>>=|<<|>>|<=|>=|==|!=|&&|\|\|)/) &&
+                !match(s, /^[-+*\/%&|^]=/))
+                match(s, /^./)
+            tok[++ntok] = substr(s, 1, RLENGTH)
+            s = substr(s, RLENGTH + 1)
+        }
+    }
+
+    function here() { return file ":" line }
+
+    function error(where, msg) {
+        print where ": error: " msg > "/dev/stderr"
+        errors++
+    }
+
+    function warning(where, msg) {
+        print where ": warning: " msg > "/dev/stderr"
+    }
+
+    # Value of a constant expression (array size), "" if it is not one
+    function number(t,    v, i, d) {
+        sub(/[uUlL]+$/, "", t)
+        if (t ~ /^0[xX][0-9a-fA-F]+$/) {
+            v = 0
+            for (i = 3; i <= length(t); ++i) {
+                d = index("0123456789abcdef", tolower(substr(t, i, 1))) - 1
+                v = v * 16 + d
+            }
+            return v
+        }
+        if (t ~ /^[0-9]+$/)
+            return t + 0
+        ebad = 1
+        return 0
+    }
+    function primary(    v) {
+        if (etok[epos] == "(") {
+            ++epos
+            if (is_ident(etok[epos])) {         # a cast
+                while (epos <= en && etok[epos] != ")")
+                    ++epos
+                ++epos
+                return unary()
+            }
+            v = shift()
+            if (etok[epos++] != ")")
+                ebad = 1
+            return v
+        }
+        return number(etok[epos++])
+    }
+    function unary() {
+        if (etok[epos] == "-") {
+            ++epos
+            return -unary()
+        }
+        if (etok[epos] == "+")
+            ++epos
+        return primary()
+    }
+    function mul(    v, op, r) {
+        v = unary()
+        while ((op = etok[epos]) == "*" || op == "/" || op == "%") {
+            ++epos
+            r = unary()
+            if (op == "*")
+                v *= r
+            else if (r == 0)
+                ebad = 1
+            else if (op == "/")
+                v = int(v / r)
+            else
+                v %= r
+        }
+        return v
+    }
+    function add(    v, op) {
+        v = mul()
+        while ((op = etok[epos]) == "+" || op == "-") {
+            ++epos
+            v = (op == "+") ? v + mul() : v - mul()
+        }
+        return v
+    }
+    function shift(    v, op, r) {
+        v = add()
+        while ((op = etok[epos]) == "<<" || op == ">>") {
+            ++epos
+            r = add()
+            v = (op == "<<") ? v * 2 ^ r : int(v / 2 ^ r)
+        }
+        return v
+    }
+    function eval(s,    v) {
+        en = split(s, etok, " ")
+        epos = 1
+        ebad = 0
+        v = shift()
+        return (ebad || epos <= en) ? "" : v
+    }
+
+    # Fields of a struct body: name, self (a double-buffered self field) and
+    # size (of an array, "" otherwise) of each
+    function struct_fields(name,    n, t, i, d, nf, decl, last, size, insize) {
+        n = split(structs[name], t, " ")
+        nf = 0
+        d = 0
+        decl = ""
+        last = ""
+        size = ""
+        insize = 0
+        for (i = 1; i <= n; ++i) {
+            if (t[i] == "{" || t[i] == "(")
+                ++d
+            else if (t[i] == "}" || t[i] == ")")
+                --d
+            else if (d == 0 && t[i] == "[")
+                insize = 1
+            else if (d == 0 && t[i] == "]")
+                insize = 0
+            else if (d == 0 && insize)
+                size = size (size == "" ? "" : " ") t[i]
+            else if (d == 0 && t[i] == ";") {
+                ++nf
+                fname[name, nf] = last
+                fself[name, nf] = (decl ~ / self_field_meta_t /)
+                fsize[name, nf] = size
+                decl = ""
+                last = ""
+                size = ""
+                continue
+            } else if (d == 0 && is_ident(t[i]))
+                last = t[i]
+            decl = decl " " t[i] " "
+        }
+        return nf
+    }
+
+    # Splits a braced initializer into its elements
+    function init_elems(s,    n, t, i, d, ne, start) {
+        n = split(s, t, " ")
+        ne = 0
+        d = 0
+        for (i = 1; i <= n; ++i) {
+            if (d == 1 && t[i] == ",") {
+                start = 1
+                continue
+            }
+            if (d == 1 && (t[i] == "}" || t[i] == ")"))
+                break
+            if (d == 1 && start) {
+                elem[++ne] = ""
+                start = 0
+            }
+            if (t[i] == "{" || t[i] == "(") {
+                if (d++ == 0)
+                    start = 1
+            } else if (t[i] == "}" || t[i] == ")") {
+                --d
+            }
+            if (d > 1 || (d == 1 && t[i] != "{" && t[i] != "("))
+                elem[ne] = elem[ne] " " t[i]
+        }
+        return ne
+    }
+
+    # Elements of a SELF_FIELD_ARRAY_INITIALIZER, -1 for a
+    # SELF_FIELD_INITIALIZER
+    function self_init_count(s,    t, n, i, d, c) {
+        n = split(s, t, " ")
+        if (t[1] != "{" || t[2] != "{")
+            return -2
+        if (t[3] != "{")
+            return -1
+        c = 0
+        d = 0
+        for (i = 2; i < n; ++i) {
+            if (t[i] == "{" && d++ == 0)
+                ++c
+            else if (t[i] == "}")
+                --d
+        }
+        return c
+    }
+
+    # Index of the token that closes the one at i, in the body of function f
+    function closing(f, i,    d) {
+        d = 0
+        for (; i <= nbody[f]; ++i) {
+            if (body[f, i] == "(" || body[f, i] == "{" || body[f, i] == "[")
+                ++d
+            else if ((body[f, i] == ")" || body[f, i] == "}" ||
+                      body[f, i] == "]") && --d == 0)
+                return i
+        }
+        return nbody[f]
+    }
+
+    # The flow of the dirty count through a statement of the function cf
+    # at pos, which it advances: the most self-channel fields marked dirty
+    # on the paths that leave the statement by falling through (F), break
+    # (B), continue (C) and exit (X), NONE where no path leaves that way
+
+    function tk(i) { return body[cf, i] }
+
+    # Self-channel fields marked dirty by the calls up to the end of the
+    # statement at pos, or up to the token that closes the one at pos; sets
+    # exits if one of them is a TRANSITION_TO
+    function scan(to_close,    end, d, n, i, j, t, g, x) {
+        end = to_close ? closing(cf, pos) : nbody[cf]
+        d = 0
+        n = 0
+        x = 0
+        for (i = pos; i < end; ++i) {
+            t = tk(i)
+            if (t == ";" && d == 0 && !to_close)
+                break
+            if (t == "(" || t == "{" || t == "[")
+                ++d
+            else if (t == ")" || t == "}" || t == "]")
+                --d
+            if (!is_ident(t) || tk(i + 1) != "(" || (t in keyword))
+                continue
+            if (t == "transition_to") {
+                x = 1
+            } else if (t == "chan_out") {
+                split("", out_seen)             # each channel, and offsetof
+                for (j = i + 2; j < closing(cf, i + 1); ++j)
+                    if (ctype[tk(j)] == "CHAN_TYPE_SELF" &&
+                        !(tk(j) in out_seen)) {
+                        out_seen[tk(j)] = 1
+                        ++n
+                    }
+            } else if ((t in defined) && !(t in is_task)) {
+                n += dirty(t)
+                if (loop_at[t] != "" && loop_at[cf] == "")
+                    loop_at[cf] = loop_at[t]
+            }
+        }
+        pos = i + 1
+        exits = x
+        return n
+    }
+
+    function flow(f, b, c, x) { F = f; B = b; C = c; X = x }
+
+    # Runs the paths that fall through a flow (f...) into the one in F...
+    function then(f, b, c, x) {
+        flow(f >= 0 && F >= 0 ? f + F : NONE,
+             max(b, f >= 0 && B >= 0 ? f + B : NONE),
+             max(c, f >= 0 && C >= 0 ? f + C : NONE),
+             max(x, f >= 0 && X >= 0 ? f + X : NONE))
+    }
+
+    # Adds the fields marked dirty before a statement, by its condition
+    function plus(n) {
+        flow(F >= 0 ? F + n : NONE, B >= 0 ? B + n : NONE,
+             C >= 0 ? C + n : NONE, X >= 0 ? X + n : NONE)
+    }
+
+    # Statements up to a closing brace, with labels as entries
+    function block(    f, b, c, x) {
+        f = 0
+        b = c = x = NONE
+        while (pos <= nbody[cf] && tk(pos) != "}") {
+            if (tk(pos) == "case") {
+                while (tk(pos) != ":")
+                    ++pos
+                ++pos
+                f = max(f, 0)
+                continue
+            }
+            if ((tk(pos) == "default" || is_ident(tk(pos))) &&
+                tk(pos + 1) == ":") {
+                pos += 2
+                f = max(f, 0)
+                continue
+            }
+            stmt()
+            then(f, b, c, x)
+            f = F; b = B; c = C; x = X
+        }
+        ++pos
+        flow(f, b, c, x)
+    }
+
+    # A loop around the statement just run, from the keyword at where
+    function loop(where, n) {
+        if (F > 0 || C > 0 || n > 0)
+            if (loop_at[cf] == "")
+                loop_at[cf] = where
+        flow(max(0, max(F, max(B, C))), NONE, NONE, X)
+        plus(n)
+    }
+
+    function stmt(    t, n, f, b, c, x, where, once) {
+        t = tk(pos)
+        where = bwhere[cf, pos]
+        if (t == "{") {
+            ++pos
+            block()
+        } else if (t == "if") {
+            ++pos
+            n = scan(1)
+            stmt()
+            f = F; b = B; c = C; x = X
+            if (tk(pos) == "else") {
+                ++pos
+                stmt()
+            } else {
+                flow(0, NONE, NONE, NONE)
+            }
+            flow(max(f, F), max(b, B), max(c, C), max(x, X))
+            plus(n)
+        } else if (t == "switch") {
+            ++pos
+            n = scan(1)
+            ++pos
+            block()
+            flow(max(0, max(F, B)), NONE, C, X)
+            plus(n)
+        } else if (t == "while" || t == "for") {
+            ++pos
+            n = scan(1)
+            stmt()
+            loop(where, n)
+        } else if (t == "do") {
+            ++pos
+            stmt()
+            once = (tk(pos + 2) == "0" && tk(pos + 3) == ")")
+            ++pos
+            f = F; b = B; c = C; x = X
+            n = scan(1)
+            ++pos                               # ;
+            flow(f, b, c, x)
+            if (once)
+                flow(max(F, max(B, C)), NONE, NONE, X)
+            else
+                loop(where, n)
+        } else if (t == "break" || t == "continue") {
+            pos += 2
+            flow(NONE, t == "break" ? 0 : NONE, t == "continue" ? 0 : NONE,
+                 NONE)
+        } else if (t == "return") {
+            n = scan(0)
+            flow(NONE, NONE, NONE, n)
+        } else {
+            n = scan(0)
+            if (exits)
+                flow(NONE, NONE, NONE, n)
+            else
+                flow(n, NONE, NONE, NONE)
+        }
+    }
+
+    # Most self-channel fields a function can mark dirty before it
+    # transitions or returns
+    function dirty(f,    save_cf, save_pos, save_exits, n) {
+        if (f in dirty_memo)
+            return dirty_memo[f]
+        dirty_memo[f] = 0
+        save_cf = cf
+        save_pos = pos
+        save_exits = exits
+        cf = f
+        pos = 1
+        stmt()
+        n = max(0, max(F, X))
+        cf = save_cf
+        pos = save_pos
+        exits = save_exits
+        return dirty_memo[f] = n
+    }
+
+    # Marks the helpers reachable from a task
+    function reach(task, f,    i, g) {
+        for (i = 1; i <= ncalls[f]; ++i) {
+            g = callee[f, i]
+            if (!(g in defined) || (g in is_task) || ((task, g) in reached))
+                continue
+            reached[task, g] = 1
+            reach(task, g)
+        }
+    }
+
+    function chan_ok(kind, task, ch) {
+        if (!(ch in ctype))
+            return 1
+        if (kind == "chan_in") {
+            if (ctype[ch] == "CHAN_TYPE_T2T")
+                return cdest[ch] == task
+            if (ctype[ch] == "CHAN_TYPE_SELF" || ctype[ch] == "CHAN_TYPE_CALL")
+                return csrc[ch] == task
+            return 1
+        }
+        if (ctype[ch] == "CHAN_TYPE_CALL")
+            return 1
+        return csrc[ch] == task
+    }
+
+    function chan_desc(ch) {
+        if (ctype[ch] == "CHAN_TYPE_SELF")
+            return "the self channel of " csrc[ch]
+        if (ctype[ch] == "CHAN_TYPE_T2T")
+            return "the channel " csrc[ch] " -> " cdest[ch]
+        return "the channel " cdest[ch] " of " csrc[ch]
+    }
+
+    function token(t) {
+        # Declarations at file scope
+        if (depth == 0) {
+            if (pending_struct != "") {
+                if (t == "{") {
+                    cap_struct = pending_struct
+                    structs[cap_struct] = ""
+                }
+                pending_struct = ""
+            }
+            if (prev == "struct" && is_ident(t))
+                pending_struct = t
+            if (t ~ /^_(ch|task)_/ && prev == "}" && last_struct != "")
+                var_struct[t] = last_struct
+            if (t == "=" && prev ~ /^_(ch|task)_/) {
+                cap_var = prev
+                var_where[cap_var] = here()
+                inits[cap_var] = ""
+            } else if (cap_var != "" && t == ";") {
+                cap_var = ""
+            }
+            if (t == "(" && is_ident(prev) && pdepth == 0)
+                cand = prev
+            if (t == "{" && prev == ")" && cand != "" && cap_var == "") {
+                cur_func = cand
+                defined[cur_func] = 1
+            }
+        }
+        if (cap_var != "" && t != "=")
+            inits[cap_var] = inits[cap_var] " " t
+        if (prev == "dirty_self_fields" && t == "[")
+            dirty_size_next = 1
+        else if (dirty_size_next) {
+            max_dirty = t + 0
+            dirty_size_next = 0
+        }
+        if (cur_func != "") {
+            ++nbody[cur_func]
+            body[cur_func, nbody[cur_func]] = t
+            bwhere[cur_func, nbody[cur_func]] = here()
+        }
+
+        if (t == "{") {
+            ++depth
+        } else if (t == "}") {
+            if (--depth == 0 && cap_struct != "") {
+                last_struct = cap_struct
+                cap_struct = ""
+                prev = t
+                return
+            }
+            if (depth == 0)
+                cur_func = ""
+        } else if (t == "(") {
+            ++pdepth
+        } else if (t == ")") {
+            --pdepth
+        } else if (t == ";" && depth == 0) {
+            last_struct = ""
+        }
+        if (cap_struct != "" && !(t == "{" && structs[cap_struct] == "" &&
+                                  depth == 1 && prev == cap_struct))
+            structs[cap_struct] = structs[cap_struct] " " t
+        prev = t
+    }
+
+    BEGIN {
+        split("if while for switch return sizeof __typeof__ __typeof typeof " \
+              "__builtin_offsetof __attribute__ __asm__ asm _Static_assert " \
+              "__extension__", kw, " ")
+        for (i in kw)
+            keyword[kw[i]] = 1
+        NONE = -1
+        max_dirty = 8
+        file = "-"
+    }
+
+    /^# [0-9]+ "/ {
+        line = $2 - 1
+        file = $3
+        gsub(/"/, "", file)
+        next
+    }
+    /^#/ { next }
+
+    {
+        ++line
+        tokenize($0)
+        for (i = 1; i <= ntok; ++i)
+            token(tok[i])
+    }
+
+    END {
+        for (v in inits) {
+            if (v ~ /^_task_/) {
+                is_task[substr(v, 7)] = 1
+                continue
+            }
+            n = split(inits[v], t, " ")
+            if (t[1] != "{" || t[2] != "{" || t[3] !~ /^CHAN_TYPE_/)
+                continue
+            ctype[v] = t[3]
+            csrc[v] = substr(t[6], 2, length(t[6]) - 2)
+            cdest[v] = substr(t[8], 2, length(t[8]) - 2)
+        }
+
+        # Channel accesses and calls in each function
+        for (f in defined) {
+            for (i = 1; i < nbody[f]; ++i) {
+                g = body[f, i]
+                if (!is_ident(g) || body[f, i + 1] != "(" || (g in keyword))
+                    continue
+                if (g != "chan_in" && g != "chan_out") {
+                    callee[f, ++ncalls[f]] = g
+                    continue
+                }
+                ++nrec
+                rfunc[nrec] = f
+                rkind[nrec] = g
+                rwhere[nrec] = bwhere[f, i]
+                rfield[nrec] = ""
+                rchans[nrec] = ""
+                split("", seen)
+                end = closing(f, i + 1)
+                for (j = i + 2; j < end; ++j) {
+                    if (rfield[nrec] == "" && body[f, j] ~ /^"/)
+                        rfield[nrec] = substr(body[f, j], 2,
+                                              length(body[f, j]) - 2)
+                    if (body[f, j] ~ /^_ch_/ && !(body[f, j] in seen)) {
+                        seen[body[f, j]] = 1
+                        rchans[nrec] = rchans[nrec] " " body[f, j]
+                    }
+                }
+            }
+        }
+
+        # Channel accesses, against the tasks that can make them
+        for (task in is_task) {
+            if (!(task in defined))
+                continue
+            reached[task, task] = 1
+            reach(task, task)
+        }
+        for (r = 1; r <= nrec; ++r) {
+            n = split(rchans[r], chans, " ")
+            for (task in is_task) {
+                if (!((task, rfunc[r]) in reached))
+                    continue
+                via = (task == rfunc[r]) ? "" : " (in " rfunc[r] ")"
+                for (i = 1; i <= n; ++i) {
+                    if (chan_ok(rkind[r], task, chans[i]))
+                        continue
+                    if (rkind[r] == "chan_in")
+                        error(rwhere[r], task " reads " rfield[r] via \
+                              " from " chan_desc(chans[i]) \
+                              ", which does not lead into it")
+                    else
+                        error(rwhere[r], task " writes " rfield[r] via \
+                              " into " chan_desc(chans[i]) \
+                              ", which does not lead out of it")
+                }
+            }
+        }
+
+        # Dirty self-channel fields per task execution
+        for (task in is_task) {
+            if (!(task in defined))
+                continue
+            n = dirty(task)
+            if (n > max_dirty)
+                error(var_where["_task_" task], task " can mark " n \
+                      " self-channel fields dirty, more than " \
+                      "MAX_DIRTY_SELF_FIELDS (" max_dirty ")")
+            if (loop_at[task] != "")
+                warning(loop_at[task], task " writes a self channel in a " \
+                        "loop: the fields it marks dirty are not bounded " \
+                        "here (MAX_DIRTY_SELF_FIELDS is " max_dirty ")")
+        }
+
+        # Initializers of the self channels
+        for (v in ctype) {
+            if (ctype[v] != "CHAN_TYPE_SELF")
+                continue
+            if (!(v in var_struct) ||
+                !match(structs[var_struct[v]], / struct [A-Za-z_0-9]+ data ;/))
+                continue
+            msg = substr(structs[var_struct[v]], RSTART + 8, RLENGTH - 15)
+            if (!(msg in structs))
+                continue
+            nf = struct_fields(msg)
+
+            split("", elem)
+            init_elems(inits[v])
+            data = elem[2]
+            split("", elem)
+            ne = (data == "") ? 0 : init_elems(data)
+
+            for (i = 1; i <= nf; ++i) {
+                if (!fself[msg, i])
+                    continue
+                what = "field " fname[msg, i] " of the self channel of " \
+                       csrc[v] " (struct " msg ")"
+                if (i > ne) {
+                    error(var_where[v], what " has no initializer in " \
+                          "FIELD_INIT_" msg)
+                    continue
+                }
+                c = self_init_count(elem[i])
+                if (fsize[msg, i] == "") {
+                    if (c != -1)
+                        error(var_where[v], what " is not initialized " \
+                              "with SELF_FIELD_INITIALIZER")
+                    continue
+                }
+                size = eval(fsize[msg, i])
+                if (c < 0)
+                    error(var_where[v], what " is an array, not initialized " \
+                          "with SELF_FIELD_ARRAY_INITIALIZER")
+                else if (size != "" && c != size)
+                    error(var_where[v], what " has " size " elements, " \
+                          "initialized with SELF_FIELD_ARRAY_INITIALIZER(" \
+                          c ")")
+            }
+            if (ne > nf)
+                error(var_where[v], "FIELD_INIT_" msg " has " ne \
+                      " initializers for " nf " fields")
+        }
+
+        exit errors > 0
+    }
+' "$@"
@@ -83,15 +83,20 @@
 
 #define INIT_CONSOLE()
 
+// Never defined: the nop printfs only take the size of a call to it, which
+// does not evaluate the arguments but keeps the variables they name in use
+int libio_printf_discard(const char *fmt, ...);
+#define PRINTF_DISCARD(...) ((void)sizeof(libio_printf_discard(__VA_ARGS__)))
+
 // All printfs fall back to nop
 #define BLOCK_PRINTF_BEGIN()
-#define BLOCK_PRINTF(...)
+#define BLOCK_PRINTF(...) PRINTF_DISCARD(__VA_ARGS__)
 #define BLOCK_PRINTF_END()
 
-#define PRINTF(...)
+#define PRINTF(...) PRINTF_DISCARD(__VA_ARGS__)
 
-#define EIF_PRINTF(...)
-#define BARE_PRINTF(...)
+#define EIF_PRINTF(...) PRINTF_DISCARD(__VA_ARGS__)
+#define BARE_PRINTF(...) PRINTF_DISCARD(__VA_ARGS__)
 
 #endif // no printf
 
@@ -0,0 +1,36 @@
+#include <msp430.h>
+
+#include "cycles.h"
+
+static volatile uint16_t cycles_hi;
+
+void msp_cycles_start()
+{
+    cycles_hi = 0;
+    TB0CTL = TBSSEL__SMCLK | MC__CONTINUOUS | TBCLR | TBIE;
+}
+
+uint32_t msp_cycles()
+{
+    uint16_t hi, lo;
+
+    // Re-read if the overflow interrupt fired in between
+    do {
+        hi = cycles_hi;
+        lo = TB0R;
+    } while (hi != cycles_hi);
+
+    return ((uint32_t)hi << 16) | lo;
+}
+
+__attribute__ ((interrupt(TIMER0_B1_VECTOR)))
+void TIMER0_B1_ISR(void)
+{
+    switch (__even_in_range(TB0IV, TB0IV_TBIFG)) {
+        case TB0IV_TBIFG:
+            ++cycles_hi;
+            break;
+        default:
+            break;
+    }
+}
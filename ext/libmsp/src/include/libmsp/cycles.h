@@ -0,0 +1,15 @@
+#ifndef LIBMSP_CYCLES_H
+#define LIBMSP_CYCLES_H
+
+#include <stdint.h>
+
+/** @brief Free-running 32-bit cycle counter
+ *  @details Timer B0 counts SMCLK in continuous mode and its overflow
+ *           interrupt extends the count to 32 bits, so interrupts must be
+ *           enabled. With the default (undivided) clocks, SMCLK = MCLK, so the
+ *           count is in CPU cycles. The count does not survive a reboot.
+ */
+void msp_cycles_start();
+uint32_t msp_cycles();
+
+#endif // LIBMSP_CYCLES_H
@@ -1,8 +1,24 @@
 #ifndef _LIBMSP_MEM_H
 #define _LIBMSP_MEM_H
 
+#if defined(__MSP430__)
+
 /* The linker script needs to allocate these sections into FRAM region. */
 #define __nv    __attribute__((section(".nv_vars")))
 #define __ro_nv __attribute__((section(".ro_nv_vars")))
 
+/* Volatile memory, lost on a power failure: the default placement. */
+#define __sram
+
+#else // !__MSP430__
+
+/* Host build: each thread simulates one device, with its own copy of the
+ * non-volatile memory. Read-only data is shared. Plain globals are shared
+ * too, so state that a device keeps in SRAM must be marked __sram. */
+#define __nv    _Thread_local
+#define __ro_nv
+#define __sram  _Thread_local
+
+#endif // !__MSP430__
+
 #endif // _LIBMSP_MEM_H
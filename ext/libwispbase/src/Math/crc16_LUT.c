@@ -1,5 +1,7 @@
 #include <stdint.h>
 
+#include "crc.h"
+
 //A good TI App Note once showed how to auto-generate this (SLA221)
 const uint16_t crc16_LUT[256] = {
     0x0000, 0x1021, 0x2042, 0x3063,
@@ -67,14 +69,9 @@ const uint16_t crc16_LUT[256] = {
     0x6E17, 0x7E36, 0x4E55, 0x5E74,
     0x2E93, 0x3EB2, 0x0ED1, 0x1EF0 };
     
-//A good TI App Note once showed how to do this (SLA221)
+// The table lookup of SLA221, run by the shared engine (crc.c)
 uint16_t crc16_cLUT(uint8_t *pmsg, uint8_t msg_size) {
-    unsigned int crc = 0xFFFF;      // load up with initial remainder
-    
-    while(msg_size--) {
-        crc = crc16_LUT[((crc >> 8) ^ *pmsg++)] ^ (crc << 8);   // normal
-    }
-    
-    return crc;
+    return crc_final(&crc16_ccitt_model,
+                     crc_update(&crc16_ccitt_model, crc_init(&crc16_ccitt_model),
+                                pmsg, msg_size));
 }
-
@@ -0,0 +1,55 @@
+/**
+ * @file crc.h
+ *
+ * Table-driven CRC engine, shared by CRC16 and CRC32
+ *
+ * A CRC is described by a model: its width, its bit order, its initial and
+ * final XOR values, and the table of its polynomial. The same update routine
+ * runs every model a byte at a time, so a CRC can be computed over several
+ * calls, e.g. one chunk of a buffer per task.
+ */
+
+#ifndef CRC_H_
+#define CRC_H_
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t width;          // 16 or 32 bits
+    uint8_t reflected;      // bytes enter at the LSb (else at the MSb)
+    uint32_t init;          // value of the register before the first byte
+    uint32_t xorout;        // XORed into the register to give the CRC
+    const void *table;      // 256 entries, uint16_t or uint32_t by width
+} crc_model_t;
+
+/** CRC-16/CCITT-FALSE: polynomial 0x1021, MSb first, init 0xFFFF, as the
+ *  EPC Gen2 RFID code computes it (crc16_LUT) */
+extern const crc_model_t crc16_ccitt_model;
+
+/** CRC-32 of ANSI X3.66 (Ethernet, zip): polynomial 0x04C11DB7, LSb first,
+ *  init and final XOR 0xFFFFFFFF (crc32_LUT) */
+extern const crc_model_t crc32_model;
+
+extern const uint32_t crc32_LUT[256];
+
+/**
+ * Continue a CRC over a buffer
+ *
+ * @param model  the CRC to compute
+ * @param crc    the register: crc_init() or the result of an earlier update
+ * @return       the register after the buffer
+ */
+uint32_t crc_update(const crc_model_t *model, uint32_t crc,
+                    const uint8_t *data, uint16_t len);
+
+static inline uint32_t crc_init(const crc_model_t *model)
+{
+    return model->init;
+}
+
+static inline uint32_t crc_final(const crc_model_t *model, uint32_t crc)
+{
+    return crc ^ model->xorout;
+}
+
+#endif /* CRC_H_ */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 1988-1997 Sam Leffler
+ * Copyright (c) 1991-1997 Silicon Graphics, Inc.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and 
+ * its documentation for any purpose is hereby granted without fee, provided
+ * that (i) the above copyright notices and this permission notice appear in
+ * all copies of the software and related documentation, and (ii) the names of
+ * Sam Leffler and Silicon Graphics may not be used in any advertising or
+ * publicity relating to the software without the specific, prior written
+ * permission of Sam Leffler and Silicon Graphics.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS-IS" AND WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS, IMPLIED OR OTHERWISE, INCLUDING WITHOUT LIMITATION, ANY 
+ * WARRANTY OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE.  
+ * 
+ * IN NO EVENT SHALL SAM LEFFLER OR SILICON GRAPHICS BE LIABLE FOR
+ * ANY SPECIAL, INCIDENTAL, INDIRECT OR CONSEQUENTIAL DAMAGES OF ANY KIND,
+ * OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+ * WHETHER OR NOT ADVISED OF THE POSSIBILITY OF DAMAGE, AND ON ANY THEORY OF 
+ * LIABILITY, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE 
+ * OF THIS SOFTWARE.
+ */
+
+/*
+ * Stand-in for the tiffdither driver of MiBench, which reads and writes
+ * TIFF files through libtiff. fsdither() is tiffdither's, with the scanline
+ * I/O of libtiff replaced by a binary PGM on input and the packed rows,
+ * bit set for white (PHOTOMETRIC_MINISBLACK), on output:
+ *
+ *	pgmdither [-t threshold] input.pgm output.raw
+ *
+ * Like tiffdither, it writes one row less than the image has: the last row
+ * is only ever the next line of the one before.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef unsigned int uint32;
+
+static	uint32 imagewidth;
+static	uint32 imagelength;
+static	int threshold = 128;
+
+static	unsigned char *image;
+
+static void
+readpgm(const char* name)
+{
+	FILE *fd = fopen(name, "rb");
+	char line[256];
+	int maxval, n = 0;
+
+	if (!fd || !fgets(line, sizeof (line), fd) || strncmp(line, "P5", 2)) {
+		fprintf(stderr, "%s: not a binary PGM\n", name);
+		exit(-1);
+	}
+	while (n < 3 && fgets(line, sizeof (line), fd)) {
+		if (line[0] == '#')
+			continue;
+		if (n == 0)
+			n = sscanf(line, "%u %u %d", &imagewidth, &imagelength,
+			    &maxval);
+		else
+			n += sscanf(line, "%d", &maxval);
+	}
+	image = (unsigned char *)malloc(imagewidth * imagelength);
+	if (n < 3 || maxval > 255 || fread(image, imagewidth,
+	    imagelength, fd) != imagelength) {
+		fprintf(stderr, "%s: bad PGM\n", name);
+		exit(-1);
+	}
+	fclose(fd);
+}
+
+static void
+fsdither(FILE* out)
+{
+	unsigned char *outline, *inputline, *inptr;
+	short *thisline, *nextline, *tmpptr;
+	register unsigned char	*outptr;
+	register short *thisptr, *nextptr;
+	register uint32 i, j;
+	uint32 imax, jmax;
+	int lastline, lastpixel;
+	int bit;
+	size_t outlinesize;
+
+	imax = imagelength - 1;
+	jmax = imagewidth - 1;
+	thisline = (short *)malloc(imagewidth * sizeof (short));
+	nextline = (short *)malloc(imagewidth * sizeof (short));
+	outlinesize = (imagewidth + 7) / 8;
+	outline = (unsigned char *) malloc(outlinesize);
+
+	/*
+	 * Get first line
+	 */
+	inputline = image;
+	inptr = inputline;
+	nextptr = nextline;
+	for (j = 0; j < imagewidth; ++j)
+		*nextptr++ = *inptr++;
+	for (i = 1; i < imagelength; ++i) {
+		tmpptr = thisline;
+		thisline = nextline;
+		nextline = tmpptr;
+		lastline = (i == imax);
+		inputline = image + i * imagewidth;
+		inptr = inputline;
+		nextptr = nextline;
+		for (j = 0; j < imagewidth; ++j)
+			*nextptr++ = *inptr++;
+		thisptr = thisline;
+		nextptr = nextline;
+		memset(outptr = outline, 0, outlinesize);
+		bit = 0x80;
+		for (j = 0; j < imagewidth; ++j) {
+			register int v;
+
+			lastpixel = (j == jmax);
+			v = *thisptr++;
+			if (v < 0)
+				v = 0;
+			else if (v > 255)
+				v = 255;
+			if (v > threshold) {
+				*outptr |= bit;
+				v -= 255;
+			}
+			bit >>= 1;
+			if (bit == 0) {
+				outptr++;
+				bit = 0x80;
+			}
+			if (!lastpixel)
+				thisptr[0] += v * 7 / 16;
+			if (!lastline) {
+				if (j != 0)
+					nextptr[-1] += v * 3 / 16;
+				*nextptr++ += v * 5 / 16;
+				if (!lastpixel)
+					nextptr[0] += v / 16;
+			}
+		}
+		if (fwrite(outline, outlinesize, 1, out) != 1)
+			break;
+	}
+	free(thisline);
+	free(nextline);
+	free(outline);
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: pgmdither [-t threshold] input.pgm output.raw\n");
+	exit(-1);
+}
+
+int
+main(int argc, char* argv[])
+{
+	FILE *out;
+	int c;
+
+	while ((c = getopt(argc, argv, "t:")) != -1)
+		switch (c) {
+		case 't':
+			threshold = atoi(optarg);
+			if (threshold < 0)
+				threshold = 0;
+			else if (threshold > 255)
+				threshold = 255;
+			break;
+		default:
+			usage();
+		}
+	if (argc - optind < 2)
+		usage();
+	readpgm(argv[optind]);
+	out = fopen(argv[optind+1], "wb");
+	if (out == NULL)
+		return (-2);
+	fsdither(out);
+	fclose(out);
+	return (0);
+}
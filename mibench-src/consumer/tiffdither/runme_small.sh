@@ -0,0 +1,2 @@
+#!/bin/sh
+./pgmdither ../../automotive/susan/input_small.pgm output_small.raw
@@ -0,0 +1,2 @@
+#!/bin/sh
+./dijkstra_large input.dat > output_large.dat
@@ -0,0 +1,2 @@
+#!/bin/sh
+./dijkstra_small input.dat > output_small.dat
@@ -0,0 +1,197 @@
+/*
+ * patricia.c
+ *
+ * Patricia trie implementation.
+ *
+ * Functions for inserting nodes, removing nodes, and searching in
+ * a Patricia trie designed for IP addresses and netmasks.  A
+ * head node must be created with (key,mask) = (0,0).
+ *
+ * NOTE: The fact that we keep multiple masks per node makes this
+ *       more complicated/computationally expensive then a standard
+ *       trie.  This is because we need to do longest prefix matching,
+ *       which is useful for computer networks, but not as useful
+ *       elsewhere.
+ *
+ * Matthew Smart <mcsmart@eecs.umich.edu>
+ *
+ * Copyright (c) 2000
+ * The Regents of the University of Michigan
+ * All rights reserved
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "patricia.h"
+
+/*
+ * Private function used to return whether
+ * or not bit 'i' is set in 'key'.
+ */
+static __inline
+unsigned long
+bit(int i, unsigned long key)
+{
+	return key & (1UL << (31-i));
+}
+
+
+/*
+ * Private function used for inserting a node recursively.
+ */
+static struct ptree *
+insertR(struct ptree *h, struct ptree *n, int d, struct ptree *p)
+{
+	if ((h->p_b >= d) || (h->p_b <= p->p_b)) {
+		n->p_b = d;
+		n->p_left = bit(d, n->p_key) ? h : n;
+		n->p_right = bit(d, n->p_key) ? n : h;
+		return n;
+	}
+
+	if (bit(h->p_b, n->p_key))
+		h->p_right = insertR(h->p_right, n, d, h);
+	else
+		h->p_left = insertR(h->p_left, n, d, h);
+	return h;
+}
+
+
+/*
+ * Patricia trie insert.
+ *
+ * 1) Go down to leaf.
+ * 2) Determine longest prefix match with leaf node.
+ * 3) Insert new internal node at appropriate location and
+ *    attach new external node.
+ */
+struct ptree *
+pat_insert(struct ptree *n, struct ptree *head)
+{
+	struct ptree *t;
+	struct ptree_mask *buf, *pm;
+	int i, copied;
+
+	if (!head || !n || !n->p_m)
+		return 0;
+
+	/*
+	 * Make sure key is sane.
+	 */
+	n->p_key &= n->p_m->pm_mask;
+
+	/*
+	 * Find closest matching leaf node.
+	 */
+	t = head;
+	do {
+		i = t->p_b;
+		t = bit(t->p_b, n->p_key) ? t->p_right : t->p_left;
+	} while (i < t->p_b);
+
+	/*
+	 * If the keys are the same we need to check the masks.
+	 */
+	if (n->p_key == t->p_key) {
+		/*
+		 * If we have a duplicate mask, replace the entry
+		 * with the new one.
+		 */
+		for (i=0; i < t->p_mlen; i++) {
+			if (n->p_m->pm_mask == t->p_m[i].pm_mask) {
+				t->p_m[i].pm_data = n->p_m->pm_data;
+				free(n->p_m);
+				free(n);
+				n = 0;
+				return t;
+			}
+		}
+
+		/*
+		 * Allocate space for a new set of masks.
+		 */
+		buf = (struct ptree_mask *)malloc(
+		       sizeof(struct ptree_mask)*(t->p_mlen+1));
+
+		/*
+		 * Insert the new mask in the proper order from least
+		 * to greatest mask.
+		 */
+		copied = 0;
+		for (i=0, pm=buf; i < t->p_mlen; pm++) {
+			if (n->p_m->pm_mask > t->p_m[i].pm_mask) {
+				memcpy(pm, t->p_m + i, sizeof(struct ptree_mask));
+				i++;
+			}
+			else {
+				memcpy(pm, n->p_m, sizeof(struct ptree_mask));
+				n->p_m->pm_mask = 0xffffffff;
+				copied = 1;
+			}
+		}
+		if (!copied) {
+			memcpy(pm, n->p_m, sizeof(struct ptree_mask));
+		}
+		free(n->p_m);
+		free(n);
+		n = 0;
+		t->p_mlen++;
+
+		/*
+		 * Free old masks and point to new ones.
+		 */
+		t->p_m = buf;
+		return t;
+	}
+
+	/*
+	 * Find the first bit that differs.
+	 */
+	for (i=1; i < 32 && bit(i, n->p_key) == bit(i, t->p_key); i++);
+
+	/*
+	 * Recursive step.
+	 */
+	if (bit(head->p_b, n->p_key))
+		head->p_right = insertR(head->p_right, n, i, head);
+	else
+		head->p_left = insertR(head->p_left, n, i, head);
+
+	return n;
+}
+
+
+/*
+ * Find an entry given a key in a Patricia trie.
+ */
+struct ptree *
+pat_search(unsigned long key, struct ptree *head)
+{
+	struct ptree *p = 0, *t = head;
+	int i;
+
+	if (!t)
+		return 0;
+
+	/*
+	 * Find closest matching leaf node.
+	 */
+	do {
+		/*
+		 * Keep track of most complete match so far.
+		 */
+		if (t->p_key == (key & t->p_m->pm_mask))
+			p = t;
+
+		i = t->p_b;
+		t = bit(t->p_b, key) ? t->p_right : t->p_left;
+	} while (i < t->p_b);
+
+	/*
+	 * Compare keys (and masks) to see if this
+	 * is really the node we want.
+	 */
+	return (t->p_key == (key & t->p_m->pm_mask)) ? t : p;
+}
@@ -0,0 +1,162 @@
+/*
+ * patricia_test.c
+ *
+ * Patricia trie test code.
+ *
+ * This code is an example of how to use the Patricia trie library for
+ * doing longest-prefix matching.  We begin by adding a default
+ * route/default node as the head of the Patricia trie.  This will become
+ * an initialization functin (pat_init) in the future.  We then read in a
+ * set of IP addresses and netmasks from a file and insert them into the
+ * trie.  We print out some statistics and then delete them from the trie.
+ *
+ * Matthew Smart <mcsmart@eecs.umich.edu>
+ *
+ * Copyright (c) 2000
+ * The Regents of the University of Michigan
+ * All rights reserved
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "patricia.h"
+
+struct MyNode {
+	int foo;
+	double bar;
+};
+
+int
+main(int argc, char **argv)
+{
+	struct ptree *phead;
+	struct ptree *p,*pfind;
+	struct ptree_mask *pm;
+	FILE *fp;
+	char line[128];
+	unsigned int addr;
+	unsigned long mask=0xffffffff;
+	float time;
+
+	if (argc<2) {
+		printf("Usage: %s <TCP stream>\n", argv[0]);
+		exit(-1);
+	}
+
+	/*
+	 * Open file of IP addresses and masks.
+	 * Each line looks like:
+	 *    10.0.3.4 0xffff0000
+	 */
+	if ((fp = fopen(argv[1], "r")) == NULL) {
+		printf("File %s doesn't seem to exist\n",argv[1]);
+		exit(0);
+	}
+
+	/*
+	 * Initialize the Patricia trie by doing the following:
+	 *   1. Assign the head pointer a default route/default node
+	 *   2. Give it an address of 0.0.0.0 and a mask of 0x00000000
+	 *      (matches everything)
+	 *   3. Set the bit position (p_b) to 0.
+	 *   4. Set the number of masks to 1 (the default one).
+	 *   5. Point the head's 'left' and 'right' pointers to itself.
+	 * NOTE: This should go into an intialization function.
+	 */
+	phead = (struct ptree *)calloc(1, sizeof(struct ptree));
+	if (!phead) {
+		perror("Allocating p-trie node");
+		exit(0);
+	}
+	phead->p_m = (struct ptree_mask *)calloc(1,
+			sizeof(struct ptree_mask));
+	if (!phead->p_m) {
+		perror("Allocating p-trie mask data");
+		exit(0);
+	}
+	pm = phead->p_m;
+	pm->pm_data = (struct MyNode *)calloc(1, sizeof(struct MyNode));
+	if (!pm->pm_data) {
+		perror("Allocating p-trie mask's node data");
+		exit(0);
+	}
+	/*******
+	 *
+	 * Fill in default route/default node data here.
+	 *
+	 *******/
+	phead->p_mlen = 1;
+	phead->p_left = phead->p_right = phead;
+
+
+	/*
+	 * The main loop to insert nodes.
+	 */
+	while (fgets(line, 128, fp)) {
+		/*
+		 * Read in each IP address and mask and convert them to
+		 * more usable formats.
+		 */
+		sscanf(line, "%f %u", &time, &addr);
+
+		/*
+		 * Create a Patricia trie node to insert.
+		 */
+		p = (struct ptree *)calloc(1, sizeof(struct ptree));
+		if (!p) {
+			perror("Allocating p-trie node");
+			exit(0);
+		}
+
+		/*
+		 * Allocate the mask data.
+		 */
+		p->p_m = (struct ptree_mask *)calloc(1,
+				sizeof(struct ptree_mask));
+		if (!p->p_m) {
+			perror("Allocating p-trie mask data");
+			exit(0);
+		}
+
+		/*
+		 * Allocate the data for this node.
+		 * Replace 'struct MyNode' with whatever you'd like.
+		 */
+		pm = p->p_m;
+		pm->pm_data = (struct MyNode *)calloc(1, sizeof(struct MyNode));
+		if (!pm->pm_data) {
+			perror("Allocating p-trie mask's node data");
+			exit(0);
+		}
+
+		/*
+		 * Assign a value to the IP address and mask field for this
+		 * node.
+		 */
+		p->p_key = addr;		/* Network-byte order */
+		p->p_m->pm_mask = mask;
+
+		pfind=pat_search(addr,phead);
+		if(pfind->p_key==addr)
+		{
+			printf("%f %08x: ", time, addr);
+			printf("Found.\n");
+		}
+		else
+		{
+			/*
+		 	* Insert the node.
+		 	* Returns the node it inserted on success, 0 on failure.
+		 	*/
+			p = pat_insert(p, phead);
+		}
+		if (!p) {
+			fprintf(stderr, "Failed on pat_insert\n");
+			exit(0);
+		}
+	}
+
+	exit(1);
+}
@@ -0,0 +1,2 @@
+#!/bin/sh
+./patricia small.udp > output_small.txt
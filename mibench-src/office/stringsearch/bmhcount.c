@@ -0,0 +1,48 @@
+/*
+**  Count the occurrences of each pattern in a text file, with the
+**  Boyer-Moore-Horspool search of bmhsrch.c. The matches do not overlap:
+**  the search resumes after the end of each match.
+**
+**  Usage: bmhcount <text file> <pattern> ...
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "search.h"
+
+#define MAX_TEXT 32000      /* bmh_search takes less than 32767 bytes */
+
+static char text[MAX_TEXT];
+
+int main(int argc, char *argv[])
+{
+      FILE *f;
+      int len, i, count;
+      char *here, *end;
+
+      if (argc < 3)
+      {
+            fprintf(stderr, "Usage: bmhcount <text file> <pattern> ...\n");
+            return 1;
+      }
+      if ((f = fopen(argv[1], "rb")) == NULL)
+      {
+            perror(argv[1]);
+            return 1;
+      }
+      len = fread(text, 1, MAX_TEXT, f);
+      fclose(f);
+      end = text + len;
+
+      for (i = 2; i < argc; i++)
+      {
+            bmh_init(argv[i]);
+            count = 0;
+            for (here = text; (here = bmh_search(here, end - here)) != NULL;
+                 here += strlen(argv[i]))
+                  count++;
+            printf("\"%s\" found %d times\n", argv[i], count);
+      }
+      return 0;
+}
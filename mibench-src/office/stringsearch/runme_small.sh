@@ -0,0 +1,5 @@
+#!/bin/sh
+head -c 4096 ../../security/sha/input_small.asc > text_small.asc
+./bmhcount text_small.asc sensor "battery voltage" error "packet was" \
+    "tag reader" ok. the a node temperature timeout "reading of" \
+    humidity sample "log reader" "voltage 1" > output_small.txt
@@ -0,0 +1,13 @@
+/*
+**  SNIPPETS string searching functions
+*/
+
+#ifndef SEARCH__H
+#define SEARCH__H
+
+#include <stddef.h>
+
+void bmh_init(const char *pattern);
+char *bmh_search(const char *string, const int stringlen);
+
+#endif /* SEARCH__H */
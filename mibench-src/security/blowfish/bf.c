@@ -0,0 +1,122 @@
+/* Blowfish file encryption driver, from the MiBench security suite.
+ *
+ * Usage: bf {e|d} <input> <output> <key> [cfb64|ecb|cbc]
+ *
+ * The key is in hexadecimal; as in MiBench, only its first 8 bytes are
+ * used. The IV is zero. ECB and CBC pad the last block with zeros.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "blowfish.h"
+
+int
+main(int argc, char *argv[])
+{
+	BF_KEY key;
+	unsigned char ukey[32];
+	unsigned char indata[40],outdata[40],ivec[8];
+	int num=0;
+	int by=0,i=0,j;
+	int encordec=-1;
+	int mode=0;
+	char *cp,ch;
+	FILE *fp,*fp2;
+
+if (argc<5)
+{
+	printf("Usage: blowfish {e|d} <intput> <output> key [cfb64|ecb|cbc]\n");
+	exit(-1);
+}
+
+if (*argv[1]=='e' || *argv[1]=='E')
+	encordec = 1;
+else if (*argv[1]=='d' || *argv[1]=='D')
+	encordec = 0;
+else
+{
+	printf("Usage: blowfish {e|d} <intput> <output> key [cfb64|ecb|cbc]\n");
+	exit(-1);
+}
+
+if (argc>5)
+{
+	if (!strcmp(argv[5],"ecb"))
+		mode = 1;
+	else if (!strcmp(argv[5],"cbc"))
+		mode = 2;
+	else if (strcmp(argv[5],"cfb64"))
+	{
+		printf("Unknown mode %s\n",argv[5]);
+		exit(-1);
+	}
+}
+
+/* Read the key */
+cp = argv[4];
+while(i < 64 && *cp)    /* the maximum key length is 32 bytes and   */
+{                       /* hence at most 64 hexadecimal digits      */
+	ch = toupper(*cp++);            /* process a hexadecimal digit  */
+	if(ch >= '0' && ch <= '9')
+		by = (by << 4) + ch - '0';
+	else if(ch >= 'A' && ch <= 'F')
+		by = (by << 4) + ch - 'A' + 10;
+	else                            /* error if not hexadecimal     */
+	{
+		printf("key must be in hexadecimal notation\n");
+		exit(-1);
+	}
+
+	/* store a key byte for each pair of hexadecimal digits         */
+	if(i++ & 1)
+		ukey[i / 2 - 1] = by & 0xff;
+}
+
+BF_set_key(&key,8,ukey);
+
+if(*cp)
+{
+	printf("Bad key value.\n");
+	exit(-1);
+}
+
+/* open the input and output files */
+if ((fp = fopen(argv[2],"r"))==0)
+{
+	printf("Usage: blowfish {e|d} <intput> <output> key [cfb64|ecb|cbc]\n");
+	exit(-1);
+};
+if ((fp2 = fopen(argv[3],"w"))==0)
+{
+	printf("Usage: blowfish {e|d} <intput> <output> key [cfb64|ecb|cbc]\n");
+	exit(-1);
+};
+
+memset(ivec,0,sizeof(ivec));
+
+while((i = fread(indata,1,40,fp)) > 0)
+{
+	if (mode != 0)
+	{
+		/* pad to a whole block */
+		while (i % BF_BLOCK)
+			indata[i++]=0;
+	}
+
+	if (mode == 0)
+		BF_cfb64_encrypt(indata,outdata,i,&key,ivec,&num,encordec);
+	else if (mode == 1)
+		for (j=0;j<i;j+=BF_BLOCK)
+			BF_ecb_encrypt(indata+j,outdata+j,&key,encordec);
+	else
+		BF_cbc_encrypt(indata,outdata,i,&key,ivec,encordec);
+
+	fwrite(outdata,1,i,fp2);
+}
+
+fclose(fp);
+fclose(fp2);
+exit(0);
+}
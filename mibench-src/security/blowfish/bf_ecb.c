@@ -0,0 +1,20 @@
+/* crypto/bf/bf_ecb.c */
+/* Copyright (C) 1995-1997 Eric Young (eay@mincom.oz.au)
+ * All rights reserved.
+ */
+
+#include "blowfish.h"
+#include "bf_locl.h"
+
+void BF_ecb_encrypt(unsigned char *in, unsigned char *out, BF_KEY *ks,
+	int encrypt)
+	{
+	BF_LONG l,d[2];
+
+	n2l(in,l); d[0]=l;
+	n2l(in,l); d[1]=l;
+	BF_encrypt(d,ks,encrypt);
+	l=d[0]; l2n(l,out);
+	l=d[1]; l2n(l,out);
+	l=d[0]=d[1]=0;
+	}
@@ -0,0 +1,28 @@
+/*
+**  CRC.H - header file for SNIPPETS CRC and checksum functions
+*/
+
+#ifndef CRC__H
+#define CRC__H
+
+#include <stdlib.h>           /* For size_t                 */
+
+/* 32 bits: MiBench has unsigned long, which is 64 bits on LP64 hosts */
+typedef unsigned char  BYTE;
+typedef unsigned short WORD;
+typedef unsigned int   DWORD;
+
+typedef enum {Error_ = -1, Success_, False_ = 0, True_} Boolean_T;
+
+/*
+**  File: CRC_32.C
+*/
+
+#define UPDC32(octet,crc) (crc_32_tab[((crc)\
+     ^ ((BYTE)octet)) & 0xff] ^ ((crc) >> 8))
+
+DWORD updateCRC32(unsigned char ch, DWORD crc);
+Boolean_T crc32file(char *name, DWORD *crc, long *charcnt);
+DWORD crc32buf(char *buf, size_t len);
+
+#endif /* CRC__H */
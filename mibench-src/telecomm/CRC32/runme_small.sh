@@ -0,0 +1,2 @@
+#!/bin/sh
+./crc ../adpcm/data/small.pcm > output_small.txt
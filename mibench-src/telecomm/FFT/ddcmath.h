@@ -0,0 +1,16 @@
+/*============================================================================
+
+       ddcmath.h  -  Don Cross <dcross@intersrv.com>, October 1994.
+
+       Contains useful math stuff.
+
+============================================================================*/
+
+#ifndef __ddcmath_h
+#define __ddcmath_h
+
+#define  DDC_PI  (3.14159265358979323846)
+
+#endif /* __ddcmath_h */
+
+/*--- end of file ddcmath.h ---*/
@@ -0,0 +1,3 @@
+#!/bin/sh
+./fft 4 4096 > output_small.txt
+./fft 8 4096 -i > output_small.inv.txt
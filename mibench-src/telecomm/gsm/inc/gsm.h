@@ -0,0 +1,27 @@
+/*
+ * Copyright 1992 by Jutta Degener and Carsten Bormann, Technische
+ * Universitaet Berlin.  See the accompanying file "COPYRIGHT" for
+ * details.  THERE IS ABSOLUTELY NO WARRANTY FOR THIS SOFTWARE.
+ */
+
+#ifndef	GSM_H
+#define	GSM_H
+
+/*
+ *	Interface
+ */
+
+typedef struct gsm_state * 	gsm;
+typedef short		   	gsm_signal;		/* signed 16 bit */
+typedef unsigned char		gsm_byte;
+typedef gsm_byte 		gsm_frame[33];		/* 33 * 8 bits	 */
+
+#define	GSM_MAGIC	0xD			  	/* 13 kbit/s RPE-LTP */
+
+extern gsm  gsm_create 	(void);
+extern void gsm_destroy (gsm);
+
+extern void gsm_encode  (gsm, gsm_signal *, gsm_byte  *);
+extern int  gsm_decode  (gsm, gsm_byte   *, gsm_signal *);
+
+#endif	/* GSM_H */
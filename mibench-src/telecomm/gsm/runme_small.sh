@@ -0,0 +1,3 @@
+#!/bin/sh
+bin/toast < ../adpcm/data/small.pcm > output_small.gsm
+bin/toast -d < data/small.gsm > output_small.decode.pcm
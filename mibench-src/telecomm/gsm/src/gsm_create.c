@@ -0,0 +1,29 @@
+/*
+ * Copyright 1992 by Jutta Degener and Carsten Bormann, Technische
+ * Universitaet Berlin.  See the accompanying file "COPYRIGHT" for
+ * details.  THERE IS ABSOLUTELY NO WARRANTY FOR THIS SOFTWARE.
+ */
+
+#include	<stdlib.h>
+#include	<string.h>
+
+#include	"private.h"
+#include	"gsm.h"
+
+gsm gsm_create (void)
+{
+	gsm  r;
+
+	r = (gsm)malloc(sizeof(struct gsm_state));
+	if (!r) return r;
+
+	memset((char *)r, 0, sizeof(*r));
+	r->nrp = 40;
+
+	return r;
+}
+
+void gsm_destroy (gsm S)
+{
+	if (S) free((char *)S);
+}
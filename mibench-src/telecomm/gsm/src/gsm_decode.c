@@ -0,0 +1,61 @@
+/*
+ * Copyright 1992 by Jutta Degener and Carsten Bormann, Technische
+ * Universitaet Berlin.  See the accompanying file "COPYRIGHT" for
+ * details.  THERE IS ABSOLUTELY NO WARRANTY FOR THIS SOFTWARE.
+ */
+
+#include "private.h"
+#include "gsm.h"
+
+int gsm_decode (gsm s, gsm_byte * c, gsm_signal * target)
+{
+	word  	LARc[8], Nc[4], Mc[4], bc[4], xmaxc[4], xmc[13*4];
+	int	i;
+
+	/* GSM_MAGIC  = (*c >> 4) & 0xF; */
+
+	if (((*c >> 4) & 0x0F) != GSM_MAGIC) return -1;
+
+	LARc[0]  = (*c++ & 0xF) << 2;		/* 1 */
+	LARc[0] |= (*c >> 6) & 0x3;
+	LARc[1]  = *c++ & 0x3F;
+	LARc[2]  = (*c >> 3) & 0x1F;
+	LARc[3]  = (*c++ & 0x7) << 2;
+	LARc[3] |= (*c >> 6) & 0x3;
+	LARc[4]  = (*c >> 2) & 0xF;
+	LARc[5]  = (*c++ & 0x3) << 2;
+	LARc[5] |= (*c >> 6) & 0x3;
+	LARc[6]  = (*c >> 3) & 0x7;
+	LARc[7]  = *c++ & 0x7;
+
+	for (i = 0; i < 4; i++) {
+		word	* x = xmc + 13 * i;
+
+		Nc[i]     = (*c >> 1) & 0x7F;
+		bc[i]     = (*c++ & 0x1) << 1;
+		bc[i]    |= (*c >> 7) & 0x1;
+		Mc[i]     = (*c >> 5) & 0x3;
+		xmaxc[i]  = (*c++ & 0x1F) << 1;
+		xmaxc[i] |= (*c >> 7) & 0x1;
+		x[0]      = (*c >> 4) & 0x7;
+		x[1]      = (*c >> 1) & 0x7;
+		x[2]      = (*c++ & 0x1) << 2;
+		x[2]     |= (*c >> 6) & 0x3;
+		x[3]      = (*c >> 3) & 0x7;
+		x[4]      = *c++ & 0x7;
+		x[5]      = (*c >> 5) & 0x7;
+		x[6]      = (*c >> 2) & 0x7;
+		x[7]      = (*c++ & 0x3) << 1;
+		x[7]     |= (*c >> 7) & 0x1;
+		x[8]      = (*c >> 4) & 0x7;
+		x[9]      = (*c >> 1) & 0x7;
+		x[10]     = (*c++ & 0x1) << 2;
+		x[10]    |= (*c >> 6) & 0x3;
+		x[11]     = (*c >> 3) & 0x7;
+		x[12]     = *c++ & 0x7;
+	}
+
+	Gsm_Decoder(s, LARc, Nc, bc, Mc, xmaxc, xmc, target);
+
+	return 0;
+}
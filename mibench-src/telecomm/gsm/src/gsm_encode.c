@@ -0,0 +1,63 @@
+/*
+ * Copyright 1992 by Jutta Degener and Carsten Bormann, Technische
+ * Universitaet Berlin.  See the accompanying file "COPYRIGHT" for
+ * details.  THERE IS ABSOLUTELY NO WARRANTY FOR THIS SOFTWARE.
+ */
+
+#include "private.h"
+#include "gsm.h"
+
+void gsm_encode (gsm s, gsm_signal * source, gsm_byte * c)
+{
+	word	 	LARc[8], Nc[4], Mc[4], bc[4], xmaxc[4], xmc[13*4];
+	int		i;
+
+	Gsm_Coder(s, source, LARc, Nc, bc, Mc, xmaxc, xmc);
+
+
+	/*  The frame is the magic number, the eight LARs and the four
+	 *  sub-frames, each field MSB first without padding:
+	 *  LARc[0..7] take 6, 6, 5, 5, 4, 4, 3 and 3 bits, and each
+	 *  sub-frame Nc 7, bc 2, Mc 2, xmaxc 6 and xmc[0..12] 3 bits.
+	 */
+
+	*c++ =   ((GSM_MAGIC & 0xF) << 4)		/* 1 */
+	       | ((LARc[0] >> 2) & 0xF);
+	*c++ =   ((LARc[0] & 0x3) << 6)
+	       | (LARc[1] & 0x3F);
+	*c++ =   ((LARc[2] & 0x1F) << 3)
+	       | ((LARc[3] >> 2) & 0x7);
+	*c++ =   ((LARc[3] & 0x3) << 6)
+	       | ((LARc[4] & 0xF) << 2)
+	       | ((LARc[5] >> 2) & 0x3);
+	*c++ =   ((LARc[5] & 0x3) << 6)
+	       | ((LARc[6] & 0x7) << 3)
+	       | (LARc[7] & 0x7);
+
+	for (i = 0; i < 4; i++) {
+		word	* x = xmc + 13 * i;
+
+		*c++ =   ((Nc[i] & 0x7F) << 1)
+		       | ((bc[i] >> 1) & 0x1);
+		*c++ =   ((bc[i] & 0x1) << 7)
+		       | ((Mc[i] & 0x3) << 5)
+		       | ((xmaxc[i] >> 1) & 0x1F);
+		*c++ =   ((xmaxc[i] & 0x1) << 7)
+		       | ((x[0] & 0x7) << 4)
+		       | ((x[1] & 0x7) << 1)
+		       | ((x[2] >> 2) & 0x1);
+		*c++ =   ((x[2] & 0x3) << 6)
+		       | ((x[3] & 0x7) << 3)
+		       | (x[4] & 0x7);
+		*c++ =   ((x[5] & 0x7) << 5)
+		       | ((x[6] & 0x7) << 2)
+		       | ((x[7] >> 1) & 0x3);
+		*c++ =   ((x[7] & 0x1) << 7)
+		       | ((x[8] & 0x7) << 4)
+		       | ((x[9] & 0x7) << 1)
+		       | ((x[10] >> 2) & 0x1);
+		*c++ =   ((x[10] & 0x3) << 6)
+		       | ((x[11] & 0x7) << 3)
+		       | (x[12] & 0x7);
+	}
+}
@@ -0,0 +1,45 @@
+/*
+ * Stand-in for the toast and untoast drivers of the MiBench gsm benchmark,
+ * which read and write Sun audio files. This one codes raw 16-bit native
+ * PCM at 8 kHz: toast < pcm > gsm, and toast -d < gsm > pcm. The last frame
+ * is padded with silence, as toast does.
+ */
+
+#include	<stdio.h>
+#include	<string.h>
+
+#include	"gsm.h"
+
+int main (int argc, char ** argv)
+{
+	gsm		r;
+	gsm_signal	s[160];
+	gsm_frame	f;
+	size_t		n;
+	int		decode = argc > 1 && !strcmp(argv[1], "-d");
+
+	if (!(r = gsm_create())) {
+		perror("gsm_create");
+		return 1;
+	}
+
+	if (decode) {
+		while (fread(f, sizeof(f), 1, stdin) == 1) {
+			if (gsm_decode(r, f, s)) {
+				fprintf(stderr, "toast: bad frame\n");
+				return 1;
+			}
+			fwrite(s, sizeof(s), 1, stdout);
+		}
+	} else {
+		while ((n = fread(s, sizeof(*s), 160, stdin)) > 0) {
+			if (n < 160)
+				memset(s + n, 0, (160 - n) * sizeof(*s));
+			gsm_encode(r, s, f);
+			fwrite(f, sizeof(f), 1, stdout);
+		}
+	}
+
+	gsm_destroy(r);
+	return 0;
+}
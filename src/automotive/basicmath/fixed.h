@@ -0,0 +1,190 @@
+#ifndef _BASICMATH_FIXED_H
+#define _BASICMATH_FIXED_H
+
+/* Q16.16 fixed-point backend of basicmath
+ *
+ * Intermediate products and quotients are 64-bit, so the only library calls
+ * are the integer multiply and divide helpers. Ranges are sufficient for the
+ * coefficients in basicmath_small.c (|R|, Q^3 < 2^15).
+ */
+
+#include <stdint.h>
+
+typedef int32_t fx_t;
+
+#define FX_FRAC_BITS 16
+#define FX_ONE (1L << FX_FRAC_BITS)
+
+/* Conversion of constants, rounded to nearest */
+#define FX(x) ((fx_t)((x) * 65536.0 + ((x) >= 0 ? 0.5 : -0.5)))
+#define FX_INT(n) ((fx_t)(n) << FX_FRAC_BITS)
+
+#define FX_PI       FX(3.14159265358979323846)
+#define FX_HALF_PI  FX(1.57079632679489661923)
+#define FX_TWO_PI   FX(6.28318530717958647692)
+
+static inline fx_t fx_mul(fx_t a, fx_t b)
+{
+    return (fx_t)(((int64_t)a * b) >> FX_FRAC_BITS);
+}
+
+static inline fx_t fx_div(fx_t a, fx_t b)
+{
+    return (fx_t)(((int64_t)a << FX_FRAC_BITS) / b);
+}
+
+static inline fx_t fx_abs(fx_t a)
+{
+    return a < 0 ? -a : a;
+}
+
+/** @brief Bitwise integer square root with fractional bits
+ *  @details Returns floor(sqrt(x) * 2^frac_bits), for frac_bits <= 16.
+ *           The algorithm of ISQRT.C, extended past the integer part.
+ */
+static inline uint32_t isqrt_frac(uint32_t x, unsigned frac_bits)
+{
+    uint32_t a = 0;     // accumulator
+    uint32_t r = 0;     // remainder
+    uint32_t e = 0;     // trial product
+    unsigned i;
+
+    for (i = 0; i < 16 + frac_bits; i++) {
+        r = (r << 2) + (x >> 30);
+        x <<= 2;
+        a <<= 1;
+        e = (a << 1) + 1;
+        if (r >= e) {
+            r -= e;
+            a++;
+        }
+    }
+    return a;
+}
+
+/* sqrt(x / 2^16) * 2^16 = sqrt(x) * 2^8 */
+static inline fx_t fx_sqrt(fx_t x)
+{
+    if (x <= 0)
+        return 0;
+    return (fx_t)isqrt_frac((uint32_t)x, FX_FRAC_BITS / 2);
+}
+
+/** @brief Cube root of a positive number, by Newton's method
+ *  @details The initial guess is 2^(e/3) for x ~ 2^e, so a few iterations
+ *           converge to the last bit.
+ */
+static inline fx_t fx_cbrt(fx_t x)
+{
+    fx_t y, prev;
+    int e = -FX_FRAC_BITS;
+    unsigned i;
+
+    if (x <= 0)
+        return 0;
+
+    for (y = x; y > 1; y >>= 1)
+        ++e;
+    y = (e >= 0) ? FX_ONE << (e / 3) : FX_ONE >> (-e / 3);
+
+    for (i = 0; i < 8; ++i) {
+        prev = y;
+        y = (2 * y + fx_div(x, fx_mul(y, y))) / 3;
+        if (y == prev)
+            break;
+    }
+    return y;
+}
+
+/** @brief Cosine, by Taylor series on [0, pi/2]
+ *  @details Error below 3e-5, about two units in the last place.
+ */
+static inline fx_t fx_cos(fx_t x)
+{
+    fx_t x2, c;
+    int negate = 0;
+
+    x %= FX_TWO_PI;
+    if (x > FX_PI)
+        x -= FX_TWO_PI;
+    else if (x < -FX_PI)
+        x += FX_TWO_PI;
+    x = fx_abs(x);
+    if (x > FX_HALF_PI) {
+        x = FX_PI - x;
+        negate = 1;
+    }
+
+    x2 = fx_mul(x, x);
+    c = FX(1.0 / 40320);
+    c = FX(-1.0 / 720) + fx_mul(x2, c);
+    c = FX(1.0 / 24) + fx_mul(x2, c);
+    c = FX(-1.0 / 2) + fx_mul(x2, c);
+    c = FX_ONE + fx_mul(x2, c);
+
+    return negate ? -c : c;
+}
+
+/** @brief Arc cosine on [-1, 1]
+ *  @details Abramowitz and Stegun 4.4.45, error below 7e-5.
+ */
+static inline fx_t fx_acos(fx_t x)
+{
+    fx_t p, ax;
+
+    if (x > FX_ONE)
+        x = FX_ONE;
+    else if (x < -FX_ONE)
+        x = -FX_ONE;
+    ax = fx_abs(x);
+
+    p = FX(-0.0187293);
+    p = FX(0.0742610) + fx_mul(ax, p);
+    p = FX(-0.2121144) + fx_mul(ax, p);
+    p = FX(1.5707288) + fx_mul(ax, p);
+    p = fx_mul(fx_sqrt(FX_ONE - ax), p);
+
+    return (x < 0) ? FX_PI - p : p;
+}
+
+/** @brief Solve a cubic polynomial (CUBIC.C by Ross Cottrell, in Q16.16) */
+static inline void fx_solve_cubic(fx_t a, fx_t b, fx_t c, fx_t d,
+                                  int *solutions, fx_t *x)
+{
+    fx_t a1 = fx_div(b, a), a2 = fx_div(c, a), a3 = fx_div(d, a);
+    fx_t a1_3 = a1 / 3;
+    fx_t Q = (fx_mul(a1, a1) - 3 * a2) / 9;
+    fx_t R = (fx_t)(((int64_t)2 * fx_mul(fx_mul(a1, a1), a1) -
+                     (int64_t)9 * fx_mul(a1, a2) + (int64_t)27 * a3) / 54);
+    fx_t Q3 = fx_mul(fx_mul(Q, Q), Q);
+    fx_t R2_Q3 = fx_mul(R, R) - Q3;
+    fx_t theta, sq;
+
+    if (R2_Q3 <= 0) {
+        *solutions = 3;
+        theta = (Q3 > 0) ? fx_acos(fx_div(R, fx_sqrt(Q3))) : FX_HALF_PI;
+        sq = 2 * fx_sqrt(Q);
+        x[0] = -fx_mul(sq, fx_cos(theta / 3)) - a1_3;
+        x[1] = -fx_mul(sq, fx_cos((theta + FX_TWO_PI) / 3)) - a1_3;
+        x[2] = -fx_mul(sq, fx_cos((theta + 2 * FX_TWO_PI) / 3)) - a1_3;
+    } else {
+        *solutions = 1;
+        x[0] = fx_cbrt(fx_sqrt(R2_Q3) + fx_abs(R));
+        x[0] += fx_div(Q, x[0]);
+        x[0] = (R < 0) ? x[0] : -x[0];
+        x[0] -= a1_3;
+    }
+}
+
+/* RAD2DEG.C, with the same order of operations */
+static inline fx_t fx_rad2deg(fx_t rad)
+{
+    return fx_div(180 * rad, FX_PI);
+}
+
+static inline fx_t fx_deg2rad(fx_t deg)
+{
+    return fx_mul(FX_PI, deg) / 180;
+}
+
+#endif // _BASICMATH_FIXED_H
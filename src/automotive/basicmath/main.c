@@ -0,0 +1,413 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+#include <libwispbase/wisp-base.h>
+
+#include "pin_assign.h"
+#include "fixed.h"
+
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+/* Workload of basicmath_small.c */
+#define NUM_CUBIC_FIXED 4
+#define NUM_CUBIC_LOOP (9 * 10 * 20 * 10)  // a, b, c, d in the nested loops
+#define NUM_USQRT (USQRT_LIMIT + 2)        // 0..USQRT_LIMIT and 0x3fed0169
+#define NUM_ANGLES 361                     // 0..360 degrees, 0..2pi radians
+
+// Largest integer whose square root is taken (MiBench: 1000 small)
+#ifndef USQRT_LIMIT
+#define USQRT_LIMIT 1000
+#endif
+
+// Operations per task execution
+#define CUBIC_BLOCK 4
+#define USQRT_BLOCK 32
+#define ANGLE_BLOCK 32
+
+uint8_t usrBank[USRBANK_SIZE];
+
+volatile unsigned work_x;
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/* Backend: soft-float double (default) or Q16.16 fixed point. Results are
+ * summed in thousandths in both, so that they can be compared. */
+#ifdef BASICMATH_FIXED
+
+typedef fx_t real_t;
+#define REAL(x)             FX(x)
+#define REAL_INT(n)         FX_INT(n)
+#define REAL_TO_MILLI(x)    ((int32_t)(((int64_t)(x) * 1000) >> FX_FRAC_BITS))
+#define BACKEND_NAME        "Q16.16 fixed point"
+
+#define solve_cubic fx_solve_cubic
+#define deg2rad fx_deg2rad
+#define rad2deg fx_rad2deg
+
+#else // !BASICMATH_FIXED
+
+#include <math.h>
+
+typedef double real_t;
+#define REAL(x)             (x)
+#define REAL_INT(n)         ((double)(n))
+#define REAL_TO_MILLI(x)    ((int32_t)((x) * 1000.0))
+#define BACKEND_NAME        "soft-float double"
+
+#define PI 3.14159265358979323846
+
+/* CUBIC.C - Solve a cubic polynomial, public domain by Ross Cottrell */
+static void solve_cubic(double a, double b, double c, double d,
+                        int *solutions, double *x)
+{
+    long double a1 = b/a, a2 = c/a, a3 = d/a;
+    long double Q = (a1*a1 - 3.0*a2)/9.0;
+    long double R = (2.0*a1*a1*a1 - 9.0*a1*a2 + 27.0*a3)/54.0;
+    double R2_Q3 = R*R - Q*Q*Q;
+    double theta;
+
+    if (R2_Q3 <= 0) {
+        *solutions = 3;
+        theta = acos(R/sqrt(Q*Q*Q));
+        x[0] = -2.0*sqrt(Q)*cos(theta/3.0) - a1/3.0;
+        x[1] = -2.0*sqrt(Q)*cos((theta+2.0*PI)/3.0) - a1/3.0;
+        x[2] = -2.0*sqrt(Q)*cos((theta+4.0*PI)/3.0) - a1/3.0;
+    } else {
+        *solutions = 1;
+        x[0] = pow(sqrt(R2_Q3)+fabs(R), 1/3.0);
+        x[0] += Q/x[0];
+        x[0] *= (R < 0.0) ? 1 : -1;
+        x[0] -= a1/3.0;
+    }
+}
+
+/* RAD2DEG.C - Functions to convert between radians and degrees */
+static double rad2deg(double rad)
+{
+    return (180.0 * rad / (PI));
+}
+
+static double deg2rad(double deg)
+{
+    return (PI * deg / 180.0);
+}
+
+#endif // !BASICMATH_FIXED
+
+/* The cubics solved before the loop in basicmath_small.c */
+__ro_nv static const real_t cubic_fixed[NUM_CUBIC_FIXED][4] = {
+    { REAL(1.0), REAL(-10.5), REAL(32.0), REAL(-30.0) },
+    { REAL(1.0), REAL(-4.5),  REAL(17.0), REAL(-30.0) },
+    { REAL(1.0), REAL(-3.5),  REAL(22.0), REAL(-31.0) },
+    { REAL(1.0), REAL(-13.7), REAL(1.0),  REAL(-35.0) },
+};
+
+/* Integer square root (ISQRT.C), returns floor(sqrt(x) * 2^16). Integer-only,
+ * so the same in both backends. */
+#define usqrt(x) isqrt_frac(x, 16)
+
+/* Names of the operations, in the order of the tasks */
+#define NUM_OPS 5
+__ro_nv static const char * const op_names[NUM_OPS] = {
+    "cubic (fixed)",
+    "cubic (loop)",
+    "usqrt",
+    "deg2rad",
+    "rad2deg",
+};
+
+__ro_nv static const unsigned op_counts[NUM_OPS] = {
+    NUM_CUBIC_FIXED,
+    NUM_CUBIC_LOOP,
+    NUM_USQRT,
+    NUM_ANGLES,
+    NUM_ANGLES,
+};
+
+TASK(1, task_init)
+TASK(2, task_cubic_fixed)
+TASK(3, task_cubic_loop)
+TASK(4, task_usqrt)
+TASK(5, task_deg2rad)
+TASK(6, task_rad2deg)
+TASK(7, task_done)
+TASK(8, task_end)
+
+/* Initial state of an operation task */
+struct op_args {
+    CHAN_FIELD(unsigned, i);
+    CHAN_FIELD(int32_t, sum);
+};
+
+/* Progress of an operation task, saved after each block */
+struct op_state {
+    SELF_CHAN_FIELD(unsigned, i);
+    SELF_CHAN_FIELD(int32_t, sum);
+    SELF_CHAN_FIELD(uint32_t, start);
+};
+
+#define FIELD_INIT_op_state {\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER\
+}
+
+/* Result of an operation task: sum of the results and cycles taken */
+struct op_result {
+    CHAN_FIELD(int32_t, sum);
+    CHAN_FIELD(uint32_t, cycles);
+};
+
+#define OP_CHANNELS(task) \
+    CHANNEL(task_init, task, op_args); \
+    SELF_CHANNEL(task, op_state); \
+    CHANNEL(task, task_done, op_result)
+
+OP_CHANNELS(task_cubic_fixed);
+OP_CHANNELS(task_cubic_loop);
+OP_CHANNELS(task_usqrt);
+OP_CHANNELS(task_deg2rad);
+OP_CHANNELS(task_rad2deg);
+
+/* Results of deg2rad, the inputs of rad2deg, so that the rad2deg loop does
+ * not convert its input back first. Each angle is written from its index
+ * only, so re-executing a block writes the same values. */
+__nv static real_t angle_rad[NUM_ANGLES];
+
+/** @brief Load the progress of an operation task
+ *  @details The cycle count starts when the task first runs, so it holds
+ *           only on continuous power.
+ */
+#define OP_BEGIN(task, i, sum, start) \
+    do { \
+        i = *CHAN_IN2(unsigned, i, CH(task_init, task), SELF_IN_CH(task)); \
+        sum = *CHAN_IN2(int32_t, sum, CH(task_init, task), SELF_IN_CH(task)); \
+        if (i == 0) { \
+            start = msp_cycles(); \
+            CHAN_OUT1(uint32_t, start, start, SELF_OUT_CH(task)); \
+        } else { \
+            start = *CHAN_IN1(uint32_t, start, SELF_IN_CH(task)); \
+        } \
+    } while (0)
+
+/** @brief Save the progress, or output the result and move on when done */
+#define OP_END(task, i, count, sum, start, next_task) \
+    do { \
+        if (i < count) { \
+            CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task)); \
+            CHAN_OUT1(int32_t, sum, sum, SELF_OUT_CH(task)); \
+            TRANSITION_TO(task); \
+        } \
+        start = msp_cycles() - start; \
+        CHAN_OUT1(int32_t, sum, sum, CH(task, task_done)); \
+        CHAN_OUT1(uint32_t, cycles, start, CH(task, task_done)); \
+        TRANSITION_TO(next_task); \
+    } while (0)
+
+static int32_t sum_solutions(int solutions, const real_t *x)
+{
+    int32_t sum = 0;
+    int k;
+
+    for (k = 0; k < solutions; k++)
+        sum += REAL_TO_MILLI(x[k]);
+    return sum;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %s\r\n", BACKEND_NAME);
+
+    unsigned i = 0;
+    int32_t sum = 0;
+
+    CHAN_OUT5(unsigned, i, i, CH(task_init, task_cubic_fixed),
+              CH(task_init, task_cubic_loop), CH(task_init, task_usqrt),
+              CH(task_init, task_deg2rad), CH(task_init, task_rad2deg));
+    CHAN_OUT5(int32_t, sum, sum, CH(task_init, task_cubic_fixed),
+              CH(task_init, task_cubic_loop), CH(task_init, task_usqrt),
+              CH(task_init, task_deg2rad), CH(task_init, task_rad2deg));
+    TRANSITION_TO(task_cubic_fixed);
+}
+
+void task_cubic_fixed() {
+    task_prologue();
+
+    unsigned i;
+    int32_t sum;
+    uint32_t start;
+    real_t x[3];
+    int solutions;
+
+    OP_BEGIN(task_cubic_fixed, i, sum, start);
+
+    const real_t *coef = cubic_fixed[i];
+    solve_cubic(coef[0], coef[1], coef[2], coef[3], &solutions, x);
+    sum += sum_solutions(solutions, x);
+    i++;
+
+    OP_END(task_cubic_fixed, i, NUM_CUBIC_FIXED, sum, start, task_cubic_loop);
+}
+
+/* The nested loops of basicmath_small.c, flattened:
+ *   a = 1..9, b = 10..1, c = 5..14.5 in steps of 0.5, d = -1..-10 */
+void task_cubic_loop() {
+    task_prologue();
+
+    unsigned i, end, n;
+    int32_t sum;
+    uint32_t start;
+    real_t a, b, c, d, x[3];
+    int solutions;
+
+    OP_BEGIN(task_cubic_loop, i, sum, start);
+
+    end = i + CUBIC_BLOCK;
+    if (end > NUM_CUBIC_LOOP)
+        end = NUM_CUBIC_LOOP;
+    for ( ; i < end; i++) {
+        n = i;
+        d = -REAL_INT(1 + n % 10);
+        n /= 10;
+        c = REAL_INT(5) + REAL_INT(n % 20) / 2;
+        n /= 20;
+        b = REAL_INT(10 - n % 10);
+        n /= 10;
+        a = REAL_INT(1 + n);
+
+        solve_cubic(a, b, c, d, &solutions, x);
+        sum += sum_solutions(solutions, x);
+    }
+
+    OP_END(task_cubic_loop, i, NUM_CUBIC_LOOP, sum, start, task_usqrt);
+}
+
+void task_usqrt() {
+    task_prologue();
+
+    unsigned i, end;
+    int32_t sum;
+    uint32_t start, x;
+
+    OP_BEGIN(task_usqrt, i, sum, start);
+
+    end = i + USQRT_BLOCK;
+    if (end > NUM_USQRT)
+        end = NUM_USQRT;
+    for ( ; i < end; i++) {
+        x = (i < NUM_USQRT - 1) ? i : 0x3fed0169UL;
+        sum += usqrt(x) >> 16; // integer part, as printed by MiBench
+    }
+
+    OP_END(task_usqrt, i, NUM_USQRT, sum, start, task_deg2rad);
+}
+
+void task_deg2rad() {
+    task_prologue();
+
+    unsigned i, end;
+    int32_t sum;
+    uint32_t start;
+
+    OP_BEGIN(task_deg2rad, i, sum, start);
+
+    end = i + ANGLE_BLOCK;
+    if (end > NUM_ANGLES)
+        end = NUM_ANGLES;
+    for ( ; i < end; i++) {
+        real_t rad = deg2rad(REAL_INT(i));
+        angle_rad[i] = rad;
+        sum += REAL_TO_MILLI(rad);
+    }
+
+    OP_END(task_deg2rad, i, NUM_ANGLES, sum, start, task_rad2deg);
+}
+
+void task_rad2deg() {
+    task_prologue();
+
+    unsigned i, end;
+    int32_t sum;
+    uint32_t start;
+
+    OP_BEGIN(task_rad2deg, i, sum, start);
+
+    // MiBench steps by pi/180 from 0 to 2pi, i.e. the angles of deg2rad
+    end = i + ANGLE_BLOCK;
+    if (end > NUM_ANGLES)
+        end = NUM_ANGLES;
+    for ( ; i < end; i++)
+        sum += REAL_TO_MILLI(rad2deg(angle_rad[i]));
+
+    OP_END(task_rad2deg, i, NUM_ANGLES, sum, start, task_done);
+}
+
+/* Prints cycles per operation and the sum of the results (in thousandths) */
+void task_done() {
+    task_prologue();
+
+    int32_t sum[NUM_OPS];
+    uint32_t cycles[NUM_OPS];
+    unsigned i;
+
+    sum[0] = *CHAN_IN1(int32_t, sum, CH(task_cubic_fixed, task_done));
+    sum[1] = *CHAN_IN1(int32_t, sum, CH(task_cubic_loop, task_done));
+    sum[2] = *CHAN_IN1(int32_t, sum, CH(task_usqrt, task_done));
+    sum[3] = *CHAN_IN1(int32_t, sum, CH(task_deg2rad, task_done));
+    sum[4] = *CHAN_IN1(int32_t, sum, CH(task_rad2deg, task_done));
+
+    cycles[0] = *CHAN_IN1(uint32_t, cycles, CH(task_cubic_fixed, task_done));
+    cycles[1] = *CHAN_IN1(uint32_t, cycles, CH(task_cubic_loop, task_done));
+    cycles[2] = *CHAN_IN1(uint32_t, cycles, CH(task_usqrt, task_done));
+    cycles[3] = *CHAN_IN1(uint32_t, cycles, CH(task_deg2rad, task_done));
+    cycles[4] = *CHAN_IN1(uint32_t, cycles, CH(task_rad2deg, task_done));
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+
+    PRINTF("basicmath (%s): op count cycles/op sum(1e-3)\r\n", BACKEND_NAME);
+    for (i = 0; i < NUM_OPS; ++i) {
+        PRINTF("%s %u %n %l\r\n", op_names[i], op_counts[i],
+               cycles[i] / op_counts[i], sum[i]);
+    }
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
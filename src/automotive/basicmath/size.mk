@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): largest integer
+# whose square root is taken. The cubics and the angles are as in MiBench.
+SIZE_small = 250
+SIZE_medium = 1000
+SIZE_large = 4000
+SIZE_CFLAGS = -DUSQRT_LIMIT=$(SIZE_N)
@@ -1,7 +1,10 @@
 #include <msp430.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
 #include <libchain/chain.h>
 #include <libwispbase/wisp-base.h>
 
@@ -9,9 +12,19 @@
 
 
 #define WAIT_TICK_DURATION_ITERS 300000
-#define NUM_VALS 8
 #define SEED 4
 
+// Calls to each counting function (MiBench: 75000 small, 1125000 large)
+#ifndef ITERATIONS
+#define ITERATIONS 75000
+#endif
+
+// Calls per execution of a counting task: the unit of work that is lost on
+// a power failure, and between which the progress is saved to channels
+#define ITERS_PER_TASK 64
+
+#define NUM_FUNCS 7
+
 uint8_t usrBank[USRBANK_SIZE];
 
 volatile unsigned work_x;
@@ -21,31 +34,218 @@ static void burn(uint32_t iters) {
         work_x++;
 }
 
+/* Bits set in each byte value (bitcnt_3.c, bitcnt_4.c) */
+__ro_nv static const uint8_t bits[256] =
+{
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,  /* 0   - 15  */
+      1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,  /* 16  - 31  */
+      1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,  /* 32  - 47  */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 48  - 63  */
+      1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,  /* 64  - 79  */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 80  - 95  */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 96  - 111 */
+      3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,  /* 112 - 127 */
+      1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,  /* 128 - 143 */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 144 - 159 */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 160 - 175 */
+      3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,  /* 176 - 191 */
+      2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,  /* 192 - 207 */
+      3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,  /* 208 - 223 */
+      3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,  /* 224 - 239 */
+      4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8   /* 240 - 255 */
+};
+
+/* The counting functions from MiBench, on 32-bit values ('long' there) */
+
+/* Optimized 1 bit/loop counter (bitcnt_1.c) */
+static unsigned bit_count(uint32_t x)
+{
+    unsigned n = 0;
+
+    if (x) do
+        n++;
+    while (0 != (x = x & (x - 1)));
+    return n;
+}
+
+/* Ratko's mystery algorithm (bitcnt_2.c) */
+static unsigned bitcount(uint32_t i)
+{
+    i = ((i & 0xAAAAAAAAUL) >>  1) + (i & 0x55555555UL);
+    i = ((i & 0xCCCCCCCCUL) >>  2) + (i & 0x33333333UL);
+    i = ((i & 0xF0F0F0F0UL) >>  4) + (i & 0x0F0F0F0FUL);
+    i = ((i & 0xFF00FF00UL) >>  8) + (i & 0x00FF00FFUL);
+    i = ((i & 0xFFFF0000UL) >> 16) + (i & 0x0000FFFFUL);
+    return (unsigned)i;
+}
+
+/* Recursive bit count by nybbles (bitcnt_4.c) */
+static unsigned ntbl_bitcnt(uint32_t x)
+{
+    unsigned cnt = bits[(unsigned)(x & 0x0000000FUL)];
+
+    if (0 != (x >>= 4))
+        cnt += ntbl_bitcnt(x);
+    return cnt;
+}
+
+/* Non-recursive bit count by nybbles (bitcnt_3.c) */
+static unsigned ntbl_bitcount(uint32_t x)
+{
+    return
+        bits[(unsigned) (x & 0x0000000FUL)       ] +
+        bits[(unsigned)((x & 0x000000F0UL) >> 4) ] +
+        bits[(unsigned)((x & 0x00000F00UL) >> 8) ] +
+        bits[(unsigned)((x & 0x0000F000UL) >> 12)] +
+        bits[(unsigned)((x & 0x000F0000UL) >> 16)] +
+        bits[(unsigned)((x & 0x00F00000UL) >> 20)] +
+        bits[(unsigned)((x & 0x0F000000UL) >> 24)] +
+        bits[(unsigned)((x & 0xF0000000UL) >> 28)];
+}
+
+/* Non-recursive bit count by bytes, by Bruce Wedding (bitcnt_3.c) */
+static unsigned BW_btbl_bitcount(uint32_t x)
+{
+    union
+    {
+        uint8_t ch[4];
+        uint32_t y;
+    } U;
+
+    U.y = x;
+    return bits[U.ch[0]] + bits[U.ch[1]] +
+           bits[U.ch[3]] + bits[U.ch[2]];
+}
+
+/* Non-recursive bit count by bytes, by Auke Reitsma (bitcnt_3.c) */
+static unsigned AR_btbl_bitcount(uint32_t x)
+{
+    uint8_t *ptr = (uint8_t *)&x;
+    unsigned accu;
+
+    accu  = bits[*ptr++];
+    accu += bits[*ptr++];
+    accu += bits[*ptr++];
+    accu += bits[*ptr];
+    return accu;
+}
 
-struct bit_vals {
-    CHAN_FIELD_ARRAY(unsigned, vals, NUM_VALS);
-    CHAN_FIELD_ARRAY(unsigned, results, NUM_VALS);
-    CHAN_FIELD(unsigned, index);
+/* Shift and count bits (bitcnts.c) */
+static unsigned bit_shifter(uint32_t x)
+{
+    unsigned i, n;
+
+    for (i = n = 0; x && (i < sizeof(x) * 8); ++i, x >>= 1)
+        n += (unsigned)(x & 1);
+    return n;
+}
+
+/* Descriptions, in the order of the counting tasks */
+__ro_nv static const char * const func_names[NUM_FUNCS] = {
+    "Optimized 1 bit/loop counter",
+    "Ratko's mystery algorithm",
+    "Recursive bit count by nybbles",
+    "Non-recursive bit count by nybbles",
+    "Non-recursive bit count by bytes (BW)",
+    "Non-recursive bit count by bytes (AR)",
+    "Shift and count bits",
 };
 
-struct init_i {
-    SELF_CHAN_FIELD(unsigned, index);
+/* Initial state of a counting task: seed = rand() */
+struct count_args {
+    CHAN_FIELD(uint32_t, iter);
+    CHAN_FIELD(uint32_t, seed);
+    CHAN_FIELD(uint32_t, n);
 };
 
-#define FIELD_INIT_init_i {\
+/* Progress of a counting task, saved after each block of iterations */
+struct count_state {
+    SELF_CHAN_FIELD(uint32_t, iter);
+    SELF_CHAN_FIELD(uint32_t, seed);
+    SELF_CHAN_FIELD(uint32_t, n);
+    SELF_CHAN_FIELD(uint32_t, start);
+};
+
+#define FIELD_INIT_count_state {\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER,\
     SELF_FIELD_INITIALIZER\
 }
 
-CHANNEL(pre_init, task_init, init_i);
-CHANNEL(task_init, task_bitcount, bit_vals);
-SELF_CHANNEL(task_bitcount, init_i);
-SELF_CHANNEL(task_init, init_i);
+/* Result of a counting task: total bits counted and cycles taken */
+struct count_result {
+    CHAN_FIELD(uint32_t, n);
+    CHAN_FIELD(uint32_t, cycles);
+};
 
-TASK(1, pre_init)
-TASK(2, task_init)
+TASK(1, task_init)
+TASK(2, task_bit_count)
 TASK(3, task_bitcount)
-TASK(4, task_end)
+TASK(4, task_ntbl_bitcnt)
+TASK(5, task_ntbl_bitcount)
+TASK(6, task_BW_btbl_bitcount)
+TASK(7, task_AR_btbl_bitcount)
+TASK(8, task_bit_shifter)
+TASK(9, task_done)
+TASK(10, task_end)
 
+#define COUNT_CHANNELS(task) \
+    CHANNEL(task_init, task, count_args); \
+    SELF_CHANNEL(task, count_state); \
+    CHANNEL(task, task_done, count_result)
+
+COUNT_CHANNELS(task_bit_count);
+COUNT_CHANNELS(task_bitcount);
+COUNT_CHANNELS(task_ntbl_bitcnt);
+COUNT_CHANNELS(task_ntbl_bitcount);
+COUNT_CHANNELS(task_BW_btbl_bitcount);
+COUNT_CHANNELS(task_AR_btbl_bitcount);
+COUNT_CHANNELS(task_bit_shifter);
+
+/** @brief Body of a counting task
+ *  @details Makes the next ITERS_PER_TASK calls of MiBench's loop
+ *           'n += func(seed); seed += 13', then either loops to itself or,
+ *           after ITERATIONS calls, outputs the result and moves on to the
+ *           next counting task. The cycle count starts when the task first
+ *           runs, so it holds only on continuous power.
+ */
+#define COUNT_TASK(task, func, next_task) \
+void task() { \
+    task_prologue(); \
+    \
+    uint32_t iter, seed, n, start, end; \
+    \
+    iter = *CHAN_IN2(uint32_t, iter, CH(task_init, task), SELF_IN_CH(task)); \
+    seed = *CHAN_IN2(uint32_t, seed, CH(task_init, task), SELF_IN_CH(task)); \
+    n = *CHAN_IN2(uint32_t, n, CH(task_init, task), SELF_IN_CH(task)); \
+    \
+    if (iter == 0) { \
+        start = msp_cycles(); \
+        CHAN_OUT1(uint32_t, start, start, SELF_OUT_CH(task)); \
+    } else { \
+        start = *CHAN_IN1(uint32_t, start, SELF_IN_CH(task)); \
+    } \
+    \
+    end = iter + ITERS_PER_TASK; \
+    if (end > ITERATIONS) \
+        end = ITERATIONS; \
+    for ( ; iter < end; iter++, seed += 13) \
+        n += func(seed); \
+    \
+    if (iter < ITERATIONS) { \
+        CHAN_OUT1(uint32_t, iter, iter, SELF_OUT_CH(task)); \
+        CHAN_OUT1(uint32_t, seed, seed, SELF_OUT_CH(task)); \
+        CHAN_OUT1(uint32_t, n, n, SELF_OUT_CH(task)); \
+        TRANSITION_TO(task); \
+    } \
+    \
+    end = msp_cycles() - start; \
+    LOG(#func ": bits %n cycles %n\r\n", n, end); \
+    CHAN_OUT1(uint32_t, n, n, CH(task, task_done)); \
+    CHAN_OUT1(uint32_t, cycles, end, CH(task, task_done)); \
+    TRANSITION_TO(next_task); \
+}
 
 void init() {
     WISP_init();
@@ -62,65 +262,88 @@ void init() {
     INIT_CONSOLE();
 
     __enable_interrupt();
+    msp_cycles_start();
 
     LOG("main.c booted\r\n");
     srand(SEED);
 }
 
-void pre_init() {
-    task_prologue();
-    LOG("pre_init");
-    unsigned i = 0;
-    CHAN_OUT1(unsigned, index, i, CH(pre_init, task_init));
-    TRANSITION_TO(task_init);
-}
+#define INIT_COUNT_TASK(task) \
+    do { \
+        seed = (uint32_t)rand(); \
+        CHAN_OUT1(uint32_t, iter, zero, CH(task_init, task)); \
+        CHAN_OUT1(uint32_t, seed, seed, CH(task_init, task)); \
+        CHAN_OUT1(uint32_t, n, zero, CH(task_init, task)); \
+    } while (0)
 
+/* Draws the seed of each counting function, like MiBench does before each
+ * timed loop. rand() restarts from SEED on every boot, so re-executing this
+ * task after a power failure gives the same seeds. */
 void task_init() {
     task_prologue();
     LOG("init\r\n");
 
-    unsigned i;
-    i = *CHAN_IN2(unsigned, index, SELF_IN_CH(task_init),
-            CH(pre_init, task_init));
-
-    unsigned vals[NUM_VALS];
-    unsigned results[NUM_VALS];
-    for ( ; i < NUM_VALS; i++) {
-        vals[i] = (unsigned) rand();
-        results[i] = 0;
-        CHAN_OUT1(unsigned, index, i, SELF_OUT_CH(task_init));
-        CHAN_OUT1(unsigned, vals[i], vals[i], CH(task_init, task_bitcount));
-        CHAN_OUT1(unsigned, results[i], vals[i], CH(task_init, task_bitcount));
-        LOG("START %x:%x, %x\r\n", i, vals[i], results[i]);
-    }
-    i = 0;
-    CHAN_OUT1(unsigned, index, i, CH(task_init, task_bitcount));
-    TRANSITION_TO(task_bitcount);
+    uint32_t seed, zero = 0;
+
+    INIT_COUNT_TASK(task_bit_count);
+    INIT_COUNT_TASK(task_bitcount);
+    INIT_COUNT_TASK(task_ntbl_bitcnt);
+    INIT_COUNT_TASK(task_ntbl_bitcount);
+    INIT_COUNT_TASK(task_BW_btbl_bitcount);
+    INIT_COUNT_TASK(task_AR_btbl_bitcount);
+    INIT_COUNT_TASK(task_bit_shifter);
+
+    TRANSITION_TO(task_bit_count);
 }
 
-void task_bitcount() {
+COUNT_TASK(task_bit_count, bit_count, task_bitcount)
+COUNT_TASK(task_bitcount, bitcount, task_ntbl_bitcnt)
+COUNT_TASK(task_ntbl_bitcnt, ntbl_bitcnt, task_ntbl_bitcount)
+COUNT_TASK(task_ntbl_bitcount, ntbl_bitcount, task_BW_btbl_bitcount)
+COUNT_TASK(task_BW_btbl_bitcount, BW_btbl_bitcount, task_AR_btbl_bitcount)
+COUNT_TASK(task_AR_btbl_bitcount, AR_btbl_bitcount, task_bit_shifter)
+COUNT_TASK(task_bit_shifter, bit_shifter, task_done)
+
+/* Prints the table of bitcnts.c, with cycles instead of seconds */
+void task_done() {
     task_prologue();
-    unsigned i, val, count;
-    unsigned *vals, *results;
-    i = *CHAN_IN2(unsigned, index, CH(task_init, task_bitcount),
-            SELF_IN_CH(task_bitcount));
-    results = *CHAN_IN1(unsigned *, results, CH(task_init, task_bitcount));
-    for ( ; i < NUM_VALS; i++) {
-        count = 0;
-        val = *CHAN_IN1(unsigned, vals[i], CH(task_init, task_bitcount));
-        LOG("val %u=%x\r\n", i, val);
-        // Do the counting
-        if (val) {
-            do {
-                count++;
-                val = val & (val - 1);
-            } while (val);
-        }
-
-        results[i] = count;
-        CHAN_OUT1(unsigned, index, i, SELF_OUT_CH(task_bitcount));
-        LOG("END %x: %x\r\n", i, results[i]);
+
+    uint32_t n[NUM_FUNCS], cycles[NUM_FUNCS];
+    unsigned i, best = 0, worst = 0;
+
+    n[0] = *CHAN_IN1(uint32_t, n, CH(task_bit_count, task_done));
+    n[1] = *CHAN_IN1(uint32_t, n, CH(task_bitcount, task_done));
+    n[2] = *CHAN_IN1(uint32_t, n, CH(task_ntbl_bitcnt, task_done));
+    n[3] = *CHAN_IN1(uint32_t, n, CH(task_ntbl_bitcount, task_done));
+    n[4] = *CHAN_IN1(uint32_t, n, CH(task_BW_btbl_bitcount, task_done));
+    n[5] = *CHAN_IN1(uint32_t, n, CH(task_AR_btbl_bitcount, task_done));
+    n[6] = *CHAN_IN1(uint32_t, n, CH(task_bit_shifter, task_done));
+
+    cycles[0] = *CHAN_IN1(uint32_t, cycles, CH(task_bit_count, task_done));
+    cycles[1] = *CHAN_IN1(uint32_t, cycles, CH(task_bitcount, task_done));
+    cycles[2] = *CHAN_IN1(uint32_t, cycles, CH(task_ntbl_bitcnt, task_done));
+    cycles[3] = *CHAN_IN1(uint32_t, cycles, CH(task_ntbl_bitcount, task_done));
+    cycles[4] = *CHAN_IN1(uint32_t, cycles, CH(task_BW_btbl_bitcount, task_done));
+    cycles[5] = *CHAN_IN1(uint32_t, cycles, CH(task_AR_btbl_bitcount, task_done));
+    cycles[6] = *CHAN_IN1(uint32_t, cycles, CH(task_bit_shifter, task_done));
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+
+    PRINTF("Bit counter algorithm benchmark: %n iterations\r\n",
+           (unsigned long)ITERATIONS);
+    for (i = 0; i < NUM_FUNCS; ++i) {
+        PRINTF("%s > Cycles: %n; Bits: %n\r\n", func_names[i],
+               cycles[i], n[i]);
+        if (cycles[i] < cycles[best])
+            best = i;
+        if (cycles[i] > cycles[worst])
+            worst = i;
     }
+    PRINTF("Best  > %s\r\n", func_names[best]);
+    PRINTF("Worst > %s\r\n", func_names[worst]);
+
+    CHAIN_REPORT();
     TRANSITION_TO(task_end);
 }
 
@@ -133,5 +356,5 @@ void task_end() {
     TRANSITION_TO(task_end);
 }
 
-ENTRY_TASK(pre_init)
+ENTRY_TASK(task_init)
 INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): calls to each
+# counting function
+SIZE_small = 18750
+SIZE_medium = 75000
+SIZE_large = 300000
+SIZE_CFLAGS = -DITERATIONS=$(SIZE_N)
@@ -0,0 +1,20 @@
+#! /bin/bash
+#
+# Generate input_large.h from the first N vertices of MiBench's input file
+#
+# Usage: ./gen_input.sh [count] [input_large.dat] > input_large.h
+
+COUNT=${1:-2048}
+INPUT=${2:-../../../mibench-src/automotive/qsort/input_large.dat}
+
+awk -v count=$COUNT '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench qsort input_large.dat */"
+        print ""
+        print "#define NUM_VERTICES " count
+        print ""
+        print "__ro_nv static const vertex_t vertices[NUM_VERTICES] = {"
+    }
+    NR <= count { printf "    { %d, %d, %d },\n", $1, $2, $3 }
+    END { print "};" }
+' $INPUT
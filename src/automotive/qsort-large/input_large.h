@@ -0,0 +1,2054 @@
+/* Generated by gen_input.sh from MiBench qsort input_large.dat */
+
+#define NUM_VERTICES 2048
+
+__ro_nv static const vertex_t vertices[NUM_VERTICES] = {
+    { 1681692777, 846930886, 1804289383 },
+    { 424238335, 1957747793, 1714636915 },
+    { 596516649, 1649760492, 719885386 },
+    { 1350490027, 1025202362, 1189641421 },
+    { 2044897763, 1102520059, 783368690 },
+    { 1540383426, 1365180540, 1967513926 },
+    { 35005211, 1303455736, 304089172 },
+    { 1726956429, 294702567, 521595368 },
+    { 278722862, 861021530, 336465782 },
+    { 468703135, 2145174067, 233665123 },
+    { 1315634022, 1801979802, 1101513929 },
+    { 1125898167, 1369133069, 635723058 },
+    { 628175011, 2089018456, 1059961393 },
+    { 1653377373, 1131176229, 1656478042 },
+    { 608413784, 1914544919, 859484421 },
+    { 1973594324, 1734575198, 756898537 },
+    { 1129566413, 2038664370, 149798315 },
+    { 1424268980, 412776091, 184803526 },
+    { 137806862, 749241873, 1911759956 },
+    { 135497281, 982906996, 42999170 },
+    { 1937477084, 2084420925, 511702305 },
+    { 1159126505, 572660336, 1827336327 },
+    { 1100661313, 1632621729, 805750846 },
+    { 84353895, 1141616124, 1433925857 },
+    { 1998898814, 2001100545, 939819582 },
+    { 1585990364, 610515434, 1548233367 },
+    { 1477171087, 760313750, 1374344043 },
+    { 1889947178, 945117276, 356426808 },
+    { 491705403, 709393584, 1780695788 },
+    { 1474612399, 752392754, 1918502651 },
+    { 1411549676, 1264095060, 2053999932 },
+    { 1984210012, 943947739, 1843993368 },
+    { 1469348094, 1749698586, 855636226 },
+    { 463480570, 1036140795, 1956297539 },
+    { 317097467, 1975960378, 2040651434 },
+    { 927612902, 1376710097, 1892066601 },
+    { 1687926652, 603570492, 1330573317 },
+    { 485560280, 959997301, 660260756 },
+    { 1194953865, 593209441, 402724286 },
+    { 1947346619, 364228444, 894429689 },
+    { 1063958031, 270744729, 221558440 },
+    { 2007905771, 2114738097, 1633108117 },
+    { 1610120709, 822890675, 1469834481 },
+    { 498777856, 631704567, 791698927 },
+    { 327254586, 524872353, 1255179497 },
+    { 1703964683, 269455306, 1572276965 },
+    { 160051528, 1600028624, 352406219 },
+    { 1120048829, 112805732, 2040332871 },
+    { 1713258270, 515530019, 378409503 },
+    { 2077486715, 1409959708, 1573363368 },
+    { 200747796, 1631518149, 1373226340 },
+    { 168002245, 1117142618, 289700723 },
+    { 990892921, 439493451, 150122846 },
+    { 1622597488, 1231192379, 1760243555 },
+    { 2147469841, 338888228, 111537764 },
+    { 269441500, 1911165193, 438792350 },
+    { 1869470124, 116087764, 2142757034 },
+    { 1982275856, 8936987, 155324914 },
+    { 350322227, 387346491, 1275373743 },
+    { 1760281936, 1960709859, 841148365 },
+    { 1244316437, 1186452551, 771151432 },
+    { 213975407, 1476153275, 971899228 },
+    { 653468858, 1626276121, 1139901474 },
+    { 1884661237, 1239036029, 2130794395 },
+    { 76065818, 1350573793, 1605908235 },
+    { 1987231011, 1789366143, 1605894428 },
+    { 2103318776, 1784639529, 1875335928 },
+    { 2112255763, 1939964443, 1597322404 },
+    { 352118606, 1067854538, 1432114613 },
+    { 165344818, 1909002904, 1782436840 },
+    { 1351797369, 532670688, 1395235128 },
+    { 680466996, 1504569917, 492067917 },
+    { 159259470, 496987743, 706043324 },
+    { 1398295499, 480298490, 1359512183 },
+    { 601385644, 2086206725, 1096689772 },
+    { 243268139, 1544617505, 1172755590 },
+    { 2027907669, 1272469786, 1012502954 },
+    { 1820388464, 722308542, 968338082 },
+    { 740759355, 6939507, 933110197 },
+    { 502278611, 1789376348, 1285228804 },
+    { 1034949299, 1037127828, 1450573622 },
+    { 392035568, 1529195746, 654887343 },
+    { 889023311, 87755422, 1335354340 },
+    { 1369321801, 1447267605, 1494613810 },
+    { 1308044878, 396473730, 745425661 },
+    { 705178736, 1569229320, 1346811305 },
+    { 1977648522, 434248626, 1590079444 },
+    { 552473416, 1402586708, 1470503465 },
+    { 559412924, 188213258, 1143408282 },
+    { 201305624, 1473442062, 1884167637 },
+    { 1238433452, 776532036, 238962600 },
+    { 620145550, 1431419379, 1273911899 },
+    { 707900973, 619290071, 1665947468 },
+    { 7684930, 2113903881, 407487131 },
+    { 404158660, 711845894, 1776808933 },
+    { 1973387981, 2058657199, 937370163 },
+    { 260152959, 1501252996, 1642548899 },
+    { 1662739668, 824272813, 1472713773 },
+    { 1850952926, 1967681095, 2025187190 },
+    { 1176911340, 1704365084, 437116466 },
+    { 1953443376, 1943327684, 638422090 },
+    { 1237379107, 1069755936, 1876855542 },
+    { 1856669179, 588219756, 349517445 },
+    { 1823089412, 995706887, 1057418418 },
+    { 387451659, 625032172, 1065103348 },
+    { 298625210, 1562402336, 1469262009 },
+    { 1799878206, 1057467587, 1295166342 },
+    { 476667372, 382697713, 1555319301 },
+    { 296864819, 260401255, 1070575321 },
+    { 2001229904, 697517721, 774044599 },
+    { 1797073940, 1335939811, 1950955939 },
+    { 719346228, 1065311705, 1756915667 },
+    { 1307565984, 1414829150, 846811127 },
+    { 155789224, 324763920, 555996658 },
+    { 780821396, 1389867269, 231602422 },
+    { 195740084, 711645630, 619054081 },
+    { 1253207672, 2006811972, 917679292 },
+    { 1635905385, 1414647625, 570073850 },
+    { 1896306640, 337739299, 1046741222 },
+    { 446340713, 1111783898, 1343606042 },
+    { 1782280524, 915256190, 1197352298 },
+    { 700108581, 524688209, 846942590 },
+    { 2114937732, 1371499336, 1566288819 },
+    { 292218004, 1927495994, 726371155 },
+    { 1682085273, 11614769, 882160379 },
+    { 246247255, 630668850, 1662981776 },
+    { 105575579, 1548348142, 1858721860 },
+    { 1520223205, 2118421993, 964445884 },
+    { 1857962504, 1017679567, 452867621 },
+    { 822262754, 213801961, 201690613 },
+    { 1737518944, 1411154259, 648031326 },
+    { 114723506, 110613202, 282828202 },
+    { 1486222842, 1676902021, 982936784 },
+    { 1266235189, 255789528, 950390868 },
+    { 1277849958, 1137949908, 1242608872 },
+    { 1908518808, 653448036, 777210498 },
+    { 1309383303, 364686248, 1023457753 },
+    { 1280321648, 1329132133, 1129033333 },
+    { 150517567, 1781999754, 501772890 },
+    { 364319529, 1983690368, 212251746 },
+    { 1775473788, 484238046, 1034514500 },
+    { 1886086990, 767066249, 624549797 },
+    { 1415505363, 1750003033, 739273303 },
+    { 1671294892, 552910253, 78012497 },
+    { 661761152, 1795519125, 1344247686 },
+    { 1315209188, 425245975, 474613996 },
+    { 1679895436, 1448703729, 235649157 },
+    { 861543921, 430253414, 1545032460 },
+    { 496060028, 932026304, 677870460 },
+    { 332266748, 1144278050, 828388027 },
+    { 816504794, 31308902, 1192707556 },
+    { 1583571043, 655858699, 820697697 },
+    { 1186090428, 1395132002, 559301039 },
+    { 1739000681, 1473144500, 1974806403 },
+    { 1387036159, 669908538, 1498617647 },
+    { 1812282134, 1144522535, 12895151 },
+    { 1113502215, 1380171692, 1328104339 },
+    { 1543755629, 777720504, 860516127 },
+    { 328298285, 1455590964, 1722060049 },
+    { 1472576335, 136495343, 70636429 },
+    { 1503885238, 1329202900, 402903177 },
+    { 12260289, 2416949, 1219407971 },
+    { 1407392292, 561717988, 655495367 },
+    { 733053144, 389040743, 1841585795 },
+    { 1402961682, 1887658390, 1433102829 },
+    { 400000569, 1900553541, 672655340 },
+    { 1780172261, 1081174232, 337453826 },
+    { 410409117, 1941690360, 1450956042 },
+    { 1866000081, 1516266761, 847228023 },
+    { 2002495425, 1586903190, 1175526309 },
+    { 1184214677, 1989806367, 500618996 },
+    { 1186631626, 1061730690, 2004504234 },
+    { 1748349614, 1717226057, 2016764524 },
+    { 2137390358, 1411328205, 1276673168 },
+    { 1877565100, 696947386, 2009726312 },
+    { 1630634994, 1369602726, 1265204346 },
+    { 564325578, 1707056552, 1665204916 },
+    { 358532290, 1010528946, 1297893529 },
+    { 1874799051, 1857756970, 1708302647 },
+    { 1314218593, 885799631, 1426819080 },
+    { 1156541312, 1386418627, 1281830857 },
+    { 70788355, 1243439214, 318561886 },
+    { 1788014412, 1112720090, 1505193512 },
+    { 1051858969, 241909610, 1106059479 },
+    { 1748806355, 104152274, 1095966189 },
+    { 970925433, 1369356620, 826047641 },
+    { 530498338, 887077888, 309198987 },
+    { 1541027284, 37487770, 873524566 },
+    { 1251300606, 1745790417, 1232056856 },
+    { 2137100237, 1025125849, 959372260 },
+    { 1376035217, 159473059, 126107205 },
+    { 471990783, 478034945, 1282648518 },
+    { 1584710873, 1983228458, 1353436873 },
+    { 1826620483, 941804289, 993967637 },
+    { 1930772757, 2037770478, 2045826607 },
+    { 1152645729, 716334471, 1647149314 },
+    { 2039723618, 1025533459, 470591100 },
+    { 2077211388, 1899058025, 1001089438 },
+    { 1675518157, 983631233, 394633074 },
+    { 553160358, 1943003493, 1645933681 },
+    { 712633417, 2069110699, 1635550270 },
+    { 1190668363, 1204275569, 864101839 },
+    { 1026413173, 410228794, 1336092622 },
+    { 1968217462, 1404196431, 773319847 },
+    { 1858504292, 1302539390, 452456682 },
+    { 427355115, 802205057, 235745791 },
+    { 1452888574, 1272796157, 1388391521 },
+    { 1204462951, 126401947, 1280631491 },
+    { 40610537, 521035021, 1210359231 },
+    { 1983614030, 19485054, 738393740 },
+    { 1905241081, 1655035325, 1291554098 },
+    { 962033002, 371653516, 2004187516 },
+    { 1372261796, 1707746139, 1047372231 },
+    { 628974580, 333582338, 2073785404 },
+    { 1931513970, 786039021, 1894519218 },
+    { 586235379, 1021784812, 1605539862 },
+    { 1859031536, 262692685, 2032894977 },
+    { 1985433483, 1543324176, 1338299904 },
+    { 358984857, 606199759, 395279207 },
+    { 378469911, 1344593499, 435889744 },
+    { 2033505236, 488663950, 272020127 },
+    { 257675105, 345367818, 29777560 },
+    { 1965421244, 1392740049, 991810563 },
+    { 151519934, 1319041805, 216588711 },
+    { 937558955, 1066077375, 845563291 },
+    { 1959343768, 524133589, 629593614 },
+    { 74552805, 409544918, 1215828993 },
+    { 1617876982, 1747844822, 927376882 },
+    { 76593093, 2143124030, 765326717 },
+    { 1421186593, 431530126, 1124311574 },
+    { 1909850543, 703550253, 1502781486 },
+    { 107734713, 733327814, 1388803074 },
+    { 1500474762, 1725138377, 1646478179 },
+    { 672032919, 1941727088, 1464415775 },
+    { 1738110294, 639806732, 1615935710 },
+    { 114760235, 1269400346, 406011017 },
+    { 524305153, 337745691, 217871137 },
+    { 124666328, 1265122573, 292423943 },
+    { 120306710, 2030449291, 1910300925 },
+    { 551836836, 1007277217, 1986894018 },
+    { 1255387090, 362575055, 1260596963 },
+    { 1988714904, 1751378130, 1022963858 },
+    { 1566369633, 1250372661, 1130698571 },
+    { 1360613073, 567304789, 483689685 },
+    { 2000419805, 35756851, 1155722604 },
+    { 1122336503, 441767868, 746349250 },
+    { 1460082195, 659639006, 861109485 },
+    { 577721120, 952062949, 1385414639 },
+    { 460686763, 714880226, 1510080967 },
+    { 1467963981, 554290596, 1630387677 },
+    { 1830539036, 1814887560, 34740865 },
+    { 1434433518, 690367770, 1290127955 },
+    { 537322532, 1821066342, 1131359211 },
+    { 1104627321, 157272379, 550245196 },
+    { 1140384172, 1312994984, 1910858270 },
+    { 1582152040, 2059344234, 1763794427 },
+    { 94307398, 772970072, 738647283 },
+    { 1046370347, 10901063, 51245830 },
+    { 1761250573, 1520982030, 628966950 },
+    { 168057522, 1003886059, 1089653714 },
+    { 1982945082, 1038626924, 410134047 },
+    { 525829204, 181271232, 93189435 },
+    { 199411898, 1312630443, 1527622954 },
+    { 356684278, 1862875640, 2064945486 },
+    { 1669679262, 1626250262, 1022089159 },
+    { 1581539848, 1242561041, 14989683 },
+    { 207026272, 1981208324, 1597141723 },
+    { 217927335, 2032454154, 1691449122 },
+    { 1738909365, 513937457, 590335821 },
+    { 595311776, 1603591171, 204102747 },
+    { 1633938701, 2013725218, 372160269 },
+    { 1815209933, 2106914653, 207621703 },
+    { 980356728, 1487053959, 733450907 },
+    { 695748720, 1404515797, 932862806 },
+    { 174515334, 279121308, 1289547084 },
+    { 1417076376, 294110991, 811742698 },
+    { 1250801052, 1891252715, 245798898 },
+    { 1135771559, 1435218189, 452825171 },
+    { 1649709016, 2025554010, 670752506 },
+    { 1105816539, 82173109, 262178224 },
+    { 972058109, 454333378, 857490000 },
+    { 931489114, 661955081, 343945053 },
+    { 271059426, 1395405989, 11671338 },
+    { 1675575223, 180785147, 992028067 },
+    { 1954696532, 1470332231, 1687776787 },
+    { 101323875, 134591281, 1862292122 },
+    { 1992576590, 380390179, 1131884850 },
+    { 1280311131, 833215350, 235202254 },
+    { 1158381494, 1503967857, 1370973813 },
+    { 1240554603, 1766146081, 873199181 },
+    { 1694887982, 476152433, 1979015720 },
+    { 209359415, 820097487, 803590181 },
+    { 1604765404, 831768825, 1735079296 },
+    { 1785550551, 1823796892, 2006138722 },
+    { 1108399134, 1364090032, 1534230297 },
+    { 1242990415, 1078898506, 1341443181 },
+    { 1623380595, 63299708, 1442767057 },
+    { 309112297, 298501962, 1287859999 },
+    { 1813080154, 1669475776, 420687483 },
+    { 1431742587, 395191309, 1579068977 },
+    { 1907895021, 226723382, 672139932 },
+    { 580508860, 1030313563, 219544266 },
+    { 1412277685, 617909211, 428903682 },
+    { 1088590930, 476564285, 2033669086 },
+    { 305197314, 2010794583, 1671735990 },
+    { 1384095820, 1204754116, 632651476 },
+    { 1447395528, 500037525, 1875641892 },
+    { 1745897490, 1787897525, 1351538839 },
+    { 1267889618, 61101360, 1660651136 },
+    { 1663080928, 1640170337, 1326247643 },
+    { 1889804310, 164826621, 610506582 },
+    { 772634225, 384370888, 370917955 },
+    { 1390543437, 813274570, 951426815 },
+    { 1867107722, 699460008, 216220853 },
+    { 1730418657, 223712350, 1304811783 },
+    { 787689126, 856363827, 1610009097 },
+    { 1287726651, 584522071, 846621269 },
+    { 928140528, 1936060910, 146533149 },
+    { 989241888, 1449228398, 1892430639 },
+    { 481928577, 627992393, 1012836610 },
+    { 646755199, 1238498976, 528433890 },
+    { 1031126087, 1609416931, 270754552 },
+    { 1844400657, 413360099, 1043388777 },
+    { 396377017, 629580952, 286448566 },
+    { 620089368, 1934392735, 6072641 },
+    { 1476453195, 1396918184, 1736491298 },
+    { 2060975266, 96055805, 376696776 },
+    { 1849552528, 242588954, 1664423428 },
+    { 1151297278, 2135019593, 445080308 },
+    { 1779289672, 1000372555, 1434322197 },
+    { 870305000, 1528806445, 1916250774 },
+    { 332238283, 1799560997, 415522325 },
+    { 745598382, 695466127, 1446648412 },
+    { 1375179334, 981914693, 1143565421 },
+    { 1162088421, 987987334, 1539942439 },
+    { 411522957, 576994985, 12548159 },
+    { 507578762, 953691761, 1489001354 },
+    { 750167716, 470631541, 1402492972 },
+    { 737703662, 915711850, 1104561852 },
+    { 1738076217, 202550399, 108375482 },
+    { 1119399015, 2118801173, 1887665154 },
+    { 771476364, 386839851, 610486506 },
+    { 1466942491, 1833488263, 942724790 },
+    { 301373537, 829570037, 1688323172 },
+    { 1289360871, 222028828, 916018859 },
+    { 1866355856, 234576987, 2078107280 },
+    { 672563970, 1723578341, 342146590 },
+    { 1143195511, 978587665, 849725352 },
+    { 2058907361, 2083149517, 1599893069 },
+    { 113974112, 44041351, 190113083 },
+    { 85291638, 1931706506, 1928189300 },
+    { 472131489, 394709364, 900104667 },
+    { 158136104, 1337434154, 1671581032 },
+    { 987706141, 878273679, 991039875 },
+    { 1209734969, 1794292538, 1292413412 },
+    { 1444311956, 1724916170, 434290636 },
+    { 1020406649, 2067062760, 153162844 },
+    { 1998994314, 769304465, 825726814 },
+    { 1934660183, 221713886, 1968922326 },
+    { 1978701535, 411826969, 1880346039 },
+    { 1762924393, 192532621, 1994320152 },
+    { 10150109, 1092637289, 2079611790 },
+    { 1347584264, 616734673, 404259631 },
+    { 78374295, 1607774548, 562395735 },
+    { 1872666833, 752704313, 1550101877 },
+    { 1450099355, 1186994949, 612353198 },
+    { 1369678468, 1340157793, 2056665155 },
+    { 2138982933, 18400960, 929588156 },
+    { 213213171, 1987323286, 781098823 },
+    { 625040140, 1720185677, 568275358 },
+    { 817572761, 1567022181, 399493245 },
+    { 1910210050, 1499150323, 14933990 },
+    { 379461075, 1903409954, 25084100 },
+    { 1987235624, 318322042, 1372668364 },
+    { 592456289, 1868423919, 1451042659 },
+    { 1779451238, 333293469, 1176225844 },
+    { 972125383, 242474976, 478841551 },
+    { 990526343, 1172063133, 1848520019 },
+    { 830365981, 1953161956, 1840019304 },
+    { 403068011, 373953666, 2053232475 },
+    { 1970090192, 773446912, 530788967 },
+    { 1321756868, 788380902, 1348361729 },
+    { 1077683174, 813465002, 1111088131 },
+    { 1396005216, 38649718, 1490549207 },
+    { 1116945487, 1489692377, 1330301183 },
+    { 1450238957, 518434573, 1922757472 },
+    { 1692713933, 997276125, 1554725062 },
+    { 717293418, 698312496, 379366797 },
+    { 522971726, 390848153, 1369893141 },
+    { 896925393, 296596980, 52775474 },
+    { 1670372305, 827385948, 455843485 },
+    { 311269559, 28264029, 278450030 },
+    { 1124734562, 1139352160, 1600206898 },
+    { 1163384280, 482417719, 530406424 },
+    { 505593010, 1812718902, 1926411641 },
+    { 1024027583, 1587992726, 895873480 },
+    { 2021303708, 995234140, 198628789 },
+    { 572132557, 1374600938, 1891342723 },
+    { 962980710, 597010431, 461152493 },
+    { 1259577690, 649785905, 984124220 },
+    { 2086963638, 1105629391, 1881049613 },
+    { 2115227667, 1384079421, 1403938270 },
+    { 1107096180, 836802671, 1715207829 },
+    { 1589513899, 1367209095, 692458743 },
+    { 1254749154, 1146137088, 1855843024 },
+    { 695258232, 2042010569, 213952386 },
+    { 1690492373, 93155710, 1237979969 },
+    { 917609663, 1984498433, 1111800030 },
+    { 1514620094, 298167279, 1683932587 },
+    { 16922351, 1282291499, 499429649 },
+    { 1122551742, 1015857464, 1759007339 },
+    { 359147515, 272312086, 1698487330 },
+    { 1195950186, 1987519915, 1666231349 },
+    { 415675634, 532495011, 625843881 },
+    { 1561812722, 240854387, 67874133 },
+    { 1456339643, 454806773, 1322623287 },
+    { 1549495354, 1692786742, 2017881519 },
+    { 1386510139, 657103124, 1560890244 },
+    { 1684677418, 193552063, 331016259 },
+    { 819485269, 692981712, 1845636353 },
+    { 1835342733, 304505404, 1862558705 },
+    { 2107654819, 2002992734, 837626799 },
+    { 1947691087, 1521740435, 1196774315 },
+    { 332702450, 100669, 245240853 },
+    { 573556837, 67974802, 660916487 },
+    { 1028363610, 1390598089, 75245562 },
+    { 573666704, 1260995960, 1531585205 },
+    { 1230769829, 674402557, 933596911 },
+    { 1424321892, 1005418816, 172623403 },
+    { 2117303605, 703571522, 1857300821 },
+    { 274325361, 418646579, 529302443 },
+    { 129834447, 1256273378, 217161528 },
+    { 1651574882, 305564045, 177332700 },
+    { 1651675551, 550804899, 2125023787 },
+    { 1719650353, 1211721386, 310242589 },
+    { 962764794, 1286966948, 883799426 },
+    { 76277107, 671068506, 1912163036 },
+    { 750679664, 1604665417, 338346092 },
+    { 1756098480, 1777288820, 1569115921 },
+    { 312186354, 1487105994, 845954166 },
+    { 730832933, 2016408437, 815774123 },
+    { 1987106312, 86086317, 1090099484 },
+    { 145186709, 263419017, 1219933931 },
+    { 695991608, 240959156, 724025165 },
+    { 1907712995, 551201745, 228217069 },
+    { 1047196295, 1435001171, 1947867422 },
+    { 1718264801, 1199680559, 763148569 },
+    { 1175446571, 1538026652, 839425676 },
+    { 805251743, 959658925, 1590105340 },
+    { 144874089, 1805613091, 1198720172 },
+    { 13798878, 473903566, 1510906527 },
+    { 99885196, 1564003050, 94255812 },
+    { 363304213, 636453333, 2081362124 },
+    { 604263370, 1360478499, 79065186 },
+    { 1155465115, 1588695568, 775056794 },
+    { 442982639, 1389079342, 535286141 },
+    { 1642663198, 4744263, 1582482437 },
+    { 1033206202, 844169939, 1153263590 },
+    { 1992865128, 286791631, 181226513 },
+    { 1650994571, 1485511804, 986478257 },
+    { 2124898138, 848934683, 1131352346 },
+    { 1541417540, 943190495, 1145151225 },
+    { 30387226, 877068972, 1245036421 },
+    { 1390865725, 956134158, 1608340634 },
+    { 832077645, 1731190952, 65120356 },
+    { 73673339, 118993446, 1220585472 },
+    { 78417603, 1701475883, 1663568111 },
+    { 922587542, 707255825, 1158747661 },
+    { 1209379174, 888482339, 44470216 },
+    { 547407330, 1874960596, 2037335344 },
+    { 1396342013, 858829294, 1540846267 },
+    { 192048860, 2003980519, 1518260757 },
+    { 1069117832, 1101533292, 912194650 },
+    { 2025251990, 562390279, 942581876 },
+    { 1608959295, 627510635, 185963953 },
+    { 1727952741, 1848096107, 1018041598 },
+    { 1281944976, 1364180570, 1091714937 },
+    { 1989200801, 375444584, 1170132540 },
+    { 730199492, 419914800, 2092720083 },
+    { 457676440, 309766496, 1154615609 },
+    { 1316505735, 1850612763, 1702022939 },
+    { 1173002606, 1221389873, 950881304 },
+    { 127052251, 2133584523, 1142930164 },
+    { 689442530, 928682751, 64564349 },
+    { 1316953165, 1114646704, 2089816339 },
+    { 1017565625, 2132688302, 1551291986 },
+    { 234262547, 1076919591, 1131761079 },
+    { 609707131, 99568484, 266222407 },
+    { 1029621931, 44804919, 107939561 },
+    { 1339388427, 1199420528, 838139053 },
+    { 1042517543, 753959819, 1295815494 },
+    { 116423768, 1704841123, 464837581 },
+    { 102524643, 700287639, 1637840187 },
+    { 1031207394, 764851988, 1764892438 },
+    { 2145854098, 707184680, 306851320 },
+    { 2131058752, 110993018, 1623804486 },
+    { 1060494695, 1242754098, 493886463 },
+    { 1160063179, 1508976505, 728149010 },
+    { 1204868098, 1616916066, 1337856142 },
+    { 256804978, 307571472, 219994425 },
+    { 1010764797, 1603386966, 1559382853 },
+    { 568122272, 2068224547, 454416748 },
+    { 1268409912, 1558581086, 570840516 },
+    { 2033261900, 1175989877, 673365159 },
+    { 592962932, 1482841197, 1704572553 },
+    { 703955951, 959162035, 1702943003 },
+    { 1946710049, 1453048498, 1686518107 },
+    { 1308202906, 33713861, 599529154 },
+    { 777635325, 1371570003, 1759592334 },
+    { 1085206797, 1591564428, 816976784 },
+    { 541110115, 1003463633, 1073781763 },
+    { 461851014, 1457880381, 2084546560 },
+    { 2020432100, 2028720897, 505185185 },
+    { 1048938329, 554602408, 1773595097 },
+    { 384295879, 111691313, 1659373349 },
+    { 1343457914, 1814634316, 104852634 },
+    { 649022765, 1353668775, 808808585 },
+    { 682736626, 1953197930, 608034986 },
+    { 2054306629, 1565306616, 1916237892 },
+    { 1498387409, 234799752, 546389569 },
+    { 354367395, 1308581515, 1631596366 },
+    { 1812247776, 1245644428, 25222833 },
+    { 1693485026, 1750829613, 487073847 },
+    { 100603786, 1376941062, 360022300 },
+    { 212295100, 888830763, 1408960629 },
+    { 2026929416, 993683397, 1793256508 },
+    { 1233114544, 1802491982, 989230775 },
+    { 1038828826, 263043320, 1638253540 },
+    { 456651794, 31797565, 173506518 },
+    { 691451546, 578187134, 80329499 },
+    { 2000033062, 62299853, 1578716908 },
+    { 1098193842, 87522686, 1933084303 },
+    { 701539807, 574596534, 1597848432 },
+    { 2078480869, 934618834, 1143849810 },
+    { 819827984, 196095815, 1244453596 },
+    { 1813511382, 1989352324, 1456748696 },
+    { 1468519716, 831099451, 1336194465 },
+    { 1731563037, 321869343, 421825361 },
+    { 1763360602, 495375861, 1460654187 },
+    { 194064088, 575705360, 1917305981 },
+    { 256363941, 6938620, 461273879 },
+    { 343886628, 1940022924, 313823293 },
+    { 918483162, 1390387708, 1412017135 },
+    { 1853101996, 386753870, 2113556942 },
+    { 2049197811, 1631207466, 2044554163 },
+    { 1891066487, 940472515, 716898500 },
+    { 574682290, 129183332, 382926234 },
+    { 896551633, 551008693, 1851445950 },
+    { 1391927494, 2011662880, 1435525339 },
+    { 1967632854, 1781485213, 1051402293 },
+    { 1974571475, 95275444, 1245466382 },
+    { 1767110751, 409098738, 1501830323 },
+    { 1010014811, 1821115873, 1845716951 },
+    { 1396768681, 1787189168, 616716465 },
+    { 880492499, 1684259683, 322334813 },
+    { 1820965014, 253674535, 224048977 },
+    { 1950148346, 636600769, 2115115464 },
+    { 353673391, 340563072, 542314107 },
+    { 217852623, 1776088411, 1438865740 },
+    { 1999337836, 680007057, 683309587 },
+    { 2094613281, 1925473439, 503458793 },
+    { 356228371, 1279820114, 330546620 },
+    { 29860596, 978053418, 2097657371 },
+    { 1817049764, 1594769883, 960188534 },
+    { 1353825800, 1917104697, 209473567 },
+    { 1607500335, 2141153674, 1089966067 },
+    { 96617457, 2108785490, 763447433 },
+    { 437180529, 503615949, 566112132 },
+    { 65785292, 1942481690, 919785523 },
+    { 745792349, 478307629, 1137638147 },
+    { 523782140, 981766422, 989492335 },
+    { 1803602255, 1312313043, 936621968 },
+    { 634172025, 1262486766, 1292850339 },
+    { 81458260, 75191653, 1322710936 },
+    { 1998562957, 284665220, 992277052 },
+    { 1992232983, 1374631287, 198619204 },
+    { 1953534826, 2138078721, 1806119540 },
+    { 309667127, 556707205, 1902736997 },
+    { 104665169, 1476492728, 192433878 },
+    { 582972798, 466647227, 258219170 },
+    { 1564739221, 1456139563, 1004011520 },
+    { 729568616, 245277883, 1527793660 },
+    { 1992055382, 1538128223, 1183912267 },
+    { 2067247035, 713355511, 1818084292 },
+    { 204428608, 1705632563, 1899542553 },
+    { 1579059895, 1904251768, 1750621862 },
+    { 1569654968, 1562887660, 1595371198 },
+    { 2126362173, 1318141009, 1401422376 },
+    { 1455371254, 1510574887, 1711089503 },
+    { 1922018481, 1768794057, 1815754673 },
+    { 1230674396, 625321929, 251243823 },
+    { 1475952280, 5631942, 1815983044 },
+    { 866596855, 1189544209, 398068012 },
+    { 1579952366, 860144854, 242639747 },
+    { 1138101281, 612203759, 162403134 },
+    { 894869401, 215341973, 366831742 },
+    { 310273413, 1810713171, 1945891638 },
+    { 1628414422, 1064651899, 1368062958 },
+    { 991505661, 628257755, 1346941484 },
+    { 612816071, 296528780, 654829090 },
+    { 1238138000, 547772603, 429363923 },
+    { 1243769942, 216272000, 1660038320 },
+    { 285830504, 614340012, 988506952 },
+    { 1145975358, 856979759, 1855103807 },
+    { 1758179117, 1019382894, 1287572525 },
+    { 1973521090, 1386214636, 278190158 },
+    { 1636750614, 1184622626, 1173059560 },
+    { 553918865, 405201937, 1483332973 },
+    { 1182176620, 1752143421, 964263748 },
+    { 1478705400, 259488863, 1955769409 },
+    { 2026478004, 688852786, 421101832 },
+    { 95266356, 201407458, 1659239833 },
+    { 709606368, 1189914410, 755526127 },
+    { 1566586128, 897534569, 1041356631 },
+    { 438485374, 37623446, 39848341 },
+    { 1824700010, 315813605, 1798027458 },
+    { 861838989, 1488873165, 1624064901 },
+    { 1267040926, 824722490, 1113331867 },
+    { 871700699, 1788986238, 1667250732 },
+    { 1131189562, 1597272000, 701943705 },
+    { 1820042348, 2018373832, 33165457 },
+    { 2021449807, 1530130017, 2059643461 },
+    { 1063880569, 138172497, 7426169 },
+    { 1961415139, 1179529128, 717032538 },
+    { 1999038585, 1219377470, 136135018 },
+    { 167368542, 869921280, 574620392 },
+    { 1656241707, 346502533, 251836754 },
+    { 333480550, 1459834400, 1113675743 },
+    { 2122466788, 979601485, 233233021 },
+    { 1572255140, 1681545190, 1104933720 },
+    { 1443145325, 1714710647, 88639634 },
+    { 825791694, 1626870461, 1908681983 },
+    { 963964191, 1634296630, 1782648142 },
+    { 2143493320, 203845520, 699045063 },
+    { 1215387142, 339980538, 512976554 },
+    { 2085308422, 914600930, 364531492 },
+    { 284327308, 1166437685, 531900034 },
+    { 1744161708, 132629780, 40658094 },
+    { 576279545, 365862802, 374138644 },
+    { 110341087, 1470796522, 349121784 },
+    { 1825051735, 1559436157, 1921376925 },
+    { 1304438548, 1320634492, 1217038602 },
+    { 791251530, 955798986, 2042830296 },
+    { 995097051, 1654844049, 859310840 },
+    { 1335077589, 20336956, 855320512 },
+    { 102194872, 384868448, 2070707654 },
+    { 1268632557, 916768482, 2008532428 },
+    { 1401262337, 957426576, 145376088 },
+    { 1767125139, 1331565220, 1889537797 },
+    { 1090438014, 1680687005, 318333694 },
+    { 502390523, 1454580282, 428674782 },
+    { 1823025015, 524135236, 106242869 },
+    { 631340353, 419481884, 1410681417 },
+    { 138700754, 1278792724, 54449299 },
+    { 159037710, 2134113236, 1049546350 },
+    { 543906158, 2057337242, 237140292 },
+    { 1460674641, 1918386023, 339335164 },
+    { 270617569, 2063762111, 1607967721 },
+    { 1602182790, 1805816260, 861746410 },
+    { 1135386147, 2124149955, 481387902 },
+    { 442482781, 405341089, 1571825916 },
+    { 966618017, 511583958, 2074216439 },
+    { 1386099901, 1922265375, 1749757806 },
+    { 517408978, 1976714674, 233614511 },
+    { 504038566, 878777377, 372315265 },
+    { 413892161, 1115917669, 531352976 },
+    { 184794536, 1455252833, 1075259134 },
+    { 101072999, 915736906, 388450127 },
+    { 1906889260, 1777483316, 659067697 },
+    { 1883555567, 111387570, 113766839 },
+    { 141413008, 1683213486, 1249152986 },
+    { 652996966, 1609946277, 1691635767 },
+    { 427778693, 1212220435, 510770136 },
+    { 257009719, 1445834946, 1896870037 },
+    { 1135787096, 1818150212, 266795367 },
+    { 104221117, 202019540, 770833934 },
+    { 1559473950, 1277278674, 1184726095 },
+    { 327727208, 1665728802, 1369520631 },
+    { 2105210525, 177312851, 1470593630 },
+    { 69114447, 291079690, 1229999242 },
+    { 1752327934, 1540232676, 966071161 },
+    { 1214790563, 1084384795, 1107484169 },
+    { 279527351, 1595154931, 1760481135 },
+    { 1725362297, 1344541320, 40776180 },
+    { 1396028861, 1611336688, 297785900 },
+    { 1598048401, 234686974, 1433572996 },
+    { 727843428, 1419413069, 1537794114 },
+    { 246088582, 641450052, 949784416 },
+    { 423401433, 2112043682, 1277511625 },
+    { 714481123, 1194559277, 1235238502 },
+    { 107230151, 13146790, 1304352949 },
+    { 1191614946, 1120630960, 909197235 },
+    { 639286229, 733628447, 2123987799 },
+    { 1983827549, 774404628, 256031502 },
+    { 1447680589, 1072190528, 1981393799 },
+    { 1682367563, 358279876, 1229939013 },
+    { 954296984, 1896073990, 680503766 },
+    { 1595747036, 698374759, 1408347194 },
+    { 1560307071, 1975886384, 1654435776 },
+    { 607382700, 1063641238, 2077837209 },
+    { 620529490, 220510539, 644834684 },
+    { 1741160450, 1129707775, 752064835 },
+    { 327305250, 1106211926, 1943679781 },
+    { 1101709878, 1362243428, 435482362 },
+    { 26416758, 1196153579, 271826264 },
+    { 384696634, 278608944, 1719506853 },
+    { 133286977, 959112711, 1254390769 },
+    { 831661736, 219976257, 61204105 },
+    { 660064472, 1874412034, 1656951142 },
+    { 1723705710, 1804765595, 1069774565 },
+    { 1944216249, 302116632, 1677157265 },
+    { 926440376, 1054181467, 150203107 },
+    { 2032652302, 850377601, 1891363558 },
+    { 1247412082, 1285859963, 71185160 },
+    { 296082014, 1557686227, 1172895038 },
+    { 574690958, 1129709433, 1199311796 },
+    { 1533803669, 236616554, 1584008430 },
+    { 1753779927, 297820659, 1717295407 },
+    { 1480708313, 1954771801, 401473495 },
+    { 1137990260, 877062718, 1061537967 },
+    { 1440106892, 406736335, 637760029 },
+    { 346804712, 556939443, 434492631 },
+    { 1197182313, 300819353, 1360933007 },
+    { 335558628, 372004513, 1246101662 },
+    { 1893244856, 1544899551, 346030096 },
+    { 875470641, 596727699, 642112110 },
+    { 1112087195, 33252481, 1216803069 },
+    { 1409907854, 1750547889, 603123090 },
+    { 1217196008, 4537736, 209419369 },
+    { 2094258726, 1066075704, 1690127682 },
+    { 353511414, 1703835733, 680634295 },
+    { 910450857, 2138328364, 2120741187 },
+    { 1211270210, 1351777724, 320062251 },
+    { 1583274723, 450395738, 1517244564 },
+    { 980690626, 796425834, 1852803193 },
+    { 1577418325, 1438537945, 1598564401 },
+    { 1610670806, 507857366, 326551394 },
+    { 1213735047, 1110980456, 1438638589 },
+    { 1218272784, 1320399826, 701062795 },
+    { 136864840, 863043860, 1918258803 },
+    { 1840700573, 1543678155, 1865033882 },
+    { 1831545290, 1516935695, 71061648 },
+    { 1035839366, 1836997946, 981512505 },
+    { 1486235104, 1206758863, 45299067 },
+    { 135177290, 912078408, 1628573790 },
+    { 1573715235, 363159161, 461780768 },
+    { 2081572601, 689710555, 2039199093 },
+    { 1045069410, 2128349144, 1502386251 },
+    { 217985588, 681928291, 568637651 },
+    { 1081029448, 452703447, 1786910435 },
+    { 477223956, 170253681, 1923775275 },
+    { 1994159651, 241315329, 1616992200 },
+    { 1683673949, 1222827834, 1301053842 },
+    { 742949164, 1268126901, 189409560 },
+    { 1655027572, 749217043, 1675644664 },
+    { 2018186733, 1210997811, 1810821955 },
+    { 560413640, 1102713256, 1237053542 },
+    { 541279136, 457615859, 1171142496 },
+    { 1223207428, 1026253510, 68728258 },
+    { 1675910875, 665680297, 286713846 },
+    { 1846164556, 441971924, 1367743294 },
+    { 2087479885, 2058964125, 1844967250 },
+    { 1162824071, 1212534319, 1691643253 },
+    { 283467324, 1401943880, 1227833555 },
+    { 1032684367, 930104896, 1970782719 },
+    { 96198530, 593443203, 1478326644 },
+    { 1198911786, 1830496746, 1349029729 },
+    { 1656527645, 854155594, 1909443370 },
+    { 535297508, 922883852, 303238858 },
+    { 1200977805, 1209597698, 1526446286 },
+    { 1642949730, 429857344, 1054873513 },
+    { 1554430207, 127340947, 753554421 },
+    { 619480878, 1818984200, 693550658 },
+    { 2021424758, 899334107, 1856374729 },
+    { 804046007, 722633179, 2139842053 },
+    { 1397489210, 53476175, 1025042772 },
+    { 1080502308, 1402505904, 1121241302 },
+    { 1934657902, 1164465626, 172669440 },
+    { 710058106, 1467704485, 1829197086 },
+    { 1919655804, 846667123, 217010946 },
+    { 202029501, 1901540637, 1417988751 },
+    { 329370448, 507611410, 913454833 },
+    { 871000, 1201162069, 320401392 },
+    { 900205108, 910053150, 939882271 },
+    { 1622838287, 902411556, 813823381 },
+    { 1676314462, 1927454328, 1617869388 },
+    { 931336718, 901211983, 867874951 },
+    { 2095802345, 1073881423, 1948377259 },
+    { 1416023182, 755594861, 1735551514 },
+    { 115206657, 972605807, 298125972 },
+    { 2016747294, 243110911, 70298129 },
+    { 376875057, 1156565744, 272327630 },
+    { 1578037126, 1476967137, 601698078 },
+    { 340606628, 269365760, 602569078 },
+    { 1243018184, 1083189141, 1502774186 },
+    { 1022988865, 553574882, 978128825 },
+    { 1924200848, 1421449833, 506959639 },
+    { 850598623, 1222343444, 1438296358 },
+    { 1606193485, 810411310, 1386615055 },
+    { 431315644, 1108537283, 655154589 },
+    { 674426555, 1178835412, 770361246 },
+    { 1830992300, 1451163042, 639624893 },
+    { 1160475789, 2052861120, 1016499950 },
+    { 1429841549, 507946550, 447053428 },
+    { 365547042, 2010720737, 787660056 },
+    { 919121924, 841365914, 2030678241 },
+    { 193088109, 1348325554, 906183458 },
+    { 1415431554, 639138264, 682900658 },
+    { 78359216, 2025753319, 1533499281 },
+    { 1186896499, 533424260, 992209118 },
+    { 218248263, 1303785506, 1423524763 },
+    { 1669411305, 1943410399, 2097951318 },
+    { 1574788777, 812426701, 1781459970 },
+    { 2082735328, 1259480129, 794452111 },
+    { 1945972417, 2047140186, 76810012 },
+    { 639854683, 1930334779, 442357055 },
+    { 1988180237, 689034589, 1361478979 },
+    { 479834853, 1371935247, 1554567089 },
+    { 358104524, 757950880, 822514995 },
+    { 891528784, 1750159999, 900874211 },
+    { 47830643, 1026201114, 2087770711 },
+    { 1991241042, 976668784, 158535326 },
+    { 656184096, 610645107, 1827946632 },
+    { 1915664225, 1405097218, 1255251761 },
+    { 1815320763, 1481907231, 1190503441 },
+    { 1598171894, 1924264286, 988992210 },
+    { 139722835, 1138259617, 1628846894 },
+    { 1511658082, 545343058, 1469543483 },
+    { 122125315, 1367858053, 1949378337 },
+    { 1872285314, 121248617, 159999213 },
+    { 751002780, 61535680, 1051527998 },
+    { 1727671564, 220071006, 1099358641 },
+    { 190833023, 2048017638, 943116035 },
+    { 1595930242, 1155785752, 1599300131 },
+    { 930353825, 198805545, 1367480709 },
+    { 707134463, 1187797756, 1035317824 },
+    { 1845394080, 669161002, 486006071 },
+    { 243253491, 2138704485, 625728906 },
+    { 1611111544, 1940599174, 2137386989 },
+    { 1732360161, 2100598388, 112028656 },
+    { 1793895841, 1004642738, 1984313970 },
+    { 2013966848, 2104001379, 587833102 },
+    { 1914500838, 899633766, 168021018 },
+    { 922802942, 351450250, 358854042 },
+    { 1121608488, 1718930959, 1954784284 },
+    { 161922596, 606765135, 737654461 },
+    { 831083598, 1092771206, 1444788924 },
+    { 822304435, 1718500113, 1142699356 },
+    { 615419962, 1708403454, 1385952847 },
+    { 568534702, 1820432110, 849580744 },
+    { 1573177440, 1657262432, 434457257 },
+    { 1529695171, 97611886, 80869451 },
+    { 281845289, 265632904, 2094836299 },
+    { 633295539, 624486946, 1861853489 },
+    { 204742850, 431787582, 637172784 },
+    { 811507986, 1169442043, 1758781272 },
+    { 1904279192, 466747319, 1920703868 },
+    { 1475295657, 1609446676, 604303818 },
+    { 1036215463, 847915875, 1426608253 },
+    { 709163925, 1697496619, 2042028215 },
+    { 218942709, 2131953877, 463079269 },
+    { 316554595, 65339680, 2036256709 },
+    { 582187500, 12692331, 1418468232 },
+    { 1206674446, 1874545820, 1700313522 },
+    { 1638462029, 364234956, 186125413 },
+    { 660420424, 2123016228, 390868264 },
+    { 1127167744, 1896236448, 1202376250 },
+    { 589130772, 353056618, 959171794 },
+    { 1437046647, 1779664872, 286983804 },
+    { 987059619, 1674209439, 1323199267 },
+    { 971529848, 2137288709, 2032363193 },
+    { 1036869528, 2026061770, 103822254 },
+    { 1049561859, 1297046355, 420376850 },
+    { 776624031, 849876229, 1002564350 },
+    { 1140858988, 1036001642, 61755148 },
+    { 1116391568, 1426869906, 1700217177 },
+    { 865144369, 481762508, 213153954 },
+    { 1218200987, 1440934303, 1340321698 },
+    { 850382211, 1727918107, 1929452470 },
+    { 377108003, 903633726, 1219015469 },
+    { 366913064, 788513271, 58591440 },
+    { 245491186, 892335526, 1030121288 },
+    { 1542537541, 1312712376, 2066990816 },
+    { 244930122, 167793078, 969069027 },
+    { 1280931765, 229548226, 1745693059 },
+    { 560318023, 1929765404, 739068399 },
+    { 1042080532, 2142919358, 1855459967 },
+    { 335531187, 1335757408, 573120688 },
+    { 2063449294, 1117726230, 1791321676 },
+    { 819599372, 189258051, 494220239 },
+    { 1608112644, 247849492, 871328242 },
+    { 352964522, 1277970780, 1238241306 },
+    { 1665676898, 1197477949, 1483732493 },
+    { 1833469976, 19063328, 878786386 },
+    { 2063018202, 1764756387, 1123716509 },
+    { 1845299958, 356341138, 257164626 },
+    { 1840735668, 64317458, 817482649 },
+    { 1029009428, 637438146, 1859563181 },
+    { 2146735658, 281276174, 47610720 },
+    { 188510062, 775496414, 2111060014 },
+    { 436359554, 1646824656, 783175739 },
+    { 1714330334, 737582315, 243804735 },
+    { 764324635, 73831160, 596769257 },
+    { 783387964, 952617546, 114962507 },
+    { 400660703, 2076334055, 1948432483 },
+    { 757001842, 186015033, 1863967037 },
+    { 821319300, 1003497683, 1561783348 },
+    { 1458757446, 715577216, 1255035368 },
+    { 1740033621, 763187937, 136561149 },
+    { 368046387, 726764303, 135813159 },
+    { 2014871043, 1509940042, 324323221 },
+    { 604969710, 1753744777, 760682775 },
+    { 678800870, 203030386, 327529462 },
+    { 1631418417, 317992893, 1091854097 },
+    { 1560268824, 118941728, 1875242061 },
+    { 1746283858, 1982908766, 128419117 },
+    { 602297893, 1397208466, 885420959 },
+    { 1317875109, 504760186, 1706740259 },
+    { 2081063046, 641321335, 1018014057 },
+    { 660343702, 777134495, 610564030 },
+    { 22800096, 1101457716, 978610417 },
+    { 1776544874, 1862140492, 845997813 },
+    { 1979575260, 42186306, 1450967523 },
+    { 150084506, 1134040403, 2129768394 },
+    { 269026234, 861798817, 1613703163 },
+    { 104451352, 990217934, 1026488339 },
+    { 1501659818, 1875638893, 625288549 },
+    { 2006420005, 1434895504, 1227586442 },
+    { 500257692, 305425913, 397977904 },
+    { 1277392187, 915989944, 331557302 },
+    { 231366256, 1894600361, 991901004 },
+    { 2093506748, 593114526, 1014701101 },
+    { 2135693054, 2044082050, 643762327 },
+    { 1122249809, 2026366796, 475853939 },
+    { 1984048626, 1492586311, 625938445 },
+    { 826782912, 371591002, 894964680 },
+    { 554938157, 996879552, 999416032 },
+    { 1989833661, 76982346, 353592203 },
+    { 147775927, 474960250, 212528560 },
+    { 1063765871, 806517553, 712786252 },
+    { 810882584, 1798418557, 1990178440 },
+    { 1403997111, 665636010, 74061048 },
+    { 1300595513, 1309398337, 20084148 },
+    { 1179478661, 1785252277, 8293554 },
+    { 524581324, 263707074, 1130543363 },
+    { 896172326, 1158671754, 967108342 },
+    { 1893051878, 10604139, 1793891254 },
+    { 1970034225, 364196342, 201345764 },
+    { 297510827, 576724902, 43695777 },
+    { 1104028380, 1289511154, 191471704 },
+    { 754963290, 1132205946, 1255237575 },
+    { 1420599300, 1206266994, 2066120160 },
+    { 582513990, 1226351142, 1322633623 },
+    { 220282619, 1234644696, 475745488 },
+    { 483989693, 217704412, 1655224149 },
+    { 1642661448, 1184812754, 32321825 },
+    { 1653265587, 831220360, 928494151 },
+    { 2017461929, 1032566124, 674062382 },
+    { 446703183, 1076261902, 496612959 },
+    { 1736214337, 1267733606, 794123786 },
+    { 720936636, 375487534, 1898152167 },
+    { 1927203630, 294124046, 505631809 },
+    { 1006071125, 1616757669, 1926231109 },
+    { 93232173, 2092503157, 361261451 },
+    { 310936585, 1600243658, 581544070 },
+    { 1495749339, 1632565483, 1065533764 },
+    { 179486052, 413575986, 560711564 },
+    { 1212052176, 1087638368, 66493503 },
+    { 140830430, 1584251327, 2083955432 },
+    { 1408564037, 230891466, 383174967 },
+    { 1784051571, 2129043633, 2119389304 },
+    { 2078175617, 487191794, 692842292 },
+    { 1547449638, 265939255, 472562275 },
+    { 1492469147, 627200707, 1478633400 },
+    { 945229157, 1208744777, 1571865573 },
+    { 430310992, 126794893, 1882802159 },
+    { 843886978, 687506457, 1231067850 },
+    { 1931525347, 753999960, 1410553902 },
+    { 1368293026, 690471744, 475122431 },
+    { 1599184492, 1073646711, 615952861 },
+    { 1580744477, 1045552368, 2024516898 },
+    { 2067936271, 1738394660, 1661084821 },
+    { 186391879, 63473287, 1591776790 },
+    { 813592586, 1542106687, 991742780 },
+    { 2022337363, 966488613, 336728279 },
+    { 1648609, 701807124, 1281957436 },
+    { 689155066, 1932874974, 1712268428 },
+    { 1443155027, 1195945229, 408671759 },
+    { 2133626771, 1671067660, 192713458 },
+    { 1059789835, 139536873, 1561006484 },
+    { 2105342203, 16570124, 1012707329 },
+    { 1696253215, 1677654945, 445968158 },
+    { 1759726503, 1121948088, 366420782 },
+    { 1154349542, 2113690868, 552812661 },
+    { 2120838155, 302935500, 1366405247 },
+    { 675161631, 1584892936, 1241258962 },
+    { 460552958, 1149677717, 1242907571 },
+    { 1656498187, 1558349476, 1932062638 },
+    { 1180082199, 1751062934, 1227734017 },
+    { 1319619072, 1164585770, 1213877140 },
+    { 1336189196, 29809451, 126183327 },
+    { 866360494, 475777610, 84041882 },
+    { 1988308582, 842198392, 1780295098 },
+    { 1954515802, 1395011053, 1392537953 },
+    { 109967654, 613932652, 399403847 },
+    { 1694860591, 1855191614, 372758355 },
+    { 697054660, 950615538, 1047919986 },
+    { 107920488, 735194528, 1508472944 },
+    { 1858983422, 1962928545, 1017487483 },
+    { 876085544, 1029322037, 50086034 },
+    { 905894996, 1155505365, 1369705107 },
+    { 1381672606, 1239547247, 558410655 },
+    { 76387350, 872358697, 1424771149 },
+    { 1471398403, 117413002, 1265596083 },
+    { 2085331055, 516816850, 1072628238 },
+    { 1793039021, 889575205, 1182595892 },
+    { 596170911, 1937495191, 729972835 },
+    { 1331365439, 1298484488, 1427027495 },
+    { 1146810336, 168488323, 1534947983 },
+    { 28648726, 218574358, 1246447757 },
+    { 1184154091, 1588279465, 2122533302 },
+    { 276217690, 2146690120, 880944650 },
+    { 1148576388, 1423977622, 115133608 },
+    { 1265989390, 542090057, 191520958 },
+    { 1782806240, 1614718295, 1662919361 },
+    { 524897797, 649830540, 1600766768 },
+    { 314909341, 1379803375, 1246322141 },
+    { 1613393829, 659347223, 1842493053 },
+    { 1781882152, 46811558, 1026374844 },
+    { 2000456510, 1293259316, 25701533 },
+    { 1441252327, 1268308970, 54350259 },
+    { 1440458800, 1769972, 1238504350 },
+    { 716952774, 116903580, 1514722040 },
+    { 1259042831, 308424538, 515814780 },
+    { 726277479, 1971343899, 1781804171 },
+    { 1376108019, 1424627019, 1417126763 },
+    { 608427746, 523465512, 1942024561 },
+    { 1267774969, 218474917, 109450254 },
+    { 1314586528, 1244849762, 1722844083 },
+    { 460362196, 1270551295, 1357242587 },
+    { 1728671166, 1324901554, 1210215450 },
+    { 1730441138, 415922256, 503984129 },
+    { 1847344718, 1930644296, 1944442929 },
+    { 8285608, 298975429, 513912055 },
+    { 1979629507, 2080779600, 1772954887 },
+    { 1256772878, 1350422715, 351748718 },
+    { 1780238390, 1144963628, 1727856737 },
+    { 1998713308, 1254413882, 188800835 },
+    { 1096079422, 829774317, 1456575805 },
+    { 219147069, 39533257, 623678685 },
+    { 1544048623, 1249748707, 1084040881 },
+    { 1959970879, 1753732836, 665228399 },
+    { 1743131527, 1550692118, 248185889 },
+    { 2042106956, 2064604173, 2095530607 },
+    { 1975402908, 1690075412, 2103816215 },
+    { 1178341976, 2041824130, 1935962074 },
+    { 175821956, 1622197219, 1045251304 },
+    { 1430235839, 1810998055, 678006046 },
+    { 112526508, 1120090212, 529235706 },
+    { 152059765, 1743768897, 1625315128 },
+    { 1401808472, 680326130, 1844462197 },
+    { 1008057661, 1345554529, 1241027172 },
+    { 411266131, 1593740418, 1053514403 },
+    { 328386656, 1541787377, 649162283 },
+    { 2018462069, 1498119944, 543785591 },
+    { 1912802551, 1286598370, 371704852 },
+    { 1387516123, 184366026, 1550046828 },
+    { 1051030530, 862372072, 1725868784 },
+    { 23637094, 1391607779, 1008620975 },
+    { 1767405991, 869439259, 1121147484 },
+    { 300248473, 566417809, 1273207249 },
+    { 1645803002, 1807444981, 527532074 },
+    { 1092059772, 713475737, 1535589735 },
+    { 486363501, 1362638020, 1946855866 },
+    { 1984483445, 1906423611, 127758874 },
+    { 1123598167, 130644815, 2146220943 },
+    { 1307964193, 1680691643, 1911539847 },
+    { 22852617, 1259076780, 1151572322 },
+    { 1414460396, 120214107, 55119204 },
+    { 136416008, 1241361591, 78756298 },
+    { 702833817, 367085193, 1846162289 },
+    { 362795150, 894617267, 2146410762 },
+    { 1076270887, 282723354, 1644730116 },
+    { 291425259, 82095572, 589306240 },
+    { 50365223, 209854446, 1075669741 },
+    { 181010038, 208591742, 912669538 },
+    { 1861701682, 2120131589, 2036267705 },
+    { 973294814, 1124220263, 1196748250 },
+    { 1093508921, 1179339467, 1219600867 },
+    { 187386865, 1258095765, 486577616 },
+    { 554472058, 956774406, 622993624 },
+    { 1449089325, 955701520, 1325827441 },
+    { 1731812679, 452947988, 1688622591 },
+    { 1813908251, 1042254228, 617409831 },
+    { 2023762697, 2117923969, 908835090 },
+    { 84870791, 883109859, 959200313 },
+    { 57518732, 771893916, 1140210352 },
+    { 1181738995, 1968642166, 854428386 },
+    { 213594814, 1040759385, 1827723200 },
+    { 1471690579, 1527337001, 773748473 },
+    { 280981337, 2846977, 961135338 },
+    { 1236682857, 1328674418, 1515607396 },
+    { 1689630845, 869813362, 817213073 },
+    { 584401425, 1487223193, 401542104 },
+    { 554841746, 248574635, 67966707 },
+    { 1437951605, 1207774949, 2091729405 },
+    { 62361873, 200501653, 29116548 },
+    { 2031004039, 1054930039, 86635281 },
+    { 924279777, 735169591, 1268374276 },
+    { 304133130, 1508918064, 1481969091 },
+    { 306980108, 322569755, 806176022 },
+    { 1635654526, 1838177151, 1087157360 },
+    { 357984240, 507906577, 176356569 },
+    { 1845207433, 909448681, 1865987415 },
+    { 2093782069, 977415389, 302905192 },
+    { 1154073370, 921661146, 857746939 },
+    { 1354575023, 950777694, 148214896 },
+    { 262021414, 1037412975, 210576770 },
+    { 997191005, 158303604, 94097161 },
+    { 358625421, 1640272695, 1018376938 },
+    { 681195176, 298965069, 1322510069 },
+    { 371888680, 1386122429, 1629490177 },
+    { 879795257, 1562478999, 1117661055 },
+    { 1789243938, 1280982766, 1475645296 },
+    { 619175679, 1583887958, 1173369081 },
+    { 1540836825, 294151249, 1119667502 },
+    { 344130872, 442366146, 126257224 },
+    { 1381543847, 652942916, 1480832247 },
+    { 1539847451, 747040077, 1742853661 },
+    { 1032636498, 1765417016, 592561018 },
+    { 1331601568, 940443437, 951186440 },
+    { 570240349, 422449966, 1632381616 },
+    { 2132719348, 1540111021, 2004270296 },
+    { 1266218466, 868272669, 736581905 },
+    { 702622777, 2041641751, 378342196 },
+    { 996774026, 1013825605, 997517875 },
+    { 1439140172, 1140082830, 390871053 },
+    { 2092083088, 473431429, 735001925 },
+    { 691639518, 68801443, 2116545772 },
+    { 309572886, 661362461, 1508909576 },
+    { 1250016323, 1612548901, 394062426 },
+    { 1672466289, 1097446870, 1725663994 },
+    { 1065093662, 954233518, 148420696 },
+    { 1933366332, 1690815424, 133656396 },
+    { 1827524435, 2069157620, 1399874863 },
+    { 693866392, 919191847, 2102497640 },
+    { 1833949222, 1310062900, 951788018 },
+    { 159897004, 2045064825, 243444543 },
+    { 228698447, 2014126950, 188043983 },
+    { 890060908, 1375552878, 879683501 },
+    { 355126162, 1769615304, 1189256387 },
+    { 1452573032, 1347795651, 291789062 },
+    { 259322902, 1496216347, 1964255351 },
+    { 1950138326, 1629872743, 881865366 },
+    { 1871812298, 882263958, 667748050 },
+    { 643520498, 837277950, 347788837 },
+    { 1953583398, 1789065969, 1041655229 },
+    { 1851164576, 2032510512, 728120804 },
+    { 1717807878, 73070847, 888017808 },
+    { 945877108, 952754349, 1116716255 },
+    { 568008764, 2142010736, 2006777163 },
+    { 1915804415, 286316151, 214419677 },
+    { 1264537114, 103087854, 1666992709 },
+    { 746926210, 984953220, 1926315612 },
+    { 1629190168, 1652701270, 1728970290 },
+    { 318984471, 2000490107, 1453298941 },
+    { 2108050440, 894661689, 2096819439 },
+    { 1993077304, 1622782493, 1902919189 },
+    { 2066148151, 363316653, 1606600117 },
+    { 871418852, 1480032908, 1176924347 },
+    { 865945941, 1339326423, 2122801455 },
+    { 1152262092, 1553746101, 543326572 },
+    { 1255349946, 1073255162, 311647339 },
+    { 92819519, 852087126, 1576184454 },
+    { 1745520789, 433573769, 175627016 },
+    { 1598527249, 1886872710, 1804817184 },
+    { 345705290, 1836208501, 2123801655 },
+    { 1968487783, 1591644042, 2084368447 },
+    { 184320788, 1050760512, 1929962103 },
+    { 1664353696, 80201211, 1848626607 },
+    { 856196471, 55519019, 572561811 },
+    { 262458924, 598845591, 1438507752 },
+    { 1335714087, 910492930, 443286196 },
+    { 40317565, 339193736, 1698636143 },
+    { 473891334, 514820752, 1791455662 },
+    { 213280396, 172154289, 1389492803 },
+    { 2049488897, 148472296, 840536404 },
+    { 1493649292, 85357096, 1186241694 },
+    { 396926156, 2015319199, 1007245829 },
+    { 477127367, 1716462158, 1191566617 },
+    { 532646386, 141540322, 708436665 },
+    { 1131491977, 1580048074, 1564633137 },
+    { 2041984908, 2023334271, 1827092061 },
+    { 233694996, 1574486766, 1015322500 },
+    { 748515749, 1218458780, 1055640066 },
+    { 920670038, 460467935, 1529531400 },
+    { 1069142334, 1301004340, 1742811797 },
+    { 1154499430, 339762386, 1644817046 },
+    { 1022334982, 1347008216, 990982690 },
+    { 591313492, 391091185, 1387908846 },
+    { 732853814, 1099527851, 1865036214 },
+    { 165418241, 516677340, 250198952 },
+    { 41268864, 196285753, 1381690930 },
+    { 1615755630, 1211608254, 1276192190 },
+    { 686730762, 119764672, 1509887186 },
+    { 1147198697, 1649296072, 110919287 },
+    { 300719389, 1244624221, 1031589325 },
+    { 640481776, 741957620, 2100731660 },
+    { 1987489992, 1732940310, 1107747442 },
+    { 231097529, 973365509, 2130082424 },
+    { 1330625380, 690918075, 573912269 },
+    { 1847302720, 941117027, 1306766083 },
+    { 2043588474, 175324309, 1472184324 },
+    { 1107713080, 1451516499, 1513453188 },
+    { 1227477752, 813920038, 981725170 },
+    { 729290176, 924839325, 1668455932 },
+    { 1973914398, 1956428651, 668170982 },
+    { 568388370, 1909676663, 968890371 },
+    { 153845032, 869940457, 1609372147 },
+    { 1127210541, 852539234, 1449378491 },
+    { 1818128616, 1426451503, 1680476021 },
+    { 611761996, 585733938, 863617753 },
+    { 787086305, 2057918263, 563436826 },
+    { 91119157, 1423887803, 459541652 },
+    { 905039195, 258129326, 1567254732 },
+    { 1829878520, 1926585258, 647248836 },
+    { 1638823523, 447272592, 1376539012 },
+    { 1401016538, 1416162964, 1202969762 },
+    { 123473348, 878051463, 1771358132 },
+    { 976012582, 179946307, 1925203165 },
+    { 254980437, 1860422328, 904930058 },
+    { 840714375, 576556433, 575575027 },
+    { 751148990, 1139993259, 1187337023 },
+    { 27553146, 1599534911, 1974423328 },
+    { 285682472, 1019305995, 2065542485 },
+    { 64784082, 1666554831, 823098032 },
+    { 512056675, 895610196, 505492905 },
+    { 1928219639, 2098579958, 2144316428 },
+    { 658787454, 1722454443, 1397849319 },
+    { 838733761, 1500173960, 1521322667 },
+    { 551672441, 257620370, 349851601 },
+    { 1128228875, 833195397, 604832038 },
+    { 120738486, 2020532420, 1445546413 },
+    { 1720273398, 1847472101, 49211756 },
+    { 592095745, 1765530938, 76764902 },
+    { 111166929, 441145323, 362447374 },
+    { 1006777125, 946638228, 427231456 },
+    { 957873435, 943471008, 939288131 },
+    { 532844230, 193836679, 720024122 },
+    { 2033018190, 1715159346, 1378811577 },
+    { 143154913, 2065010947, 70061690 },
+    { 976350310, 522359337, 621734132 },
+    { 849399083, 1967905751, 1749963007 },
+    { 549387536, 2017117507, 1870701493 },
+    { 167434826, 2093882409, 1443491243 },
+    { 608580149, 308846135, 2035586989 },
+    { 1555218377, 736077591, 2146753918 },
+    { 351205738, 1675365723, 1006047395 },
+    { 545042417, 247906197, 1963920830 },
+    { 112718116, 1626717774, 349281413 },
+    { 30245415, 1696779465, 234815955 },
+    { 552604753, 171029949, 377970868 },
+    { 373026856, 1920992956, 1354321179 },
+    { 242660715, 1644210801, 56236614 },
+    { 189059476, 940218397, 605624150 },
+    { 497905611, 828321738, 773058976 },
+    { 1233983202, 827592008, 1381639126 },
+    { 761865277, 1833639403, 789373855 },
+    { 1009771475, 1650076585, 1140579593 },
+    { 489005601, 1999357998, 1685622011 },
+    { 38301418, 86690306, 1798340127 },
+    { 209331367, 464661174, 1828585542 },
+    { 2130324323, 1818982353, 233706647 },
+    { 1627051477, 1875218967, 606733503 },
+    { 419786226, 333359469, 849394218 },
+    { 1248107964, 1106418446, 1038453694 },
+    { 2075699972, 340573924, 1536359305 },
+    { 1761855727, 1129947779, 622858860 },
+    { 1264448664, 123043725, 1384724137 },
+    { 1116323015, 1808665736, 247011964 },
+    { 1203013321, 1459522215, 736017566 },
+    { 1667674495, 1140624109, 774318984 },
+    { 1339173201, 1374330757, 983650352 },
+    { 1066908520, 1981064260, 966491027 },
+    { 1400267990, 682974831, 446058856 },
+    { 359202788, 1721428525, 865845082 },
+    { 699776712, 1110304183, 2113953046 },
+    { 1829724491, 1733163043, 2042169370 },
+    { 1952768216, 970403532, 1656541449 },
+    { 1613950304, 1217415497, 773506466 },
+    { 925988871, 1953433063, 1889829481 },
+    { 2066612981, 580268399, 945359154 },
+    { 1293460090, 1563918751, 465550001 },
+    { 1127040702, 382926131, 1804723202 },
+    { 1810015533, 828984987, 724148075 },
+    { 1383960411, 1694830070, 2124416065 },
+    { 346780946, 1661299468, 336135205 },
+    { 2079943989, 1555985191, 1035911917 },
+    { 902863873, 1065042992, 718152760 },
+    { 2120279370, 1838549458, 523437329 },
+    { 1926228785, 1580895291, 2137387633 },
+    { 359013537, 378770797, 915892857 },
+    { 1922932288, 844320799, 835022190 },
+    { 158374771, 501560353, 2128482280 },
+    { 987359759, 1225708428, 1108039334 },
+    { 534706181, 1202640845, 770571220 },
+    { 48522001, 1538776050, 7047983 },
+    { 1604507192, 427204319, 353828929 },
+    { 522066537, 1145357080, 286289270 },
+    { 213132347, 1668794409, 1189153143 },
+    { 1794027639, 1658698394, 1161948866 },
+    { 25314788, 427107603, 940694003 },
+    { 869635587, 1262129793, 1299707540 },
+    { 1371195941, 1243128425, 1075156181 },
+    { 449420721, 203684112, 1233530952 },
+    { 1652061567, 974255332, 73407063 },
+    { 1043353969, 981303315, 608113244 },
+    { 1470558289, 1335132244, 656635246 },
+    { 468431721, 1621421514, 113658790 },
+    { 2137226130, 663091009, 635725327 },
+    { 1648440876, 1825039875, 848857675 },
+    { 2075548480, 618250231, 495401666 },
+    { 1190194625, 1917957771, 520716454 },
+    { 285839403, 845630304, 1390352042 },
+    { 489523515, 2079161257, 614064335 },
+    { 1463778847, 5084672, 1063485056 },
+    { 297598514, 613197917, 568062975 },
+    { 1632730758, 1269833163, 1611416945 },
+    { 1106668624, 1383491953, 934491586 },
+    { 1769759633, 2019217281, 1402923307 },
+    { 1447315861, 720591308, 1392665789 },
+    { 2065566092, 1215992974, 893623017 },
+    { 1836040215, 1736709428, 821687849 },
+    { 534186872, 979577822, 2011882475 },
+    { 465864481, 1593642157, 150238230 },
+    { 470949153, 509643566, 639761745 },
+    { 1084147070, 1077706541, 2103540592 },
+    { 206496585, 541639838, 253655458 },
+    { 1589988539, 1476131424, 1886386216 },
+    { 1461722172, 731571083, 845571192 },
+    { 34829832, 2124236872, 467847177 },
+    { 1250822806, 870376242, 1915163038 },
+    { 840048586, 1692064091, 1833245482 },
+    { 1819626409, 1556462918, 1521802050 },
+    { 1265784918, 1706701148, 2055988922 },
+    { 1775428484, 198979245, 374369755 },
+    { 705651378, 155036189, 845318908 },
+    { 1247291216, 408691647, 1929465979 },
+    { 575938993, 147594215, 2135962564 },
+    { 1307510076, 993165407, 1578467455 },
+    { 1284263301, 1461012585, 892705979 },
+    { 7155895, 1228691975, 927535811 },
+    { 1699219986, 914453810, 30874969 },
+    { 1108199257, 288772212, 870923556 },
+    { 667416757, 197277486, 543066317 },
+    { 866396003, 571647241, 1808851235 },
+    { 1021432192, 1416966149, 1436796072 },
+    { 1430123840, 1198948480, 2142447450 },
+    { 1577718055, 1187427397, 1242255018 },
+    { 423399815, 618411204, 1818194011 },
+    { 1884412400, 1511117184, 978220440 },
+    { 965620727, 291169347, 115000093 },
+    { 1880074537, 322044317, 122155988 },
+    { 21363101, 1192967873, 1821375974 },
+    { 218640587, 1736034190, 782091583 },
+    { 790287828, 1397401777, 1449508341 },
+    { 59770330, 686714201, 168420696 },
+    { 1258718810, 681678003, 1189852888 },
+    { 298662559, 1923933022, 472493080 },
+    { 917073764, 1594643385, 2050211136 },
+    { 280707300, 425380177, 326127303 },
+    { 571876647, 540380270, 63056055 },
+    { 893920964, 662536258, 1028676782 },
+    { 2086888837, 336428585, 761267672 },
+    { 1675439379, 1118520168, 782630773 },
+    { 925357509, 420544861, 1001271361 },
+    { 1612071710, 588965557, 1791559189 },
+    { 146266066, 1778818446, 1851329519 },
+    { 2070199088, 103827878, 962564682 },
+    { 1517358825, 6555366, 1261227241 },
+    { 1942739003, 332682669, 30817357 },
+    { 335635625, 395738724, 311524657 },
+    { 998171884, 1424415507, 883401305 },
+    { 1334600469, 38199531, 1777322269 },
+    { 305636989, 820830304, 1716727459 },
+    { 726181851, 1822101665, 1244683190 },
+    { 1315147408, 1466177207, 22557051 },
+    { 946482206, 1170023078, 1634628762 },
+    { 1050310085, 2132587760, 1780894828 },
+    { 1056865451, 1246331354, 1703610268 },
+    { 1389548121, 1277148711, 1073485445 },
+    { 1785286845, 1588673369, 868740800 },
+    { 1062218704, 324591026, 1204376426 },
+    { 1100418235, 2101913295, 55064662 },
+    { 1921248540, 1671157106, 1389665131 },
+    { 1595866557, 768356649, 1695302120 },
+    { 914560116, 790913700, 274000323 },
+    { 2084583195, 278058814, 1589147732 },
+    { 2069687307, 2058953642, 388146290 },
+    { 1168535013, 1615080262, 1438456375 },
+    { 298200077, 541082060, 347838179 },
+    { 1886873446, 1409822860, 1737386300 },
+    { 63980824, 466715638, 1375189497 },
+    { 18410471, 521780300, 289924554 },
+    { 1689567578, 1911445431, 1390342789 },
+    { 310440579, 1459263904, 1164107681 },
+    { 1101354279, 1733264227, 612490591 },
+    { 1379413094, 1174928311, 1527050707 },
+    { 1290883088, 1563074602, 1464150254 },
+    { 758479703, 854047329, 1386353914 },
+    { 1299561763, 1201885508, 407405279 },
+    { 561900975, 791788160, 705605356 },
+    { 1028616614, 19494010, 444995154 },
+    { 1550396914, 309418564, 508975978 },
+    { 1314358698, 1699761353, 527386450 },
+    { 626138954, 716385387, 69470380 },
+    { 211919533, 1328875978, 379910959 },
+    { 1386847845, 708443037, 1481265238 },
+    { 802438799, 25109644, 713194684 },
+    { 1656486128, 1411463558, 2004077773 },
+    { 710887989, 1818868837, 615073828 },
+    { 1502676149, 376990546, 1914635591 },
+    { 1522170159, 821985700, 329052918 },
+    { 1831588723, 1330961679, 1357669532 },
+    { 1383866429, 1858348129, 760582799 },
+    { 2100251816, 1927818509, 2074941497 },
+    { 1281644146, 160245820, 553596803 },
+    { 1990087183, 1641511058, 765516336 },
+    { 2015196827, 207222095, 4880533 },
+    { 1279176737, 63816220, 807319332 },
+    { 950561927, 678890048, 316321813 },
+    { 1327552473, 446041991, 1027209802 },
+    { 2054525, 775094909, 382402303 },
+    { 1333016204, 2132764442, 1904572463 },
+    { 1043880685, 745863593, 1588677538 },
+    { 824215546, 673321442, 825060319 },
+    { 984461366, 1226918245, 777828487 },
+    { 478488777, 1992434581, 2059472633 },
+    { 685710872, 1997315115, 1902076169 },
+    { 749527092, 657150799, 1769789348 },
+    { 1428417140, 973472612, 901482438 },
+    { 1874459131, 2000682414, 1852044365 },
+    { 502070392, 235601070, 1032113190 },
+    { 487351186, 2140173533, 1034167715 },
+    { 1233214779, 1581367423, 219700272 },
+    { 1906536221, 258944095, 1263580957 },
+    { 985970818, 1036772582, 2087796504 },
+    { 830921752, 948761568, 924774222 },
+    { 680753219, 703354089, 1403262999 },
+    { 1337904018, 325659789, 2088973871 },
+    { 163892983, 1227142227, 691017315 },
+    { 17091749, 931702944, 2119434455 },
+    { 252692819, 1963816134, 1846409938 },
+    { 245382704, 850500202, 200996683 },
+    { 1826750128, 1070200474, 688347869 },
+    { 2085694223, 186297783, 1921562649 },
+    { 974983157, 126610639, 1680615222 },
+    { 1923744725, 1051384862, 519102393 },
+    { 479615166, 307164213, 1350024145 },
+    { 805274956, 248654437, 2030777364 },
+    { 2032417183, 939671752, 1221197734 },
+    { 816636480, 911622560, 1385090717 },
+    { 632968966, 610548850, 1402182467 },
+    { 1483469168, 811545533, 1654875286 },
+    { 406185994, 1499893403, 1900257991 },
+    { 592483778, 1273972404, 1579524471 },
+    { 719094417, 807103978, 1517735046 },
+    { 1770479279, 1326206371, 345234555 },
+    { 2077643493, 528746868, 121495633 },
+    { 178814282, 412040584, 601110799 },
+    { 1118486034, 1633238319, 1406385755 },
+    { 2030108594, 870845388, 1291319291 },
+    { 493173797, 125544207, 2107955771 },
+    { 1304719330, 1780419494, 593441089 },
+    { 657129085, 1533193837, 2076910258 },
+    { 1931101489, 965234660, 335612604 },
+    { 590721820, 335486058, 928096382 },
+    { 1916928191, 680720613, 1647190800 },
+    { 298191412, 802216246, 1270186431 },
+    { 710231996, 1403327046, 1200346276 },
+    { 195986667, 662229153, 1379160558 },
+    { 1066832056, 1953548444, 350162945 },
+    { 1192376263, 1914020567, 232787891 },
+    { 825312109, 359978009, 725961688 },
+    { 211022298, 289404619, 2030681019 },
+    { 1176256958, 625017223, 540326456 },
+    { 1511743016, 1553113606, 323944298 },
+    { 44979982, 1052820758, 914666118 },
+    { 847196228, 175523541, 684110661 },
+    { 103039626, 1375869818, 982302073 },
+    { 765268780, 607546728, 1692534070 },
+    { 571333576, 957709673, 1888520737 },
+    { 337870496, 1190497565, 807869145 },
+    { 697848505, 1916459253, 2000245409 },
+    { 987253124, 1799656624, 678073870 },
+    { 1612270347, 192499433, 889096169 },
+    { 1017900305, 516443731, 2065353127 },
+    { 2070721063, 1431109849, 1429612496 },
+    { 98760957, 2115220510, 1474592478 },
+    { 1474630775, 950038936, 174305058 },
+    { 2082177503, 495089358, 277344685 },
+    { 892403529, 236126447, 1042613465 },
+    { 2082901094, 1043995593, 1613947041 },
+    { 1851876699, 896757354, 1951817537 },
+    { 1504049676, 1574831224, 502182394 },
+    { 1696549109, 316443745, 1489435518 },
+    { 65509192, 234313225, 954222218 },
+    { 1496619041, 1663925721, 1972122523 },
+    { 1464355903, 991034551, 1895359939 },
+    { 266911191, 1165339609, 1994120896 },
+    { 762000549, 1442684294, 1321268023 },
+    { 998126997, 337814111, 1255961878 },
+    { 2042122590, 1951761153, 881759 },
+    { 791396296, 1756095042, 2083782853 },
+    { 218743872, 110793789, 1788175905 },
+    { 535187618, 1600229307, 1144741933 },
+    { 769500843, 406967877, 693807394 },
+    { 285942916, 231606753, 759316586 },
+    { 1276977467, 2126966692, 108451979 },
+    { 294833428, 1973603940, 1572807882 },
+    { 1737517723, 1147388315, 1839719074 },
+    { 2075331834, 255866545, 454235975 },
+    { 1879609339, 256748305, 1452362972 },
+    { 1488220734, 193047510, 1347001914 },
+    { 1599014523, 1981223415, 2138398210 },
+    { 1051760182, 978481700, 209658435 },
+    { 1458728060, 1672289094, 744846053 },
+    { 1690334813, 284122032, 1514346896 },
+    { 1669817857, 392574011, 1800289812 },
+    { 1495938149, 1965381894, 929783631 },
+    { 495842816, 1657617320, 1224617059 },
+    { 751709361, 2111853295, 814651134 },
+    { 1008457666, 1416732620, 742499321 },
+    { 1201505177, 616250886, 474625012 },
+    { 1035244944, 607165449, 1962845746 },
+    { 2013726645, 816823884, 1414376621 },
+    { 1538532091, 1561669937, 318653156 },
+    { 1822654124, 928533185, 1777381216 },
+    { 67744487, 581339349, 1320232381 },
+    { 2033126381, 1511122980, 842566590 },
+    { 1543260053, 588256391, 191021091 },
+    { 1507629701, 1402907526, 686863907 },
+    { 776878673, 2145406847, 1438573268 },
+    { 1393129559, 472548211, 299547287 },
+    { 2000295008, 287910310, 1501052464 },
+    { 669635244, 1702286931, 388813760 },
+    { 83821533, 2020940087, 255056757 },
+    { 1012354718, 1650837655, 1793588849 },
+    { 1593694067, 823586388, 1468759325 },
+    { 957333399, 1666152978, 1536503812 },
+    { 1545589791, 1857174069, 1422146546 },
+    { 801013669, 396554328, 817922951 },
+    { 798936868, 1835127597, 178069004 },
+    { 1271485079, 2134674884, 954947677 },
+    { 1559395389, 1488243700, 200593589 },
+    { 1114198673, 1877057460, 53404949 },
+    { 987655112, 2132114218, 723040194 },
+    { 491009120, 1778219419, 806861727 },
+    { 1314595508, 1099495096, 1819216446 },
+    { 833264839, 488515260, 1265426865 },
+    { 542955260, 1910661806, 75276617 },
+    { 939509589, 581101110, 1620866408 },
+    { 627153538, 759170114, 274396429 },
+    { 614344774, 1714117792, 1073333297 },
+    { 2102588474, 1914711381, 197334728 },
+    { 1832162286, 1968116330, 1756730118 },
+    { 1816792856, 543672876, 723445143 },
+    { 1447528627, 1350534604, 1711100255 },
+    { 399540075, 1022267402, 54625727 },
+    { 888055336, 140210619, 1369221236 },
+    { 651233494, 215487236, 55002427 },
+    { 1232334604, 1836353644, 597957687 },
+    { 1991504719, 2110750073, 1537467276 },
+    { 1558138863, 1036599722, 17137166 },
+    { 1325366596, 1233934451, 631481940 },
+    { 1145999278, 843180921, 586586766 },
+    { 1689672155, 1566626064, 271265405 },
+    { 892723111, 1130242671, 2088058261 },
+    { 1914990513, 1184868399, 1388103241 },
+    { 2055201132, 406605987, 1787643316 },
+    { 123204721, 461608414, 528215004 },
+    { 1959558365, 1059566101, 1179448499 },
+    { 1922824791, 449549730, 264299455 },
+    { 811940865, 466686896, 108320526 },
+    { 2045875316, 1098168837, 1666459389 },
+    { 741572589, 1684755603, 844342337 },
+    { 160715005, 1956021008, 1990341616 },
+    { 1290957677, 1896595622, 1532530123 },
+    { 328342428, 1137215215, 277769586 },
+    { 734948415, 777374883, 45276451 },
+    { 1196556829, 1305589888, 2100477583 },
+    { 108639282, 337554739, 76198656 },
+    { 558189012, 601854194, 2035757022 },
+    { 1024875909, 710174721, 1811098165 },
+    { 2123044746, 229150462, 475555382 },
+    { 1660316701, 1073492800, 373947051 },
+    { 1468854062, 916350768, 1115519640 },
+    { 1217966036, 301397243, 1276234646 },
+    { 207697603, 579166829, 419708675 },
+    { 985072486, 624443280, 748051103 },
+    { 143178726, 577437215, 1482999518 },
+    { 480733465, 653635872, 532072699 },
+    { 1082587660, 541909246, 640711981 },
+    { 1792762381, 205523763, 1198900994 },
+    { 2021912843, 681079145, 76293255 },
+    { 947921995, 1055026196, 51854353 },
+    { 1864272763, 23062189, 1712171054 },
+    { 18186358, 1299296835, 1033541468 },
+    { 597353187, 1719005510, 104023856 },
+    { 1221796467, 319572965, 311721459 },
+    { 1799233683, 1802572483, 1296793946 },
+    { 305385907, 187161534, 1439972672 },
+    { 847295153, 827873515, 1920706138 },
+    { 1052818916, 2026774509, 855810150 },
+    { 1733898061, 2103067764, 501088883 },
+    { 641440610, 7438469, 375518078 },
+    { 664502799, 1719609524, 1323440074 },
+    { 1963799634, 605667344, 1040229189 },
+    { 1535321496, 709691201, 1058415548 },
+    { 1854894461, 1021412660, 1655768735 },
+    { 1509983296, 170722958, 730081555 },
+    { 1697144830, 1610695631, 381831590 },
+    { 377534697, 1383918121, 687217497 },
+    { 256825559, 92244623, 1534512650 },
+    { 212409675, 593333506, 439847918 },
+    { 219848145, 968851584, 26262331 },
+    { 1939457669, 144808010, 667702941 },
+    { 397641365, 1185037200, 1332205740 },
+    { 1107332566, 95969100, 1148521726 },
+    { 2128745227, 1751737835, 536359574 },
+    { 151984537, 334335742, 243770387 },
+    { 1762680168, 716167332, 1753753683 },
+    { 999114641, 1403384829, 1303414865 },
+    { 1091359264, 790413831, 1680949563 },
+    { 1684692770, 1230261749, 1937775122 },
+    { 506060707, 1256524081, 2701149 },
+    { 650868717, 1924227022, 222549294 },
+    { 1835905917, 1108949115, 14523315 },
+    { 1931875017, 109987193, 412164681 },
+    { 1536129205, 646346768, 1519497247 },
+    { 1870464947, 890117155, 1500758826 },
+    { 439148632, 496387191, 1652743364 },
+    { 1842533461, 1799802056, 1267939884 },
+    { 485463645, 1333267971, 119570878 },
+    { 1715725394, 1123559445, 1210930142 },
+    { 824765827, 1126260595, 748139265 },
+    { 601509202, 1348809889, 1254199972 },
+    { 1710458317, 1363333205, 1905068689 },
+    { 1820445510, 1775497886, 1593490959 },
+    { 319308630, 1147511485, 1377882328 },
+    { 1209425786, 500786664, 766527885 },
+    { 1705812977, 6046380, 489509185 },
+    { 1358131385, 1273986264, 928657817 },
+    { 543915709, 1393557142, 623707630 },
+    { 1667475154, 457003637, 1109171275 },
+    { 646252101, 1205142902, 677413022 },
+    { 1995061991, 311859226, 1502178849 },
+    { 1210911548, 69444267, 2103688051 },
+    { 838925786, 1662935226, 1666662720 },
+    { 1986437271, 893333907, 1339624583 },
+    { 339740287, 1659861792, 1658933213 },
+    { 345786667, 1887329, 720875351 },
+    { 1619772932, 930545146, 279204680 },
+    { 865846426, 1554252777, 1637336066 },
+    { 1322850063, 515940404, 33768127 },
+    { 380509317, 1193353426, 1701243281 },
+    { 692368543, 548048628, 200011735 },
+    { 761812811, 504253031, 47590078 },
+    { 277264389, 23432104, 1258501626 },
+    { 1170598296, 1363056687, 2097427412 },
+    { 682976441, 874506252, 1936381035 },
+    { 684863770, 1595381604, 128637675 },
+    { 1615408917, 1874586284, 474424342 },
+    { 1022178046, 1364438702, 2094197274 },
+    { 1538118450, 1398206829, 812560053 },
+    { 583988229, 951966463, 2135410116 },
+    { 1132036857, 1151978198, 368435786 },
+    { 1636289888, 1199568276, 1060804329 },
+    { 1659721992, 310586254, 1822617140 },
+    { 875295031, 260530018, 2099881530 },
+    { 1749801284, 49427405, 1122996178 },
+    { 1197699240, 178065080, 1805972619 },
+    { 924801876, 652489423, 343352742 },
+    { 141756931, 599203049, 1958761659 },
+    { 1539963760, 1411763102, 833456057 },
+    { 344446575, 1399689571, 224090859 },
+    { 1496424773, 1768125357, 808079088 },
+    { 548509401, 681446038, 1940115945 },
+    { 859095655, 356579531, 1428922186 },
+    { 1119625673, 308977413, 941160530 },
+    { 1169053079, 1431973591, 1816455562 },
+    { 1347118159, 1090462563, 1418773198 },
+    { 1999607582, 1433815305, 468988790 },
+    { 451326984, 1245093316, 1393790666 },
+    { 1863090086, 2078549373, 1535547597 },
+    { 1115296009, 155156584, 928027710 },
+    { 735937718, 963235673, 1272474285 },
+    { 1417383757, 755867970, 621415411 },
+    { 1773963288, 37306508, 1169924812 },
+    { 2082940701, 978467039, 2029020468 },
+    { 1367430644, 647438953, 1001162493 },
+    { 310409559, 2066212151, 22731924 },
+    { 1744224864, 387717293, 1369850084 },
+    { 841834532, 1781507959, 1221974018 },
+    { 772900257, 1169571909, 1673301002 },
+    { 928056842, 2097599619, 1388907441 },
+    { 1891292515, 1222590256, 356719802 },
+    { 499676837, 1844005667, 1092657521 },
+    { 536983346, 866446832, 362557630 },
+    { 1515450385, 747983652, 2136520918 },
+    { 15405690, 1749146145, 2071977971 },
+    { 2081617841, 1771878070, 1291924967 },
+    { 321851486, 994244506, 1602334527 },
+    { 2103359445, 68734876, 1199075743 },
+    { 1125447706, 1742035879, 2040910276 },
+    { 1075563677, 983459672, 666326885 },
+    { 150670286, 1340179474, 1594383727 },
+    { 1994675953, 285353347, 1338192594 },
+    { 713639137, 647910977, 1837869432 },
+    { 1461622789, 636948247, 227369130 },
+    { 1063285287, 561442570, 1742819515 },
+    { 687679709, 1853367538, 1758225205 },
+    { 1681924215, 1308218417, 1692359398 },
+    { 1750659091, 359810512, 2014210884 },
+    { 1345211322, 253237140, 1970086681 },
+    { 181187346, 919564026, 948050740 },
+    { 1521366821, 366464105, 2023614417 },
+    { 1806720168, 1704656700, 26801055 },
+    { 307147498, 1395042484, 2021477009 },
+    { 944095745, 1622411614, 587632498 },
+    { 1505538316, 1217747481, 2049255288 },
+    { 1211422206, 828489038, 965056927 },
+    { 372156975, 373364788, 1652736636 },
+    { 731967487, 240092024, 1187177203 },
+    { 985204628, 62695057, 790352646 },
+    { 1904768654, 1010745797, 2135563969 },
+    { 123749111, 886876567, 169267667 },
+    { 1828405811, 913677622, 1690634488 },
+    { 1075964647, 787670983, 1349871009 },
+    { 550892613, 1375303482, 1657018507 },
+    { 1768640094, 1277075122, 453630604 },
+    { 449645484, 94648401, 1959168920 },
+    { 823010272, 1747385037, 1023107478 },
+    { 1063102296, 787078592, 1395264453 },
+    { 1125797354, 1577431238, 2127231941 },
+    { 2136543151, 1565511559, 964952921 },
+    { 875936070, 1734779227, 722237927 },
+    { 1789613693, 1277930067, 845987038 },
+    { 429801028, 480317428, 526909202 },
+    { 1805104510, 2137335935, 1602873849 },
+    { 934695984, 443482892, 6282815 },
+    { 1029344385, 255168164, 1774922909 },
+    { 629245774, 1278275643, 77084746 },
+    { 1416324366, 526056448, 900095018 },
+    { 846271957, 505804741, 1963197315 },
+    { 264299868, 1470757662, 941511021 },
+    { 1999079095, 45511941, 930570524 },
+    { 1129525515, 891498980, 1806506595 },
+    { 1609842943, 1418408182, 1448636640 },
+    { 1599695231, 873798383, 1878437668 },
+    { 2043178123, 880081198, 1536058531 },
+    { 150862639, 507520460, 323270867 },
+    { 1429138282, 584605206, 1352615253 },
+    { 1955194731, 1484700224, 1981861027 },
+    { 313515824, 1300413891, 1250701746 },
+    { 1784273487, 94441264, 2096973703 },
+    { 1829785428, 1025011789, 213789923 },
+    { 573800760, 684034736, 65385371 },
+    { 1992208942, 2132671376, 1194910886 },
+    { 718523678, 1863625396, 657270181 },
+    { 1598604876, 1252200279, 109481764 },
+    { 2106125336, 1575471147, 5176239 },
+    { 543246894, 780602752, 156038879 },
+    { 2027947119, 614980131, 1585177161 },
+    { 1180877362, 1865681877, 1392888244 },
+    { 1275318627, 1815171932, 1706404069 },
+    { 152846768, 2028961856, 1343193908 },
+    { 836881504, 2094347227, 1025495688 },
+    { 822069232, 1141774465, 1599296449 },
+    { 538210980, 1799044646, 1444021743 },
+    { 1790411260, 1908526411, 15061773 },
+    { 1218398759, 1913702650, 1613666650 },
+    { 1999001511, 2069741529, 1572308338 },
+    { 466497994, 1507435043, 2115555233 },
+    { 184696224, 752839639, 1996018704 },
+    { 1999868156, 311760060, 1029412418 },
+    { 1881346364, 1654953968, 157247397 },
+    { 1828209943, 532966009, 310094165 },
+    { 822500760, 2132262458, 1146975669 },
+    { 474061759, 1428800553, 1969044901 },
+    { 235104522, 1443862327, 359772234 },
+    { 1323524, 910045329, 2699846 },
+    { 2071065054, 334870019, 1221098605 },
+    { 1431016449, 302941604, 1072616468 },
+    { 36372440, 151476660, 1539114462 },
+    { 348132501, 1180889079, 1723810686 },
+    { 2003086469, 1338136476, 1576195195 },
+    { 388568830, 1648230642, 1310057911 },
+    { 373347640, 647722663, 990784207 },
+    { 1802148194, 469283917, 1813284967 },
+    { 1098526873, 829056151, 139863078 },
+    { 2008572202, 831755997, 374967600 },
+    { 195958573, 2052854602, 376291125 },
+    { 498900178, 977987422, 299872531 },
+    { 650376838, 369618236, 1730888980 },
+    { 1831265917, 2093428923, 1767261420 },
+    { 1021918746, 1522140470, 2115393921 },
+    { 522665740, 684714733, 1970996743 },
+    { 1170388403, 1675498940, 212081925 },
+    { 1639672320, 1341300260, 585429566 },
+    { 321244823, 1481163338, 240094112 },
+    { 1153000820, 1856130939, 1338620985 },
+    { 1058371774, 84938416, 1199709539 },
+    { 2036359196, 384810947, 1395668112 },
+    { 258493785, 2115699927, 1894568290 },
+    { 204439060, 1735477699, 397461481 },
+    { 1726579530, 1703387973, 81243750 },
+    { 263810615, 1526901068, 1103162496 },
+    { 1939309556, 1738982993, 1625828236 },
+    { 1133126168, 176928911, 648732992 },
+    { 466805858, 417023023, 140921664 },
+    { 175453149, 1755644008, 462166488 },
+    { 260391565, 807869899, 1615167308 },
+    { 645202512, 56054364, 526055435 },
+    { 613418791, 1950622654, 414930983 },
+    { 201412843, 200600487, 673424768 },
+    { 1904800816, 281844238, 877863828 },
+    { 1284218236, 1385006734, 456959710 },
+    { 875717581, 863351323, 720770326 },
+    { 1052646493, 1512084315, 512596234 },
+    { 1469669516, 1653005979, 1645722402 },
+    { 1077829877, 2115172467, 2112528260 },
+    { 1885699776, 1582856128, 140497762 },
+    { 1941754140, 2108911563, 400889327 },
+    { 1744893147, 376358898, 1046091840 },
+    { 1945493634, 1049783667, 1659510631 },
+    { 79854224, 1927647495, 1860923474 },
+    { 1464860959, 237123558, 1618240642 },
+    { 180728634, 957893884, 754975230 },
+    { 1692812949, 1470490118, 1630692812 },
+    { 1198335280, 968728872, 535855657 },
+    { 1166024100, 933773484, 2005525173 },
+    { 601396580, 1074271246, 935871402 },
+    { 562824495, 1475160574, 674087531 },
+    { 939183393, 373768766, 468358023 },
+    { 1988967060, 2033279397, 65767522 },
+    { 1769130908, 1746719224, 2011261157 },
+    { 2006254466, 1217476218, 2091115381 },
+    { 816664702, 1972451449, 1408492692 },
+    { 139671172, 1455660613, 1589221326 },
+    { 1108400044, 1991516270, 1134550627 },
+    { 2042173528, 1849557795, 185402260 },
+    { 968961127, 637945550, 1351426360 },
+    { 296638053, 1312033081, 1952822940 },
+    { 670406819, 1780391104, 368163787 },
+    { 556202568, 1846158627, 1307347180 },
+    { 155438144, 1709936136, 1148830593 },
+    { 1372914363, 1653567869, 770477853 },
+    { 1197882164, 914576914, 629248671 },
+    { 506059129, 356314592, 1445913373 },
+    { 350091751, 1490865220, 1585584545 },
+    { 52165898, 1676267480, 546500941 },
+    { 690111448, 880210192, 441190821 },
+    { 2002144529, 685549484, 1410151948 },
+    { 1635051986, 1053713271, 1706790001 },
+    { 1333726965, 213576803, 229713172 },
+    { 896179453, 1362407396, 785915741 },
+    { 402263674, 2132885249, 941353885 },
+    { 1316840588, 614650272, 166784600 },
+    { 1673155181, 2060563645, 1364666764 },
+    { 1016536753, 1498664542, 1870725893 },
+    { 545320585, 2045165483, 73333996 },
+    { 1425530777, 338872657, 125499895 },
+    { 2111080261, 1749024605, 815611343 },
+    { 1017309884, 1308330959, 670272225 },
+    { 1230886687, 1538044131, 157840563 },
+    { 445810436, 176476224, 1491567528 },
+    { 431212037, 1117830110, 240263333 },
+    { 1045862310, 1284614710, 642527007 },
+    { 958942307, 501797827, 1959367596 },
+    { 310123202, 225040072, 1485039129 },
+    { 207805037, 298374069, 354092234 },
+    { 546677694, 423873964, 899412819 },
+    { 148218652, 1239485307, 177459948 },
+    { 1456549611, 1909757532, 141056561 },
+    { 847110094, 2067598095, 1158366445 },
+    { 1023586319, 1411681975, 241769484 },
+    { 2141416429, 1651945308, 687579920 },
+    { 1278547491, 146988668, 1118791958 },
+    { 1780345318, 2106356264, 17170620 },
+    { 2005385391, 1443911745, 976112927 },
+    { 156275812, 1798003979, 1286236129 },
+    { 580149776, 549933150, 1494041167 },
+    { 1819635083, 727393098, 2040718861 },
+    { 1581908968, 868449659, 41453865 },
+    { 1502023415, 2026816104, 1498003476 },
+    { 766221743, 121101940, 197629923 },
+    { 270683403, 808681861, 1221216242 },
+    { 417672071, 1927473819, 1215149023 },
+    { 376544687, 1944644439, 346212866 },
+    { 1820456432, 773273718, 2126558185 },
+    { 1470976763, 2059509848, 1984459928 },
+    { 2020909913, 1406067367, 2140735740 },
+    { 600819363, 1299302580, 573401868 },
+    { 1469269022, 1340756446, 245553303 },
+    { 1348601478, 691276274, 1827462271 },
+    { 1469703419, 888906197, 1182002039 },
+    { 130901632, 2110122439, 1948223782 },
+    { 2058375451, 1177787814, 71423537 },
+    { 1855536242, 1524000681, 489095609 },
+    { 481326312, 1503075218, 865640296 },
+    { 393352512, 1340051498, 538613081 },
+    { 1799419879, 1333303590, 2009589844 },
+    { 951238812, 1906705458, 1883016110 },
+    { 144511610, 4775113, 336351825 },
+    { 835787884, 1832237385, 1805620848 },
+    { 1724694082, 866755776, 1006738678 },
+    { 1687332873, 667495910, 328958449 },
+    { 717637040, 738919447, 459860081 },
+    { 94154073, 1228015056, 370751884 },
+    { 1597229291, 2093655353, 78804478 },
+    { 789797141, 484784786, 560130791 },
+    { 2123100731, 346890982, 953483303 },
+    { 1882322541, 82423444, 605419535 },
+    { 1887097654, 418775270, 1556658347 },
+    { 1571851391, 76912470, 1701169957 },
+    { 291123519, 1083651148, 389474193 },
+    { 958619429, 1412609598, 2114168275 },
+    { 1697538877, 1872469679, 1654017501 },
+    { 778070285, 95737916, 224170893 },
+    { 724241990, 174542394, 318324966 },
+    { 1209026776, 734673185, 1915554257 },
+    { 1555917759, 1688156489, 557867750 },
+    { 1638341203, 146092376, 533484833 },
+    { 2057116473, 1702750723, 268323726 },
+    { 2134028943, 1256437032, 7937732 },
+    { 1070196444, 1645911225, 1579789124 },
+    { 335322394, 1612595853, 1870912643 },
+    { 60308425, 1119129706, 682048425 },
+    { 156046341, 1343300599, 232103654 },
+    { 330588736, 1661625565, 1010173939 },
+    { 1065261921, 1429696174, 1734415930 },
+    { 605934762, 1987563924, 795959058 },
+    { 752027138, 373565109, 204393169 },
+    { 307294213, 641888835, 1842734373 },
+    { 1563731245, 649826567, 1752367198 },
+    { 1062158823, 82132043, 1738912494 },
+    { 527271028, 1953044687, 661625290 },
+    { 1646400734, 487609464, 996947684 },
+    { 842217685, 719713118, 1057256109 },
+    { 356359602, 1729887057, 1213302451 },
+    { 1786055776, 1316819339, 1543891187 },
+    { 1626136052, 2112778398, 461669460 },
+    { 1999701161, 169687919, 1067604223 },
+    { 494106348, 2012422292, 1819631361 },
+    { 1143932915, 1617305843, 2126925575 },
+    { 1226064959, 1208734689, 1543173172 },
+    { 1031625998, 1870359979, 457848347 },
+    { 1519235462, 719824015, 985119375 },
+    { 91464932, 1777080124, 484036461 },
+    { 1821351989, 842898927, 1326254146 },
+    { 990687681, 239306466, 1682613748 },
+    { 955982431, 700975927, 1321185876 },
+    { 1125670350, 1768580150, 799838280 },
+    { 990608995, 1440727863, 652055793 },
+    { 460431190, 1420169790, 1146162141 },
+    { 1669165879, 815859315, 142611409 },
+    { 1392042210, 1273707662, 1368676368 },
+    { 2111866225, 111343390, 252818718 },
+    { 1741462701, 595379851, 1772054180 },
+    { 436877981, 1921633998, 1863519112 },
+    { 676184447, 1456764098, 1537387453 },
+    { 1377160374, 630466327, 380591486 },
+    { 998256876, 1430304607, 1336573917 },
+    { 291501092, 2082360401, 314760620 },
+    { 1711670882, 1081038894, 1305369615 },
+    { 380046549, 1223650303, 1765800805 },
+    { 1653754212, 444843023, 1287483036 },
+    { 1765097602, 697661741, 532041598 },
+    { 212993805, 322232273, 496424175 },
+    { 2134627803, 38267737, 90403228 },
+    { 1443908254, 1575655191, 527281209 },
+    { 2074374581, 1956246677, 1203465657 },
+    { 1357195540, 1145336947, 433142383 },
+    { 1292072293, 1460097567, 1431399260 },
+    { 225627540, 617983534, 1722900352 },
+    { 1449277843, 236300691, 1287087586 },
+    { 1894120867, 1523783727, 1667134136 },
+    { 444298960, 2055825325, 1173404700 },
+    { 766531234, 404765852, 791018654 },
+    { 804798971, 495169080, 1004012459 },
+    { 232970514, 1022450290, 991156615 },
+    { 41733544, 78432299, 287581221 },
+    { 1187070491, 511574682, 214472154 },
+    { 499684410, 1942973942, 1571667694 },
+    { 1117667944, 1518390646, 716256340 },
+    { 1353968635, 657994585, 941883880 },
+    { 730268714, 177645073, 243678075 },
+    { 638610391, 1351049773, 2137798942 },
+    { 1043376243, 2142068427, 434614255 },
+    { 1538545323, 998597238, 1201145489 },
+    { 413511965, 1989753853, 2005944460 },
+    { 491944264, 129851426, 91431327 },
+    { 1003518947, 344323580, 133164871 },
+    { 799009241, 1915991275, 1320235362 },
+    { 169916240, 484763967, 1819919772 },
+    { 827910825, 1426647847, 790104068 },
+    { 1005555898, 1670325922, 2144072703 },
+    { 209122023, 1660641217, 726857769 },
+    { 203706802, 2095255472, 1365468160 },
+    { 1202304040, 1148917313, 261360755 },
+    { 1044574246, 1007378125, 1799906078 },
+    { 1174425672, 1098809452, 65934396 },
+    { 1518749253, 1231974323, 557878660 },
+    { 1287256880, 404726037, 1561397607 },
+    { 1772020847, 77162161, 212923201 },
+    { 1051185046, 867266229, 382839441 },
+    { 574027320, 863855284, 1210750266 },
+    { 87184889, 1590713053, 68822516 },
+    { 34956713, 808697565, 277944539 },
+    { 1183874026, 1070058320, 481651341 },
+    { 43768504, 722480751, 1683955381 },
+    { 1142577956, 788415147, 581045979 },
+    { 227068632, 1346293807, 1755471652 },
+    { 631794669, 760207767, 1126737257 },
+    { 708956831, 973130968, 266510489 },
+    { 1576223060, 1355970409, 2038531336 },
+    { 292594697, 419237027, 942232734 },
+    { 1883307750, 488059543, 1516260054 },
+    { 544521668, 766004082, 1603444944 },
+    { 1614579988, 1247655423, 1638401657 },
+    { 189577091, 784127156, 674792036 },
+    { 977992238, 1365173136, 718560540 },
+    { 176802398, 973161140, 1861138496 },
+    { 937010165, 2099898397, 2088207128 },
+    { 1910141133, 218925238, 572518150 },
+    { 1118627894, 109972926, 1281474981 },
+    { 1537864921, 1052205660, 710214393 },
+    { 2025924464, 420982066, 1002809090 },
+    { 644444898, 2024427010, 738633193 },
+    { 1892100321, 1515345020, 1283154861 },
+    { 528743829, 42653408, 750251201 },
+    { 1893916965, 761213948, 939828293 },
+    { 719594457, 474868796, 1917820531 },
+    { 672009206, 415592277, 2094622929 },
+    { 890934444, 988110427, 884149446 },
+    { 1000907370, 122101760, 646806931 },
+    { 2053113030, 832316153, 1765434825 },
+};
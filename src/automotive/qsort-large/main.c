@@ -1,10 +1,11 @@
 #include <msp430.h>
-#include <stdio.h>
-#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <libwispbase/wisp-base.h>
 #include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
 #include <libchain/chain.h>
 
 #ifdef CONFIG_LIBEDB_PRINTF
@@ -13,78 +14,158 @@
 
 #include "pin_assign.h"
 
-#define UNLIMIT
-
 #define WAIT_TICK_DURATION_ITERS 300000
 
-#define SEED 2 // No guarentuee of on-board timer
-#define MAXARRAY 8 // TODO change to 128
-#define STACK_SIZE 8 // 2*ceil(log2(MAXARRAY)), upto next power 2
-
-
 typedef struct my3DVertexStruct {
-    //int x, y, z;
-    unsigned distance;
+    int32_t x, y, z;
 } vertex_t;
 
-typedef struct stack_val {
-    unsigned lo, hi;
-} stack_val_t;
+// Defines NUM_VERTICES and vertices[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input_large.h"
+#endif
 
-static int compare(const unsigned elem1, const unsigned elem2) {
-    unsigned dist1, dist2;
+// Elements handled per task execution: the work lost on a power failure
+#define DIST_BLOCK 16
+#define PARTITION_BLOCK 64
+#define CHECK_BLOCK 128
+
+// Pending subarrays: the smaller half is always sorted first, so the depth
+// is at most ceil(log2(NUM_VERTICES)) + 1, rounded up to a power of 2 for
+// SELF_FIELD_ARRAY_INITIALIZER
+#if NUM_VERTICES <= 32768
+#define STACK_SIZE 16
+#elif NUM_VERTICES <= 65535
+#define STACK_SIZE 32
+#else
+#error NUM_VERTICES is larger than the uint16_t vertex indexes allow
+#endif
+#define STACK_OVERFLOW (STACK_SIZE + 1) // returned by push_range
+
+/* Sorting permutes vertex indexes (not the vertices) between two buffers:
+ * each pass partitions a subarray from one buffer into the other, so the
+ * source is never modified and a partition interrupted by a power failure
+ * can resume from its saved scan position (or be redone). Elements that are
+ * in their final position are copied to order[SORTED] as they settle. */
+#define SORTED 0
+
+__nv static uint32_t dist[NUM_VERTICES];
+__nv static uint16_t order[2][NUM_VERTICES];
+
+// Subarray [lo, hi] of order[buf]
+typedef struct {
+    uint16_t lo, hi;
+    uint16_t buf;
+} range_t;
+
+typedef enum {
+    PART_IDLE = 0,  // pop the next subarray
+    PART_SCAN,      // partition the subarray, in blocks
+    PART_SPLIT,     // place the pivot and push the two halves
+} part_state_t;
+
+// Partition in progress
+typedef struct {
+    range_t range;
+    uint16_t state;     // part_state_t
+    uint16_t pivot;     // vertex index
+    uint16_t pivot_pos; // where the pivot is in the source
+    uint16_t k;         // next source position to scan
+    uint16_t l, r;      // next destination positions from the left/right
+} partition_t;
+
+/** @brief Distance of a vertex from the origin
+ *  @details Fixed-point with no fractional bits: the coordinates are up to
+ *           2^31, so the integer part alone needs 32 bits. The sum of the
+ *           squares fits in 64 bits; the square root is bitwise.
+ */
+static uint32_t distance(const vertex_t *v)
+{
+    uint64_t n = (uint64_t)((int64_t)v->x * v->x) +
+                 (uint64_t)((int64_t)v->y * v->y) +
+                 (uint64_t)((int64_t)v->z * v->z);
+    uint64_t root = 0, bit = (uint64_t)1 << 62;
+
+    while (bit > n)
+        bit >>= 2;
+    while (bit) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
 
-    dist1 = elem1;
-    dist2 = elem2;
+/* Order by distance, ties by index, so that the order is total */
+static int compare(uint16_t v1, uint16_t v2) {
+    uint32_t dist1 = dist[v1], dist2 = dist[v2];
 
-    return (dist1 > dist2) ? 1 : ((dist1 == dist2) ? 0 : -1);
+    if (dist1 != dist2)
+        return dist1 > dist2 ? 1 : -1;
+    return (v1 > v2) ? 1 : ((v1 == v2) ? 0 : -1);
 }
 
-TASK(1, pre_init)
-TASK(2, task_init)
+TASK(1, task_init)
+TASK(2, task_dist)
 TASK(3, task_sort)
-TASK(4, task_end)
+TASK(4, task_check)
 TASK(5, bench_fail)
 TASK(6, bench_success)
 
-// The stack contains subarrays to be processed (i.e. a call stack)
-struct sort_params {
-    SELF_CHAN_FIELD_ARRAY(unsigned, vals, MAXARRAY);
-    SELF_CHAN_FIELD_ARRAY(stack_val_t, stack, STACK_SIZE);
-    SELF_CHAN_FIELD(unsigned, stack_idx);
+struct dist_state {
+    SELF_CHAN_FIELD(unsigned, i);
 };
 
-#define FIELD_INIT_sort_params {\
-    SELF_FIELD_ARRAY_INITIALIZER(MAXARRAY),\
-    SELF_FIELD_ARRAY_INITIALIZER(STACK_SIZE),\
+#define FIELD_INIT_dist_state {\
     SELF_FIELD_INITIALIZER\
 }
 
-struct init_i {
-    SELF_CHAN_FIELD(unsigned, i);
+struct sort_args {
+    CHAN_FIELD(partition_t, part);
+    CHAN_FIELD_ARRAY(range_t, stack, STACK_SIZE);
+    CHAN_FIELD(unsigned, stack_idx);
+};
+
+// The stack contains subarrays to be processed (i.e. a call stack)
+struct sort_state {
+    SELF_CHAN_FIELD(partition_t, part);
+    SELF_CHAN_FIELD_ARRAY(range_t, stack, STACK_SIZE);
+    SELF_CHAN_FIELD(unsigned, stack_idx);
 };
 
-#define FIELD_INIT_init_i {\
+#define FIELD_INIT_sort_state {\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_ARRAY_INITIALIZER(STACK_SIZE),\
     SELF_FIELD_INITIALIZER\
 }
 
-// Add array field
-struct end_vals {
+struct check_args {
+    CHAN_FIELD(unsigned, i);
+    CHAN_FIELD(uint32_t, idx_sum);
+};
+
+struct check_state {
     SELF_CHAN_FIELD(unsigned, i);
-    SELF_CHAN_FIELD_ARRAY(unsigned, vals, MAXARRAY);
+    SELF_CHAN_FIELD(uint32_t, idx_sum);
 };
 
-#define FIELD_INIT_end_vals {\
+#define FIELD_INIT_check_state {\
     SELF_FIELD_INITIALIZER,\
-    SELF_FIELD_ARRAY_INITIALIZER(MAXARRAY)\
+    SELF_FIELD_INITIALIZER\
 }
 
-CHANNEL(pre_init, task_init, init_i);
-CHANNEL(task_init, task_sort, sort_params);
-CHANNEL(task_sort, task_end, end_vals);
-SELF_CHANNEL(task_sort, sort_params);
-SELF_CHANNEL(task_init, init_i);
-SELF_CHANNEL(task_end, end_vals);
+CHANNEL(task_init, task_dist, dist_state);
+SELF_CHANNEL(task_dist, dist_state);
+CHANNEL(task_dist, task_sort, sort_args);
+SELF_CHANNEL(task_sort, sort_state);
+CHANNEL(task_sort, task_check, check_args);
+SELF_CHANNEL(task_check, check_state);
 
 volatile unsigned work_x;
 
@@ -94,40 +175,88 @@ static void burn(uint32_t iters) {
         work_x++;
 }
 
-// Taken from algolist.net/Algorithms/Sorting/Quicksort
-static unsigned partition(unsigned low_idx, unsigned hi_idx) {
-    LOG("Partition\r\n");
-    unsigned vals[MAXARRAY];
-    for (unsigned k = low_idx; k <= hi_idx; k++) {
-        vals[k] = *CHAN_IN2(unsigned, vals[k], SELF_IN_CH(task_sort),
-                CH(task_init, task_sort));
+/** @brief Pick the median of the first, middle and last element as pivot */
+static void partition_start(partition_t *part, const range_t *range) {
+    const uint16_t *src = order[range->buf];
+    uint16_t pos[3] = { range->lo, range->lo + (range->hi - range->lo) / 2,
+                        range->hi };
+    uint16_t tmp;
+
+    if (compare(src[pos[1]], src[pos[0]]) < 0) {
+        tmp = pos[0]; pos[0] = pos[1]; pos[1] = tmp;
     }
-    unsigned i = low_idx, j = hi_idx;
-    unsigned tmp;
-    unsigned pivot = vals[(i + j) / 2];
-
-    while (i <= j) {
-        while (compare(vals[i], pivot) < 0) { i++;}
-        while (compare(vals[j], pivot) > 0) { j--;}
-        if (i <= j) {
-            tmp = vals[i];
-            vals[i] = vals[j];
-            vals[j] = tmp;
-            i++;
-            j++;
+    if (compare(src[pos[2]], src[pos[1]]) < 0) {
+        tmp = pos[1]; pos[1] = pos[2]; pos[2] = tmp;
+        if (compare(src[pos[1]], src[pos[0]]) < 0) {
+            tmp = pos[0]; pos[0] = pos[1]; pos[1] = tmp;
         }
     }
-    for (unsigned k = low_idx; k <= hi_idx; k++) {
-        CHAN_OUT1(unsigned, vals[k], vals[k], SELF_OUT_CH(task_sort));
-        if (i <= MAXARRAY) {
-        //TODO caused lots of printing garbage
-            LOG("vals[%u] = %u\r\n", k, vals[k]);
-        }
+
+    part->range = *range;
+    part->state = PART_SCAN;
+    part->pivot_pos = pos[1];
+    part->pivot = src[pos[1]];
+    part->k = range->lo;
+    part->l = range->lo;
+    part->r = range->hi;
+}
+
+/** @brief Scan up to PARTITION_BLOCK source elements
+ *  @details Writes only to the destination buffer, at positions determined
+ *           by the saved state, so re-executing a block is harmless.
+ */
+static void partition_step(partition_t *part) {
+    const uint16_t *src = order[part->range.buf];
+    uint16_t *dst = order[!part->range.buf];
+    unsigned end = (unsigned)part->k + PARTITION_BLOCK;
+    uint16_t v;
+
+    if (end > (unsigned)part->range.hi + 1)
+        end = (unsigned)part->range.hi + 1;
+
+    for ( ; part->k < end; part->k++) {
+        if (part->k == part->pivot_pos)
+            continue;
+        v = src[part->k];
+        if (compare(v, part->pivot) < 0)
+            dst[part->l++] = v;
+        else
+            dst[part->r--] = v;
     }
-    return i;
+
+    if (part->k > part->range.hi) {
+        dst[part->l] = part->pivot; // l == r
+        part->state = PART_SPLIT;
+    }
+}
+
+/** @brief Copy an element in its final position to the sorted buffer
+ *  @details Only called once the subarray that contained the position in
+ *           the sorted buffer has been scanned, i.e. it is no longer read.
+ */
+static void settle(uint16_t buf, unsigned pos) {
+    if (buf != SORTED)
+        order[SORTED][pos] = order[buf][pos];
 }
 
+/** @brief Push a half of a partitioned subarray, unless it is settled
+ *  @return Updated stack index, or STACK_OVERFLOW if the stack is full
+ *          (also when passed STACK_OVERFLOW)
+ */
+static unsigned push_range(unsigned stack_i, int lo, int hi, uint16_t buf) {
+    range_t range = { lo, hi, buf };
+
+    if (lo == hi)
+        settle(buf, lo);
+    if (lo >= hi)
+        return stack_i;
 
+    if (stack_i >= STACK_SIZE)
+        return STACK_OVERFLOW;
+
+    CHAN_OUT1(range_t, stack[stack_i], range, SELF_OUT_CH(task_sort));
+    return stack_i + 1;
+}
 
 void init() {
     WISP_init();
@@ -144,114 +273,157 @@ void init() {
     INIT_CONSOLE();
 
     __enable_interrupt();
-
-    srand(SEED);
+    msp_cycles_start();
 }
 
-void pre_init() {
+void task_init() {
     task_prologue();
+    LOG("\r\ninit\r\n");
+
     unsigned i = 0;
-    CHAN_OUT1(unsigned, i, i, CH(pre_init, task_init));
-    TRANSITION_TO(task_init);
+    CHAN_OUT1(unsigned, i, i, CH(task_init, task_dist));
+    TRANSITION_TO(task_dist);
 }
 
-// Assemble array, transition to task_sort
-void task_init() {
+// Compute the distances and the initial (identity) order
+void task_dist() {
     task_prologue();
-    LOG("\r\ninit\r\n");
 
-    unsigned i = *CHAN_IN2(unsigned, i, SELF_IN_CH(task_init),
-            CH(pre_init, task_init));
+    unsigned i, end;
+
+    i = *CHAN_IN2(unsigned, i, CH(task_init, task_dist), SELF_IN_CH(task_dist));
 
-    unsigned val;
-    for ( ; i < MAXARRAY; i++) {
-        val = (unsigned) rand();
-        CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task_init));
-        CHAN_OUT1(unsigned, vals[i], val,
-                CH(task_init, task_sort));
-        LOG("%u:%u\r\n", i, val);
+    end = i + DIST_BLOCK;
+    if (end > NUM_VERTICES)
+        end = NUM_VERTICES;
+    for ( ; i < end; i++) {
+        dist[i] = distance(&vertices[i]);
+        order[0][i] = i;
     }
 
-    // Set stack idx to 0xFFFF - need a default value
-    unsigned stack_i = 0;
-    stack_val_t stack_val;
-    stack_val.lo = 0;
-    stack_val.hi = MAXARRAY - 1;
-    CHAN_OUT1(unsigned, stack_idx, stack_i,
-            CH(task_init, task_sort));
-    CHAN_OUT1(stack_val_t, stack[0], stack_val, CH(task_init, task_sort));
+    if (i < NUM_VERTICES) {
+        CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task_dist));
+        TRANSITION_TO(task_dist);
+    }
+
+    LOG("dist: done\r\n");
+
+    partition_t part = { .state = PART_IDLE };
+    range_t range = { 0, NUM_VERTICES - 1, 0 };
+    unsigned stack_i = 1;
+    CHAN_OUT1(partition_t, part, part, CH(task_dist, task_sort));
+    CHAN_OUT1(range_t, stack[0], range, CH(task_dist, task_sort));
+    CHAN_OUT1(unsigned, stack_idx, stack_i, CH(task_dist, task_sort));
     TRANSITION_TO(task_sort);
 }
 
 void task_sort() {
-    stack_val_t stack_val, new_val;
     task_prologue();
-    unsigned stack_i, i;
-    // How much the stack index will change by
-    int d_stacki = 0;
-
-
-    stack_i = *CHAN_IN2(unsigned, stack_idx,
-            CH(task_init, task_sort), SELF_IN_CH(task_sort));
-    stack_val = *CHAN_IN2(stack_val_t, stack[stack_i],
-        CH(task_init, task_sort), SELF_IN_CH(task_sort));
-    // NOTE: Chain array symantics are pretty bad
-    LOG("sort: stacki=%u, lo = %u, hi = %u\r\n",
-            stack_i, stack_val.lo, stack_val.hi);
-    if (stack_i < ((unsigned) -1) && (stack_val.lo < stack_val.hi)) {
-            i = partition(stack_val.lo, stack_val.hi);
-            LOG("i = %u\r\n", i);
-            if (stack_val.lo < i - 1) {
-                LOG("Adding to stack lo: %u:%u\r\n", stack_val.lo, i-1);
-                new_val.lo = stack_val.lo;
-                new_val.hi = i - 1;
-                CHAN_OUT1(stack_val_t, stack[stack_i + d_stacki],
-                        new_val, SELF_OUT_CH(task_sort));
-                d_stacki++;
+
+    partition_t part;
+    range_t range;
+    unsigned stack_i, stack_i_orig;
+
+    part = *CHAN_IN2(partition_t, part,
+            CH(task_dist, task_sort), SELF_IN_CH(task_sort));
+    stack_i = stack_i_orig = *CHAN_IN2(unsigned, stack_idx,
+            CH(task_dist, task_sort), SELF_IN_CH(task_sort));
+
+    switch (part.state) {
+        case PART_IDLE:
+            if (stack_i == 0) {
+                LOG("sort: done\r\n");
+                unsigned i = 0;
+                uint32_t idx_sum = 0;
+                CHAN_OUT1(unsigned, i, i, CH(task_sort, task_check));
+                CHAN_OUT1(uint32_t, idx_sum, idx_sum, CH(task_sort, task_check));
+                TRANSITION_TO(task_check);
             }
-            if (i < stack_val.hi) {
-                LOG("Adding to stack hi: %u:%u\r\n", i, stack_val.hi);
-                new_val.lo = i;
-                new_val.hi = stack_val.hi;
-                CHAN_OUT1(stack_val_t, stack[stack_i + d_stacki],
-                        new_val, SELF_OUT_CH(task_sort));
-                d_stacki++;
+
+            --stack_i;
+            range = *CHAN_IN2(range_t, stack[stack_i],
+                    CH(task_dist, task_sort), SELF_IN_CH(task_sort));
+            LOG("sort: stack_i=%u lo=%u hi=%u buf=%u\r\n",
+                stack_i, range.lo, range.hi, range.buf);
+            partition_start(&part, &range);
+            // fall through
+        case PART_SCAN:
+            partition_step(&part);
+            break;
+        case PART_SPLIT: {
+            // The pivot is in place, the halves are in the other buffer.
+            // Push the larger half first, so that the smaller is sorted
+            // first, which bounds the depth of the stack.
+            int lo = part.range.lo, hi = part.range.hi, mid = part.l;
+            uint16_t buf = !part.range.buf;
+
+            settle(buf, mid);
+            if (mid - lo > hi - mid) {
+                stack_i = push_range(stack_i, lo, mid - 1, buf);
+                stack_i = push_range(stack_i, mid + 1, hi, buf);
+            } else {
+                stack_i = push_range(stack_i, mid + 1, hi, buf);
+                stack_i = push_range(stack_i, lo, mid - 1, buf);
             }
-            stack_i += d_stacki - 1; // -1 since we used up the current idx
-            LOG("Transition_to task_sort - stack_i = %u\r\n", stack_i);
-            CHAN_OUT1(unsigned, stack_idx, stack_i,
-                    SELF_OUT_CH(task_sort));
-            TRANSITION_TO(task_sort);
-    } else {
-        LOG("Done sorting - transitioning to task_end\r\n");
-        unsigned int end_i = 0;
-        CHAN_OUT1(unsigned, i, end_i, CH(task_sort, task_end));
-        unsigned val;
-        for (unsigned i = 0; i < MAXARRAY; i++) {
-            val = *CHAN_IN2(unsigned, vals[i], CH(task_init, task_sort),
-                    SELF_IN_CH(task_sort));
-            CHAN_OUT1(unsigned, vals[i], val, CH(task_sort, task_end));
+            if (stack_i == STACK_OVERFLOW) {
+                LOG("Stack overflow at depth %u\r\n", STACK_SIZE);
+                PRINTF("cycles: %n\r\n", msp_cycles());
+                CHAIN_REPORT();
+                TRANSITION_TO(bench_fail);
+            }
+            part.state = PART_IDLE;
+            break;
         }
-        TRANSITION_TO(task_end);
     }
+
+    CHAN_OUT1(partition_t, part, part, SELF_OUT_CH(task_sort));
+    if (stack_i != stack_i_orig)
+        CHAN_OUT1(unsigned, stack_idx, stack_i, SELF_OUT_CH(task_sort));
+    TRANSITION_TO(task_sort);
 }
 
-void task_end() {
+// Check that the distances are in order and that the indexes add up
+void task_check() {
     task_prologue();
-    unsigned vals[MAXARRAY];
-
-    unsigned i = *CHAN_IN2(unsigned, i, SELF_IN_CH(task_end),
-            CH(task_sort, task_end));
-    vals[i] = *CHAN_IN1(unsigned, vals[i], CH(task_sort, task_end));
-    for ( ; i < MAXARRAY-1; i++) {
-        CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task_end));
-        vals[i+1] = *CHAN_IN1(unsigned, vals[i], CH(task_sort, task_end));
-        if (compare(vals[i+1],vals[i]) < 0) {
-            LOG("Failed to sort correctly\r\n");
+
+    unsigned i, end;
+    uint32_t idx_sum;
+
+    i = *CHAN_IN2(unsigned, i, CH(task_sort, task_check), SELF_IN_CH(task_check));
+    idx_sum = *CHAN_IN2(uint32_t, idx_sum,
+            CH(task_sort, task_check), SELF_IN_CH(task_check));
+
+    end = i + CHECK_BLOCK;
+    if (end > NUM_VERTICES)
+        end = NUM_VERTICES;
+    for ( ; i < end; i++) {
+        idx_sum += order[SORTED][i];
+        if (i > 0 && compare(order[SORTED][i], order[SORTED][i - 1]) < 0) {
+            LOG("Failed to sort correctly at %u\r\n", i);
+            PRINTF("cycles: %n\r\n", msp_cycles());
+            CHAIN_REPORT();
             TRANSITION_TO(bench_fail);
         }
     }
+
+    if (i < NUM_VERTICES) {
+        CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task_check));
+        CHAN_OUT1(uint32_t, idx_sum, idx_sum, SELF_OUT_CH(task_check));
+        TRANSITION_TO(task_check);
+    }
+
+    if (idx_sum != (uint32_t)NUM_VERTICES * (NUM_VERTICES - 1) / 2) {
+        LOG("Not a permutation\r\n");
+        PRINTF("cycles: %n\r\n", msp_cycles());
+        CHAIN_REPORT();
+        TRANSITION_TO(bench_fail);
+    }
+
     LOG("success\r\n");
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("Sorted %u vectors based on distance from the origin.\r\n",
+           NUM_VERTICES);
+    CHAIN_REPORT();
     TRANSITION_TO(bench_success);
 }
 
@@ -275,5 +447,5 @@ void bench_success() {
     TRANSITION_TO(bench_success);
 }
 
-ENTRY_TASK(pre_init)
+ENTRY_TASK(task_init)
 INIT_FUNC(init)
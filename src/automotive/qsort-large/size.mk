@@ -0,0 +1,5 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): vertices sorted
+SIZE_small = 512
+SIZE_medium = 1024
+SIZE_large = 2048
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,45 @@
+#! /bin/bash
+#
+# Generate input_small.h from the first N strings of MiBench's input file
+#
+# The strings are packed, each terminated by a NUL, into one __ro_nv array;
+# a second array holds the offset of each string.
+#
+# Usage: ./gen_input.sh [count] [input_small.dat] > input_small.h
+
+COUNT=${1:-1024}
+INPUT=${2:-../../../mibench-src/automotive/qsort/input_small.dat}
+
+awk -v count=$COUNT '
+    function escape(s) {
+        gsub(/\\/, "\\\\", s)
+        gsub(/"/, "\\\"", s)
+        return s
+    }
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench qsort input_small.dat */"
+        print ""
+        print "#define NUM_STRINGS " count
+        print ""
+        print "__ro_nv static const char string_pool[] ="
+    }
+    {
+        for (f = 1; f <= NF && n < count; ++f) {
+            printf "    \"%s\\0\"\n", escape($f)
+            offsets[n++] = pos + 0
+            pos += length($f) + 1
+        }
+    }
+    END {
+        print "    ;"
+        print ""
+        print "__ro_nv static const uint16_t string_offsets[NUM_STRINGS] = {"
+        for (i = 0; i < n; i += 8) {
+            line = "   "
+            for (j = i; j < i + 8 && j < n; ++j)
+                line = line " " offsets[j] ","
+            print line
+        }
+        print "};"
+    }
+' $INPUT
@@ -0,0 +1,1161 @@
+/* Generated by gen_input.sh from MiBench qsort input_small.dat */
+
+#define NUM_STRINGS 1024
+
+__ro_nv static const char string_pool[] =
+    "Kurt\0"
+    "Vonneguts\0"
+    "Commencement\0"
+    "Address\0"
+    "at\0"
+    "MIT\0"
+    "Ladies\0"
+    "and\0"
+    "gentlemen\0"
+    "of\0"
+    "the\0"
+    "class\0"
+    "of\0"
+    "97\0"
+    "Wear\0"
+    "sunscreen\0"
+    "If\0"
+    "I\0"
+    "could\0"
+    "offer\0"
+    "you\0"
+    "only\0"
+    "one\0"
+    "tip\0"
+    "for\0"
+    "the\0"
+    "future\0"
+    "sunscreen\0"
+    "would\0"
+    "be\0"
+    "it\0"
+    "The\0"
+    "longterm\0"
+    "benefits\0"
+    "of\0"
+    "sunscreen\0"
+    "have\0"
+    "been\0"
+    "proved\0"
+    "by\0"
+    "scientists\0"
+    "whereas\0"
+    "the\0"
+    "rest\0"
+    "of\0"
+    "my\0"
+    "advice\0"
+    "has\0"
+    "no\0"
+    "basis\0"
+    "more\0"
+    "reliable\0"
+    "than\0"
+    "my\0"
+    "own\0"
+    "meandering\0"
+    "experience\0"
+    "I\0"
+    "will\0"
+    "dispense\0"
+    "this\0"
+    "advice\0"
+    "now\0"
+    "Enjoy\0"
+    "the\0"
+    "power\0"
+    "and\0"
+    "beauty\0"
+    "of\0"
+    "your\0"
+    "youth\0"
+    "Oh\0"
+    "never\0"
+    "mind\0"
+    "You\0"
+    "will\0"
+    "not\0"
+    "understand\0"
+    "the\0"
+    "power\0"
+    "and\0"
+    "beauty\0"
+    "of\0"
+    "your\0"
+    "youth\0"
+    "until\0"
+    "theyve\0"
+    "faded\0"
+    "But\0"
+    "trust\0"
+    "me\0"
+    "in\0"
+    "20\0"
+    "years\0"
+    "youll\0"
+    "look\0"
+    "back\0"
+    "at\0"
+    "photos\0"
+    "of\0"
+    "yourself\0"
+    "and\0"
+    "recall\0"
+    "in\0"
+    "a\0"
+    "way\0"
+    "you\0"
+    "cant\0"
+    "grasp\0"
+    "now\0"
+    "how\0"
+    "much\0"
+    "possibility\0"
+    "lay\0"
+    "before\0"
+    "you\0"
+    "and\0"
+    "how\0"
+    "fabulous\0"
+    "you\0"
+    "really\0"
+    "looked\0"
+    "You\0"
+    "are\0"
+    "not\0"
+    "as\0"
+    "fat\0"
+    "as\0"
+    "you\0"
+    "imagine\0"
+    "Dont\0"
+    "worry\0"
+    "about\0"
+    "the\0"
+    "future\0"
+    "Or\0"
+    "worry\0"
+    "but\0"
+    "know\0"
+    "that\0"
+    "worrying\0"
+    "is\0"
+    "as\0"
+    "effective\0"
+    "as\0"
+    "trying\0"
+    "to\0"
+    "solve\0"
+    "an\0"
+    "algebra\0"
+    "equation\0"
+    "by\0"
+    "chewing\0"
+    "bubble\0"
+    "gum\0"
+    "The\0"
+    "real\0"
+    "troubles\0"
+    "in\0"
+    "your\0"
+    "life\0"
+    "are\0"
+    "apt\0"
+    "to\0"
+    "be\0"
+    "things\0"
+    "that\0"
+    "never\0"
+    "crossed\0"
+    "your\0"
+    "worried\0"
+    "mind\0"
+    "the\0"
+    "kind\0"
+    "that\0"
+    "blindside\0"
+    "you\0"
+    "at\0"
+    "4\0"
+    "pm\0"
+    "on\0"
+    "some\0"
+    "idle\0"
+    "Tuesday\0"
+    "Do\0"
+    "one\0"
+    "thing\0"
+    "every\0"
+    "day\0"
+    "that\0"
+    "scares\0"
+    "you\0"
+    "Sing\0"
+    "Dont\0"
+    "be\0"
+    "reckless\0"
+    "with\0"
+    "other\0"
+    "peoples\0"
+    "hearts\0"
+    "Dont\0"
+    "put\0"
+    "up\0"
+    "with\0"
+    "people\0"
+    "who\0"
+    "are\0"
+    "reckless\0"
+    "with\0"
+    "yours\0"
+    "Floss\0"
+    "Dont\0"
+    "waste\0"
+    "your\0"
+    "time\0"
+    "on\0"
+    "jealousy\0"
+    "Sometimes\0"
+    "youre\0"
+    "ahead\0"
+    "sometimes\0"
+    "youre\0"
+    "behind\0"
+    "The\0"
+    "race\0"
+    "is\0"
+    "long\0"
+    "and\0"
+    "in\0"
+    "the\0"
+    "end\0"
+    "its\0"
+    "only\0"
+    "with\0"
+    "yourself\0"
+    "Remember\0"
+    "compliments\0"
+    "you\0"
+    "receive\0"
+    "Forget\0"
+    "the\0"
+    "insults\0"
+    "If\0"
+    "you\0"
+    "succeed\0"
+    "in\0"
+    "doing\0"
+    "this\0"
+    "tell\0"
+    "me\0"
+    "how\0"
+    "Keep\0"
+    "your\0"
+    "old\0"
+    "love\0"
+    "letters\0"
+    "Throw\0"
+    "away\0"
+    "your\0"
+    "old\0"
+    "bank\0"
+    "statements\0"
+    "Stretch\0"
+    "Dont\0"
+    "feel\0"
+    "guilty\0"
+    "if\0"
+    "you\0"
+    "dont\0"
+    "know\0"
+    "what\0"
+    "you\0"
+    "want\0"
+    "to\0"
+    "do\0"
+    "with\0"
+    "your\0"
+    "life\0"
+    "The\0"
+    "most\0"
+    "interesting\0"
+    "people\0"
+    "I\0"
+    "know\0"
+    "didnt\0"
+    "know\0"
+    "at\0"
+    "22\0"
+    "what\0"
+    "they\0"
+    "wanted\0"
+    "to\0"
+    "do\0"
+    "with\0"
+    "their\0"
+    "lives\0"
+    "Some\0"
+    "of\0"
+    "the\0"
+    "most\0"
+    "interesting\0"
+    "40yearolds\0"
+    "I\0"
+    "know\0"
+    "still\0"
+    "dont\0"
+    "Get\0"
+    "plenty\0"
+    "of\0"
+    "calcium\0"
+    "Be\0"
+    "kind\0"
+    "to\0"
+    "your\0"
+    "knees\0"
+    "Youll\0"
+    "miss\0"
+    "them\0"
+    "when\0"
+    "theyre\0"
+    "gone\0"
+    "Maybe\0"
+    "youll\0"
+    "marry\0"
+    "maybe\0"
+    "you\0"
+    "wont\0"
+    "Maybe\0"
+    "youll\0"
+    "have\0"
+    "children\0"
+    "maybe\0"
+    "you\0"
+    "wont\0"
+    "Maybe\0"
+    "youll\0"
+    "divorce\0"
+    "at\0"
+    "40\0"
+    "maybe\0"
+    "youll\0"
+    "dance\0"
+    "the\0"
+    "funky\0"
+    "chicken\0"
+    "on\0"
+    "your\0"
+    "75th\0"
+    "wedding\0"
+    "anniversary\0"
+    "Whatever\0"
+    "you\0"
+    "do\0"
+    "dont\0"
+    "congratulate\0"
+    "yourself\0"
+    "too\0"
+    "much\0"
+    "or\0"
+    "berate\0"
+    "yourself\0"
+    "either\0"
+    "Your\0"
+    "choices\0"
+    "are\0"
+    "half\0"
+    "chance\0"
+    "So\0"
+    "are\0"
+    "everybody\0"
+    "elses\0"
+    "Enjoy\0"
+    "your\0"
+    "body\0"
+    "Use\0"
+    "it\0"
+    "every\0"
+    "way\0"
+    "you\0"
+    "can\0"
+    "Dont\0"
+    "be\0"
+    "afraid\0"
+    "of\0"
+    "it\0"
+    "or\0"
+    "of\0"
+    "what\0"
+    "other\0"
+    "people\0"
+    "think\0"
+    "of\0"
+    "it\0"
+    "Its\0"
+    "the\0"
+    "greatest\0"
+    "instrument\0"
+    "youll\0"
+    "ever\0"
+    "own\0"
+    "Dance\0"
+    "even\0"
+    "if\0"
+    "you\0"
+    "have\0"
+    "nowhere\0"
+    "to\0"
+    "do\0"
+    "it\0"
+    "but\0"
+    "your\0"
+    "living\0"
+    "room\0"
+    "Read\0"
+    "the\0"
+    "directions\0"
+    "even\0"
+    "if\0"
+    "you\0"
+    "dont\0"
+    "follow\0"
+    "them\0"
+    "Do\0"
+    "not\0"
+    "read\0"
+    "beauty\0"
+    "magazines\0"
+    "They\0"
+    "will\0"
+    "only\0"
+    "make\0"
+    "you\0"
+    "feel\0"
+    "ugly\0"
+    "Get\0"
+    "to\0"
+    "know\0"
+    "your\0"
+    "parents\0"
+    "You\0"
+    "never\0"
+    "know\0"
+    "when\0"
+    "theyll\0"
+    "be\0"
+    "gone\0"
+    "for\0"
+    "good\0"
+    "Be\0"
+    "nice\0"
+    "to\0"
+    "your\0"
+    "siblings\0"
+    "Theyre\0"
+    "your\0"
+    "best\0"
+    "link\0"
+    "to\0"
+    "your\0"
+    "past\0"
+    "and\0"
+    "the\0"
+    "people\0"
+    "most\0"
+    "likely\0"
+    "to\0"
+    "stick\0"
+    "with\0"
+    "you\0"
+    "in\0"
+    "the\0"
+    "future\0"
+    "Understand\0"
+    "that\0"
+    "friends\0"
+    "come\0"
+    "and\0"
+    "go\0"
+    "but\0"
+    "with\0"
+    "a\0"
+    "precious\0"
+    "few\0"
+    "you\0"
+    "should\0"
+    "hold\0"
+    "on\0"
+    "Work\0"
+    "hard\0"
+    "to\0"
+    "bridge\0"
+    "the\0"
+    "gaps\0"
+    "in\0"
+    "geography\0"
+    "and\0"
+    "lifestyle\0"
+    "because\0"
+    "the\0"
+    "older\0"
+    "you\0"
+    "get\0"
+    "the\0"
+    "more\0"
+    "you\0"
+    "need\0"
+    "the\0"
+    "people\0"
+    "who\0"
+    "knew\0"
+    "you\0"
+    "when\0"
+    "you\0"
+    "were\0"
+    "young\0"
+    "Live\0"
+    "in\0"
+    "New\0"
+    "York\0"
+    "City\0"
+    "once\0"
+    "but\0"
+    "leave\0"
+    "before\0"
+    "it\0"
+    "makes\0"
+    "you\0"
+    "hard\0"
+    "Live\0"
+    "in\0"
+    "Northern\0"
+    "California\0"
+    "once\0"
+    "but\0"
+    "leave\0"
+    "before\0"
+    "it\0"
+    "makes\0"
+    "you\0"
+    "soft\0"
+    "Travel\0"
+    "Accept\0"
+    "certain\0"
+    "inalienable\0"
+    "truths\0"
+    "Prices\0"
+    "will\0"
+    "rise\0"
+    "Politicians\0"
+    "will\0"
+    "philander\0"
+    "You\0"
+    "too\0"
+    "will\0"
+    "get\0"
+    "old\0"
+    "And\0"
+    "when\0"
+    "you\0"
+    "do\0"
+    "youll\0"
+    "fantasize\0"
+    "that\0"
+    "when\0"
+    "you\0"
+    "were\0"
+    "young\0"
+    "prices\0"
+    "were\0"
+    "reasonable\0"
+    "politicians\0"
+    "were\0"
+    "noble\0"
+    "and\0"
+    "children\0"
+    "respected\0"
+    "their\0"
+    "elders\0"
+    "Respect\0"
+    "your\0"
+    "elders\0"
+    "Dont\0"
+    "expect\0"
+    "anyone\0"
+    "else\0"
+    "to\0"
+    "support\0"
+    "you\0"
+    "Maybe\0"
+    "you\0"
+    "have\0"
+    "a\0"
+    "trust\0"
+    "fund\0"
+    "Maybe\0"
+    "youll\0"
+    "have\0"
+    "a\0"
+    "wealthy\0"
+    "spouse\0"
+    "But\0"
+    "you\0"
+    "never\0"
+    "know\0"
+    "when\0"
+    "either\0"
+    "one\0"
+    "might\0"
+    "run\0"
+    "out\0"
+    "Dont\0"
+    "mess\0"
+    "too\0"
+    "much\0"
+    "with\0"
+    "your\0"
+    "hair\0"
+    "or\0"
+    "by\0"
+    "the\0"
+    "time\0"
+    "youre\0"
+    "40\0"
+    "it\0"
+    "will\0"
+    "look\0"
+    "85\0"
+    "Be\0"
+    "careful\0"
+    "whose\0"
+    "advice\0"
+    "you\0"
+    "buy\0"
+    "but\0"
+    "be\0"
+    "patient\0"
+    "with\0"
+    "those\0"
+    "who\0"
+    "supply\0"
+    "it\0"
+    "Advice\0"
+    "is\0"
+    "a\0"
+    "form\0"
+    "of\0"
+    "nostalgia\0"
+    "Dispensing\0"
+    "it\0"
+    "is\0"
+    "a\0"
+    "way\0"
+    "of\0"
+    "fishing\0"
+    "the\0"
+    "past\0"
+    "from\0"
+    "the\0"
+    "disposal\0"
+    "wiping\0"
+    "it\0"
+    "off\0"
+    "painting\0"
+    "over\0"
+    "the\0"
+    "ugly\0"
+    "parts\0"
+    "and\0"
+    "recycling\0"
+    "it\0"
+    "for\0"
+    "more\0"
+    "than\0"
+    "its\0"
+    "worth\0"
+    "But\0"
+    "trust\0"
+    "me\0"
+    "on\0"
+    "the\0"
+    "sunscreen\0"
+    "Kurt\0"
+    "Vonneguts\0"
+    "Commencement\0"
+    "Address\0"
+    "at\0"
+    "MIT\0"
+    "Ladies\0"
+    "and\0"
+    "gentlemen\0"
+    "of\0"
+    "the\0"
+    "class\0"
+    "of\0"
+    "97\0"
+    "Wear\0"
+    "sunscreen\0"
+    "If\0"
+    "I\0"
+    "could\0"
+    "offer\0"
+    "you\0"
+    "only\0"
+    "one\0"
+    "tip\0"
+    "for\0"
+    "the\0"
+    "future\0"
+    "sunscreen\0"
+    "would\0"
+    "be\0"
+    "it\0"
+    "The\0"
+    "longterm\0"
+    "benefits\0"
+    "of\0"
+    "sunscreen\0"
+    "have\0"
+    "been\0"
+    "proved\0"
+    "by\0"
+    "scientists\0"
+    "whereas\0"
+    "the\0"
+    "rest\0"
+    "of\0"
+    "my\0"
+    "advice\0"
+    "has\0"
+    "no\0"
+    "basis\0"
+    "more\0"
+    "reliable\0"
+    "than\0"
+    "my\0"
+    "own\0"
+    "meandering\0"
+    "experience\0"
+    "I\0"
+    "will\0"
+    "dispense\0"
+    "this\0"
+    "advice\0"
+    "now\0"
+    "Enjoy\0"
+    "the\0"
+    "power\0"
+    "and\0"
+    "beauty\0"
+    "of\0"
+    "your\0"
+    "youth\0"
+    "Oh\0"
+    "never\0"
+    "mind\0"
+    "You\0"
+    "will\0"
+    "not\0"
+    "understand\0"
+    "the\0"
+    "power\0"
+    "and\0"
+    "beauty\0"
+    "of\0"
+    "your\0"
+    "youth\0"
+    "until\0"
+    "theyve\0"
+    "faded\0"
+    "But\0"
+    "trust\0"
+    "me\0"
+    "in\0"
+    "20\0"
+    "years\0"
+    "youll\0"
+    "look\0"
+    "back\0"
+    "at\0"
+    "photos\0"
+    "of\0"
+    "yourself\0"
+    "and\0"
+    "recall\0"
+    "in\0"
+    "a\0"
+    "way\0"
+    "you\0"
+    "cant\0"
+    "grasp\0"
+    "now\0"
+    "how\0"
+    "much\0"
+    "possibility\0"
+    "lay\0"
+    "before\0"
+    "you\0"
+    "and\0"
+    "how\0"
+    "fabulous\0"
+    "you\0"
+    "really\0"
+    "looked\0"
+    "You\0"
+    "are\0"
+    "not\0"
+    "as\0"
+    "fat\0"
+    "as\0"
+    "you\0"
+    "imagine\0"
+    "Dont\0"
+    "worry\0"
+    "about\0"
+    "the\0"
+    "future\0"
+    "Or\0"
+    "worry\0"
+    "but\0"
+    "know\0"
+    "that\0"
+    "worrying\0"
+    "is\0"
+    "as\0"
+    "effective\0"
+    "as\0"
+    "trying\0"
+    "to\0"
+    "solve\0"
+    "an\0"
+    "algebra\0"
+    "equation\0"
+    "by\0"
+    "chewing\0"
+    "bubble\0"
+    "gum\0"
+    "The\0"
+    "real\0"
+    "troubles\0"
+    "in\0"
+    "your\0"
+    "life\0"
+    "are\0"
+    "apt\0"
+    "to\0"
+    "be\0"
+    "things\0"
+    "that\0"
+    "never\0"
+    "crossed\0"
+    "your\0"
+    "worried\0"
+    "mind\0"
+    "the\0"
+    "kind\0"
+    "that\0"
+    "blindside\0"
+    "you\0"
+    "at\0"
+    "4\0"
+    "pm\0"
+    "on\0"
+    "some\0"
+    "idle\0"
+    "Tuesday\0"
+    "Do\0"
+    "one\0"
+    "thing\0"
+    "every\0"
+    "day\0"
+    "that\0"
+    "scares\0"
+    "you\0"
+    "Sing\0"
+    "Dont\0"
+    "be\0"
+    "reckless\0"
+    "with\0"
+    "other\0"
+    "peoples\0"
+    "hearts\0"
+    "Dont\0"
+    "put\0"
+    "up\0"
+    "with\0"
+    "people\0"
+    "who\0"
+    "are\0"
+    "reckless\0"
+    "with\0"
+    "yours\0"
+    "Floss\0"
+    "Dont\0"
+    "waste\0"
+    "your\0"
+    "time\0"
+    "on\0"
+    "jealousy\0"
+    "Sometimes\0"
+    "youre\0"
+    "ahead\0"
+    "sometimes\0"
+    "youre\0"
+    "behind\0"
+    "The\0"
+    "race\0"
+    "is\0"
+    "long\0"
+    "and\0"
+    "in\0"
+    "the\0"
+    "end\0"
+    "its\0"
+    "only\0"
+    "with\0"
+    "yourself\0"
+    "Remember\0"
+    "compliments\0"
+    "you\0"
+    "receive\0"
+    "Forget\0"
+    "the\0"
+    "insults\0"
+    "If\0"
+    "you\0"
+    "succeed\0"
+    "in\0"
+    "doing\0"
+    "this\0"
+    "tell\0"
+    "me\0"
+    "how\0"
+    "Keep\0"
+    "your\0"
+    "old\0"
+    "love\0"
+    "letters\0"
+    "Throw\0"
+    "away\0"
+    "your\0"
+    "old\0"
+    "bank\0"
+    "statements\0"
+    "Stretch\0"
+    "Dont\0"
+    "feel\0"
+    "guilty\0"
+    "if\0"
+    "you\0"
+    "dont\0"
+    "know\0"
+    "what\0"
+    "you\0"
+    "want\0"
+    "to\0"
+    "do\0"
+    "with\0"
+    "your\0"
+    "life\0"
+    "The\0"
+    "most\0"
+    "interesting\0"
+    "people\0"
+    "I\0"
+    "know\0"
+    "didnt\0"
+    "know\0"
+    "at\0"
+    "22\0"
+    "what\0"
+    "they\0"
+    "wanted\0"
+    "to\0"
+    "do\0"
+    "with\0"
+    "their\0"
+    "lives\0"
+    "Some\0"
+    "of\0"
+    "the\0"
+    "most\0"
+    "interesting\0"
+    "40yearolds\0"
+    "I\0"
+    "know\0"
+    "still\0"
+    "dont\0"
+    "Get\0"
+    "plenty\0"
+    "of\0"
+    "calcium\0"
+    "Be\0"
+    "kind\0"
+    "to\0"
+    "your\0"
+    "knees\0"
+    "Youll\0"
+    "miss\0"
+    "them\0"
+    "when\0"
+    "theyre\0"
+    "gone\0"
+    "Maybe\0"
+    "youll\0"
+    "marry\0"
+    "maybe\0"
+    "you\0"
+    "wont\0"
+    "Maybe\0"
+    "youll\0"
+    "have\0"
+    "children\0"
+    "maybe\0"
+    "you\0"
+    "wont\0"
+    "Maybe\0"
+    "youll\0"
+    "divorce\0"
+    "at\0"
+    "40\0"
+    "maybe\0"
+    "youll\0"
+    "dance\0"
+    "the\0"
+    ;
+
+__ro_nv static const uint16_t string_offsets[NUM_STRINGS] = {
+    0, 5, 15, 28, 36, 39, 43, 50,
+    54, 64, 67, 71, 77, 80, 83, 88,
+    98, 101, 103, 109, 115, 119, 124, 128,
+    132, 136, 140, 147, 157, 163, 166, 169,
+    173, 182, 191, 194, 204, 209, 214, 221,
+    224, 235, 243, 247, 252, 255, 258, 265,
+    269, 272, 278, 283, 292, 297, 300, 304,
+    315, 326, 328, 333, 342, 347, 354, 358,
+    364, 368, 374, 378, 385, 388, 393, 399,
+    402, 408, 413, 417, 422, 426, 437, 441,
+    447, 451, 458, 461, 466, 472, 478, 485,
+    491, 495, 501, 504, 507, 510, 516, 522,
+    527, 532, 535, 542, 545, 554, 558, 565,
+    568, 570, 574, 578, 583, 589, 593, 597,
+    602, 614, 618, 625, 629, 633, 637, 646,
+    650, 657, 664, 668, 672, 676, 679, 683,
+    686, 690, 698, 703, 709, 715, 719, 726,
+    729, 735, 739, 744, 749, 758, 761, 764,
+    774, 777, 784, 787, 793, 796, 804, 813,
+    816, 824, 831, 835, 839, 844, 853, 856,
+    861, 866, 870, 874, 877, 880, 887, 892,
+    898, 906, 911, 919, 924, 928, 933, 938,
+    948, 952, 955, 957, 960, 963, 968, 973,
+    981, 984, 988, 994, 1000, 1004, 1009, 1016,
+    1020, 1025, 1030, 1033, 1042, 1047, 1053, 1061,
+    1068, 1073, 1077, 1080, 1085, 1092, 1096, 1100,
+    1109, 1114, 1120, 1126, 1131, 1137, 1142, 1147,
+    1150, 1159, 1169, 1175, 1181, 1191, 1197, 1204,
+    1208, 1213, 1216, 1221, 1225, 1228, 1232, 1236,
+    1240, 1245, 1250, 1259, 1268, 1280, 1284, 1292,
+    1299, 1303, 1311, 1314, 1318, 1326, 1329, 1335,
+    1340, 1345, 1348, 1352, 1357, 1362, 1366, 1371,
+    1379, 1385, 1390, 1395, 1399, 1404, 1415, 1423,
+    1428, 1433, 1440, 1443, 1447, 1452, 1457, 1462,
+    1466, 1471, 1474, 1477, 1482, 1487, 1492, 1496,
+    1501, 1513, 1520, 1522, 1527, 1533, 1538, 1541,
+    1544, 1549, 1554, 1561, 1564, 1567, 1572, 1578,
+    1584, 1589, 1592, 1596, 1601, 1613, 1624, 1626,
+    1631, 1637, 1642, 1646, 1653, 1656, 1664, 1667,
+    1672, 1675, 1680, 1686, 1692, 1697, 1702, 1707,
+    1714, 1719, 1725, 1731, 1737, 1743, 1747, 1752,
+    1758, 1764, 1769, 1778, 1784, 1788, 1793, 1799,
+    1805, 1813, 1816, 1819, 1825, 1831, 1837, 1841,
+    1847, 1855, 1858, 1863, 1868, 1876, 1888, 1897,
+    1901, 1904, 1909, 1922, 1931, 1935, 1940, 1943,
+    1950, 1959, 1966, 1971, 1979, 1983, 1988, 1995,
+    1998, 2002, 2012, 2018, 2024, 2029, 2034, 2038,
+    2041, 2047, 2051, 2055, 2059, 2064, 2067, 2074,
+    2077, 2080, 2083, 2086, 2091, 2097, 2104, 2110,
+    2113, 2116, 2120, 2124, 2133, 2144, 2150, 2155,
+    2159, 2165, 2170, 2173, 2177, 2182, 2190, 2193,
+    2196, 2199, 2203, 2208, 2215, 2220, 2225, 2229,
+    2240, 2245, 2248, 2252, 2257, 2264, 2269, 2272,
+    2276, 2281, 2288, 2298, 2303, 2308, 2313, 2318,
+    2322, 2327, 2332, 2336, 2339, 2344, 2349, 2357,
+    2361, 2367, 2372, 2377, 2384, 2387, 2392, 2396,
+    2401, 2404, 2409, 2412, 2417, 2426, 2433, 2438,
+    2443, 2448, 2451, 2456, 2461, 2465, 2469, 2476,
+    2481, 2488, 2491, 2497, 2502, 2506, 2509, 2513,
+    2520, 2531, 2536, 2544, 2549, 2553, 2556, 2560,
+    2565, 2567, 2576, 2580, 2584, 2591, 2596, 2599,
+    2604, 2609, 2612, 2619, 2623, 2628, 2631, 2641,
+    2645, 2655, 2663, 2667, 2673, 2677, 2681, 2685,
+    2690, 2694, 2699, 2703, 2710, 2714, 2719, 2723,
+    2728, 2732, 2737, 2743, 2748, 2751, 2755, 2760,
+    2765, 2770, 2774, 2780, 2787, 2790, 2796, 2800,
+    2805, 2810, 2813, 2822, 2833, 2838, 2842, 2848,
+    2855, 2858, 2864, 2868, 2873, 2880, 2887, 2895,
+    2907, 2914, 2921, 2926, 2931, 2943, 2948, 2958,
+    2962, 2966, 2971, 2975, 2979, 2983, 2988, 2992,
+    2995, 3001, 3011, 3016, 3021, 3025, 3030, 3036,
+    3043, 3048, 3059, 3071, 3076, 3082, 3086, 3095,
+    3105, 3111, 3118, 3126, 3131, 3138, 3143, 3150,
+    3157, 3162, 3165, 3173, 3177, 3183, 3187, 3192,
+    3194, 3200, 3205, 3211, 3217, 3222, 3224, 3232,
+    3239, 3243, 3247, 3253, 3258, 3263, 3270, 3274,
+    3280, 3284, 3288, 3293, 3298, 3302, 3307, 3312,
+    3317, 3322, 3325, 3328, 3332, 3337, 3343, 3346,
+    3349, 3354, 3359, 3362, 3365, 3373, 3379, 3386,
+    3390, 3394, 3398, 3401, 3409, 3414, 3420, 3424,
+    3431, 3434, 3441, 3444, 3446, 3451, 3454, 3464,
+    3475, 3478, 3481, 3483, 3487, 3490, 3498, 3502,
+    3507, 3512, 3516, 3525, 3532, 3535, 3539, 3548,
+    3553, 3557, 3562, 3568, 3572, 3582, 3585, 3589,
+    3594, 3599, 3603, 3609, 3613, 3619, 3622, 3625,
+    3629, 3639, 3644, 3654, 3667, 3675, 3678, 3682,
+    3689, 3693, 3703, 3706, 3710, 3716, 3719, 3722,
+    3727, 3737, 3740, 3742, 3748, 3754, 3758, 3763,
+    3767, 3771, 3775, 3779, 3786, 3796, 3802, 3805,
+    3808, 3812, 3821, 3830, 3833, 3843, 3848, 3853,
+    3860, 3863, 3874, 3882, 3886, 3891, 3894, 3897,
+    3904, 3908, 3911, 3917, 3922, 3931, 3936, 3939,
+    3943, 3954, 3965, 3967, 3972, 3981, 3986, 3993,
+    3997, 4003, 4007, 4013, 4017, 4024, 4027, 4032,
+    4038, 4041, 4047, 4052, 4056, 4061, 4065, 4076,
+    4080, 4086, 4090, 4097, 4100, 4105, 4111, 4117,
+    4124, 4130, 4134, 4140, 4143, 4146, 4149, 4155,
+    4161, 4166, 4171, 4174, 4181, 4184, 4193, 4197,
+    4204, 4207, 4209, 4213, 4217, 4222, 4228, 4232,
+    4236, 4241, 4253, 4257, 4264, 4268, 4272, 4276,
+    4285, 4289, 4296, 4303, 4307, 4311, 4315, 4318,
+    4322, 4325, 4329, 4337, 4342, 4348, 4354, 4358,
+    4365, 4368, 4374, 4378, 4383, 4388, 4397, 4400,
+    4403, 4413, 4416, 4423, 4426, 4432, 4435, 4443,
+    4452, 4455, 4463, 4470, 4474, 4478, 4483, 4492,
+    4495, 4500, 4505, 4509, 4513, 4516, 4519, 4526,
+    4531, 4537, 4545, 4550, 4558, 4563, 4567, 4572,
+    4577, 4587, 4591, 4594, 4596, 4599, 4602, 4607,
+    4612, 4620, 4623, 4627, 4633, 4639, 4643, 4648,
+    4655, 4659, 4664, 4669, 4672, 4681, 4686, 4692,
+    4700, 4707, 4712, 4716, 4719, 4724, 4731, 4735,
+    4739, 4748, 4753, 4759, 4765, 4770, 4776, 4781,
+    4786, 4789, 4798, 4808, 4814, 4820, 4830, 4836,
+    4843, 4847, 4852, 4855, 4860, 4864, 4867, 4871,
+    4875, 4879, 4884, 4889, 4898, 4907, 4919, 4923,
+    4931, 4938, 4942, 4950, 4953, 4957, 4965, 4968,
+    4974, 4979, 4984, 4987, 4991, 4996, 5001, 5005,
+    5010, 5018, 5024, 5029, 5034, 5038, 5043, 5054,
+    5062, 5067, 5072, 5079, 5082, 5086, 5091, 5096,
+    5101, 5105, 5110, 5113, 5116, 5121, 5126, 5131,
+    5135, 5140, 5152, 5159, 5161, 5166, 5172, 5177,
+    5180, 5183, 5188, 5193, 5200, 5203, 5206, 5211,
+    5217, 5223, 5228, 5231, 5235, 5240, 5252, 5263,
+    5265, 5270, 5276, 5281, 5285, 5292, 5295, 5303,
+    5306, 5311, 5314, 5319, 5325, 5331, 5336, 5341,
+    5346, 5353, 5358, 5364, 5370, 5376, 5382, 5386,
+    5391, 5397, 5403, 5408, 5417, 5423, 5427, 5432,
+    5438, 5444, 5452, 5455, 5458, 5464, 5470, 5476,
+};
@@ -0,0 +1,389 @@
+#include <msp430.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines NUM_STRINGS, string_pool[] and string_offsets[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input_small.h"
+#endif
+
+// Indexes written per execution of the init task
+#define INIT_BLOCK 64
+// Characters compared per execution of the sort task: a comparison that
+// runs out resumes from where it stopped in the next execution
+#define CMP_BUDGET 32
+// Adjacent pairs checked per execution in the final check
+#define CHECK_BLOCK 32
+
+// Pending subarrays: the smaller half is always sorted first, so the depth
+// is at most ceil(log2(NUM_STRINGS)) + 1, rounded up to a power of 2 for
+// SELF_FIELD_ARRAY_INITIALIZER
+#if NUM_STRINGS <= 32768
+#define STACK_SIZE 16
+#elif NUM_STRINGS <= 65535
+#define STACK_SIZE 32
+#else
+#error NUM_STRINGS is larger than the uint16_t indexes allow
+#endif
+#define STACK_OVERFLOW (STACK_SIZE + 1) // returned by push_range
+
+#define STRING(idx) (&string_pool[string_offsets[idx]])
+
+// Subarray [lo, hi] of the index array
+typedef struct {
+    uint16_t lo, hi;
+} range_t;
+
+typedef enum {
+    SORT_IDLE = 0,  // pop the next subarray
+    SORT_SCAN,      // Lomuto partition of the subarray, the pivot is at hi
+    SORT_SPLIT,     // move the pivot in place and push the two halves
+    SORT_CHECK,     // the array is sorted, check it
+} sort_phase_t;
+
+typedef struct {
+    uint16_t phase;     // sort_phase_t
+    range_t range;
+    uint16_t i;         // next slot for an element that goes before the pivot
+    uint16_t j;         // element being compared against the pivot
+    uint16_t pos;       // characters of the comparison already found equal
+    uint32_t idx_sum;   // check: sum of the indexes seen so far
+} progress_t;
+
+typedef enum {
+    CMP_BEFORE,
+    CMP_AFTER,
+    CMP_UNDECIDED,      // out of budget
+} cmp_t;
+
+/** @brief Compare two strings, starting at a given character
+ *  @details Same order as MiBench, which sorts in descending strcmp order.
+ *           Equal strings are not before one another.
+ *  @param pos      In: first character to compare, out: first character not
+ *                  yet compared, when out of budget
+ *  @param budget   In/out: characters left to compare in this execution
+ */
+static cmp_t compare(uint16_t a, uint16_t b, uint16_t *pos, unsigned *budget)
+{
+    const unsigned char *s1 = (const unsigned char *)STRING(a) + *pos;
+    const unsigned char *s2 = (const unsigned char *)STRING(b) + *pos;
+
+    for ( ; *budget > 0; --*budget) {
+        if (*s1 != *s2)
+            return *s1 > *s2 ? CMP_BEFORE : CMP_AFTER;
+        if (*s1 == '\0')
+            return CMP_AFTER;
+        ++s1;
+        ++s2;
+        ++*pos;
+    }
+    return CMP_UNDECIDED;
+}
+
+TASK(1, pre_init)
+TASK(2, task_init)
+TASK(3, task_sort)
+TASK(4, bench_fail)
+TASK(5, bench_success)
+
+struct init_state {
+    SELF_CHAN_FIELD(unsigned, i);
+};
+
+#define FIELD_INIT_init_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct sort_args {
+    CHAN_FIELD_ARRAY(uint16_t, idx, NUM_STRINGS);
+    CHAN_FIELD(progress_t, prog);
+    CHAN_FIELD_ARRAY(range_t, stack, STACK_SIZE);
+    CHAN_FIELD(unsigned, stack_idx);
+};
+
+// The index array is permuted in place; the stack contains subarrays to be
+// processed (i.e. a call stack)
+struct sort_state {
+    SELF_CHAN_FIELD_ARRAY(uint16_t, idx, NUM_STRINGS);
+    SELF_CHAN_FIELD(progress_t, prog);
+    SELF_CHAN_FIELD_ARRAY(range_t, stack, STACK_SIZE);
+    SELF_CHAN_FIELD(unsigned, stack_idx);
+};
+
+#define FIELD_INIT_sort_state {\
+    SELF_FIELD_ARRAY_INITIALIZER(NUM_STRINGS),\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_ARRAY_INITIALIZER(STACK_SIZE),\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(pre_init, task_init, init_state);
+SELF_CHANNEL(task_init, init_state);
+CHANNEL(task_init, task_sort, sort_args);
+SELF_CHANNEL(task_sort, sort_state);
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+static uint16_t idx_in(unsigned k) {
+    return *CHAN_IN2(uint16_t, idx[k], CH(task_init, task_sort),
+                     SELF_IN_CH(task_sort));
+}
+
+/** @brief Swap two elements of the index array
+ *  @details Each self-channel field may be written once per task execution,
+ *           so the sort task ends its execution after a swap.
+ */
+static void idx_swap(unsigned k, unsigned l) {
+    uint16_t vk = idx_in(k), vl = idx_in(l);
+
+    if (k == l)
+        return;
+    CHAN_OUT1(uint16_t, idx[k], vl, SELF_OUT_CH(task_sort));
+    CHAN_OUT1(uint16_t, idx[l], vk, SELF_OUT_CH(task_sort));
+}
+
+/** @brief Push a half of a partitioned subarray, unless it is sorted
+ *  @return Updated stack index, or STACK_OVERFLOW if the stack is full
+ *          (also when passed STACK_OVERFLOW)
+ */
+static unsigned push_range(unsigned stack_i, int lo, int hi) {
+    range_t range = { lo, hi };
+
+    if (lo >= hi)
+        return stack_i;
+
+    if (stack_i >= STACK_SIZE)
+        return STACK_OVERFLOW;
+
+    CHAN_OUT1(range_t, stack[stack_i], range, SELF_OUT_CH(task_sort));
+    return stack_i + 1;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void pre_init() {
+    task_prologue();
+    unsigned i = 0;
+    CHAN_OUT1(unsigned, i, i, CH(pre_init, task_init));
+    TRANSITION_TO(task_init);
+}
+
+// Initialize the index array to the identity permutation
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit\r\n");
+
+    unsigned i, end;
+    uint16_t v;
+
+    i = *CHAN_IN2(unsigned, i, SELF_IN_CH(task_init), CH(pre_init, task_init));
+
+    end = i + INIT_BLOCK;
+    if (end > NUM_STRINGS)
+        end = NUM_STRINGS;
+    for ( ; i < end; i++) {
+        v = i;
+        CHAN_OUT1(uint16_t, idx[i], v, CH(task_init, task_sort));
+    }
+
+    if (i < NUM_STRINGS) {
+        CHAN_OUT1(unsigned, i, i, SELF_OUT_CH(task_init));
+        TRANSITION_TO(task_init);
+    }
+
+    progress_t prog = { .phase = SORT_IDLE };
+    range_t range = { 0, NUM_STRINGS - 1 };
+    unsigned stack_i = 1;
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_sort));
+    CHAN_OUT1(range_t, stack[0], range, CH(task_init, task_sort));
+    CHAN_OUT1(unsigned, stack_idx, stack_i, CH(task_init, task_sort));
+    TRANSITION_TO(task_sort);
+}
+
+void task_sort() {
+    task_prologue();
+
+    progress_t prog;
+    unsigned stack_i, stack_i_orig, budget, mid;
+    uint16_t pivot, v;
+    cmp_t cmp;
+
+    prog = *CHAN_IN2(progress_t, prog,
+            CH(task_init, task_sort), SELF_IN_CH(task_sort));
+    stack_i = stack_i_orig = *CHAN_IN2(unsigned, stack_idx,
+            CH(task_init, task_sort), SELF_IN_CH(task_sort));
+
+    switch (prog.phase) {
+        case SORT_IDLE:
+            if (stack_i == 0) {
+                LOG("sort: done\r\n");
+                prog.phase = SORT_CHECK;
+                prog.i = 0;
+                prog.idx_sum = 0;
+                break;
+            }
+
+            --stack_i;
+            prog.range = *CHAN_IN2(range_t, stack[stack_i],
+                    CH(task_init, task_sort), SELF_IN_CH(task_sort));
+            LOG("sort: stack_i=%u lo=%u hi=%u\r\n",
+                stack_i, prog.range.lo, prog.range.hi);
+
+            // Middle element as the pivot, kept at hi during the scan
+            mid = prog.range.lo + (prog.range.hi - prog.range.lo) / 2;
+            idx_swap(mid, prog.range.hi);
+
+            prog.phase = SORT_SCAN;
+            prog.i = prog.j = prog.range.lo;
+            prog.pos = 0;
+            break;
+
+        case SORT_SCAN:
+            pivot = idx_in(prog.range.hi);
+            budget = CMP_BUDGET;
+
+            while (prog.j < prog.range.hi) {
+                v = idx_in(prog.j);
+                cmp = compare(v, pivot, &prog.pos, &budget);
+                if (cmp == CMP_UNDECIDED)
+                    break;
+
+                prog.pos = 0;
+                if (cmp == CMP_BEFORE) {
+                    idx_swap(prog.i, prog.j);
+                    prog.i++;
+                    prog.j++;
+                    break;
+                }
+                prog.j++;
+            }
+
+            if (prog.j == prog.range.hi)
+                prog.phase = SORT_SPLIT;
+            break;
+
+        case SORT_SPLIT: {
+            // Push the larger half first, so that the smaller is sorted
+            // first, which bounds the depth of the stack
+            int lo = prog.range.lo, hi = prog.range.hi, mid = prog.i;
+
+            idx_swap(mid, hi);
+            if (mid - lo > hi - mid) {
+                stack_i = push_range(stack_i, lo, mid - 1);
+                stack_i = push_range(stack_i, mid + 1, hi);
+            } else {
+                stack_i = push_range(stack_i, mid + 1, hi);
+                stack_i = push_range(stack_i, lo, mid - 1);
+            }
+            if (stack_i == STACK_OVERFLOW) {
+                LOG("Stack overflow at depth %u\r\n", STACK_SIZE);
+                PRINTF("cycles: %n\r\n", msp_cycles());
+                CHAIN_REPORT();
+                TRANSITION_TO(bench_fail);
+            }
+            prog.phase = SORT_IDLE;
+            break;
+        }
+
+        case SORT_CHECK: {
+            unsigned end = prog.i + CHECK_BLOCK;
+            uint16_t prev = prog.i > 0 ? idx_in(prog.i - 1) : 0;
+
+            if (end > NUM_STRINGS)
+                end = NUM_STRINGS;
+            for ( ; prog.i < end; prog.i++) {
+                v = idx_in(prog.i);
+                prog.idx_sum += v;
+                if (prog.i > 0 && strcmp(STRING(prev), STRING(v)) < 0) {
+                    LOG("Failed to sort correctly at %u\r\n", prog.i);
+                    PRINTF("cycles: %n\r\n", msp_cycles());
+                    CHAIN_REPORT();
+                    TRANSITION_TO(bench_fail);
+                }
+                prev = v;
+            }
+
+            if (prog.i < NUM_STRINGS)
+                break;
+
+            if (prog.idx_sum != (uint32_t)NUM_STRINGS * (NUM_STRINGS - 1) / 2) {
+                LOG("Not a permutation\r\n");
+                PRINTF("cycles: %n\r\n", msp_cycles());
+                CHAIN_REPORT();
+                TRANSITION_TO(bench_fail);
+            }
+
+            LOG("success\r\n");
+            PRINTF("cycles: %n\r\n", msp_cycles());
+            PRINTF("Sorted %u elements.\r\n", NUM_STRINGS);
+            CHAIN_REPORT();
+            TRANSITION_TO(bench_success);
+        }
+    }
+
+    CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_sort));
+    if (stack_i != stack_i_orig)
+        CHAN_OUT1(unsigned, stack_idx, stack_i, SELF_OUT_CH(task_sort));
+    TRANSITION_TO(task_sort);
+}
+
+// Blink LED1 on failure
+void bench_fail() {
+    task_prologue();
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_1, OUT) &= ~BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_fail);
+}
+
+// Blink LED2 on success
+void bench_success() {
+    task_prologue();
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_success);
+}
+
+ENTRY_TASK(pre_init)
+INIT_FUNC(init)
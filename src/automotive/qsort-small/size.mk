@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): strings sorted, a
+# power of 2 (the index array is a channel field array)
+SIZE_small = 256
+SIZE_medium = 512
+SIZE_large = 1024
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,425 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+#include <libwispbase/wisp-base.h>
+
+#include "pin_assign.h"
+
+// Defines X_SIZE, Y_SIZE, image[] and bright_lut[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input_small.h"
+#endif
+
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+#define MAX_NO_CORNERS 1850
+
+// Capacity of the corner list (MiBench: 15000, allocated on the heap)
+#define MAX_CORNERS 256
+
+// Rows per task execution of the passes over the whole image, and corners
+// drawn per task execution
+#define RESPONSE_ROWS 4
+#define SUPPRESS_ROWS 4
+#define COPY_ROWS 16
+#define DRAW_CORNERS 32
+
+/* Corners are searched at least this far from the border */
+#define BORDER 7
+
+#define PASS_RESPONSE   0
+#define PASS_SUPPRESS   1
+#define PASS_DRAW       2
+#define NUM_PASSES      3
+
+uint8_t usrBank[USRBANK_SIZE];
+
+typedef struct {
+    uint16_t x, y;
+    int16_t dx, dy;     // intensity gradient
+    uint8_t I;          // mean intensity around the corner
+} corner_t;
+
+/* Corner response, written only by the response pass */
+__nv static int16_t r[X_SIZE * Y_SIZE];
+
+/** @brief Corner list, append-only
+ *  @details Entries are committed by the count in the suppression task's
+ *           self channel. An execution writes only the entries past the
+ *           committed count, and a re-execution writes the same entries
+ *           again, so a power failure can not duplicate a corner.
+ */
+__nv static corner_t corners[MAX_CORNERS];
+
+__nv static uint8_t out[X_SIZE * Y_SIZE];
+
+/* Timestamps at the start of the first pass and the end of each pass */
+__nv static uint32_t pass_end[NUM_PASSES + 1];
+
+__ro_nv static const char * const pass_names[NUM_PASSES] = {
+    "response",
+    "suppress",
+    "draw",
+};
+
+/* Half-width of each row of the 37-pixel circular mask, rows -3..3 */
+__ro_nv static const int8_t mask_half_width[7] = { 1, 2, 3, 3, 3, 2, 1 };
+
+volatile unsigned work_x;
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+TASK(1, task_init)
+TASK(2, task_response)
+TASK(3, task_suppress)
+TASK(4, task_copy)
+TASK(5, task_draw)
+TASK(6, task_done)
+TASK(7, task_end)
+
+struct row_args {
+    CHAN_FIELD(unsigned, row);
+};
+
+struct row_state {
+    SELF_CHAN_FIELD(unsigned, row);
+};
+
+#define FIELD_INIT_row_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct list_args {
+    CHAN_FIELD(unsigned, row);
+    CHAN_FIELD(unsigned, count);
+};
+
+struct list_state {
+    SELF_CHAN_FIELD(unsigned, row);
+    SELF_CHAN_FIELD(unsigned, count);
+};
+
+#define FIELD_INIT_list_state {\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct list {
+    CHAN_FIELD(unsigned, count);
+};
+
+struct draw_args {
+    CHAN_FIELD(unsigned, next);
+};
+
+struct draw_state {
+    SELF_CHAN_FIELD(unsigned, next);
+};
+
+#define FIELD_INIT_draw_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_response, row_args);
+SELF_CHANNEL(task_response, row_state);
+CHANNEL(task_init, task_suppress, list_args);
+SELF_CHANNEL(task_suppress, list_state);
+CHANNEL(task_suppress, task_draw, list);
+CHANNEL(task_suppress, task_done, list);
+CHANNEL(task_init, task_copy, row_args);
+SELF_CHANNEL(task_copy, row_state);
+CHANNEL(task_init, task_draw, draw_args);
+SELF_CHANNEL(task_draw, draw_state);
+
+#define BP(centre, p) bright_lut[256 + (centre) - (p)]
+#define IN(i, j) image[(i) * X_SIZE + (j)]
+
+/* USAN area of a pixel, up to the threshold (susan_corners_quick stops
+ * adding once it is reached) */
+static int usan(unsigned i, unsigned j)
+{
+    uint8_t centre = IN(i, j);
+    const uint8_t *p;
+    int n = 100, dx, dy, w;
+
+    for (dy = -3; dy <= 3; dy++) {
+        w = mask_half_width[dy + 3];
+        p = image + (i + dy) * X_SIZE + j;
+        for (dx = -w; dx <= w; dx++) {
+            if (dy != 0 || dx != 0)
+                n += BP(centre, p[dx]);
+        }
+        if (dy >= 0 && n >= MAX_NO_CORNERS)
+            break;
+    }
+    return n;
+}
+
+/* Whether the response is the maximum of the 7x7 neighbourhood; ties go to
+ * the pixel that comes first in scan order (SEVEN_SUPP) */
+static int local_max(unsigned i, unsigned j)
+{
+    int x = r[i * X_SIZE + j];
+    const int16_t *p;
+    int dx, dy;
+
+    for (dy = -3; dy <= 3; dy++) {
+        p = r + (i + dy) * X_SIZE + j;
+        for (dx = -3; dx <= 3; dx++) {
+            if (dy < 0 || (dy == 0 && dx < 0)) {
+                if (x <= p[dx])
+                    return 0;
+            } else if (dy > 0 || dx > 0) {
+                if (x < p[dx])
+                    return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Mean intensity and gradient over the 5x5 neighbourhood */
+static void describe(corner_t *c, unsigned i, unsigned j)
+{
+    int x = 0, y = 0, sum = 0, col, row, dx, dy;
+
+    for (dy = -2; dy <= 2; dy++)
+        for (dx = -2; dx <= 2; dx++)
+            sum += IN(i + dy, j + dx);
+
+    for (dx = 1; dx <= 2; dx++) {
+        col = 0;
+        row = 0;
+        for (dy = -2; dy <= 2; dy++) {
+            col += IN(i + dy, j + dx) - IN(i + dy, j - dx);
+            row += IN(i + dx, j + dy) - IN(i - dx, j + dy);
+        }
+        // Columns and rows at distance 2 count twice
+        x += dx * col;
+        y += dx * row;
+    }
+
+    c->x = j;
+    c->y = i;
+    c->I = sum / 25;
+    c->dx = x / 15;
+    c->dy = y / 15;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %ux%u\r\n", X_SIZE, Y_SIZE);
+
+    unsigned zero = 0;
+
+    CHAN_OUT3(unsigned, row, zero, CH(task_init, task_response),
+              CH(task_init, task_suppress), CH(task_init, task_copy));
+    CHAN_OUT1(unsigned, count, zero, CH(task_init, task_suppress));
+    CHAN_OUT1(unsigned, next, zero, CH(task_init, task_draw));
+
+    pass_end[0] = msp_cycles();
+    TRANSITION_TO(task_response);
+}
+
+/* Corner response: r = MAX_NO_CORNERS - USAN area where the area is below
+ * the threshold, 0 elsewhere */
+void task_response() {
+    task_prologue();
+
+    unsigned row, end, j, idx;
+    int n;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_response),
+                    SELF_IN_CH(task_response));
+
+    end = row + RESPONSE_ROWS;
+    if (end > Y_SIZE)
+        end = Y_SIZE;
+    for ( ; row < end; row++) {
+        for (j = 0; j < X_SIZE; j++) {
+            idx = row * X_SIZE + j;
+            r[idx] = 0;
+            if (row < BORDER || row >= Y_SIZE - BORDER ||
+                j < BORDER || j >= X_SIZE - BORDER)
+                continue;
+            n = usan(row, j);
+            if (n < MAX_NO_CORNERS)
+                r[idx] = MAX_NO_CORNERS - n;
+        }
+    }
+
+    if (row < Y_SIZE) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_response));
+        TRANSITION_TO(task_response);
+    }
+    pass_end[PASS_RESPONSE + 1] = msp_cycles();
+    TRANSITION_TO(task_suppress);
+}
+
+/* Non-maximum suppression: appends the local maxima of r to the list */
+void task_suppress() {
+    task_prologue();
+
+    unsigned row, end, j, count;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_suppress),
+                    SELF_IN_CH(task_suppress));
+    count = *CHAN_IN2(unsigned, count, CH(task_init, task_suppress),
+                      SELF_IN_CH(task_suppress));
+    if (row < BORDER)
+        row = BORDER;
+
+    end = row + SUPPRESS_ROWS;
+    if (end > Y_SIZE - BORDER)
+        end = Y_SIZE - BORDER;
+    for ( ; row < end; row++) {
+        for (j = BORDER; j < X_SIZE - BORDER; j++) {
+            if (r[row * X_SIZE + j] <= 0 || !local_max(row, j))
+                continue;
+            if (count == MAX_CORNERS) {
+                PRINTF("cycles: %n\r\n", msp_cycles());
+                PRINTF("Too many corners.\r\n");
+                TRANSITION_TO(task_end);
+            }
+            describe(&corners[count], row, j);
+            count++;
+        }
+    }
+
+    if (row < Y_SIZE - BORDER) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_suppress));
+        CHAN_OUT1(unsigned, count, count, SELF_OUT_CH(task_suppress));
+        TRANSITION_TO(task_suppress);
+    }
+    CHAN_OUT2(unsigned, count, count, CH(task_suppress, task_draw),
+              CH(task_suppress, task_done));
+    pass_end[PASS_SUPPRESS + 1] = msp_cycles();
+    TRANSITION_TO(task_copy);
+}
+
+/* Output image: a copy of the input, on which the corners are drawn */
+void task_copy() {
+    task_prologue();
+
+    unsigned row, end, j;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_copy),
+                    SELF_IN_CH(task_copy));
+
+    end = row + COPY_ROWS;
+    if (end > Y_SIZE)
+        end = Y_SIZE;
+    for ( ; row < end; row++) {
+        for (j = 0; j < X_SIZE; j++)
+            out[row * X_SIZE + j] = IN(row, j);
+    }
+
+    if (row < Y_SIZE) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_copy));
+        TRANSITION_TO(task_copy);
+    }
+    TRANSITION_TO(task_draw);
+}
+
+/* Draws the corners in list order (corner_draw, drawing mode 0): a black
+ * pixel in a white 3x3 block. The pixels drawn are constants, so drawing a
+ * block of corners again after a power failure gives the same image. */
+void task_draw() {
+    task_prologue();
+
+    unsigned next, end, count;
+    uint8_t *p;
+
+    next = *CHAN_IN2(unsigned, next, CH(task_init, task_draw),
+                     SELF_IN_CH(task_draw));
+    count = *CHAN_IN1(unsigned, count, CH(task_suppress, task_draw));
+
+    end = next + DRAW_CORNERS;
+    if (end > count)
+        end = count;
+    for ( ; next < end; next++) {
+        p = out + (corners[next].y - 1) * X_SIZE + corners[next].x - 1;
+        *p++ = 255; *p++ = 255; *p = 255; p += X_SIZE - 2;
+        *p++ = 255; *p++ = 0;   *p = 255; p += X_SIZE - 2;
+        *p++ = 255; *p++ = 255; *p = 255;
+    }
+
+    if (next < count) {
+        CHAN_OUT1(unsigned, next, next, SELF_OUT_CH(task_draw));
+        TRANSITION_TO(task_draw);
+    }
+    pass_end[PASS_DRAW + 1] = msp_cycles();
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the cycles of each pass, the number of corners and a checksum of
+ * the output image: the sum of the pixels and the sum weighted by position,
+ * to compare with MiBench's output (susan -c -q) */
+void task_done() {
+    task_prologue();
+
+    uint32_t sum = 0, weighted = 0;
+    unsigned i, count;
+
+    count = *CHAN_IN1(unsigned, count, CH(task_suppress, task_done));
+
+    for (i = 0; i < X_SIZE * Y_SIZE; ++i) {
+        sum += out[i];
+        weighted += (uint32_t)(i + 1) * out[i];
+    }
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("corners: %u checksum: %n %n\r\n", count, sum, weighted);
+
+    PRINTF("pass Cycles\r\n");
+    for (i = 0; i < NUM_PASSES; ++i)
+        PRINTF("%s %n\r\n", pass_names[i], pass_end[i + 1] - pass_end[i]);
+
+    for (i = 0; i < count; ++i) {
+        LOG("%u %u dx %i dy %i I %u\r\n", corners[i].x, corners[i].y,
+            corners[i].dx, corners[i].dy, corners[i].I);
+    }
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
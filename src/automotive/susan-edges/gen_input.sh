@@ -0,0 +1,65 @@
+#! /bin/bash
+#
+# Generate input_small.h from a MiBench susan input image (binary PGM), with
+# the brightness lookup table of setup_brightness_lut(bt, form 6), indexed by
+# -256..256, that susan_edges and susan_corners compute at run time.
+#
+# Usage: ./gen_input.sh [input_small.pgm] [bt] [rows] > input_small.h
+
+INPUT=${1:-../../../mibench-src/automotive/susan/input_small.pgm}
+BT=${2:-20}
+
+# Header: magic, comments, "width height", maxval; the pixels are the rest
+SIZE=$(head -c 256 $INPUT | grep -av '^#' | sed -n 2p)
+X_SIZE=${SIZE% *}
+Y_SIZE=${SIZE#* }
+PIXELS=$((X_SIZE * Y_SIZE))
+
+# The first rows of the image, all of them by default
+Y_SIZE=${3:-$Y_SIZE}
+
+tail -c $PIXELS $INPUT | head -c $((X_SIZE * Y_SIZE)) | od -An -v -tu1 | awk \
+    -v x_size=$X_SIZE -v y_size=$Y_SIZE -v bt=$BT '
+    function table(name, type, size, values, n,    i, j, line) {
+        print "__ro_nv static const " type " " name "[" size "] = {"
+        for (i = 0; i < n; i += 16) {
+            line = "   "
+            for (j = i; j < i + 16 && j < n; ++j)
+                line = line " " values[j] ","
+            print line
+        }
+        print "};"
+        print ""
+    }
+    # Round to single precision, as MiBench stores the value in a float
+    # before truncating it (100 * exp(-1.6e-8) becomes 100, not 99)
+    function single(v,    e, ulp) {
+        if (v <= 0)
+            return v
+        for (e = 0; 2 ^ (e + 1) <= v; ++e)
+            ;
+        for ( ; 2 ^ e > v; --e)
+            ;
+        ulp = 2 ^ (e - 23)
+        return int(v / ulp + 0.5) * ulp
+    }
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench susan input_small.pgm */"
+        print ""
+        print "#define X_SIZE " x_size
+        print "#define Y_SIZE " y_size
+        print "#define BRIGHT_THRESH " bt
+        print ""
+    }
+    { for (f = 1; f <= NF; ++f) pixels[n++] = $f }
+    END {
+        table("image", "uint8_t", "X_SIZE * Y_SIZE", pixels, n)
+
+        for (k = -256; k <= 256; ++k) {
+            t = k / bt
+            t = t * t
+            bright[k + 256] = int(single(100.0 * exp(-t * t * t)))
+        }
+        table("bright_lut", "uint8_t", "513", bright, 513)
+    }
+'
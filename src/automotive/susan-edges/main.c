@@ -0,0 +1,623 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+#include <libwispbase/wisp-base.h>
+
+#include "pin_assign.h"
+
+// Defines X_SIZE, Y_SIZE, image[] and bright_lut[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input_small.h"
+#endif
+
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+#define MAX_NO_EDGES 2650
+
+// Rows per task execution of the passes over the whole image
+#define RESPONSE_ROWS 2
+#define DIRECTION_ROWS 2
+#define DRAW_ROWS 8
+
+// Pixels visited by the thinning pass per task execution, and the writes to
+// mid it can buffer (a visit writes at most two)
+#define THIN_BLOCK 256
+#define THIN_LOG_SIZE 16
+
+/* mid[] values: < 8 marks an edge point (1, 2 from the direction pass, 3..7
+ * from thinning), anything else is background */
+#define IS_EDGE(v) ((v) < 8)
+#define NO_EDGE 100
+
+#define PASS_RESPONSE   0
+#define PASS_DIRECTION  1
+#define PASS_THIN       2
+#define PASS_DRAW       3
+#define NUM_PASSES      4
+
+uint8_t usrBank[USRBANK_SIZE];
+
+/* Edge response and edge direction (mid) images. The response and direction
+ * passes only write the pixels of their rows from pixels that are not
+ * written in the same pass, so re-executing their tasks writes the same
+ * values. The thinning pass updates mid in place, through a log (below). */
+__nv static int16_t r[X_SIZE * Y_SIZE];
+__nv static uint8_t mid[X_SIZE * Y_SIZE];
+__nv static uint8_t out[X_SIZE * Y_SIZE];
+
+/* Timestamps at the start of the first pass and the end of each pass */
+__nv static uint32_t pass_end[NUM_PASSES + 1];
+
+__ro_nv static const char * const pass_names[NUM_PASSES] = {
+    "response",
+    "direction",
+    "thin",
+    "draw",
+};
+
+/* Half-width of each row of the 37-pixel circular mask, rows -3..3 */
+__ro_nv static const int8_t mask_half_width[7] = { 1, 2, 3, 3, 3, 2, 1 };
+
+volatile unsigned work_x;
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/** @brief Writes to mid made by one execution of the thinning task
+ *  @details Thinning reads pixels of mid that it has written earlier in the
+ *           pass, so it can not write mid directly and be re-executed. The
+ *           writes are collected here and committed through the task's self
+ *           channel with its position; the next execution applies them to
+ *           mid before it continues, which can safely be repeated.
+ */
+typedef struct {
+    uint16_t idx[THIN_LOG_SIZE];
+    uint8_t val[THIN_LOG_SIZE];
+    uint8_t len;
+} thin_log_t;
+
+TASK(1, task_init)
+TASK(2, task_response)
+TASK(3, task_direction)
+TASK(4, task_thin)
+TASK(5, task_draw)
+TASK(6, task_done)
+TASK(7, task_end)
+
+struct row_args {
+    CHAN_FIELD(unsigned, row);
+};
+
+struct row_state {
+    SELF_CHAN_FIELD(unsigned, row);
+};
+
+#define FIELD_INIT_row_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct thin_args {
+    CHAN_FIELD(int, i);
+    CHAN_FIELD(int, j);
+    CHAN_FIELD(thin_log_t, log);
+};
+
+struct thin_state {
+    SELF_CHAN_FIELD(int, i);
+    SELF_CHAN_FIELD(int, j);
+    SELF_CHAN_FIELD(thin_log_t, log);
+};
+
+#define FIELD_INIT_thin_state {\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER,\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_response, row_args);
+SELF_CHANNEL(task_response, row_state);
+CHANNEL(task_init, task_direction, row_args);
+SELF_CHANNEL(task_direction, row_state);
+CHANNEL(task_init, task_thin, thin_args);
+SELF_CHANNEL(task_thin, thin_state);
+CHANNEL(task_init, task_draw, row_args);
+SELF_CHANNEL(task_draw, row_state);
+
+#define BP(centre, p) bright_lut[256 + (centre) - (p)]
+
+/* USAN area of a pixel: similar pixels in the mask, weighted by the LUT */
+static int usan(unsigned i, unsigned j)
+{
+    uint8_t centre = image[i * X_SIZE + j];
+    const uint8_t *p;
+    int n = 100, dx, dy, w;
+
+    for (dy = -3; dy <= 3; dy++) {
+        w = mask_half_width[dy + 3];
+        p = image + (i + dy) * X_SIZE + j;
+        for (dx = -w; dx <= w; dx++) {
+            if (dy != 0 || dx != 0)
+                n += BP(centre, p[dx]);
+        }
+    }
+    return n;
+}
+
+/** @brief Mark the pixel as an edge point if its response is a local
+ *         maximum across the edge direction (second loop of susan_edges)
+ */
+static void edge_direction(unsigned i, unsigned j)
+{
+    int m = r[i * X_SIZE + j];
+    int n = MAX_NO_EDGES - m;
+    uint8_t centre = image[i * X_SIZE + j];
+    const uint8_t *p;
+    int32_t x2y2;
+    int x, y, w, c, dx, dy, hw, a, b;
+
+    if (n > 600) {
+        // Centre of gravity of the USAN
+        x = 0; y = 0;
+        for (dy = -3; dy <= 3; dy++) {
+            hw = mask_half_width[dy + 3];
+            p = image + (i + dy) * X_SIZE + j;
+            for (dx = -hw; dx <= hw; dx++) {
+                c = BP(centre, p[dx]);
+                x += dx * c;
+                y += dy * c;
+            }
+        }
+
+        // sqrt(x^2 + y^2) > 0.9 n, and the slope y/x against 0.5 and 2
+        x2y2 = (int32_t)x * x + (int32_t)y * y;
+        if (100 * x2y2 > 81 * (int32_t)n * n) {
+            if (x == 0) {
+                a = 1; b = 0;
+            } else {
+                int ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+                if (2 * ay < ax) {              // vertical edge
+                    a = 0; b = 1;
+                } else if (ay > 2 * ax) {       // horizontal edge
+                    a = 1; b = 0;
+                } else if ((x < 0) == (y < 0)) { // diagonal edge
+                    a = 1; b = 1;
+                } else {
+                    a = -1; b = 1;
+                }
+            }
+            if (m > r[(i + a) * X_SIZE + j + b] &&
+                m >= r[(i - a) * X_SIZE + j - b] &&
+                m > r[(i + 2 * a) * X_SIZE + j + 2 * b] &&
+                m >= r[(i - 2 * a) * X_SIZE + j - 2 * b])
+                mid[i * X_SIZE + j] = 1;
+            return;
+        }
+    }
+
+    // Second moments of the USAN, for small or symmetric USANs
+    x = 0; y = 0; w = 0;
+    for (dy = -3; dy <= 3; dy++) {
+        hw = mask_half_width[dy + 3];
+        p = image + (i + dy) * X_SIZE + j;
+        for (dx = -hw; dx <= hw; dx++) {
+            c = BP(centre, p[dx]);
+            x += dx * dx * c;
+            y += dy * dy * c;
+            w += dx * dy * c;
+        }
+    }
+
+    if (y != 0 && 2 * x < y) {                  // vertical
+        a = 0; b = 1;
+    } else if (y == 0 || x > 2 * y) {           // horizontal
+        a = 1; b = 0;
+    } else if (w > 0) {                         // diagonal
+        a = -1; b = 1;
+    } else {
+        a = 1; b = 1;
+    }
+    if (m > r[(i + a) * X_SIZE + j + b] &&
+        m >= r[(i - a) * X_SIZE + j - b] &&
+        m > r[(i + 2 * a) * X_SIZE + j + 2 * b] &&
+        m >= r[(i - 2 * a) * X_SIZE + j - 2 * b])
+        mid[i * X_SIZE + j] = 2;
+}
+
+/* Writes of the current execution of the thinning task (in SRAM: cleared
+ * at the start of each execution) */
+__sram static thin_log_t thin_log;
+
+/* Read mid as modified by the writes logged so far */
+static uint8_t mid_get(int i, int j)
+{
+    unsigned idx = i * X_SIZE + j;
+    int k;
+
+    for (k = (int)thin_log.len - 1; k >= 0; --k) {
+        if (thin_log.idx[k] == idx)
+            return thin_log.val[k];
+    }
+    return mid[idx];
+}
+
+static void mid_set(int i, int j, uint8_t val)
+{
+    thin_log.idx[thin_log.len] = i * X_SIZE + j;
+    thin_log.val[thin_log.len] = val;
+    thin_log.len++;
+}
+
+#define E(di, dj) IS_EDGE(mid_get(i + (di), j + (dj)))
+
+/** @brief Thin the edge at an edge point (loop body of susan_thin)
+ *  @details May move (i, j) back, to revisit pixels affected by the change.
+ */
+static void thin_point(int *pi, int *pj)
+{
+    int i = *pi, j = *pj;
+    int l[9], centre, n, m, a = 0, b = 0, x, y;
+    int b00, b01, b02, b10, b12, b20, b21, b22, p1, p2, p3, p4;
+    uint8_t c = mid_get(i, j);
+
+    centre = r[i * X_SIZE + j];
+
+    n = E(-1, -1) + E(-1, 0) + E(-1, 1) + E(0, -1) + E(0, 1) +
+        E(1, -1) + E(1, 0) + E(1, 1);
+
+    if (n == 0) {
+        // No neighbours: remove the point
+        mid_set(i, j, NO_EDGE);
+    } else if (n == 1 && c < 6) {
+        // Extend the line, a few times at most (counted in mid), to the
+        // strongest neighbour opposite the one present
+        l[0] = r[(i - 1) * X_SIZE + j - 1];
+        l[1] = r[(i - 1) * X_SIZE + j];
+        l[2] = r[(i - 1) * X_SIZE + j + 1];
+        l[3] = r[i * X_SIZE + j - 1];
+        l[4] = 0;
+        l[5] = r[i * X_SIZE + j + 1];
+        l[6] = r[(i + 1) * X_SIZE + j - 1];
+        l[7] = r[(i + 1) * X_SIZE + j];
+        l[8] = r[(i + 1) * X_SIZE + j + 1];
+
+        if (E(-1, -1)) {
+            l[0] = 0; l[1] = 0; l[3] = 0; l[2] *= 2;
+            l[6] *= 2; l[5] *= 3; l[7] *= 3; l[8] *= 4;
+        } else if (E(-1, 0)) {
+            l[1] = 0; l[0] = 0; l[2] = 0; l[3] *= 2;
+            l[5] *= 2; l[6] *= 3; l[8] *= 3; l[7] *= 4;
+        } else if (E(-1, 1)) {
+            l[2] = 0; l[1] = 0; l[5] = 0; l[0] *= 2;
+            l[8] *= 2; l[3] *= 3; l[7] *= 3; l[6] *= 4;
+        } else if (E(0, -1)) {
+            l[3] = 0; l[0] = 0; l[6] = 0; l[1] *= 2;
+            l[7] *= 2; l[2] *= 3; l[8] *= 3; l[5] *= 4;
+        } else if (E(0, 1)) {
+            l[5] = 0; l[2] = 0; l[8] = 0; l[1] *= 2;
+            l[7] *= 2; l[0] *= 3; l[6] *= 3; l[3] *= 4;
+        } else if (E(1, -1)) {
+            l[6] = 0; l[3] = 0; l[7] = 0; l[0] *= 2;
+            l[8] *= 2; l[1] *= 3; l[5] *= 3; l[2] *= 4;
+        } else if (E(1, 0)) {
+            l[7] = 0; l[6] = 0; l[8] = 0; l[3] *= 2;
+            l[5] *= 2; l[0] *= 3; l[2] *= 3; l[1] *= 4;
+        } else if (E(1, 1)) {
+            l[8] = 0; l[5] = 0; l[7] = 0; l[6] *= 2;
+            l[2] *= 2; l[1] *= 3; l[3] *= 3; l[0] *= 4;
+        }
+
+        m = 0;
+        for (y = 0; y < 3; y++)
+            for (x = 0; x < 3; x++)
+                if (l[y + y + y + x] > m) {
+                    m = l[y + y + y + x]; a = y; b = x;
+                }
+
+        if (m > 0) {
+            mid_set(i + a - 1, j + b - 1, c < 4 ? 4 : c + 1);
+            if (a + a + b < 3) {
+                // Jump back in the image
+                i += a - 1;
+                j += b - 2;
+                if (i < 4) i = 4;
+                if (j < 4) j = 4;
+            }
+        }
+    } else if (n == 2) {
+        b00 = E(-1, -1);
+        b02 = E(-1, 1);
+        b20 = E(1, -1);
+        b22 = E(1, 1);
+        if (b00 + b02 + b20 + b22 == 2 && ((b00 | b22) & (b02 | b20))) {
+            // Move a point back into line
+            if (b00) {
+                if (b02) { x = 0; y = -1; }
+                else     { x = -1; y = 0; }
+            } else {
+                if (b02) { x = 1; y = 0; }
+                else     { x = 0; y = 1; }
+            }
+            // r / centre > 0.7
+            if (10 * (int32_t)r[(i + y) * X_SIZE + j + x] > 7 * (int32_t)centre) {
+                if ((x == 0 && !E(2 * y, 0) && !E(2 * y, -1) && !E(2 * y, 1)) ||
+                    (y == 0 && !E(0, 2 * x) && !E(1, 2 * x) && !E(-1, 2 * x))) {
+                    mid_set(i, j, NO_EDGE);
+                    mid_set(i + y, j + x, 3);
+                }
+            }
+        } else {
+            b01 = E(-1, 0);
+            b12 = E(0, 1);
+            b21 = E(1, 0);
+            b10 = E(0, -1);
+            if (b01 + b12 + b21 + b10 == 2 && ((b10 | b12) & (b01 | b21)) &&
+                ((b01 & (E(-2, -1) | E(-2, 1))) | (b10 & (E(-1, -2) | E(1, -2))) |
+                 (b12 & (E(-1, 2) | E(1, 2))) | (b21 & (E(2, -1) | E(2, 1))))) {
+                // Clear an odd right angle
+                mid_set(i, j, NO_EDGE);
+                i--;
+                j -= 2;
+                if (i < 4) i = 4;
+                if (j < 4) j = 4;
+            }
+        }
+    } else if (n > 2) {
+        // Thin without breaking connectivity
+        b01 = E(-1, 0);
+        b12 = E(0, 1);
+        b21 = E(1, 0);
+        b10 = E(0, -1);
+        if (b01 + b12 + b21 + b10 > 1) {
+            b00 = E(-1, -1);
+            b02 = E(-1, 1);
+            b20 = E(1, -1);
+            b22 = E(1, 1);
+            p1 = b00 | b01;
+            p2 = b02 | b12;
+            p3 = b22 | b21;
+            p4 = b20 | b10;
+
+            if ((p1 + p2 + p3 + p4) -
+                ((b01 & p2) + (b12 & p3) + (b21 & p4) + (b10 & p1)) < 2) {
+                mid_set(i, j, NO_EDGE);
+                i--;
+                j -= 2;
+                if (i < 4) i = 4;
+                if (j < 4) j = 4;
+            }
+        }
+    }
+
+    *pi = i;
+    *pj = j;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %ux%u\r\n", X_SIZE, Y_SIZE);
+
+    unsigned zero = 0;
+    int start = 4;
+    thin_log_t log;
+
+    log.len = 0;
+
+    CHAN_OUT3(unsigned, row, zero, CH(task_init, task_response),
+              CH(task_init, task_direction), CH(task_init, task_draw));
+    CHAN_OUT1(int, i, start, CH(task_init, task_thin));
+    CHAN_OUT1(int, j, start, CH(task_init, task_thin));
+    CHAN_OUT1(thin_log_t, log, log, CH(task_init, task_thin));
+
+    pass_end[0] = msp_cycles();
+    TRANSITION_TO(task_response);
+}
+
+/* Edge response: r = MAX_NO_EDGES - USAN area where the area is below the
+ * threshold, 0 elsewhere; also resets mid */
+void task_response() {
+    task_prologue();
+
+    unsigned row, end, j, idx;
+    int n;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_response),
+                    SELF_IN_CH(task_response));
+
+    end = row + RESPONSE_ROWS;
+    if (end > Y_SIZE)
+        end = Y_SIZE;
+    for ( ; row < end; row++) {
+        for (j = 0; j < X_SIZE; j++) {
+            idx = row * X_SIZE + j;
+            mid[idx] = NO_EDGE;
+            r[idx] = 0;
+            if (row < 3 || row >= Y_SIZE - 3 || j < 3 || j >= X_SIZE - 3)
+                continue;
+            n = usan(row, j);
+            if (n <= MAX_NO_EDGES)
+                r[idx] = MAX_NO_EDGES - n;
+        }
+    }
+
+    if (row < Y_SIZE) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_response));
+        TRANSITION_TO(task_response);
+    }
+    pass_end[PASS_RESPONSE + 1] = msp_cycles();
+    TRANSITION_TO(task_direction);
+}
+
+/* Non-maximum suppression across the edge direction: marks edge points in
+ * mid, rows 4 .. Y_SIZE - 5 */
+void task_direction() {
+    task_prologue();
+
+    unsigned row, end, j;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_direction),
+                    SELF_IN_CH(task_direction));
+    if (row < 4)
+        row = 4;
+
+    end = row + DIRECTION_ROWS;
+    if (end > Y_SIZE - 4)
+        end = Y_SIZE - 4;
+    for ( ; row < end; row++) {
+        for (j = 4; j < X_SIZE - 4; j++) {
+            if (r[row * X_SIZE + j] > 0)
+                edge_direction(row, j);
+        }
+    }
+
+    if (row < Y_SIZE - 4) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_direction));
+        TRANSITION_TO(task_direction);
+    }
+    pass_end[PASS_DIRECTION + 1] = msp_cycles();
+    TRANSITION_TO(task_thin);
+}
+
+/* Thinning (susan_thin): one scan of the edge points, which moves back when
+ * a change affects pixels already visited */
+void task_thin() {
+    task_prologue();
+
+    int i, j;
+    unsigned visits, k;
+    const thin_log_t *log;
+
+    i = *CHAN_IN2(int, i, CH(task_init, task_thin), SELF_IN_CH(task_thin));
+    j = *CHAN_IN2(int, j, CH(task_init, task_thin), SELF_IN_CH(task_thin));
+    log = CHAN_IN2(thin_log_t, log, CH(task_init, task_thin),
+                   SELF_IN_CH(task_thin));
+
+    // Apply the writes committed by the previous execution
+    for (k = 0; k < log->len; ++k)
+        mid[log->idx[k]] = log->val[k];
+
+    if (i >= Y_SIZE - 4) {
+        pass_end[PASS_THIN + 1] = msp_cycles();
+        TRANSITION_TO(task_draw);
+    }
+
+    thin_log.len = 0;
+    for (visits = 0; visits < THIN_BLOCK && i < Y_SIZE - 4 &&
+                     thin_log.len <= THIN_LOG_SIZE - 2; ++visits) {
+        if (IS_EDGE(mid_get(i, j)))
+            thin_point(&i, &j);
+        if (++j >= X_SIZE - 4) {
+            j = 4;
+            i++;
+        }
+    }
+
+    CHAN_OUT1(int, i, i, SELF_OUT_CH(task_thin));
+    CHAN_OUT1(int, j, j, SELF_OUT_CH(task_thin));
+    CHAN_OUT1(thin_log_t, log, thin_log, SELF_OUT_CH(task_thin));
+    TRANSITION_TO(task_thin);
+}
+
+/* Draws the edges on the image (edge_draw, drawing mode 0): a black pixel at
+ * each edge point, in a white 3x3 block */
+void task_draw() {
+    task_prologue();
+
+    unsigned row, end, j, idx;
+    uint8_t val;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_draw),
+                    SELF_IN_CH(task_draw));
+
+    end = row + DRAW_ROWS;
+    if (end > Y_SIZE)
+        end = Y_SIZE;
+    for ( ; row < end; row++) {
+        for (j = 0; j < X_SIZE; j++) {
+            idx = row * X_SIZE + j;
+            val = image[idx];
+            if (IS_EDGE(mid[idx])) {
+                val = 0;
+            } else if (row > 0 && row < Y_SIZE - 1 && j > 0 && j < X_SIZE - 1) {
+                if (IS_EDGE(mid[idx - X_SIZE - 1]) || IS_EDGE(mid[idx - X_SIZE]) ||
+                    IS_EDGE(mid[idx - X_SIZE + 1]) || IS_EDGE(mid[idx - 1]) ||
+                    IS_EDGE(mid[idx + 1]) || IS_EDGE(mid[idx + X_SIZE - 1]) ||
+                    IS_EDGE(mid[idx + X_SIZE]) || IS_EDGE(mid[idx + X_SIZE + 1]))
+                    val = 255;
+            }
+            out[idx] = val;
+        }
+    }
+
+    if (row < Y_SIZE) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_draw));
+        TRANSITION_TO(task_draw);
+    }
+    pass_end[PASS_DRAW + 1] = msp_cycles();
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the cycles of each pass, the number of edge points and a checksum
+ * of the output image: the sum of the pixels and the sum weighted by
+ * position, to compare with MiBench's output_small.edges.pgm */
+void task_done() {
+    task_prologue();
+
+    uint32_t sum = 0, weighted = 0;
+    unsigned i, edges = 0;
+
+    for (i = 0; i < X_SIZE * Y_SIZE; ++i) {
+        sum += out[i];
+        weighted += (uint32_t)(i + 1) * out[i];
+        if (IS_EDGE(mid[i]))
+            edges++;
+    }
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("edges: %u checksum: %n %n\r\n", edges, sum, weighted);
+
+    PRINTF("pass Cycles\r\n");
+    for (i = 0; i < NUM_PASSES; ++i)
+        PRINTF("%s %n\r\n", pass_names[i], pass_end[i + 1] - pass_end[i]);
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
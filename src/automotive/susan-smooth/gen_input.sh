@@ -0,0 +1,64 @@
+#! /bin/bash
+#
+# Generate input_small.h from a MiBench susan input image (binary PGM), with
+# the lookup tables that susan_smoothing computes at run time:
+#
+#   bright_lut[]: setup_brightness_lut(bt, form 2), indexed by -256..256
+#   dist_lut[]:   the Gaussian distance mask for distance threshold dt
+#
+# Usage: ./gen_input.sh [input_small.pgm] [bt] [dt] [rows] > input_small.h
+
+INPUT=${1:-../../../mibench-src/automotive/susan/input_small.pgm}
+BT=${2:-20}
+DT=${3:-4.0}
+
+# Header: magic, comments, "width height", maxval; the pixels are the rest
+SIZE=$(head -c 256 $INPUT | grep -av '^#' | sed -n 2p)
+X_SIZE=${SIZE% *}
+Y_SIZE=${SIZE#* }
+PIXELS=$((X_SIZE * Y_SIZE))
+
+# The first rows of the image, all of them by default
+Y_SIZE=${4:-$Y_SIZE}
+
+tail -c $PIXELS $INPUT | head -c $((X_SIZE * Y_SIZE)) | od -An -v -tu1 | awk \
+    -v x_size=$X_SIZE -v y_size=$Y_SIZE -v bt=$BT -v dt=$DT '
+    function table(name, type, size, values, n,    i, j, line) {
+        print "__ro_nv static const " type " " name "[" size "] = {"
+        for (i = 0; i < n; i += 16) {
+            line = "   "
+            for (j = i; j < i + 16 && j < n; ++j)
+                line = line " " values[j] ","
+            print line
+        }
+        print "};"
+        print ""
+    }
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench susan input_small.pgm */"
+        print ""
+        print "#define X_SIZE " x_size
+        print "#define Y_SIZE " y_size
+        print "#define BRIGHT_THRESH " bt
+        print "#define MASK_SIZE " int(1.5 * dt) + 1
+        print ""
+    }
+    { for (f = 1; f <= NF; ++f) pixels[n++] = $f }
+    END {
+        table("image", "uint8_t", "X_SIZE * Y_SIZE", pixels, n)
+
+        for (k = -256; k <= 256; ++k) {
+            t = k / bt
+            bright[k + 256] = int(100.0 * exp(-t * t))
+        }
+        table("bright_lut", "uint8_t", "513", bright, 513)
+
+        mask = int(1.5 * dt) + 1
+        m = 0
+        for (i = -mask; i <= mask; ++i)
+            for (j = -mask; j <= mask; ++j)
+                dist[m++] = int(100.0 * exp((i * i + j * j) / -(dt * dt)))
+        table("dist_lut", "uint8_t", "(2 * MASK_SIZE + 1) * (2 * MASK_SIZE + 1)",
+              dist, m)
+    }
+'
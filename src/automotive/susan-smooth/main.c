@@ -0,0 +1,288 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+#include <libwispbase/wisp-base.h>
+
+#include "pin_assign.h"
+
+// Defines X_SIZE, Y_SIZE, MASK_SIZE, image[], bright_lut[] and dist_lut[],
+// see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input_small.h"
+#endif
+
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Output rows per tile: one tile is smoothed per task execution, so this is
+// the unit of work lost on a power failure. Each tile takes roughly
+// TILE_ROWS * X_SIZE * (2 * MASK_SIZE + 1)^2 multiply-accumulates.
+#ifndef TILE_ROWS
+#define TILE_ROWS 4
+#endif
+
+#define NUM_TILES ((Y_SIZE + TILE_ROWS - 1) / TILE_ROWS)
+
+// Rows of the enlarged image copied per task execution
+#define ENLARGE_ROWS 8
+
+/* The image with a border of MASK_SIZE pixels, mirrored (enlarge()) */
+#define ENL_X_SIZE (X_SIZE + 2 * MASK_SIZE)
+#define ENL_Y_SIZE (Y_SIZE + 2 * MASK_SIZE)
+
+#define MASK_WIDTH (2 * MASK_SIZE + 1)
+
+uint8_t usrBank[USRBANK_SIZE];
+
+/* Both images are written, never read back, by the task that fills them,
+ * so re-executing a task after a power failure writes the same values. */
+__nv static uint8_t enlarged[ENL_X_SIZE * ENL_Y_SIZE];
+__nv static uint8_t smoothed[X_SIZE * Y_SIZE];
+
+/* Cycles of the last complete execution of each tile */
+__nv static uint32_t tile_cycles[NUM_TILES];
+
+volatile unsigned work_x;
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+TASK(1, task_init)
+TASK(2, task_enlarge)
+TASK(3, task_smooth)
+TASK(4, task_done)
+TASK(5, task_end)
+
+struct row_args {
+    CHAN_FIELD(unsigned, row);
+};
+
+struct row_state {
+    SELF_CHAN_FIELD(unsigned, row);
+};
+
+#define FIELD_INIT_row_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct tile_args {
+    CHAN_FIELD(unsigned, tile);
+};
+
+struct tile_state {
+    SELF_CHAN_FIELD(unsigned, tile);
+};
+
+#define FIELD_INIT_tile_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_enlarge, row_args);
+SELF_CHANNEL(task_enlarge, row_state);
+CHANNEL(task_init, task_smooth, tile_args);
+SELF_CHANNEL(task_smooth, tile_state);
+
+/* Mirror a coordinate of the enlarged image into the input image */
+static unsigned reflect(int v, int size)
+{
+    if (v < 0)
+        return -1 - v;
+    if (v >= size)
+        return 2 * size - 1 - v;
+    return v;
+}
+
+/* Median of the 8 neighbours, for a pixel whose mask is all dissimilar */
+static uint8_t median(const uint8_t *in, unsigned i, unsigned j)
+{
+    uint8_t p[8], tmp;
+    int k, l;
+
+    p[0] = in[(i - 1) * ENL_X_SIZE + j - 1];
+    p[1] = in[(i - 1) * ENL_X_SIZE + j    ];
+    p[2] = in[(i - 1) * ENL_X_SIZE + j + 1];
+    p[3] = in[(i    ) * ENL_X_SIZE + j - 1];
+    p[4] = in[(i    ) * ENL_X_SIZE + j + 1];
+    p[5] = in[(i + 1) * ENL_X_SIZE + j - 1];
+    p[6] = in[(i + 1) * ENL_X_SIZE + j    ];
+    p[7] = in[(i + 1) * ENL_X_SIZE + j + 1];
+
+    for (k = 0; k < 7; k++)
+        for (l = 0; l < (7 - k); l++)
+            if (p[l] > p[l + 1]) {
+                tmp = p[l]; p[l] = p[l + 1]; p[l + 1] = tmp;
+            }
+
+    return (p[3] + p[4]) / 2;
+}
+
+/** @brief Smooth one pixel with the Gaussian mask (susan_smoothing)
+ *  @param i, j  Coordinates in the enlarged image
+ */
+static uint8_t smooth_pixel(unsigned i, unsigned j)
+{
+    const uint8_t *ip = enlarged + (i - MASK_SIZE) * ENL_X_SIZE + j - MASK_SIZE;
+    const uint8_t *dpt = dist_lut;
+    uint8_t centre = enlarged[i * ENL_X_SIZE + j];
+    const uint8_t *cp = bright_lut + 256 + centre;
+    int32_t area = 0, total = 0;
+    unsigned tmp;
+    uint8_t brightness;
+    int x, y;
+
+    for (y = -MASK_SIZE; y <= MASK_SIZE; y++) {
+        for (x = -MASK_SIZE; x <= MASK_SIZE; x++) {
+            brightness = *ip++;
+            tmp = *dpt++ * *(cp - brightness);
+            area += tmp;
+            total += (int32_t)tmp * brightness;
+        }
+        ip += ENL_X_SIZE - MASK_WIDTH;
+    }
+
+    area -= 10000;
+    if (area == 0)
+        return median(enlarged, i, j);
+    return (total - (int32_t)centre * 10000) / area;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %ux%u, %u tiles of %u rows\r\n",
+        X_SIZE, Y_SIZE, NUM_TILES, TILE_ROWS);
+
+    unsigned zero = 0;
+    CHAN_OUT1(unsigned, row, zero, CH(task_init, task_enlarge));
+    CHAN_OUT1(unsigned, tile, zero, CH(task_init, task_smooth));
+    TRANSITION_TO(task_enlarge);
+}
+
+/* Copies the input into the middle of the enlarged image and mirrors
+ * MASK_SIZE rows and columns at each edge, ENLARGE_ROWS rows at a time */
+void task_enlarge() {
+    task_prologue();
+
+    unsigned row, end, src_row, j;
+
+    row = *CHAN_IN2(unsigned, row, CH(task_init, task_enlarge),
+                    SELF_IN_CH(task_enlarge));
+
+    end = row + ENLARGE_ROWS;
+    if (end > ENL_Y_SIZE)
+        end = ENL_Y_SIZE;
+    for ( ; row < end; row++) {
+        src_row = reflect((int)row - MASK_SIZE, Y_SIZE);
+        for (j = 0; j < ENL_X_SIZE; j++) {
+            enlarged[row * ENL_X_SIZE + j] =
+                image[src_row * X_SIZE + reflect((int)j - MASK_SIZE, X_SIZE)];
+        }
+    }
+
+    if (row < ENL_Y_SIZE) {
+        CHAN_OUT1(unsigned, row, row, SELF_OUT_CH(task_enlarge));
+        TRANSITION_TO(task_enlarge);
+    }
+    TRANSITION_TO(task_smooth);
+}
+
+/* Smooths one tile of TILE_ROWS output rows per execution */
+void task_smooth() {
+    task_prologue();
+
+    unsigned tile, row, end, j;
+    uint32_t start = msp_cycles();
+
+    tile = *CHAN_IN2(unsigned, tile, CH(task_init, task_smooth),
+                     SELF_IN_CH(task_smooth));
+
+    row = tile * TILE_ROWS;
+    end = row + TILE_ROWS;
+    if (end > Y_SIZE)
+        end = Y_SIZE;
+    for ( ; row < end; row++) {
+        for (j = 0; j < X_SIZE; j++)
+            smoothed[row * X_SIZE + j] =
+                smooth_pixel(row + MASK_SIZE, j + MASK_SIZE);
+    }
+
+    tile_cycles[tile] = msp_cycles() - start;
+
+    tile++;
+    if (tile < NUM_TILES) {
+        CHAN_OUT1(unsigned, tile, tile, SELF_OUT_CH(task_smooth));
+        TRANSITION_TO(task_smooth);
+    }
+    TRANSITION_TO(task_done);
+}
+
+/* Prints per-tile cycles and a checksum of the output image: the sum of the
+ * pixels and the sum weighted by position, to compare with MiBench's
+ * output_small.smoothing.pgm */
+void task_done() {
+    task_prologue();
+
+    uint32_t sum = 0, weighted = 0;
+    uint32_t min = UINT32_MAX, max = 0, tiles = 0;
+    unsigned i;
+
+    for (i = 0; i < X_SIZE * Y_SIZE; ++i) {
+        sum += smoothed[i];
+        weighted += (uint32_t)(i + 1) * smoothed[i];
+    }
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("checksum: %n %n\r\n", sum, weighted);
+
+    PRINTF("tile Cycles\r\n");
+    for (i = 0; i < NUM_TILES; ++i) {
+        PRINTF("%u %n\r\n", i, tile_cycles[i]);
+        tiles += tile_cycles[i];
+        if (tile_cycles[i] < min)
+            min = tile_cycles[i];
+        if (tile_cycles[i] > max)
+            max = tile_cycles[i];
+    }
+    PRINTF("%u tiles of %u rows: min %n avg %n max %n\r\n",
+           NUM_TILES, TILE_ROWS, min, tiles / NUM_TILES, max);
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
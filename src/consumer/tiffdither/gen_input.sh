@@ -0,0 +1,48 @@
+#! /bin/bash
+#
+# Generate input.h from a MiBench susan input image (binary PGM), with the
+# CRC-32 of the dithered rows (the gzip trailer), as the reference
+# pgmdither wrote them to data/small.raw, to check the result
+#
+# The last row is not written, so the rows dithered from the first rows of
+# the image are the first rows of small.raw.
+#
+# Usage: ./gen_input.sh [input_small.pgm] [tiffdither dir] [rows] > input.h
+
+INPUT=${1:-../../../mibench-src/automotive/susan/input_small.pgm}
+DITHER=${2:-../../../mibench-src/consumer/tiffdither}
+
+# Header: magic, comments, "width height", maxval; the pixels are the rest
+SIZE=$(head -c 256 $INPUT | grep -av '^#' | sed -n 2p)
+X_SIZE=${SIZE% *}
+Y_SIZE=${SIZE#* }
+PIXELS=$((X_SIZE * Y_SIZE))
+
+# The first rows of the image, all of them by default
+Y_SIZE=${3:-$Y_SIZE}
+
+CRC=$(head -c $(((Y_SIZE - 1) * ((X_SIZE + 7) / 8))) $DITHER/data/small.raw |
+      gzip -c | tail -c 8 | head -c 4 | od -An -tx1 |
+      awk '{ print $4 $3 $2 $1 }')
+
+tail -c $PIXELS $INPUT | head -c $((X_SIZE * Y_SIZE)) | od -An -v -tu1 | awk \
+    -v x_size=$X_SIZE -v y_size=$Y_SIZE -v crc=$CRC '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench susan input_small.pgm */"
+        print ""
+        print "#define X_SIZE " x_size
+        print "#define Y_SIZE " y_size
+        print "#define DITHER_CRC32 0x" crc "UL"
+        print ""
+        print "__ro_nv static const uint8_t image[X_SIZE * Y_SIZE] = {"
+    }
+    {
+        line = "   "
+        for (f = 1; f <= NF; ++f)
+            line = line " " $f ","
+        print line
+    }
+    END {
+        print "};"
+    }
+'
@@ -0,0 +1,460 @@
+/* Generated by gen_input.sh from MiBench susan input_small.pgm */
+
+#define X_SIZE 76
+#define Y_SIZE 95
+#define DITHER_CRC32 0x1bdee274UL
+
+__ro_nv static const uint8_t image[X_SIZE * Y_SIZE] = {
+    35, 36, 36, 36, 36, 38, 38, 36, 37, 37, 37, 38, 38, 36, 34, 38,
+    40, 41, 42, 40, 38, 36, 36, 35, 36, 35, 32, 35, 38, 42, 42, 38,
+    36, 36, 36, 37, 36, 35, 33, 33, 33, 32, 31, 33, 36, 39, 40, 36,
+    36, 34, 34, 36, 38, 39, 37, 36, 36, 35, 36, 39, 39, 37, 37, 39,
+    37, 38, 39, 40, 38, 37, 37, 33, 33, 32, 33, 34, 35, 35, 36, 36,
+    36, 37, 38, 37, 38, 38, 39, 41, 41, 40, 40, 43, 42, 41, 40, 39,
+    38, 35, 33, 35, 35, 37, 39, 38, 37, 36, 38, 36, 36, 34, 34, 38,
+    39, 39, 37, 36, 36, 34, 33, 34, 33, 35, 33, 36, 35, 35, 36, 36,
+    37, 33, 32, 36, 38, 38, 38, 39, 39, 38, 39, 37, 35, 36, 34, 35,
+    36, 37, 39, 38, 37, 34, 31, 34, 35, 35, 35, 35, 36, 38, 39, 39,
+    37, 38, 38, 40, 39, 40, 41, 43, 44, 42, 40, 39, 38, 42, 42, 39,
+    39, 36, 33, 33, 34, 36, 36, 35, 33, 33, 35, 37, 36, 34, 34, 31,
+    30, 32, 36, 42, 43, 43, 40, 36, 36, 36, 35, 34, 35, 33, 33, 30,
+    32, 34, 35, 35, 35, 36, 35, 37, 34, 34, 35, 36, 37, 37, 35, 36,
+    37, 39, 39, 38, 35, 35, 35, 35, 35, 36, 38, 37, 38, 38, 36, 35,
+    35, 36, 35, 35, 35, 35, 34, 34, 36, 36, 38, 40, 38, 37, 36, 34,
+    34, 35, 35, 36, 37, 37, 38, 38, 39, 39, 36, 35, 36, 35, 37, 36,
+    38, 39, 37, 38, 34, 33, 32, 33, 32, 28, 34, 40, 45, 44, 40, 38,
+    34, 30, 30, 33, 40, 45, 43, 41, 37, 37, 37, 36, 33, 31, 32, 31,
+    35, 35, 35, 35, 35, 38, 39, 39, 40, 39, 37, 37, 37, 35, 35, 37,
+    37, 36, 37, 37, 37, 38, 37, 38, 37, 37, 35, 35, 34, 35, 35, 35,
+    36, 39, 45, 43, 38, 39, 38, 36, 36, 36, 35, 37, 39, 38, 37, 37,
+    37, 39, 38, 37, 37, 35, 34, 34, 37, 39, 36, 37, 38, 39, 40, 41,
+    39, 36, 38, 39, 39, 39, 36, 33, 32, 30, 30, 31, 35, 35, 35, 35,
+    35, 39, 40, 38, 37, 40, 39, 38, 39, 39, 39, 38, 39, 39, 40, 40,
+    39, 41, 39, 41, 39, 38, 39, 38, 38, 36, 35, 36, 35, 37, 38, 38,
+    38, 40, 38, 39, 39, 36, 36, 33, 34, 36, 35, 37, 38, 39, 39, 38,
+    36, 32, 32, 35, 38, 38, 39, 38, 35, 35, 34, 37, 39, 38, 36, 35,
+    35, 33, 31, 30, 32, 36, 37, 38, 35, 35, 35, 35, 35, 39, 41, 42,
+    38, 33, 31, 33, 37, 36, 37, 38, 37, 37, 38, 39, 38, 38, 38, 38,
+    37, 38, 38, 39, 41, 41, 37, 39, 40, 42, 44, 43, 39, 42, 48, 45,
+    41, 39, 38, 38, 38, 38, 36, 37, 38, 39, 39, 39, 43, 41, 38, 37,
+    37, 38, 36, 34, 34, 34, 38, 41, 41, 38, 35, 35, 34, 35, 32, 30,
+    31, 33, 34, 35, 35, 35, 35, 35, 35, 39, 36, 35, 38, 41, 38, 32,
+    34, 38, 34, 38, 40, 39, 39, 36, 36, 39, 38, 39, 37, 38, 38, 36,
+    36, 35, 37, 38, 39, 38, 36, 38, 37, 35, 31, 35, 37, 40, 39, 35,
+    35, 36, 34, 36, 36, 38, 37, 38, 37, 37, 36, 37, 38, 37, 36, 35,
+    34, 34, 34, 37, 36, 37, 36, 34, 36, 36, 34, 31, 30, 33, 32, 33,
+    35, 35, 35, 35, 34, 27, 33, 39, 42, 41, 42, 44, 45, 42, 39, 41,
+    41, 42, 43, 42, 41, 40, 38, 37, 35, 37, 36, 36, 36, 37, 36, 36,
+    37, 37, 39, 43, 43, 43, 42, 39, 39, 39, 39, 40, 39, 38, 35, 34,
+    36, 37, 36, 37, 38, 38, 37, 36, 35, 35, 33, 35, 38, 38, 39, 41,
+    39, 38, 37, 38, 38, 36, 37, 36, 37, 37, 36, 36, 35, 35, 35, 35,
+    36, 42, 40, 41, 43, 42, 39, 37, 37, 37, 37, 39, 39, 38, 37, 35,
+    37, 36, 35, 36, 36, 39, 39, 36, 36, 34, 37, 40, 40, 40, 39, 41,
+    40, 39, 39, 39, 40, 38, 36, 34, 35, 37, 34, 36, 35, 35, 34, 33,
+    36, 36, 38, 39, 38, 37, 34, 34, 33, 34, 35, 36, 36, 35, 36, 35,
+    38, 39, 39, 40, 38, 37, 36, 36, 35, 35, 35, 35, 36, 36, 42, 45,
+    44, 43, 40, 38, 37, 36, 37, 37, 38, 38, 38, 38, 36, 35, 35, 34,
+    34, 36, 38, 36, 35, 38, 37, 37, 38, 38, 37, 38, 36, 33, 35, 37,
+    37, 38, 38, 41, 41, 41, 38, 35, 33, 30, 29, 32, 37, 39, 39, 38,
+    39, 38, 35, 34, 35, 35, 35, 35, 34, 35, 36, 36, 37, 38, 38, 38,
+    36, 35, 33, 34, 35, 35, 35, 35, 36, 36, 32, 33, 36, 38, 40, 42,
+    42, 39, 40, 41, 43, 42, 36, 33, 32, 33, 32, 35, 37, 41, 41, 39,
+    40, 37, 36, 38, 39, 41, 40, 40, 41, 39, 37, 37, 36, 37, 37, 36,
+    35, 37, 37, 39, 41, 41, 43, 41, 40, 40, 37, 37, 38, 38, 38, 38,
+    38, 36, 38, 37, 36, 39, 41, 41, 42, 41, 39, 38, 38, 36, 37, 37,
+    35, 35, 35, 36, 36, 33, 35, 37, 34, 35, 35, 35, 39, 38, 39, 41,
+    43, 43, 43, 42, 39, 38, 39, 37, 37, 38, 37, 36, 38, 38, 40, 38,
+    39, 39, 36, 35, 34, 33, 34, 36, 37, 38, 37, 37, 37, 36, 34, 34,
+    33, 34, 35, 38, 41, 38, 36, 37, 37, 37, 37, 39, 41, 40, 41, 42,
+    41, 40, 41, 41, 39, 40, 40, 39, 37, 37, 36, 38, 35, 35, 35, 36,
+    37, 45, 42, 40, 44, 45, 42, 43, 42, 42, 45, 47, 49, 51, 50, 51,
+    50, 49, 45, 45, 45, 43, 42, 42, 43, 41, 39, 40, 40, 40, 39, 38,
+    40, 40, 39, 39, 39, 38, 35, 33, 37, 41, 42, 39, 37, 37, 37, 38,
+    38, 36, 37, 35, 33, 32, 33, 34, 35, 35, 38, 39, 37, 38, 36, 35,
+    37, 38, 39, 42, 41, 38, 36, 34, 35, 35, 35, 35, 36, 39, 38, 36,
+    37, 37, 37, 36, 40, 42, 43, 47, 49, 48, 47, 44, 43, 47, 52, 55,
+    52, 47, 44, 42, 42, 42, 40, 40, 39, 38, 37, 37, 39, 38, 38, 38,
+    36, 33, 31, 34, 35, 38, 39, 38, 37, 38, 38, 37, 38, 37, 42, 46,
+    45, 42, 39, 39, 38, 34, 36, 39, 39, 37, 35, 36, 34, 37, 37, 36,
+    36, 39, 41, 42, 35, 35, 35, 35, 36, 40, 40, 38, 39, 39, 36, 36,
+    38, 39, 42, 46, 49, 50, 52, 52, 51, 51, 52, 54, 51, 50, 51, 52,
+    51, 47, 47, 46, 47, 45, 43, 43, 43, 43, 43, 42, 41, 41, 40, 40,
+    42, 46, 44, 41, 37, 36, 37, 39, 39, 38, 38, 39, 38, 38, 39, 37,
+    35, 35, 38, 38, 38, 36, 35, 35, 37, 35, 36, 38, 36, 38, 38, 39,
+    35, 35, 35, 36, 36, 39, 39, 40, 40, 39, 37, 38, 41, 39, 43, 46,
+    47, 49, 49, 49, 48, 48, 51, 52, 52, 53, 53, 52, 51, 52, 50, 48,
+    49, 48, 46, 47, 47, 44, 42, 43, 44, 43, 45, 48, 46, 45, 44, 42,
+    43, 46, 45, 44, 42, 41, 38, 39, 38, 37, 36, 35, 37, 35, 37, 36,
+    33, 31, 32, 38, 43, 42, 41, 39, 37, 38, 37, 37, 35, 35, 36, 36,
+    36, 38, 38, 36, 37, 39, 38, 39, 38, 39, 42, 47, 49, 46, 46, 47,
+    47, 46, 47, 49, 48, 48, 49, 51, 50, 49, 50, 51, 48, 46, 46, 47,
+    48, 47, 45, 43, 42, 44, 45, 47, 49, 51, 51, 51, 49, 47, 48, 47,
+    49, 46, 44, 40, 39, 40, 40, 39, 38, 40, 38, 39, 40, 39, 37, 36,
+    35, 33, 35, 34, 32, 33, 34, 38, 35, 36, 36, 36, 36, 35, 36, 38,
+    36, 37, 37, 37, 38, 38, 39, 43, 46, 51, 52, 50, 50, 48, 50, 49,
+    49, 50, 48, 50, 50, 49, 49, 51, 54, 54, 51, 51, 49, 47, 48, 52,
+    53, 51, 49, 46, 46, 43, 46, 45, 47, 50, 49, 47, 47, 46, 45, 48,
+    48, 45, 43, 44, 43, 43, 42, 41, 39, 39, 39, 37, 37, 34, 34, 32,
+    33, 35, 36, 39, 35, 36, 36, 36, 36, 40, 39, 36, 36, 35, 34, 33,
+    32, 37, 43, 51, 56, 54, 55, 56, 55, 52, 50, 49, 46, 46, 45, 47,
+    49, 51, 54, 54, 51, 49, 50, 50, 48, 47, 45, 46, 47, 50, 50, 48,
+    43, 42, 42, 43, 45, 47, 47, 48, 50, 49, 47, 47, 48, 49, 47, 48,
+    48, 47, 47, 45, 44, 42, 39, 38, 38, 38, 42, 41, 41, 39, 36, 35,
+    35, 35, 36, 36, 36, 34, 37, 37, 35, 36, 36, 35, 36, 37, 38, 41,
+    50, 67, 82, 84, 80, 80, 76, 75, 74, 71, 64, 61, 58, 54, 53, 54,
+    56, 56, 53, 51, 51, 49, 47, 49, 49, 48, 48, 47, 47, 48, 48, 47,
+    45, 46, 47, 46, 46, 45, 41, 42, 44, 44, 45, 45, 48, 47, 44, 42,
+    37, 35, 34, 32, 33, 37, 40, 37, 37, 36, 36, 37, 35, 35, 36, 36,
+    36, 37, 35, 37, 37, 37, 35, 35, 35, 37, 40, 41, 46, 58, 85, 119,
+    137, 133, 123, 115, 109, 110, 109, 107, 102, 95, 93, 88, 86, 86, 86, 86,
+    83, 77, 68, 64, 59, 58, 61, 61, 61, 58, 56, 51, 49, 51, 51, 50,
+    50, 45, 37, 41, 47, 50, 50, 53, 52, 49, 48, 45, 43, 42, 39, 38,
+    36, 38, 39, 39, 39, 38, 37, 36, 35, 35, 35, 36, 36, 34, 36, 36,
+    38, 39, 38, 37, 39, 41, 43, 47, 56, 79, 121, 150, 146, 148, 157, 154,
+    156, 157, 155, 153, 154, 150, 148, 146, 145, 145, 141, 139, 136, 133, 133, 131,
+    128, 127, 124, 118, 114, 119, 113, 104, 99, 100, 100, 97, 89, 83, 79, 76,
+    73, 69, 60, 52, 48, 47, 45, 46, 40, 37, 38, 38, 42, 45, 43, 42,
+    42, 39, 38, 39, 35, 35, 36, 36, 36, 37, 37, 40, 42, 42, 40, 39,
+    38, 40, 43, 49, 60, 83, 126, 151, 158, 163, 159, 162, 163, 166, 168, 165,
+    162, 165, 166, 163, 162, 162, 160, 162, 162, 160, 161, 163, 160, 156, 152, 152,
+    151, 148, 146, 141, 137, 136, 134, 131, 127, 122, 118, 115, 118, 113, 97, 78,
+    59, 45, 48, 46, 40, 38, 38, 37, 38, 38, 35, 37, 37, 34, 32, 32,
+    35, 36, 36, 36, 36, 38, 39, 38, 37, 38, 35, 34, 36, 35, 37, 41,
+    51, 77, 120, 156, 165, 160, 161, 163, 164, 167, 166, 164, 164, 163, 163, 165,
+    166, 165, 162, 162, 162, 163, 164, 163, 161, 161, 163, 162, 162, 165, 164, 162,
+    163, 165, 164, 165, 164, 160, 159, 157, 151, 144, 126, 95, 63, 43, 47, 42,
+    38, 38, 36, 36, 36, 38, 37, 37, 37, 36, 37, 38, 35, 36, 36, 36,
+    36, 39, 39, 39, 41, 38, 33, 35, 37, 39, 45, 51, 58, 80, 121, 152,
+    162, 163, 164, 162, 162, 165, 167, 167, 168, 170, 170, 168, 169, 168, 166, 166,
+    165, 165, 167, 169, 166, 164, 164, 166, 165, 165, 167, 167, 166, 164, 163, 165,
+    166, 165, 166, 165, 165, 156, 128, 88, 54, 44, 47, 48, 46, 43, 41, 36,
+    37, 40, 38, 40, 38, 38, 37, 39, 35, 36, 36, 36, 36, 38, 41, 39,
+    37, 35, 32, 34, 36, 38, 42, 47, 57, 82, 118, 151, 168, 170, 172, 168,
+    165, 165, 165, 164, 165, 167, 166, 167, 169, 168, 168, 167, 167, 165, 165, 165,
+    164, 163, 164, 163, 159, 163, 163, 163, 164, 164, 162, 162, 164, 162, 162, 165,
+    165, 158, 134, 96, 63, 53, 49, 44, 42, 42, 41, 38, 36, 37, 36, 37,
+    38, 39, 38, 40, 35, 36, 36, 36, 36, 34, 36, 35, 37, 39, 40, 43,
+    41, 41, 44, 48, 56, 83, 129, 157, 167, 168, 169, 168, 167, 169, 167, 166,
+    166, 167, 165, 165, 167, 169, 168, 169, 167, 168, 167, 168, 166, 167, 169, 168,
+    164, 165, 168, 167, 168, 169, 167, 165, 163, 161, 159, 162, 163, 157, 131, 91,
+    59, 45, 45, 47, 43, 42, 39, 36, 36, 36, 40, 38, 39, 39, 37, 36,
+    36, 36, 36, 36, 36, 34, 37, 38, 39, 40, 43, 43, 43, 43, 40, 43,
+    56, 87, 129, 156, 162, 161, 165, 168, 166, 167, 166, 164, 168, 168, 166, 168,
+    166, 166, 167, 167, 165, 165, 164, 164, 165, 166, 167, 167, 164, 166, 166, 164,
+    165, 167, 166, 165, 165, 161, 162, 164, 163, 157, 132, 92, 61, 48, 47, 49,
+    45, 44, 41, 38, 37, 37, 38, 34, 35, 35, 35, 35, 36, 36, 36, 36,
+    36, 40, 39, 36, 34, 35, 35, 37, 37, 40, 49, 56, 62, 89, 132, 157,
+    163, 168, 168, 164, 166, 169, 168, 167, 169, 168, 167, 168, 169, 168, 167, 167,
+    169, 168, 168, 169, 167, 164, 165, 164, 164, 165, 165, 166, 167, 167, 167, 166,
+    164, 163, 165, 169, 170, 160, 129, 90, 60, 45, 44, 43, 36, 36, 37, 39,
+    38, 40, 40, 37, 36, 36, 33, 35, 36, 36, 36, 36, 36, 34, 34, 34,
+    33, 34, 34, 35, 37, 40, 42, 41, 50, 80, 129, 160, 164, 167, 171, 168,
+    165, 168, 168, 167, 169, 166, 166, 167, 167, 166, 165, 166, 167, 169, 170, 169,
+    167, 166, 165, 163, 163, 163, 165, 165, 166, 166, 165, 164, 165, 164, 167, 169,
+    168, 160, 133, 96, 65, 48, 47, 45, 38, 37, 37, 37, 37, 39, 39, 37,
+    38, 36, 35, 35, 36, 36, 36, 36, 36, 40, 41, 40, 41, 42, 42, 41,
+    39, 39, 45, 53, 66, 100, 145, 170, 170, 169, 176, 170, 164, 168, 170, 169,
+    172, 173, 170, 170, 171, 171, 170, 172, 172, 168, 166, 169, 168, 168, 168, 168,
+    166, 167, 167, 167, 167, 167, 168, 169, 168, 166, 169, 168, 166, 158, 129, 93,
+    69, 50, 50, 51, 43, 44, 43, 41, 37, 37, 40, 38, 38, 37, 36, 38,
+    36, 36, 36, 36, 36, 36, 38, 39, 40, 39, 40, 39, 42, 46, 49, 52,
+    62, 90, 133, 155, 156, 158, 162, 166, 168, 169, 167, 166, 167, 168, 168, 169,
+    170, 169, 170, 170, 169, 171, 171, 168, 167, 168, 167, 168, 167, 166, 167, 166,
+    166, 165, 166, 167, 165, 165, 165, 166, 164, 157, 130, 93, 61, 45, 49, 48,
+    43, 41, 38, 37, 36, 38, 38, 37, 36, 35, 35, 39, 36, 36, 36, 36,
+    37, 41, 42, 40, 41, 41, 38, 40, 42, 42, 45, 50, 61, 91, 135, 162,
+    163, 160, 162, 162, 163, 165, 165, 163, 166, 168, 164, 166, 169, 169, 167, 168,
+    169, 167, 167, 166, 163, 160, 162, 165, 167, 168, 168, 166, 166, 167, 165, 164,
+    163, 165, 165, 164, 165, 155, 122, 84, 60, 48, 52, 46, 34, 36, 36, 37,
+    34, 34, 37, 34, 32, 33, 34, 37, 36, 36, 36, 37, 37, 36, 39, 39,
+    41, 40, 41, 40, 39, 42, 44, 49, 62, 92, 132, 160, 172, 175, 170, 169,
+    167, 166, 165, 164, 166, 168, 167, 165, 166, 167, 167, 167, 166, 167, 170, 168,
+    167, 167, 166, 168, 166, 165, 165, 164, 164, 164, 165, 165, 163, 161, 162, 163,
+    163, 155, 125, 86, 61, 47, 47, 49, 45, 44, 44, 43, 44, 45, 44, 42,
+    41, 38, 35, 38, 37, 37, 37, 37, 37, 39, 40, 40, 42, 44, 42, 43,
+    47, 45, 44, 50, 66, 99, 145, 163, 159, 160, 164, 167, 167, 167, 169, 168,
+    170, 169, 166, 168, 168, 168, 169, 169, 168, 165, 163, 165, 164, 167, 170, 172,
+    173, 173, 169, 166, 165, 166, 165, 164, 163, 162, 159, 160, 159, 149, 119, 79,
+    53, 39, 39, 38, 37, 40, 38, 38, 37, 38, 40, 41, 39, 38, 36, 36,
+    37, 37, 37, 37, 37, 40, 39, 40, 40, 40, 40, 38, 39, 43, 44, 48,
+    59, 95, 135, 153, 160, 161, 159, 162, 164, 166, 166, 166, 168, 171, 168, 167,
+    168, 167, 165, 164, 164, 165, 166, 168, 168, 168, 166, 165, 164, 165, 167, 163,
+    163, 164, 164, 165, 163, 162, 162, 162, 163, 151, 118, 79, 52, 38, 36, 40,
+    41, 41, 42, 39, 38, 40, 40, 39, 39, 39, 37, 38, 37, 37, 37, 37,
+    37, 41, 42, 40, 41, 43, 43, 45, 43, 42, 43, 47, 62, 95, 136, 163,
+    164, 160, 164, 162, 164, 165, 168, 168, 167, 166, 165, 168, 168, 167, 168, 165,
+    163, 164, 165, 166, 167, 166, 167, 165, 166, 166, 162, 161, 161, 162, 165, 169,
+    173, 169, 168, 167, 162, 150, 117, 79, 60, 51, 45, 40, 37, 38, 38, 36,
+    34, 33, 34, 34, 33, 35, 37, 36, 37, 37, 37, 37, 37, 36, 40, 38,
+    39, 40, 41, 38, 40, 43, 48, 52, 62, 96, 136, 153, 157, 162, 161, 163,
+    164, 166, 167, 166, 165, 166, 164, 161, 161, 162, 162, 164, 164, 163, 163, 164,
+    165, 166, 164, 162, 163, 164, 167, 165, 167, 169, 168, 165, 159, 158, 161, 162,
+    162, 152, 123, 86, 61, 48, 46, 47, 40, 38, 37, 34, 36, 35, 39, 41,
+    40, 39, 37, 37, 37, 37, 37, 37, 37, 39, 39, 40, 39, 40, 42, 41,
+    40, 43, 42, 43, 52, 85, 125, 150, 164, 158, 160, 172, 174, 169, 170, 171,
+    170, 170, 166, 168, 168, 169, 169, 164, 163, 163, 163, 166, 165, 164, 167, 167,
+    167, 167, 165, 165, 163, 163, 162, 163, 164, 162, 162, 165, 164, 156, 123, 79,
+    57, 47, 45, 47, 40, 37, 36, 35, 38, 37, 39, 40, 38, 39, 36, 35,
+    37, 37, 37, 37, 37, 41, 38, 33, 31, 37, 44, 44, 44, 46, 48, 52,
+    64, 96, 139, 158, 153, 157, 159, 160, 159, 159, 162, 167, 171, 166, 165, 167,
+    167, 167, 168, 169, 170, 166, 164, 165, 163, 165, 164, 164, 165, 163, 164, 164,
+    164, 165, 162, 162, 162, 161, 163, 158, 154, 146, 117, 83, 55, 40, 46, 48,
+    44, 42, 39, 40, 37, 39, 40, 38, 38, 38, 39, 42, 37, 37, 37, 37,
+    38, 39, 40, 41, 41, 41, 41, 40, 42, 46, 47, 52, 65, 102, 142, 154,
+    159, 156, 161, 173, 168, 165, 167, 165, 165, 167, 167, 168, 166, 167, 168, 168,
+    168, 167, 164, 166, 166, 166, 166, 164, 162, 161, 162, 163, 164, 166, 166, 164,
+    164, 162, 164, 164, 160, 148, 116, 76, 57, 50, 47, 42, 38, 41, 42, 41,
+    37, 36, 37, 36, 36, 37, 35, 35, 37, 37, 37, 37, 38, 39, 40, 41,
+    39, 41, 40, 36, 34, 37, 39, 42, 61, 100, 143, 166, 159, 160, 166, 169,
+    168, 166, 165, 163, 167, 165, 165, 166, 166, 165, 165, 167, 169, 166, 165, 167,
+    166, 167, 166, 166, 164, 164, 164, 165, 165, 167, 166, 164, 166, 164, 163, 163,
+    160, 149, 119, 81, 48, 37, 40, 44, 45, 41, 40, 38, 36, 37, 38, 37,
+    37, 37, 36, 35, 37, 37, 37, 37, 39, 47, 50, 45, 40, 41, 40, 41,
+    42, 44, 48, 53, 64, 98, 140, 161, 160, 159, 169, 173, 169, 169, 168, 169,
+    170, 170, 169, 165, 161, 162, 164, 168, 167, 166, 166, 168, 169, 168, 166, 162,
+    164, 163, 165, 167, 167, 169, 170, 169, 166, 164, 164, 165, 164, 156, 125, 79,
+    52, 51, 54, 50, 47, 47, 47, 46, 45, 46, 44, 40, 36, 34, 34, 34,
+    37, 37, 37, 37, 38, 41, 42, 42, 39, 39, 37, 35, 39, 46, 52, 53,
+    68, 101, 137, 155, 155, 155, 163, 166, 167, 168, 168, 168, 171, 167, 166, 167,
+    165, 163, 164, 166, 166, 166, 165, 165, 166, 165, 163, 165, 164, 164, 167, 166,
+    165, 164, 161, 161, 162, 161, 161, 160, 159, 146, 116, 81, 54, 48, 52, 51,
+    49, 45, 47, 46, 43, 44, 43, 38, 35, 35, 34, 36, 37, 37, 37, 37,
+    39, 43, 43, 41, 40, 42, 41, 41, 40, 40, 44, 50, 68, 106, 144, 163,
+    163, 161, 164, 162, 163, 166, 167, 166, 168, 166, 167, 168, 167, 167, 167, 170,
+    168, 165, 164, 164, 165, 164, 165, 165, 164, 165, 164, 166, 166, 165, 168, 169,
+    166, 164, 165, 165, 164, 152, 121, 80, 54, 43, 45, 46, 41, 41, 40, 38,
+    38, 38, 37, 37, 37, 37, 39, 40, 37, 37, 37, 37, 37, 39, 39, 40,
+    38, 40, 41, 40, 41, 43, 46, 52, 69, 105, 144, 164, 161, 162, 166, 162,
+    162, 164, 165, 166, 165, 166, 166, 166, 166, 167, 168, 167, 166, 166, 163, 162,
+    163, 164, 165, 165, 164, 162, 165, 165, 167, 167, 163, 161, 160, 159, 160, 160,
+    160, 150, 121, 86, 54, 47, 53, 50, 48, 43, 40, 39, 37, 40, 40, 38,
+    38, 36, 37, 37, 37, 37, 37, 37, 37, 39, 38, 38, 38, 38, 37, 37,
+    39, 41, 42, 45, 62, 104, 144, 163, 169, 165, 164, 164, 165, 167, 165, 167,
+    166, 168, 170, 168, 166, 165, 165, 166, 165, 165, 165, 166, 167, 166, 167, 166,
+    163, 165, 164, 164, 165, 164, 165, 165, 162, 162, 164, 163, 164, 153, 124, 92,
+    65, 49, 47, 45, 39, 40, 40, 40, 37, 37, 37, 37, 41, 41, 38, 38,
+    37, 37, 37, 37, 38, 46, 42, 42, 40, 41, 41, 37, 39, 43, 49, 59,
+    78, 112, 151, 168, 162, 163, 160, 161, 164, 166, 168, 166, 165, 166, 168, 167,
+    166, 167, 166, 165, 166, 165, 163, 163, 164, 164, 165, 165, 166, 164, 164, 164,
+    163, 164, 164, 164, 162, 162, 162, 162, 163, 149, 116, 77, 48, 43, 47, 43,
+    41, 40, 39, 38, 38, 42, 40, 38, 37, 34, 34, 34, 36, 37, 37, 37,
+    37, 41, 41, 38, 38, 39, 40, 39, 39, 40, 40, 45, 63, 102, 139, 158,
+    164, 168, 169, 165, 166, 167, 166, 165, 163, 166, 173, 171, 169, 168, 166, 165,
+    163, 164, 163, 165, 167, 167, 167, 165, 162, 164, 165, 166, 164, 164, 164, 163,
+    165, 167, 166, 167, 169, 157, 126, 86, 54, 43, 45, 46, 42, 40, 38, 36,
+    34, 34, 36, 34, 35, 34, 35, 36, 36, 37, 37, 37, 38, 43, 40, 38,
+    38, 40, 41, 40, 41, 41, 42, 50, 74, 113, 143, 158, 161, 168, 168, 166,
+    165, 166, 166, 164, 165, 168, 170, 169, 170, 170, 167, 165, 164, 164, 165, 168,
+    166, 163, 161, 159, 159, 161, 162, 163, 164, 164, 164, 163, 162, 162, 160, 161,
+    160, 145, 111, 73, 42, 39, 50, 45, 41, 40, 38, 38, 39, 41, 38, 35,
+    35, 33, 30, 28, 36, 37, 37, 37, 37, 37, 40, 38, 40, 41, 41, 43,
+    42, 40, 42, 49, 74, 119, 156, 168, 162, 163, 166, 162, 162, 165, 167, 167,
+    166, 167, 168, 163, 162, 165, 167, 169, 166, 160, 158, 160, 162, 162, 164, 164,
+    164, 167, 168, 167, 165, 166, 167, 168, 170, 169, 166, 163, 161, 146, 113, 79,
+    59, 52, 43, 38, 38, 38, 41, 41, 39, 41, 42, 41, 40, 40, 40, 39,
+    37, 37, 37, 37, 37, 39, 38, 40, 40, 42, 40, 41, 43, 47, 50, 53,
+    74, 112, 142, 157, 161, 164, 162, 161, 161, 164, 166, 165, 168, 171, 167, 168,
+    169, 168, 167, 167, 165, 165, 166, 168, 165, 162, 163, 163, 163, 162, 163, 165,
+    166, 166, 164, 163, 162, 164, 162, 162, 161, 146, 113, 78, 52, 46, 49, 45,
+    43, 42, 43, 41, 39, 41, 40, 38, 38, 35, 37, 39, 37, 37, 37, 37,
+    37, 35, 38, 38, 41, 42, 39, 42, 43, 44, 46, 55, 80, 119, 148, 157,
+    161, 165, 166, 161, 161, 164, 166, 162, 162, 167, 168, 164, 165, 165, 163, 163,
+    163, 163, 165, 167, 166, 163, 165, 167, 168, 167, 168, 167, 164, 163, 163, 163,
+    164, 164, 161, 161, 159, 143, 108, 67, 48, 46, 41, 41, 42, 39, 39, 37,
+    36, 38, 38, 36, 37, 39, 38, 39, 37, 37, 37, 37, 36, 32, 34, 36,
+    38, 38, 38, 38, 41, 42, 44, 50, 67, 115, 158, 167, 162, 163, 169, 170,
+    165, 166, 164, 163, 164, 167, 165, 164, 166, 164, 164, 165, 166, 166, 167, 169,
+    166, 163, 164, 164, 161, 162, 162, 163, 165, 164, 162, 161, 160, 163, 163, 164,
+    161, 144, 107, 73, 56, 45, 45, 44, 41, 41, 39, 38, 37, 39, 39, 37,
+    38, 37, 39, 41, 37, 37, 37, 37, 37, 40, 39, 41, 42, 42, 39, 39,
+    43, 47, 49, 56, 76, 112, 144, 154, 166, 178, 168, 163, 164, 164, 166, 167,
+    165, 168, 170, 166, 168, 169, 167, 165, 166, 166, 167, 166, 166, 168, 166, 167,
+    167, 167, 169, 166, 165, 166, 166, 168, 166, 164, 163, 163, 159, 144, 108, 71,
+    52, 48, 51, 48, 45, 40, 40, 41, 42, 42, 41, 39, 41, 42, 39, 37,
+    37, 37, 37, 37, 37, 38, 39, 40, 40, 40, 40, 42, 45, 46, 45, 51,
+    72, 121, 158, 157, 156, 161, 163, 160, 161, 163, 166, 166, 169, 167, 167, 166,
+    167, 166, 166, 167, 164, 162, 166, 165, 165, 165, 166, 167, 166, 168, 166, 164,
+    165, 164, 163, 162, 160, 162, 162, 161, 159, 143, 106, 71, 52, 48, 46, 45,
+    45, 41, 37, 33, 33, 35, 35, 37, 38, 37, 36, 35, 37, 37, 37, 37,
+    37, 37, 37, 38, 39, 39, 39, 40, 42, 40, 42, 50, 73, 114, 149, 160,
+    156, 159, 156, 153, 155, 159, 164, 167, 167, 169, 171, 168, 167, 169, 169, 168,
+    168, 167, 165, 164, 167, 170, 170, 172, 170, 170, 166, 162, 162, 163, 163, 162,
+    162, 163, 164, 162, 157, 141, 106, 72, 60, 59, 57, 55, 48, 42, 39, 37,
+    37, 39, 37, 37, 38, 37, 35, 33, 37, 37, 37, 37, 38, 45, 43, 42,
+    39, 36, 35, 34, 38, 40, 42, 50, 76, 115, 146, 159, 167, 168, 164, 161,
+    162, 165, 166, 168, 170, 169, 168, 169, 170, 168, 168, 168, 165, 166, 167, 166,
+    167, 167, 165, 166, 165, 166, 165, 163, 163, 163, 161, 159, 160, 164, 162, 159,
+    156, 138, 106, 72, 54, 50, 48, 47, 46, 44, 40, 36, 38, 40, 42, 41,
+    40, 38, 36, 38, 37, 37, 37, 37, 37, 39, 41, 41, 41, 40, 41, 45,
+    47, 47, 46, 53, 77, 119, 154, 166, 162, 167, 168, 162, 166, 169, 170, 171,
+    169, 169, 171, 170, 170, 169, 168, 166, 166, 165, 165, 165, 163, 165, 165, 164,
+    163, 163, 164, 162, 163, 166, 165, 164, 164, 165, 162, 160, 161, 151, 114, 74,
+    57, 51, 50, 53, 47, 42, 39, 37, 41, 46, 46, 43, 40, 35, 31, 29,
+    37, 37, 37, 37, 38, 39, 37, 38, 39, 40, 41, 40, 43, 46, 48, 57,
+    89, 130, 154, 159, 160, 163, 160, 164, 167, 167, 165, 162, 166, 165, 166, 168,
+    168, 166, 166, 166, 164, 163, 163, 164, 166, 167, 166, 167, 165, 163, 165, 164,
+    163, 164, 162, 161, 164, 164, 161, 157, 156, 140, 103, 70, 54, 52, 54, 49,
+    46, 43, 40, 36, 35, 39, 41, 37, 38, 38, 38, 37, 37, 37, 37, 38,
+    38, 42, 43, 41, 41, 41, 45, 45, 44, 44, 46, 56, 86, 119, 143, 160,
+    165, 178, 173, 166, 166, 166, 167, 165, 164, 164, 166, 168, 167, 165, 165, 166,
+    167, 167, 168, 168, 166, 166, 164, 164, 164, 166, 166, 162, 163, 165, 165, 164,
+    162, 165, 166, 161, 156, 135, 91, 58, 49, 49, 47, 45, 44, 44, 43, 41,
+    40, 40, 37, 35, 35, 36, 35, 34, 37, 37, 38, 38, 38, 42, 38, 37,
+    38, 37, 37, 40, 45, 45, 44, 54, 84, 123, 150, 160, 161, 160, 157, 159,
+    160, 164, 165, 164, 165, 164, 161, 162, 163, 164, 165, 167, 165, 164, 165, 165,
+    164, 162, 164, 168, 167, 165, 165, 163, 162, 164, 163, 164, 163, 164, 162, 161,
+    159, 138, 95, 55, 33, 34, 37, 37, 34, 33, 33, 31, 34, 36, 36, 34,
+    35, 36, 37, 38, 37, 37, 38, 38, 38, 40, 40, 42, 43, 43, 41, 41,
+    40, 43, 43, 50, 77, 116, 146, 172, 175, 169, 165, 162, 165, 168, 168, 167,
+    168, 168, 168, 171, 168, 167, 168, 168, 167, 164, 165, 163, 164, 164, 162, 162,
+    163, 163, 162, 160, 161, 165, 167, 168, 165, 164, 162, 158, 156, 134, 91, 57,
+    43, 46, 41, 33, 36, 36, 38, 39, 39, 38, 33, 33, 34, 34, 34, 35,
+    37, 38, 38, 38, 39, 44, 43, 44, 45, 44, 40, 40, 42, 40, 46, 60,
+    93, 129, 153, 168, 169, 162, 163, 160, 159, 162, 167, 166, 167, 168, 166, 166,
+    165, 164, 166, 166, 165, 163, 162, 162, 162, 162, 163, 165, 162, 160, 161, 158,
+    159, 162, 162, 161, 157, 158, 161, 161, 155, 135, 95, 58, 42, 39, 44, 44,
+    39, 37, 41, 42, 41, 41, 37, 33, 33, 32, 33, 33, 37, 38, 38, 38,
+    38, 39, 41, 44, 44, 47, 46, 44, 41, 39, 40, 52, 85, 127, 154, 168,
+    174, 169, 164, 162, 165, 166, 165, 164, 165, 167, 165, 164, 165, 167, 169, 170,
+    167, 165, 164, 163, 163, 164, 161, 158, 161, 166, 169, 166, 164, 163, 162, 158,
+    157, 159, 159, 160, 158, 142, 106, 65, 40, 42, 41, 39, 41, 41, 43, 46,
+    45, 43, 40, 38, 39, 40, 40, 39, 37, 38, 38, 38, 38, 34, 37, 39,
+    42, 42, 41, 42, 41, 42, 44, 58, 88, 124, 147, 158, 161, 160, 159, 161,
+    161, 161, 160, 162, 165, 166, 164, 165, 166, 166, 167, 169, 167, 164, 162, 161,
+    160, 161, 162, 162, 159, 158, 159, 159, 160, 161, 160, 161, 158, 157, 158, 159,
+    156, 135, 90, 52, 37, 36, 39, 41, 39, 39, 40, 38, 35, 33, 34, 35,
+    34, 36, 36, 35, 37, 38, 38, 38, 38, 40, 39, 40, 39, 40, 44, 46,
+    49, 53, 53, 53, 73, 108, 142, 160, 160, 157, 156, 157, 160, 162, 161, 163,
+    167, 172, 168, 165, 165, 163, 159, 159, 158, 159, 163, 164, 164, 164, 161, 161,
+    162, 164, 165, 162, 160, 160, 162, 162, 162, 164, 163, 162, 160, 141, 103, 64,
+    36, 38, 45, 42, 44, 41, 41, 41, 37, 38, 42, 45, 46, 43, 39, 33,
+    37, 38, 38, 38, 38, 42, 42, 38, 36, 35, 34, 36, 40, 39, 39, 49,
+    82, 133, 161, 165, 169, 167, 163, 162, 161, 162, 161, 162, 165, 164, 163, 164,
+    164, 162, 161, 161, 160, 162, 162, 162, 163, 162, 164, 166, 164, 166, 165, 163,
+    164, 164, 165, 165, 163, 163, 163, 163, 158, 134, 90, 54, 40, 40, 41, 40,
+    38, 36, 36, 36, 39, 42, 43, 41, 38, 38, 36, 36, 37, 38, 38, 38,
+    38, 41, 40, 37, 36, 38, 42, 42, 41, 44, 41, 48, 73, 116, 153, 168,
+    169, 164, 160, 161, 163, 165, 169, 171, 168, 171, 167, 163, 165, 168, 169, 171,
+    169, 167, 165, 163, 164, 164, 164, 165, 162, 166, 165, 163, 163, 162, 164, 164,
+    161, 163, 164, 163, 160, 140, 104, 66, 40, 39, 37, 39, 42, 43, 43, 40,
+    38, 37, 36, 36, 34, 34, 35, 35, 37, 38, 38, 38, 38, 41, 41, 38,
+    37, 36, 35, 37, 42, 44, 46, 58, 91, 136, 158, 157, 162, 167, 163, 164,
+    164, 163, 163, 163, 165, 167, 168, 171, 170, 168, 167, 169, 167, 168, 166, 162,
+    163, 162, 162, 165, 166, 170, 166, 162, 162, 160, 161, 161, 162, 163, 164, 165,
+    159, 133, 91, 58, 48, 52, 48, 44, 43, 43, 41, 36, 38, 42, 43, 39,
+    37, 34, 31, 32, 37, 38, 38, 38, 38, 41, 40, 37, 41, 42, 41, 43,
+    41, 39, 45, 60, 92, 133, 154, 154, 157, 157, 159, 164, 163, 163, 162, 162,
+    160, 163, 167, 164, 165, 166, 167, 166, 168, 166, 166, 165, 164, 164, 164, 164,
+    162, 166, 166, 166, 165, 165, 165, 163, 162, 165, 164, 161, 153, 129, 92, 59,
+    49, 56, 53, 55, 51, 50, 48, 43, 39, 36, 35, 35, 34, 33, 34, 37,
+    37, 38, 38, 38, 38, 38, 39, 38, 40, 41, 40, 42, 45, 45, 47, 64,
+    100, 138, 152, 154, 163, 161, 164, 160, 159, 160, 160, 162, 164, 167, 166, 163,
+    163, 160, 159, 162, 160, 160, 159, 158, 159, 160, 162, 162, 161, 164, 161, 162,
+    162, 161, 162, 161, 160, 161, 162, 162, 159, 138, 102, 70, 53, 53, 55, 52,
+    54, 52, 47, 41, 38, 39, 40, 36, 37, 37, 35, 36, 37, 38, 38, 38,
+    38, 40, 39, 40, 41, 39, 33, 33, 36, 40, 51, 64, 84, 125, 154, 169,
+    175, 164, 158, 155, 158, 159, 161, 161, 161, 162, 162, 158, 159, 162, 163, 163,
+    163, 164, 165, 164, 163, 163, 163, 163, 161, 162, 162, 160, 162, 165, 165, 161,
+    162, 161, 158, 158, 154, 137, 101, 71, 55, 47, 47, 48, 51, 52, 45, 38,
+    34, 30, 34, 34, 32, 34, 34, 37, 37, 37, 38, 38, 38, 41, 42, 41,
+    39, 41, 39, 37, 37, 37, 44, 66, 105, 138, 151, 149, 150, 154, 155, 154,
+    156, 155, 155, 157, 158, 160, 160, 158, 162, 162, 161, 162, 160, 159, 159, 160,
+    160, 161, 160, 162, 160, 157, 161, 160, 158, 156, 158, 159, 159, 162, 163, 159,
+    149, 123, 83, 54, 41, 45, 48, 45, 46, 44, 43, 40, 36, 39, 36, 37,
+    38, 40, 41, 40, 37, 37, 38, 38, 38, 40, 40, 43, 43, 41, 40, 42,
+    42, 40, 44, 61, 90, 121, 134, 135, 139, 143, 145, 148, 152, 152, 151, 150,
+    150, 154, 153, 150, 150, 149, 150, 150, 152, 153, 155, 156, 157, 158, 157, 156,
+    155, 158, 161, 162, 162, 163, 161, 161, 159, 159, 158, 159, 159, 141, 98, 58,
+    40, 42, 46, 46, 47, 48, 45, 43, 42, 40, 39, 36, 34, 35, 36, 38,
+    37, 37, 37, 38, 38, 37, 41, 41, 42, 43, 40, 41, 40, 40, 42, 51,
+    68, 78, 81, 81, 81, 85, 85, 87, 88, 89, 93, 96, 97, 100, 98, 101,
+    105, 109, 110, 113, 116, 116, 117, 118, 119, 120, 121, 126, 130, 130, 133, 136,
+    138, 139, 141, 142, 143, 146, 150, 148, 141, 117, 81, 52, 40, 42, 47, 48,
+    48, 45, 42, 38, 34, 37, 34, 36, 37, 39, 39, 38, 37, 37, 37, 38,
+    38, 38, 37, 39, 41, 39, 42, 42, 40, 41, 43, 53, 69, 71, 66, 65,
+    61, 57, 57, 58, 60, 62, 65, 64, 68, 76, 71, 67, 68, 69, 75, 82,
+    87, 85, 85, 86, 87, 92, 94, 94, 96, 90, 91, 95, 101, 109, 109, 114,
+    115, 119, 123, 121, 117, 104, 77, 50, 37, 32, 30, 24, 27, 35, 39, 39,
+    36, 38, 36, 37, 36, 34, 33, 32, 37, 37, 37, 37, 38, 37, 41, 40,
+    41, 43, 41, 39, 38, 40, 43, 49, 53, 52, 50, 50, 51, 51, 52, 54,
+    49, 46, 50, 48, 47, 51, 51, 50, 48, 50, 50, 50, 50, 50, 51, 51,
+    52, 52, 56, 57, 58, 59, 57, 56, 56, 55, 52, 53, 56, 59, 60, 61,
+    62, 59, 54, 54, 51, 47, 50, 47, 45, 44, 43, 40, 37, 37, 37, 39,
+    43, 45, 43, 39, 36, 37, 37, 37, 39, 46, 41, 38, 40, 40, 39, 40,
+    40, 38, 43, 49, 54, 54, 52, 52, 49, 47, 47, 50, 48, 49, 52, 49,
+    50, 51, 48, 48, 49, 49, 49, 51, 50, 46, 46, 50, 49, 52, 52, 47,
+    48, 51, 52, 48, 50, 52, 47, 45, 46, 45, 48, 49, 50, 48, 44, 45,
+    48, 50, 47, 43, 44, 44, 44, 43, 43, 43, 41, 41, 41, 38, 36, 36,
+    36, 37, 37, 37, 37, 41, 41, 39, 38, 38, 36, 36, 37, 39, 44, 48,
+    50, 50, 50, 52, 52, 52, 52, 53, 50, 46, 46, 46, 42, 43, 46, 45,
+    44, 46, 46, 45, 43, 45, 46, 50, 51, 50, 51, 50, 49, 51, 51, 50,
+    51, 50, 49, 47, 49, 49, 50, 52, 50, 48, 45, 46, 47, 47, 48, 47,
+    45, 44, 45, 42, 38, 37, 35, 31, 29, 31, 33, 35, 36, 36, 37, 37,
+    37, 39, 39, 40, 41, 42, 39, 37, 37, 36, 40, 44, 48, 47, 45, 46,
+    49, 49, 49, 50, 47, 48, 49, 48, 45, 47, 47, 49, 51, 53, 51, 49,
+    48, 46, 44, 44, 43, 44, 46, 48, 49, 51, 51, 50, 49, 49, 48, 50,
+    54, 56, 49, 44, 43, 44, 44, 45, 45, 44, 45, 42, 40, 41, 42, 41,
+    38, 36, 37, 41, 46, 43, 40, 37, 36, 36, 37, 37, 37, 40, 41, 40,
+    39, 39, 36, 35, 37, 38, 41, 43, 45, 46, 46, 46, 47, 45, 41, 45,
+    46, 47, 48, 47, 45, 44, 45, 47, 46, 46, 46, 45, 46, 45, 43, 44,
+    44, 46, 51, 51, 47, 49, 46, 44, 43, 39, 39, 42, 46, 46, 46, 44,
+    43, 42, 42, 44, 44, 46, 46, 47, 45, 40, 37, 33, 35, 40, 45, 42,
+    42, 42, 38, 36, 36, 36, 36, 37, 38, 42, 42, 40, 39, 38, 38, 39,
+    40, 39, 38, 40, 40, 38, 37, 38, 40, 40, 38, 39, 39, 40, 39, 36,
+    34, 37, 40, 40, 41, 40, 38, 35, 36, 40, 39, 38, 36, 36, 37, 39,
+    40, 40, 40, 41, 42, 42, 42, 42, 40, 41, 41, 42, 45, 45, 42, 42,
+    40, 42, 46, 46, 44, 43, 41, 39, 37, 40, 41, 37, 35, 32, 30, 31,
+    36, 36, 36, 36, 37, 40, 40, 40, 39, 39, 38, 39, 41, 42, 40, 42,
+    42, 41, 38, 38, 42, 39, 37, 39, 37, 34, 35, 36, 39, 39, 41, 41,
+    39, 39, 36, 35, 35, 37, 41, 45, 48, 47, 48, 45, 42, 44, 41, 41,
+    42, 43, 42, 41, 40, 39, 37, 37, 37, 38, 38, 40, 41, 42, 40, 41,
+    40, 39, 40, 38, 37, 39, 41, 40, 37, 35, 32, 33, 36, 36, 36, 36,
+    36, 38, 39, 38, 37, 38, 37, 37, 40, 39, 43, 48, 48, 44, 39, 38,
+    40, 41, 41, 41, 42, 42, 39, 36, 35, 35, 34, 35, 36, 38, 38, 37,
+    39, 38, 36, 36, 37, 39, 40, 40, 38, 38, 37, 35, 36, 33, 34, 37,
+    36, 39, 39, 38, 37, 33, 30, 32, 33, 33, 35, 36, 36, 36, 37, 35,
+    37, 39, 40, 36, 35, 37, 36, 35, 36, 36, 36, 36, 35, 31, 34, 35,
+    37, 38, 37, 36, 39, 42, 41, 41, 40, 38, 36, 37, 38, 39, 40, 40,
+    37, 34, 34, 35, 37, 37, 39, 39, 38, 40, 39, 41, 43, 43, 43, 40,
+    39, 41, 41, 39, 35, 33, 34, 33, 36, 38, 40, 40, 39, 40, 37, 39,
+    37, 34, 33, 34, 35, 35, 35, 35, 33, 35, 34, 33, 34, 36, 37, 36,
+    35, 35, 34, 35, 36, 36, 36, 36, 36, 38, 39, 40, 40, 42, 41, 40,
+    43, 42, 39, 38, 35, 35, 34, 35, 37, 37, 37, 37, 38, 37, 35, 34,
+    36, 39, 40, 39, 40, 41, 40, 36, 37, 38, 34, 35, 36, 37, 39, 40,
+    37, 37, 37, 34, 34, 35, 35, 37, 37, 38, 39, 42, 44, 42, 40, 41,
+    40, 38, 35, 34, 34, 36, 36, 37, 39, 38, 40, 40, 38, 36, 33, 31,
+    36, 36, 36, 36, 36, 36, 36, 39, 41, 42, 41, 40, 38, 38, 37, 37,
+    41, 40, 39, 39, 37, 39, 38, 39, 37, 35, 35, 35, 36, 39, 38, 38,
+    38, 38, 39, 39, 39, 38, 38, 39, 40, 41, 41, 41, 38, 38, 37, 37,
+    36, 38, 40, 39, 37, 35, 37, 35, 33, 34, 35, 38, 36, 36, 38, 34,
+    33, 35, 36, 35, 37, 39, 38, 38, 38, 37, 34, 31, 36, 36, 36, 36,
+    36, 37, 41, 41, 39, 40, 39, 40, 41, 42, 40, 35, 35, 36, 34, 36,
+    38, 38, 39, 39, 39, 39, 38, 37, 38, 38, 36, 34, 35, 40, 44, 43,
+    46, 47, 40, 35, 36, 36, 37, 37, 35, 36, 37, 35, 36, 38, 38, 39,
+    39, 39, 40, 40, 38, 33, 32, 35, 36, 35, 32, 31, 32, 34, 34, 35,
+    38, 39, 38, 37, 35, 36, 36, 33, 36, 36, 36, 36, 36, 35, 31, 33,
+    36, 36, 37, 37, 37, 38, 38, 39, 41, 39, 36, 36, 36, 35, 37, 34,
+    34, 32, 32, 34, 35, 39, 38, 38, 39, 38, 38, 38, 38, 36, 33, 34,
+    33, 34, 34, 37, 40, 40, 40, 37, 35, 37, 38, 37, 35, 35, 36, 37,
+    38, 41, 43, 42, 37, 36, 40, 39, 41, 43, 41, 36, 32, 33, 36, 37,
+    40, 39, 36, 33, 36, 36, 36, 36, 37, 42, 42, 39, 35, 35, 35, 37,
+    37, 38, 39, 38, 40, 40, 39, 44, 44, 39, 40, 40, 42, 44, 42, 38,
+    38, 36, 35, 35, 35, 38, 38, 35, 33, 36, 35, 35, 37, 38, 39, 38,
+    38, 38, 37, 36, 33, 33, 33, 34, 37, 38, 39, 40, 36, 31, 33, 36,
+    34, 37, 35, 34, 36, 37, 38, 38, 37, 37, 35, 33, 35, 39, 36, 34,
+    36, 36, 36, 36, 36, 36, 35, 36, 36, 37, 35, 37, 38, 38, 40, 41,
+    42, 40, 41, 44, 42, 42, 40, 38, 39, 37, 36, 35, 35, 34, 33, 34,
+    35, 36, 36, 38, 37, 37, 36, 34, 36, 39, 40, 39, 38, 39, 37, 37,
+    36, 39, 40, 39, 39, 35, 37, 37, 36, 40, 41, 40, 37, 35, 36, 36,
+    37, 35, 35, 34, 32, 36, 34, 32, 31, 30, 31, 33, 36, 36, 36, 36,
+    37, 37, 37, 36, 35, 38, 39, 41, 40, 35, 36, 35, 35, 34, 34, 38,
+    38, 39, 40, 36, 35, 36, 35, 36, 36, 38, 36, 39, 41, 42, 41, 41,
+    40, 41, 41, 39, 38, 36, 37, 37, 35, 37, 40, 39, 37, 37, 37, 38,
+    39, 43, 44, 41, 39, 39, 42, 40, 36, 38, 34, 33, 36, 37, 41, 41,
+    41, 41, 41, 40, 40, 44, 41, 38, 36, 36, 36, 37, 37, 38, 39, 39,
+    38, 38, 37, 40, 40, 37, 38, 38, 37, 36, 36, 36, 35, 39, 39, 38,
+    41, 38, 37, 38, 39, 41, 40, 40, 41, 41, 41, 40, 37, 39, 40, 40,
+    39, 39, 36, 35, 35, 35, 35, 35, 34, 36, 35, 37, 40, 40, 40, 38,
+    36, 36, 35, 37, 36, 37, 38, 38, 38, 37, 37, 34, 31, 33, 32, 33,
+    33, 33, 35, 36,
+};
@@ -0,0 +1,255 @@
+#include <msp430.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libwispbase/crc.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines X_SIZE, Y_SIZE, DITHER_CRC32 and image[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Gray level above which a pixel turns white (tiffdither -t)
+#ifndef THRESHOLD
+#define THRESHOLD 128
+#endif
+
+// Rows dithered per task execution
+#ifndef ROWS_PER_TASK
+#define ROWS_PER_TASK 1
+#endif
+
+#define ROW_BYTES ((X_SIZE + 7) / 8)
+
+// As tiffdither, the last row of the image only takes the error of the one
+// before, and is not written
+#define OUT_ROWS (Y_SIZE - 1)
+
+/** @brief Progress of the dithering between task executions
+ *  @details Error diffusion carries a dependency from each row to the next:
+ *           the next row is the pixels of the image plus the error pushed
+ *           down from the row above. That row commits with the position, so
+ *           that the whole state commits as one self-channel field.
+ */
+typedef struct {
+    uint16_t row;           // next row to write
+    int16_t next[X_SIZE];   // that row, with the error diffused into it
+    uint32_t crc;           // register, before the final XOR
+    uint16_t white;         // pixels set so far
+    uint32_t cycles;        // cycles of the executions that committed
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_dither)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct dither_args {
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct dither_state {
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_dither_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_dither, dither_args);
+SELF_CHANNEL(task_dither, dither_state);
+CHANNEL(task_dither, task_done, dither_args);
+
+/* The bilevel image, a set bit for white (PHOTOMETRIC_MINISBLACK). A row
+ * depends only on the committed state and the image, so restarting it
+ * writes the same bytes. */
+__nv static uint8_t out[OUT_ROWS][ROW_BYTES];
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/** @brief Dither one row, and diffuse its error into the next (fsdither)
+ *  @details Floyd-Steinberg: 7/16 of the error of a pixel goes right, 3/16
+ *           down-left, 5/16 down and 1/16 down-right, each rounded toward
+ *           zero. Nothing goes down from the row before the last, as in
+ *           tiffdither.
+ *  @param thisline The row, pixels plus the error from above; gets the
+ *                  error from the left
+ *  @param nextline The pixels of the row below; gets the error from this
+ *                  row
+ *  @return White pixels in the row
+ */
+static uint16_t fsdither_row(int16_t *thisline, int16_t *nextline,
+                             uint8_t *outline, int lastline) {
+    uint8_t bit = 0x80;
+    uint16_t white = 0;
+    unsigned j;
+    int16_t v;
+
+    memset(outline, 0, ROW_BYTES);
+    for (j = 0; j < X_SIZE; ++j) {
+        v = thisline[j];
+        if (v < 0)
+            v = 0;
+        else if (v > 255)
+            v = 255;
+        if (v > THRESHOLD) {
+            *outline |= bit;
+            v -= 255;
+            ++white;
+        }
+        bit >>= 1;
+        if (bit == 0) {
+            outline++;
+            bit = 0x80;
+        }
+        if (j != X_SIZE - 1)
+            thisline[j + 1] += v * 7 / 16;
+        if (!lastline) {
+            if (j != 0)
+                nextline[j - 1] += v * 3 / 16;
+            nextline[j] += v * 5 / 16;
+            if (j != X_SIZE - 1)
+                nextline[j + 1] += v / 16;
+        }
+    }
+    return white;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+    ++boots;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %ux%u pixels\r\n", X_SIZE, Y_SIZE);
+
+    progress_t prog = { .crc = crc_init(&crc32_model) };
+    unsigned j;
+
+    // Get first line
+    for (j = 0; j < X_SIZE; ++j)
+        prog.next[j] = image[j];
+
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_dither));
+    TRANSITION_TO(task_dither);
+}
+
+/* Dithers ROWS_PER_TASK rows, and passes the error of the last one on */
+void task_dither() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    progress_t prog;
+    int16_t thisline[X_SIZE];
+    unsigned end, i, j;
+
+    prog = *CHAN_IN2(progress_t, prog, CH(task_init, task_dither),
+                     SELF_IN_CH(task_dither));
+
+    end = prog.row + ROWS_PER_TASK;
+    if (end > OUT_ROWS)
+        end = OUT_ROWS;
+
+    for (; prog.row < end; ++prog.row) {
+        i = prog.row + 1;
+        memcpy(thisline, prog.next, sizeof(thisline));
+        for (j = 0; j < X_SIZE; ++j)
+            prog.next[j] = image[i * X_SIZE + j];
+
+        prog.white += fsdither_row(thisline, prog.next, out[prog.row],
+                                   i == Y_SIZE - 1);
+        prog.crc = crc_update(&crc32_model, prog.crc, out[prog.row],
+                              ROW_BYTES);
+    }
+    prog.cycles += msp_cycles() - start;
+
+    if (prog.row < OUT_ROWS) {
+        CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_dither));
+        TRANSITION_TO(task_dither);
+    }
+    CHAN_OUT1(progress_t, prog, prog, CH(task_dither, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the CRC of the bilevel image, and the throughput over the cycles of
+ * the task executions that committed, which excludes the work lost to power
+ * failures */
+void task_done() {
+    task_prologue();
+
+    progress_t prog = *CHAN_IN1(progress_t, prog, CH(task_dither, task_done));
+
+    prog.crc = crc_final(&crc32_model, prog.crc);
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("%04x%04x %u rows of %u bytes, %u white pixels\r\n",
+           (unsigned)(prog.crc >> 16), (unsigned)prog.crc, OUT_ROWS,
+           ROW_BYTES, prog.white);
+    PRINTF("dither: %u rows per task, Cycles %n, cycles/row %n, "
+           "pixels/s %n\r\n", ROWS_PER_TASK, (unsigned long)prog.cycles,
+           (unsigned long)(prog.cycles / OUT_ROWS),
+           (unsigned long)((uint64_t)OUT_ROWS * X_SIZE * CPU_FREQ /
+                           prog.cycles));
+    PRINTF("%u boots\r\n", boots);
+    PRINTF("%s\r\n", prog.crc == DITHER_CRC32 ? "CRC ok" : "CRC MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
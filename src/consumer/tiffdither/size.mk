@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): rows of the image,
+# at most 95 (all of input_small.pgm)
+SIZE_small = 24
+SIZE_medium = 48
+SIZE_large = 95
+SIZE_INPUT = ./gen_input.sh ../../../mibench-src/automotive/susan/input_small.pgm ../../../mibench-src/consumer/tiffdither $(SIZE_N)
@@ -0,0 +1,40 @@
+#! /bin/bash
+#
+# Generate input.h from MiBench's dijkstra adjacency matrix
+#
+# Weights are stored as bytes: NONE (9999, no edge) becomes ADJ_NONE, and
+# any other weight must fit below it.
+#
+# Usage: ./gen_input.sh [nodes] [input.dat] > input.h
+
+NODES=${1:-100}
+INPUT=${2:-../../../mibench-src/network/dijkstra/input.dat}
+
+awk -v nodes=$NODES '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench dijkstra input.dat */"
+        print ""
+        print "#define NUM_NODES " nodes
+        print "#define ADJ_NONE 255"
+        print ""
+        print "__ro_nv static const uint8_t adj[NUM_NODES][NUM_NODES] = {"
+    }
+    {
+        for (f = 1; f <= NF && n < nodes * nodes; ++f) {
+            w = $f
+            if (w == 9999)
+                w = "ADJ_NONE"
+            else if (w < 0 || w >= 255) {
+                print "gen_input.sh: weight " w " does not fit" > "/dev/stderr"
+                exit 1
+            }
+            if (n % nodes == 0)
+                line = "    {"
+            line = line " " w ","
+            if (n % nodes == nodes - 1)
+                print line " },"
+            ++n
+        }
+    }
+    END { print "};" }
+' $INPUT
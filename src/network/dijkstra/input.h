@@ -0,0 +1,107 @@
+/* Generated by gen_input.sh from MiBench dijkstra input.dat */
+
+#define NUM_NODES 100
+#define ADJ_NONE 255
+
+__ro_nv static const uint8_t adj[NUM_NODES][NUM_NODES] = {
+    { 0, 84, 40, 78, 80, 91, 20, 34, 77, 28, 55, 48, 63, 37, 51, 95, 91, 63, 72, 15, 61, 2, 25, 14, 80, 16, 40, 13, 11, 99, 22, 51, 84, 61, 30, 64, 52, 49, 97, 29, 77, 53, 77, 40, 89, 29, 35, 80, 91, 7, 94, 53, 9, 20, 66, 89, 35, 7, 2, 46, 7, 24, 97, 90, 85, 27, 54, 38, 76, 51, 67, 53, 4, 44, 93, 93, 72, 29, 74, 64, 36, 69, 17, 44, 88, 83, 33, 23, 89, 35, 68, 95, 59, 66, 86, 44, 92, 40, 81, 68, },
+    { 91, 0, 48, 22, 95, 92, 15, 88, 64, 43, 62, 28, 78, 31, 45, 23, 19, 28, 56, 42, 17, 90, 11, 13, 50, 76, 98, 93, 68, 38, 75, 37, 30, 23, 58, 25, 16, 73, 13, 79, 17, 74, 8, 95, 6, 52, 18, 24, 79, 73, 65, 96, 64, 76, 10, 14, 52, 8, 7, 21, 46, 82, 57, 75, 6, 16, 99, 21, 89, 13, 99, 6, 87, 8, 1, 92, 59, 18, 17, 39, 91, 82, 36, 55, 58, 45, 69, 10, 53, 75, 31, 99, 58, 87, 75, 63, 4, 75, 83, 92, },
+    { 87, 83, 0, 97, 74, 90, 98, 67, 50, 17, 83, 89, 8, 65, 25, 63, 23, 70, 32, 33, 23, 8, 63, 23, 65, 51, 97, 28, 55, 72, 12, 47, 59, 94, 45, 34, 84, 44, 1, 35, 60, 83, 24, 67, 48, 48, 31, 71, 19, 62, 5, 41, 69, 67, 64, 35, 19, 61, 63, 73, 33, 74, 21, 92, 68, 65, 26, 53, 9, 26, 87, 68, 10, 12, 36, 58, 59, 66, 29, 77, 29, 33, 19, 98, 1, 82, 33, 19, 44, 95, 91, 76, 70, 12, 68, 38, 77, 94, 91, 86, },
+    { 21, 79, 55, 0, 30, 90, 91, 87, 50, 58, 17, 28, 86, 49, 46, 85, 50, 29, 18, 68, 73, 14, 60, 49, 83, 72, 18, 22, 50, 13, 14, 36, 33, 93, 90, 62, 83, 81, 50, 34, 40, 66, 61, 26, 15, 8, 11, 65, 36, 29, 33, 10, 43, 93, 58, 27, 66, 76, 49, 16, 88, 62, 52, 21, 56, 43, 83, 40, 25, 33, 73, 64, 98, 34, 89, 14, 41, 1, 78, 77, 30, 12, 86, 72, 5, 45, 98, 71, 21, 47, 86, 10, 10, 38, 30, 66, 81, 14, 6, 6, },
+    { 46, 78, 69, 44, 0, 12, 59, 58, 53, 59, 36, 31, 88, 48, 17, 61, 53, 62, 60, 24, 83, 7, 10, 92, 17, 48, 23, 82, 29, 36, 87, 35, 81, 66, 4, 26, 78, 62, 83, 31, 22, 20, 61, 11, 67, 78, 72, 20, 40, 32, 43, 23, 39, 53, 16, 55, 2, 38, 38, 31, 74, 26, 65, 55, 92, 68, 81, 70, 31, 64, 1, 53, 84, 62, 64, 52, 40, 36, 72, 80, 68, 16, 4, 7, 68, 19, 62, 70, 57, 1, 1, 31, 26, 65, 85, 18, 34, 67, 88, 65, },
+    { 32, 88, 19, 16, 50, 0, 83, 67, 90, 19, 40, 70, 87, 55, 74, 93, 24, 92, 55, 93, 49, 55, 93, 80, 81, 59, 66, 99, 93, 33, 87, 59, 64, 76, 77, 79, 27, 60, 47, 17, 79, 86, 87, 66, 41, 61, 60, 64, 54, 15, 58, 4, 70, 52, 83, 51, 12, 49, 51, 5, 81, 39, 64, 45, 15, 41, 25, 41, 2, 72, 57, 81, 58, 45, 48, 99, 6, 8, 64, 60, 23, 22, 63, 92, 74, 46, 44, 85, 95, 94, 90, 76, 34, 54, 22, 48, 95, 47, 88, 96, },
+    { 19, 46, 78, 76, 90, 26, 0, 76, 96, 33, 40, 56, 55, 62, 19, 48, 36, 65, 91, 21, 61, 86, 11, 37, 20, 65, 59, 67, 60, 6, 56, 56, 25, 2, 35, 1, 92, 60, 77, 88, 93, 18, 45, 49, 79, 64, 96, 16, 29, 88, 37, 90, 75, 48, 28, 94, 13, 86, 62, 72, 92, 19, 28, 17, 21, 62, 18, 13, 23, 94, 2, 16, 12, 46, 65, 91, 10, 61, 7, 39, 50, 44, 30, 25, 91, 57, 19, 4, 43, 81, 75, 36, 99, 4, 52, 20, 66, 70, 33, 89, },
+    { 65, 34, 5, 76, 80, 70, 68, 0, 90, 31, 75, 30, 81, 19, 59, 6, 11, 16, 25, 14, 59, 6, 89, 94, 6, 92, 47, 26, 59, 17, 58, 48, 81, 92, 53, 58, 73, 23, 27, 63, 54, 2, 93, 35, 21, 52, 40, 31, 68, 64, 44, 27, 70, 33, 22, 76, 26, 68, 2, 84, 85, 60, 32, 67, 53, 84, 25, 26, 8, 51, 89, 61, 53, 82, 95, 73, 35, 36, 5, 3, 1, 49, 29, 71, 82, 51, 47, 8, 19, 48, 92, 5, 9, 25, 71, 61, 10, 96, 86, 17, },
+    { 48, 75, 77, 1, 58, 73, 74, 92, 0, 10, 78, 94, 11, 28, 24, 81, 10, 74, 28, 18, 93, 76, 10, 98, 84, 34, 69, 46, 44, 65, 33, 60, 13, 9, 38, 14, 66, 12, 88, 58, 21, 67, 53, 31, 94, 77, 13, 4, 51, 40, 21, 45, 16, 31, 43, 1, 65, 13, 46, 9, 78, 78, 68, 91, 86, 7, 5, 53, 18, 92, 11, 39, 60, 64, 70, 54, 41, 82, 58, 92, 22, 79, 38, 38, 10, 80, 39, 74, 93, 85, 83, 71, 63, 52, 62, 50, 58, 67, 3, 75, },
+    { 60, 14, 15, 20, 77, 84, 73, 19, 67, 0, 31, 11, 88, 11, 48, 27, 20, 29, 66, 94, 22, 51, 78, 93, 15, 30, 56, 64, 87, 24, 67, 63, 83, 81, 77, 3, 59, 62, 76, 77, 29, 8, 88, 18, 18, 36, 44, 38, 65, 10, 33, 87, 61, 11, 80, 75, 40, 37, 40, 27, 60, 7, 90, 43, 88, 67, 46, 47, 29, 23, 25, 58, 30, 13, 75, 48, 49, 20, 86, 14, 30, 19, 1, 90, 29, 81, 65, 69, 18, 5, 96, 77, 12, 86, 21, 99, 54, 67, 47, 83, },
+    { 89, 71, 41, 20, 83, 16, 67, 33, 35, 53, 0, 46, 64, 71, 46, 54, 1, 27, 19, 69, 44, 24, 65, 22, 35, 51, 43, 35, 5, 10, 81, 88, 98, 52, 29, 18, 36, 44, 85, 68, 78, 39, 14, 43, 11, 60, 96, 11, 87, 16, 80, 32, 40, 46, 53, 74, 97, 95, 9, 3, 6, 89, 90, 4, 42, 19, 22, 78, 62, 8, 46, 41, 46, 60, 83, 56, 21, 80, 67, 8, 96, 48, 39, 36, 93, 91, 11, 90, 87, 19, 92, 92, 9, 82, 96, 51, 1, 19, 29, 63, },
+    { 26, 75, 4, 72, 35, 87, 29, 55, 67, 95, 62, 0, 64, 43, 1, 99, 37, 92, 10, 27, 80, 29, 19, 73, 38, 1, 70, 89, 2, 88, 18, 64, 15, 92, 67, 87, 28, 55, 16, 83, 23, 12, 45, 86, 55, 46, 85, 91, 39, 95, 18, 19, 25, 36, 91, 63, 37, 61, 52, 38, 50, 69, 2, 65, 62, 69, 52, 89, 24, 67, 72, 46, 79, 18, 33, 34, 64, 19, 25, 3, 14, 42, 22, 39, 78, 13, 2, 15, 74, 53, 52, 25, 23, 54, 89, 84, 24, 42, 74, 48, },
+    { 10, 46, 94, 88, 64, 27, 22, 28, 45, 46, 30, 59, 0, 87, 51, 97, 65, 64, 98, 80, 39, 52, 32, 64, 74, 86, 53, 58, 10, 95, 33, 58, 5, 78, 52, 92, 43, 78, 14, 70, 24, 60, 1, 82, 47, 52, 79, 13, 17, 77, 92, 56, 29, 25, 20, 4, 12, 73, 61, 21, 68, 94, 79, 72, 72, 31, 64, 16, 9, 78, 86, 32, 38, 86, 15, 85, 39, 93, 98, 56, 71, 90, 12, 1, 16, 31, 4, 27, 4, 65, 48, 71, 59, 27, 44, 32, 57, 8, 47, 66, },
+    { 86, 33, 98, 25, 20, 13, 11, 58, 6, 9, 15, 77, 98, 0, 26, 77, 15, 56, 80, 41, 60, 45, 89, 31, 4, 16, 74, 35, 73, 82, 81, 39, 69, 15, 38, 93, 34, 51, 4, 92, 57, 13, 7, 34, 12, 33, 11, 26, 88, 90, 67, 49, 36, 56, 80, 39, 71, 55, 74, 45, 38, 56, 84, 7, 70, 22, 1, 5, 73, 5, 96, 30, 17, 4, 63, 28, 36, 74, 54, 25, 65, 21, 73, 1, 76, 54, 39, 48, 9, 14, 92, 46, 69, 77, 53, 40, 98, 53, 44, 72, },
+    { 58, 41, 2, 75, 45, 65, 4, 80, 39, 57, 6, 4, 77, 79, 0, 4, 54, 33, 43, 3, 41, 56, 94, 87, 26, 72, 40, 65, 70, 93, 9, 43, 51, 50, 44, 26, 94, 9, 29, 75, 47, 86, 80, 51, 63, 60, 54, 18, 92, 97, 20, 34, 54, 15, 22, 79, 86, 61, 44, 57, 55, 53, 99, 6, 3, 43, 32, 97, 52, 61, 72, 99, 47, 53, 50, 11, 13, 5, 29, 5, 3, 48, 39, 56, 62, 60, 35, 49, 22, 79, 6, 76, 33, 5, 82, 36, 48, 15, 33, 99, },
+    { 75, 6, 99, 23, 58, 49, 34, 70, 54, 62, 75, 56, 11, 15, 12, 0, 72, 74, 47, 21, 96, 27, 27, 72, 59, 32, 55, 94, 79, 69, 28, 79, 45, 33, 78, 67, 90, 28, 2, 61, 82, 64, 36, 38, 74, 51, 50, 47, 25, 97, 68, 22, 24, 94, 94, 82, 26, 49, 77, 6, 18, 5, 84, 62, 38, 63, 30, 29, 91, 32, 89, 73, 95, 26, 11, 70, 76, 61, 17, 2, 58, 84, 23, 81, 79, 17, 64, 5, 65, 41, 10, 83, 46, 94, 46, 84, 57, 76, 13, 48, },
+    { 8, 2, 22, 4, 27, 32, 73, 3, 93, 90, 5, 51, 74, 27, 33, 53, 0, 44, 96, 58, 10, 38, 68, 92, 84, 62, 39, 68, 20, 15, 80, 68, 23, 82, 89, 27, 9, 22, 1, 12, 15, 90, 16, 66, 65, 43, 98, 18, 86, 95, 76, 95, 34, 44, 88, 18, 6, 27, 86, 26, 42, 67, 93, 65, 49, 83, 91, 58, 5, 92, 70, 19, 82, 86, 84, 47, 29, 83, 65, 15, 78, 41, 11, 12, 84, 98, 30, 90, 26, 16, 17, 67, 82, 11, 32, 32, 93, 24, 89, 97, },
+    { 16, 60, 17, 97, 46, 2, 45, 74, 84, 10, 89, 63, 51, 99, 75, 36, 98, 0, 5, 27, 24, 21, 43, 90, 4, 53, 23, 35, 46, 46, 25, 44, 61, 84, 60, 59, 30, 61, 4, 4, 46, 14, 93, 10, 64, 92, 84, 99, 91, 88, 26, 15, 9, 69, 5, 12, 22, 27, 47, 68, 73, 71, 12, 34, 55, 71, 92, 84, 33, 96, 88, 79, 10, 81, 88, 73, 74, 73, 73, 65, 61, 99, 79, 70, 68, 84, 82, 89, 12, 29, 57, 84, 1, 69, 19, 55, 40, 12, 40, 73, },
+    { 8, 29, 53, 17, 10, 42, 90, 84, 15, 64, 50, 76, 63, 29, 46, 31, 14, 29, 0, 20, 26, 58, 77, 10, 58, 46, 29, 14, 86, 40, 53, 60, 47, 82, 13, 64, 91, 55, 55, 76, 69, 19, 26, 45, 81, 55, 91, 12, 69, 20, 32, 94, 77, 10, 5, 35, 55, 33, 49, 42, 73, 2, 2, 21, 83, 15, 85, 75, 69, 40, 52, 39, 59, 77, 83, 41, 33, 74, 53, 2, 94, 84, 95, 71, 94, 1, 7, 50, 34, 55, 91, 7, 57, 93, 27, 41, 8, 12, 16, 77, },
+    { 52, 68, 16, 11, 46, 98, 51, 78, 73, 5, 80, 67, 88, 75, 39, 83, 76, 45, 33, 0, 10, 99, 24, 16, 57, 17, 43, 97, 25, 54, 14, 2, 7, 81, 18, 17, 27, 17, 68, 6, 89, 72, 85, 57, 61, 61, 95, 45, 37, 40, 77, 46, 40, 1, 62, 96, 18, 5, 93, 43, 59, 7, 45, 65, 88, 62, 82, 15, 78, 51, 20, 68, 24, 5, 25, 85, 66, 20, 30, 3, 59, 7, 49, 99, 8, 11, 95, 26, 16, 89, 68, 75, 96, 13, 40, 84, 74, 23, 98, 53, },
+    { 73, 19, 21, 96, 24, 45, 81, 89, 64, 11, 92, 24, 18, 41, 24, 25, 52, 20, 50, 68, 0, 9, 18, 43, 5, 31, 82, 88, 6, 6, 87, 58, 78, 7, 78, 75, 31, 24, 56, 20, 88, 67, 12, 13, 84, 53, 36, 10, 5, 55, 59, 72, 64, 77, 16, 68, 9, 98, 57, 14, 4, 45, 72, 81, 52, 50, 57, 82, 74, 13, 2, 62, 80, 14, 75, 65, 67, 11, 74, 71, 66, 34, 44, 30, 12, 59, 98, 20, 57, 56, 33, 61, 1, 5, 42, 52, 55, 98, 34, 30, },
+    { 12, 36, 92, 92, 50, 67, 57, 17, 78, 32, 88, 44, 65, 33, 74, 77, 92, 72, 96, 50, 29, 0, 30, 11, 29, 35, 53, 81, 90, 51, 16, 21, 63, 51, 13, 56, 2, 80, 13, 18, 58, 45, 7, 3, 11, 39, 77, 87, 31, 50, 84, 80, 78, 14, 90, 7, 49, 43, 88, 40, 94, 4, 60, 58, 55, 72, 14, 56, 53, 27, 74, 11, 71, 80, 14, 81, 19, 91, 69, 49, 41, 53, 30, 19, 67, 21, 26, 16, 63, 14, 56, 58, 18, 16, 16, 72, 88, 30, 28, 41, },
+    { 57, 2, 52, 28, 81, 65, 10, 1, 57, 78, 50, 97, 32, 79, 17, 98, 99, 42, 15, 63, 56, 70, 0, 21, 73, 86, 37, 46, 74, 67, 73, 16, 24, 75, 67, 52, 56, 33, 61, 57, 89, 40, 7, 86, 72, 85, 4, 70, 85, 46, 85, 48, 3, 56, 69, 76, 43, 7, 22, 17, 73, 95, 32, 96, 70, 99, 49, 27, 32, 11, 83, 21, 50, 89, 8, 23, 75, 12, 92, 60, 57, 78, 9, 59, 35, 78, 35, 77, 84, 56, 94, 58, 51, 26, 54, 22, 25, 4, 48, 57, },
+    { 14, 31, 78, 64, 21, 86, 86, 95, 97, 78, 56, 54, 57, 65, 14, 91, 43, 48, 69, 28, 5, 63, 85, 0, 56, 89, 40, 77, 14, 43, 25, 71, 56, 56, 49, 20, 76, 35, 6, 72, 32, 84, 29, 86, 42, 94, 99, 34, 38, 48, 3, 65, 52, 65, 50, 8, 54, 90, 85, 68, 33, 11, 40, 89, 66, 88, 10, 43, 24, 16, 15, 56, 1, 44, 42, 42, 38, 42, 75, 75, 89, 78, 41, 42, 43, 90, 50, 97, 81, 35, 66, 14, 45, 6, 4, 12, 93, 13, 54, 18, },
+    { 28, 69, 73, 28, 13, 16, 70, 50, 58, 46, 26, 48, 24, 66, 89, 67, 57, 40, 64, 38, 75, 31, 52, 20, 0, 36, 55, 32, 30, 67, 85, 47, 95, 54, 21, 24, 66, 37, 93, 17, 94, 39, 43, 42, 63, 9, 32, 30, 66, 71, 94, 4, 46, 25, 55, 66, 61, 11, 97, 90, 77, 83, 38, 73, 37, 59, 97, 4, 95, 90, 21, 89, 30, 63, 32, 92, 72, 64, 23, 38, 35, 17, 42, 81, 42, 97, 48, 3, 8, 46, 92, 85, 29, 31, 58, 65, 89, 55, 69, 84, },
+    { 46, 89, 74, 76, 53, 7, 68, 26, 70, 90, 64, 6, 8, 6, 87, 49, 3, 35, 51, 11, 80, 44, 95, 9, 74, 0, 54, 74, 64, 10, 43, 48, 55, 33, 23, 31, 86, 29, 99, 12, 99, 90, 75, 6, 97, 80, 92, 47, 83, 28, 97, 93, 8, 42, 89, 17, 17, 43, 91, 80, 52, 35, 28, 8, 67, 51, 39, 53, 80, 38, 64, 79, 29, 40, 84, 27, 21, 77, 73, 4, 5, 71, 97, 13, 13, 86, 29, 30, 30, 20, 10, 82, 54, 38, 89, 22, 88, 28, 75, 69, },
+    { 66, 40, 48, 95, 79, 33, 22, 99, 11, 94, 4, 15, 66, 1, 27, 79, 87, 56, 9, 17, 76, 19, 98, 31, 56, 88, 0, 52, 45, 17, 28, 14, 83, 67, 62, 78, 46, 94, 99, 45, 5, 94, 48, 20, 60, 49, 47, 40, 36, 3, 48, 53, 79, 66, 52, 10, 23, 40, 62, 67, 57, 89, 80, 40, 57, 42, 18, 3, 37, 17, 48, 42, 12, 96, 61, 72, 45, 8, 12, 81, 11, 60, 35, 89, 26, 86, 99, 49, 27, 62, 16, 83, 52, 96, 23, 9, 38, 41, 12, 75, },
+    { 58, 59, 17, 69, 56, 77, 41, 1, 85, 52, 82, 96, 12, 17, 86, 38, 3, 85, 86, 30, 48, 3, 13, 99, 98, 36, 9, 0, 37, 76, 21, 12, 35, 80, 28, 4, 36, 6, 44, 37, 90, 96, 19, 86, 9, 35, 72, 47, 38, 58, 33, 68, 7, 36, 81, 7, 34, 17, 15, 70, 93, 36, 81, 28, 16, 10, 32, 51, 15, 76, 87, 6, 72, 6, 92, 81, 41, 65, 28, 79, 24, 61, 47, 30, 96, 29, 36, 31, 46, 51, 2, 40, 86, 82, 67, 2, 92, 99, 53, 7, },
+    { 75, 40, 13, 48, 46, 5, 29, 87, 70, 57, 67, 93, 19, 15, 24, 16, 43, 59, 46, 88, 11, 47, 28, 97, 30, 95, 99, 22, 0, 94, 52, 29, 69, 92, 42, 18, 39, 47, 46, 26, 17, 4, 92, 10, 22, 7, 33, 38, 50, 92, 83, 38, 4, 31, 65, 1, 61, 60, 1, 83, 55, 53, 13, 25, 45, 54, 42, 83, 1, 88, 10, 17, 91, 3, 27, 14, 9, 60, 51, 58, 53, 35, 96, 56, 66, 61, 57, 27, 22, 57, 11, 77, 11, 23, 2, 55, 76, 43, 39, 77, },
+    { 32, 48, 94, 23, 50, 21, 37, 59, 81, 88, 18, 34, 24, 14, 89, 89, 75, 47, 17, 97, 5, 27, 74, 15, 50, 76, 69, 26, 20, 0, 9, 4, 51, 56, 97, 74, 7, 18, 11, 65, 98, 99, 83, 32, 23, 96, 22, 13, 72, 69, 29, 69, 73, 56, 44, 87, 6, 20, 57, 32, 39, 66, 35, 90, 22, 32, 64, 29, 50, 74, 94, 49, 73, 77, 81, 96, 74, 3, 9, 46, 72, 38, 16, 45, 94, 60, 33, 1, 79, 90, 32, 19, 56, 67, 9, 78, 99, 72, 7, 49, },
+    { 47, 1, 98, 21, 78, 79, 17, 52, 82, 26, 98, 54, 63, 14, 98, 58, 74, 32, 58, 54, 22, 90, 72, 77, 57, 81, 55, 56, 54, 61, 0, 6, 2, 62, 4, 22, 40, 83, 39, 92, 65, 65, 91, 19, 29, 6, 18, 86, 79, 49, 44, 33, 70, 34, 5, 47, 91, 86, 3, 48, 41, 64, 54, 42, 26, 58, 64, 66, 41, 4, 59, 6, 68, 50, 24, 97, 55, 42, 83, 34, 90, 28, 66, 60, 62, 71, 8, 53, 58, 11, 2, 98, 74, 55, 41, 99, 13, 6, 66, 53, },
+    { 9, 25, 59, 77, 75, 83, 74, 30, 25, 58, 64, 15, 85, 31, 75, 48, 3, 83, 2, 60, 93, 3, 59, 67, 58, 1, 67, 70, 6, 34, 24, 0, 15, 59, 83, 91, 34, 66, 66, 64, 90, 25, 29, 6, 11, 59, 80, 58, 61, 63, 59, 22, 56, 62, 80, 24, 20, 80, 90, 90, 86, 24, 14, 1, 82, 96, 92, 17, 63, 58, 80, 53, 83, 9, 58, 93, 68, 39, 51, 29, 2, 11, 50, 58, 72, 31, 81, 91, 12, 72, 81, 97, 96, 95, 97, 78, 92, 90, 95, 55, },
+    { 49, 75, 9, 32, 84, 66, 25, 52, 6, 75, 81, 8, 86, 32, 65, 58, 63, 47, 49, 74, 19, 30, 72, 16, 26, 70, 94, 18, 60, 89, 72, 9, 0, 64, 80, 40, 49, 47, 65, 2, 52, 41, 82, 59, 27, 14, 25, 84, 76, 71, 33, 51, 90, 63, 23, 6, 88, 92, 99, 7, 52, 89, 78, 61, 54, 59, 2, 3, 6, 66, 4, 58, 7, 86, 17, 33, 99, 42, 17, 76, 14, 50, 28, 4, 14, 50, 10, 3, 43, 10, 9, 94, 98, 86, 56, 52, 45, 57, 55, 51, },
+    { 23, 58, 9, 29, 45, 26, 62, 45, 67, 78, 21, 80, 29, 49, 84, 42, 98, 94, 45, 41, 4, 53, 36, 3, 40, 91, 55, 85, 48, 10, 36, 71, 68, 0, 45, 1, 13, 70, 62, 58, 38, 41, 78, 19, 69, 27, 4, 12, 26, 97, 56, 67, 2, 10, 3, 4, 49, 94, 59, 34, 43, 69, 70, 15, 38, 15, 15, 51, 85, 76, 9, 24, 17, 87, 42, 86, 14, 46, 97, 40, 43, 54, 7, 44, 63, 10, 48, 13, 5, 8, 46, 47, 76, 17, 61, 14, 32, 76, 64, 18, },
+    { 52, 73, 41, 69, 60, 83, 55, 74, 29, 52, 14, 72, 6, 21, 16, 69, 31, 64, 81, 35, 71, 28, 82, 48, 44, 44, 62, 76, 20, 27, 93, 71, 99, 34, 0, 41, 59, 18, 95, 33, 46, 47, 46, 19, 53, 67, 34, 22, 97, 98, 4, 32, 70, 31, 15, 19, 75, 58, 80, 51, 78, 7, 44, 50, 7, 78, 90, 65, 96, 85, 97, 43, 32, 44, 61, 85, 12, 95, 8, 9, 93, 11, 41, 64, 42, 55, 82, 17, 14, 63, 67, 91, 69, 12, 41, 76, 90, 31, 41, 87, },
+    { 17, 39, 30, 49, 83, 91, 34, 94, 86, 41, 4, 80, 52, 44, 44, 93, 99, 27, 10, 14, 89, 77, 5, 59, 89, 46, 35, 80, 77, 76, 67, 93, 15, 97, 42, 0, 98, 88, 75, 92, 75, 17, 96, 55, 69, 41, 98, 62, 40, 26, 72, 54, 15, 50, 58, 73, 40, 5, 9, 20, 81, 84, 87, 74, 98, 85, 16, 97, 74, 91, 89, 49, 9, 86, 4, 77, 27, 3, 40, 67, 28, 13, 21, 42, 62, 79, 16, 2, 83, 24, 22, 65, 8, 10, 39, 7, 95, 55, 4, 69, },
+    { 47, 93, 19, 55, 80, 22, 33, 7, 25, 73, 73, 53, 85, 94, 95, 47, 73, 11, 49, 57, 35, 71, 22, 43, 81, 60, 50, 76, 16, 54, 46, 63, 48, 64, 19, 28, 0, 86, 51, 34, 12, 24, 8, 64, 10, 2, 59, 56, 75, 70, 6, 32, 6, 77, 53, 48, 58, 14, 97, 35, 30, 52, 80, 92, 99, 45, 11, 27, 32, 62, 61, 44, 86, 68, 9, 95, 70, 67, 52, 46, 38, 57, 77, 43, 34, 31, 91, 91, 45, 89, 27, 75, 41, 8, 67, 40, 52, 78, 66, 84, },
+    { 40, 28, 29, 26, 95, 37, 22, 66, 5, 73, 12, 42, 30, 89, 85, 64, 21, 76, 56, 66, 65, 82, 41, 6, 89, 9, 45, 42, 86, 12, 27, 27, 39, 55, 53, 35, 92, 0, 74, 2, 96, 47, 14, 38, 77, 3, 24, 42, 24, 99, 97, 89, 65, 80, 31, 71, 70, 39, 17, 12, 26, 28, 39, 53, 67, 94, 6, 3, 86, 80, 4, 82, 28, 17, 21, 6, 20, 44, 47, 44, 44, 45, 34, 9, 25, 64, 80, 94, 4, 96, 7, 29, 25, 46, 81, 91, 40, 87, 93, 26, },
+    { 67, 97, 8, 94, 15, 29, 99, 34, 72, 47, 78, 17, 91, 12, 26, 17, 75, 6, 11, 79, 2, 18, 8, 26, 63, 89, 18, 3, 76, 12, 28, 44, 9, 36, 39, 23, 64, 39, 0, 57, 37, 85, 36, 53, 77, 47, 78, 93, 23, 83, 4, 2, 85, 22, 10, 11, 84, 99, 28, 87, 76, 40, 16, 20, 48, 52, 58, 71, 16, 96, 29, 53, 82, 64, 6, 59, 12, 84, 52, 34, 68, 56, 36, 53, 77, 46, 64, 62, 45, 92, 50, 21, 32, 65, 40, 80, 17, 98, 52, 33, },
+    { 95, 80, 85, 77, 45, 91, 36, 57, 75, 88, 91, 43, 44, 27, 96, 22, 73, 60, 84, 18, 52, 34, 39, 84, 98, 79, 64, 16, 77, 16, 48, 72, 96, 34, 50, 42, 25, 85, 98, 0, 99, 73, 89, 43, 18, 17, 39, 39, 89, 99, 24, 8, 52, 57, 46, 36, 56, 25, 1, 71, 3, 17, 20, 74, 14, 53, 25, 55, 77, 10, 54, 77, 83, 44, 20, 2, 60, 59, 41, 50, 58, 64, 57, 10, 21, 4, 45, 77, 29, 46, 49, 31, 62, 68, 6, 75, 22, 30, 31, 99, },
+    { 40, 85, 76, 23, 29, 96, 25, 89, 55, 65, 39, 14, 29, 96, 23, 50, 1, 68, 27, 29, 14, 75, 59, 76, 44, 64, 52, 65, 94, 82, 65, 34, 67, 42, 57, 96, 38, 81, 85, 93, 0, 46, 25, 7, 74, 22, 30, 24, 22, 97, 50, 50, 12, 25, 10, 87, 69, 74, 39, 34, 68, 22, 98, 2, 89, 41, 58, 85, 79, 39, 71, 72, 84, 95, 79, 59, 18, 10, 82, 39, 8, 33, 89, 19, 58, 99, 7, 27, 73, 46, 61, 42, 68, 60, 43, 57, 1, 2, 43, 79, },
+    { 41, 14, 52, 26, 10, 31, 84, 27, 40, 67, 66, 48, 99, 56, 66, 58, 55, 73, 84, 29, 20, 46, 70, 87, 6, 14, 45, 6, 15, 87, 84, 55, 1, 37, 81, 11, 67, 65, 37, 8, 32, 0, 3, 55, 32, 59, 22, 89, 14, 95, 74, 43, 16, 20, 13, 3, 25, 27, 48, 31, 42, 36, 16, 97, 37, 52, 78, 47, 20, 43, 83, 28, 75, 86, 83, 7, 45, 5, 96, 59, 1, 70, 2, 16, 90, 15, 19, 16, 41, 66, 47, 82, 2, 62, 80, 38, 15, 58, 84, 34, },
+    { 2, 68, 61, 76, 54, 44, 83, 99, 49, 79, 58, 49, 50, 59, 65, 41, 74, 83, 56, 15, 49, 3, 97, 51, 65, 78, 89, 79, 36, 74, 13, 37, 43, 74, 13, 97, 18, 95, 96, 67, 75, 54, 0, 17, 25, 14, 81, 65, 87, 64, 22, 3, 14, 25, 1, 65, 89, 78, 54, 68, 15, 29, 80, 51, 71, 55, 64, 68, 73, 60, 64, 40, 35, 19, 56, 60, 33, 37, 26, 21, 1, 48, 24, 15, 72, 25, 79, 61, 4, 34, 29, 18, 62, 10, 69, 33, 64, 33, 2, 37, },
+    { 93, 66, 77, 29, 84, 33, 89, 18, 70, 16, 38, 71, 63, 62, 85, 36, 86, 64, 96, 89, 97, 26, 8, 60, 36, 76, 92, 1, 10, 93, 38, 3, 59, 15, 32, 44, 48, 21, 62, 18, 36, 1, 88, 0, 99, 62, 74, 35, 49, 39, 32, 38, 36, 57, 46, 95, 92, 23, 88, 93, 32, 82, 31, 35, 42, 45, 66, 86, 93, 87, 48, 11, 24, 48, 99, 23, 11, 73, 57, 59, 12, 88, 97, 48, 46, 43, 44, 39, 65, 33, 32, 97, 16, 62, 32, 57, 8, 98, 43, 1, },
+    { 86, 91, 12, 10, 40, 12, 32, 50, 85, 89, 9, 97, 78, 6, 45, 24, 49, 89, 63, 15, 23, 94, 12, 38, 57, 44, 94, 64, 43, 38, 65, 29, 30, 77, 38, 69, 88, 70, 19, 73, 59, 28, 70, 38, 0, 34, 16, 62, 82, 6, 25, 96, 28, 19, 9, 65, 76, 52, 60, 41, 94, 98, 6, 23, 28, 83, 61, 96, 71, 31, 16, 45, 90, 43, 16, 28, 76, 32, 89, 59, 37, 14, 56, 65, 33, 64, 31, 10, 17, 91, 50, 11, 89, 55, 34, 17, 39, 94, 14, 10, },
+    { 25, 29, 55, 15, 72, 70, 43, 49, 3, 32, 9, 40, 46, 64, 5, 79, 29, 36, 88, 45, 27, 38, 55, 16, 93, 89, 33, 32, 83, 46, 41, 9, 75, 96, 24, 47, 66, 66, 96, 68, 98, 5, 9, 44, 68, 0, 13, 23, 96, 49, 11, 42, 75, 49, 97, 90, 42, 86, 24, 73, 70, 69, 15, 79, 44, 11, 4, 91, 77, 69, 88, 46, 68, 92, 54, 13, 61, 67, 36, 58, 16, 47, 1, 90, 95, 97, 81, 37, 83, 6, 11, 53, 74, 25, 32, 19, 36, 36, 11, 14, },
+    { 5, 99, 59, 73, 91, 14, 85, 53, 81, 21, 12, 96, 67, 12, 87, 63, 9, 69, 99, 92, 74, 10, 46, 49, 35, 78, 68, 70, 14, 78, 83, 19, 77, 43, 91, 69, 57, 77, 23, 38, 98, 35, 35, 66, 47, 22, 0, 29, 56, 91, 28, 48, 66, 38, 93, 15, 72, 71, 82, 43, 85, 61, 27, 4, 39, 70, 94, 9, 28, 72, 32, 65, 70, 67, 99, 36, 14, 22, 65, 70, 14, 93, 18, 79, 31, 12, 94, 4, 83, 77, 47, 68, 38, 74, 71, 77, 45, 66, 86, 72, },
+    { 38, 19, 37, 9, 85, 37, 45, 99, 59, 10, 69, 72, 3, 87, 52, 34, 99, 46, 38, 82, 23, 84, 51, 61, 59, 23, 39, 4, 89, 26, 75, 27, 44, 13, 35, 29, 50, 80, 29, 10, 89, 97, 81, 91, 85, 34, 26, 0, 84, 79, 63, 67, 3, 48, 19, 64, 7, 41, 3, 10, 31, 28, 85, 57, 71, 98, 92, 1, 48, 72, 30, 57, 62, 28, 39, 53, 13, 73, 78, 97, 53, 42, 64, 55, 89, 83, 19, 95, 25, 22, 6, 55, 49, 91, 13, 21, 89, 5, 22, 38, },
+    { 77, 51, 95, 39, 78, 35, 92, 91, 8, 71, 88, 60, 13, 53, 16, 3, 36, 34, 97, 61, 56, 4, 16, 6, 94, 28, 26, 84, 33, 48, 22, 11, 98, 18, 50, 77, 52, 43, 68, 59, 14, 57, 20, 27, 10, 35, 29, 46, 0, 69, 27, 7, 25, 31, 23, 30, 25, 50, 56, 10, 83, 4, 32, 94, 3, 49, 44, 79, 2, 86, 48, 60, 1, 5, 80, 28, 15, 15, 57, 60, 84, 83, 67, 9, 15, 89, 39, 40, 40, 94, 49, 24, 97, 80, 18, 1, 30, 62, 80, 31, },
+    { 48, 28, 91, 49, 33, 71, 77, 48, 86, 34, 8, 70, 18, 75, 79, 32, 64, 18, 71, 5, 12, 21, 28, 10, 2, 45, 11, 31, 7, 90, 62, 55, 19, 53, 5, 52, 25, 81, 99, 12, 16, 8, 81, 34, 82, 61, 65, 47, 78, 0, 37, 51, 90, 57, 78, 1, 58, 24, 11, 89, 31, 1, 52, 85, 20, 6, 90, 71, 30, 71, 70, 42, 87, 77, 23, 21, 59, 83, 85, 6, 62, 23, 56, 52, 80, 35, 52, 39, 58, 63, 28, 88, 63, 79, 74, 82, 84, 64, 53, 15, },
+    { 36, 24, 56, 23, 1, 79, 43, 59, 63, 29, 65, 26, 52, 22, 77, 32, 56, 30, 70, 15, 92, 97, 4, 56, 77, 77, 39, 62, 42, 92, 77, 77, 16, 34, 1, 16, 13, 43, 75, 76, 72, 40, 2, 24, 61, 79, 56, 18, 10, 26, 0, 32, 3, 24, 36, 59, 2, 13, 97, 63, 54, 90, 41, 32, 6, 74, 32, 22, 87, 75, 97, 63, 48, 38, 65, 71, 99, 44, 27, 17, 54, 53, 49, 56, 76, 85, 15, 77, 97, 13, 41, 52, 3, 81, 84, 9, 56, 16, 31, 43, },
+    { 91, 28, 7, 39, 66, 71, 11, 65, 16, 38, 82, 69, 90, 32, 26, 66, 17, 40, 44, 15, 52, 84, 67, 54, 66, 51, 63, 22, 67, 93, 65, 58, 21, 71, 96, 86, 43, 8, 52, 59, 45, 34, 29, 35, 66, 54, 2, 82, 94, 46, 97, 0, 47, 30, 64, 2, 96, 15, 64, 18, 81, 57, 83, 39, 78, 54, 36, 65, 97, 43, 17, 57, 88, 51, 86, 24, 17, 40, 25, 99, 35, 70, 96, 81, 1, 60, 82, 96, 74, 46, 15, 56, 4, 97, 95, 81, 52, 31, 46, 50, },
+    { 74, 62, 7, 62, 14, 92, 85, 30, 33, 11, 30, 68, 81, 26, 50, 82, 86, 32, 79, 61, 78, 93, 17, 81, 91, 12, 63, 44, 43, 9, 94, 17, 71, 2, 79, 84, 94, 65, 15, 28, 75, 44, 95, 57, 70, 45, 39, 56, 77, 18, 18, 55, 0, 12, 34, 37, 3, 46, 99, 47, 88, 8, 41, 6, 78, 43, 85, 63, 37, 50, 77, 64, 26, 21, 59, 82, 91, 5, 21, 48, 81, 38, 65, 37, 50, 99, 73, 52, 45, 73, 99, 34, 80, 41, 40, 59, 83, 25, 23, 20, },
+    { 74, 99, 84, 1, 21, 44, 82, 12, 48, 4, 59, 30, 42, 25, 66, 91, 24, 40, 44, 68, 13, 43, 3, 93, 84, 42, 53, 67, 66, 75, 87, 41, 74, 71, 41, 95, 15, 24, 7, 63, 27, 66, 92, 69, 91, 58, 60, 15, 97, 5, 83, 10, 48, 0, 85, 4, 32, 27, 56, 99, 92, 31, 86, 34, 6, 58, 74, 1, 73, 98, 8, 36, 26, 74, 29, 94, 65, 87, 55, 79, 84, 59, 62, 94, 8, 48, 97, 39, 74, 53, 38, 67, 83, 25, 1, 88, 83, 75, 89, 57, },
+    { 73, 96, 93, 98, 70, 22, 93, 35, 9, 48, 15, 93, 8, 77, 87, 15, 25, 85, 53, 99, 38, 91, 66, 22, 17, 67, 11, 1, 42, 1, 57, 16, 96, 50, 14, 66, 71, 7, 2, 80, 55, 17, 73, 62, 93, 61, 76, 18, 46, 30, 18, 84, 22, 84, 0, 7, 39, 51, 18, 39, 93, 18, 95, 10, 14, 46, 23, 80, 18, 30, 82, 97, 85, 98, 71, 48, 91, 32, 25, 10, 78, 54, 27, 62, 76, 12, 69, 15, 62, 86, 54, 56, 4, 49, 65, 18, 94, 88, 98, 12, },
+    { 19, 81, 10, 4, 79, 80, 51, 71, 13, 75, 81, 90, 30, 9, 53, 7, 20, 22, 22, 81, 9, 75, 38, 13, 25, 3, 30, 20, 90, 29, 32, 10, 10, 41, 13, 88, 22, 64, 60, 34, 40, 41, 24, 70, 49, 76, 77, 68, 98, 98, 50, 7, 73, 87, 19, 0, 98, 90, 49, 18, 81, 77, 49, 90, 86, 89, 4, 75, 11, 68, 35, 45, 9, 76, 68, 79, 25, 45, 56, 93, 44, 54, 44, 50, 28, 32, 69, 26, 22, 18, 44, 4, 94, 92, 93, 81, 82, 97, 57, 93, },
+    { 65, 91, 38, 74, 68, 7, 53, 92, 52, 9, 86, 95, 63, 30, 45, 91, 61, 14, 17, 83, 31, 61, 86, 26, 53, 79, 8, 36, 77, 64, 30, 43, 56, 67, 17, 24, 74, 69, 17, 26, 78, 3, 21, 41, 32, 66, 32, 93, 79, 49, 76, 11, 10, 62, 37, 63, 0, 42, 44, 99, 19, 8, 29, 61, 63, 95, 78, 87, 70, 47, 4, 95, 26, 6, 16, 66, 38, 81, 98, 31, 61, 47, 8, 71, 57, 69, 9, 21, 12, 52, 20, 30, 60, 49, 91, 24, 45, 69, 11, 15, },
+    { 17, 14, 10, 42, 20, 26, 9, 58, 7, 7, 89, 68, 54, 96, 40, 12, 66, 48, 32, 77, 99, 52, 7, 59, 1, 98, 83, 45, 67, 93, 60, 83, 8, 69, 26, 27, 95, 34, 84, 2, 41, 73, 70, 94, 70, 10, 6, 36, 57, 38, 13, 57, 89, 20, 16, 90, 18, 0, 99, 36, 84, 92, 95, 68, 99, 65, 94, 27, 60, 28, 12, 62, 68, 85, 32, 63, 55, 41, 68, 90, 98, 7, 4, 55, 95, 23, 71, 86, 40, 70, 23, 25, 62, 19, 93, 62, 83, 87, 88, 44, },
+    { 16, 1, 7, 84, 85, 39, 47, 40, 80, 16, 31, 78, 22, 35, 34, 18, 57, 5, 4, 97, 74, 26, 23, 37, 44, 16, 98, 28, 4, 87, 72, 20, 87, 79, 4, 73, 18, 50, 14, 98, 66, 45, 77, 87, 79, 11, 5, 36, 15, 9, 34, 89, 34, 56, 26, 78, 72, 25, 0, 7, 76, 13, 79, 95, 1, 58, 99, 73, 76, 50, 87, 75, 16, 32, 52, 3, 11, 62, 8, 47, 77, 16, 80, 66, 50, 37, 92, 28, 10, 18, 35, 85, 30, 15, 81, 30, 73, 81, 4, 49, },
+    { 31, 91, 25, 46, 23, 76, 49, 34, 39, 56, 80, 17, 72, 61, 83, 22, 98, 75, 50, 8, 93, 84, 93, 23, 99, 75, 53, 72, 56, 57, 22, 87, 48, 46, 34, 71, 23, 82, 5, 62, 39, 84, 78, 12, 46, 61, 33, 45, 37, 82, 52, 31, 67, 46, 53, 66, 22, 7, 38, 0, 77, 64, 59, 65, 12, 6, 98, 82, 28, 81, 86, 89, 21, 71, 68, 32, 18, 30, 64, 62, 66, 47, 15, 96, 14, 61, 50, 79, 82, 57, 18, 60, 21, 77, 25, 33, 82, 23, 15, 10, },
+    { 5, 2, 99, 25, 73, 67, 56, 91, 96, 20, 53, 63, 66, 68, 60, 80, 29, 11, 60, 11, 67, 77, 71, 88, 55, 95, 21, 37, 19, 36, 47, 23, 38, 46, 48, 11, 14, 4, 2, 10, 24, 55, 73, 90, 24, 34, 70, 52, 44, 31, 63, 12, 9, 34, 99, 63, 30, 21, 99, 49, 0, 56, 47, 71, 93, 92, 20, 5, 6, 23, 7, 16, 47, 61, 89, 37, 84, 23, 8, 37, 66, 39, 99, 78, 47, 34, 77, 10, 63, 97, 10, 13, 53, 56, 83, 47, 49, 4, 51, 55, },
+    { 26, 57, 71, 72, 19, 60, 10, 4, 82, 18, 40, 49, 56, 40, 27, 4, 74, 5, 13, 38, 2, 23, 50, 55, 78, 34, 3, 27, 37, 53, 81, 63, 11, 52, 36, 30, 13, 45, 33, 94, 63, 73, 44, 20, 14, 70, 23, 87, 74, 36, 26, 76, 58, 75, 32, 37, 9, 34, 63, 46, 86, 0, 45, 9, 97, 97, 44, 27, 11, 89, 60, 6, 52, 33, 49, 71, 47, 20, 94, 35, 94, 30, 60, 70, 88, 35, 2, 25, 44, 36, 88, 89, 22, 34, 97, 20, 31, 41, 46, 42, },
+    { 30, 6, 47, 82, 39, 95, 54, 85, 16, 48, 20, 10, 78, 79, 80, 66, 15, 82, 90, 58, 18, 79, 48, 40, 13, 45, 59, 44, 86, 5, 85, 17, 11, 32, 98, 49, 28, 52, 35, 43, 1, 55, 52, 79, 34, 33, 45, 49, 15, 36, 8, 32, 15, 55, 71, 28, 99, 31, 71, 86, 35, 57, 0, 3, 46, 89, 2, 95, 17, 54, 30, 59, 54, 85, 12, 33, 20, 44, 78, 68, 58, 15, 75, 90, 30, 30, 61, 57, 30, 91, 29, 16, 27, 85, 19, 73, 74, 20, 68, 91, },
+    { 74, 98, 50, 28, 83, 62, 61, 3, 6, 40, 71, 64, 54, 46, 54, 83, 76, 16, 40, 6, 8, 69, 22, 35, 54, 41, 9, 29, 60, 76, 20, 34, 75, 70, 62, 59, 32, 24, 62, 38, 63, 33, 2, 18, 78, 56, 1, 55, 72, 41, 60, 80, 10, 82, 15, 64, 23, 23, 92, 83, 99, 12, 18, 0, 75, 82, 80, 34, 14, 5, 95, 52, 67, 29, 54, 85, 8, 10, 85, 62, 82, 26, 23, 62, 36, 5, 76, 99, 28, 99, 91, 12, 99, 4, 30, 74, 85, 10, 9, 99, },
+    { 14, 5, 51, 81, 33, 5, 67, 40, 15, 52, 3, 96, 78, 25, 59, 14, 30, 36, 14, 58, 35, 5, 69, 35, 9, 98, 10, 94, 9, 18, 93, 23, 22, 45, 5, 55, 50, 71, 94, 65, 24, 96, 62, 3, 22, 21, 16, 51, 56, 29, 9, 91, 34, 78, 26, 43, 77, 35, 37, 86, 53, 31, 9, 74, 0, 75, 14, 30, 26, 85, 24, 90, 9, 21, 52, 11, 43, 73, 27, 93, 29, 56, 3, 21, 90, 81, 47, 33, 59, 81, 70, 45, 35, 1, 54, 10, 76, 67, 39, 2, },
+    { 53, 62, 92, 61, 83, 44, 72, 26, 18, 99, 20, 46, 56, 23, 66, 46, 5, 13, 79, 63, 94, 49, 8, 29, 49, 61, 38, 25, 29, 77, 27, 81, 39, 19, 43, 23, 63, 16, 49, 80, 15, 69, 27, 70, 92, 93, 17, 96, 7, 95, 59, 1, 44, 67, 30, 93, 29, 68, 19, 58, 45, 46, 40, 84, 65, 0, 82, 8, 28, 98, 56, 9, 14, 26, 36, 84, 18, 29, 1, 14, 35, 96, 73, 36, 41, 40, 66, 34, 69, 35, 53, 27, 80, 98, 66, 65, 64, 49, 72, 91, },
+    { 47, 29, 1, 61, 54, 36, 45, 72, 65, 45, 85, 1, 42, 58, 36, 82, 98, 3, 17, 68, 38, 70, 94, 18, 69, 61, 82, 33, 10, 55, 24, 57, 84, 25, 18, 38, 61, 62, 10, 26, 8, 95, 26, 49, 54, 62, 32, 53, 65, 48, 21, 3, 19, 16, 20, 87, 76, 3, 20, 86, 58, 44, 43, 42, 68, 61, 0, 80, 30, 23, 90, 55, 31, 85, 81, 80, 40, 44, 12, 92, 9, 60, 14, 12, 78, 29, 31, 65, 5, 34, 84, 90, 92, 28, 34, 34, 96, 94, 15, 26, },
+    { 17, 5, 81, 48, 90, 63, 28, 30, 7, 40, 23, 16, 1, 36, 27, 78, 64, 58, 44, 69, 92, 29, 60, 84, 56, 93, 19, 53, 87, 33, 79, 5, 37, 60, 52, 28, 24, 80, 58, 30, 21, 80, 46, 21, 17, 72, 98, 81, 30, 43, 51, 22, 71, 11, 7, 28, 4, 25, 80, 90, 57, 59, 95, 94, 20, 48, 22, 0, 43, 28, 79, 73, 49, 60, 19, 69, 77, 90, 68, 58, 21, 11, 9, 43, 81, 19, 49, 9, 23, 73, 88, 14, 31, 48, 9, 25, 68, 56, 47, 11, },
+    { 84, 27, 84, 33, 86, 3, 3, 63, 93, 70, 22, 14, 80, 31, 56, 61, 49, 5, 69, 72, 78, 58, 85, 9, 6, 94, 33, 73, 51, 80, 84, 36, 7, 68, 68, 93, 70, 70, 57, 64, 41, 78, 77, 21, 9, 34, 81, 58, 39, 51, 31, 17, 9, 16, 25, 15, 11, 58, 87, 61, 39, 72, 96, 45, 40, 65, 38, 11, 0, 36, 95, 74, 76, 73, 52, 96, 82, 85, 78, 41, 24, 29, 71, 40, 37, 87, 65, 51, 97, 24, 39, 58, 62, 12, 55, 8, 51, 20, 46, 62, },
+    { 55, 41, 37, 31, 14, 88, 28, 96, 74, 6, 38, 97, 34, 9, 38, 71, 96, 4, 23, 93, 28, 61, 52, 90, 72, 7, 97, 24, 26, 43, 86, 81, 83, 23, 13, 97, 12, 40, 94, 85, 45, 32, 83, 79, 41, 22, 50, 37, 26, 73, 31, 53, 34, 83, 44, 7, 89, 41, 31, 16, 84, 18, 97, 68, 40, 10, 66, 52, 49, 0, 61, 38, 94, 92, 21, 73, 34, 43, 24, 70, 69, 96, 2, 23, 31, 84, 66, 38, 74, 8, 69, 90, 92, 86, 87, 60, 26, 96, 27, 78, },
+    { 46, 87, 16, 40, 80, 37, 14, 14, 80, 37, 83, 49, 34, 85, 71, 64, 69, 37, 2, 44, 45, 70, 34, 37, 56, 21, 97, 82, 18, 24, 60, 64, 12, 76, 4, 91, 13, 18, 5, 92, 54, 88, 41, 87, 74, 13, 52, 43, 49, 54, 86, 94, 25, 21, 31, 81, 42, 28, 63, 59, 52, 24, 23, 64, 1, 27, 56, 13, 44, 61, 0, 6, 98, 50, 47, 86, 24, 59, 39, 67, 9, 92, 54, 3, 17, 74, 33, 97, 16, 61, 61, 75, 14, 85, 97, 78, 85, 25, 34, 98, },
+    { 69, 94, 4, 67, 45, 50, 54, 68, 10, 92, 35, 18, 84, 88, 21, 2, 63, 53, 98, 78, 15, 60, 53, 29, 45, 51, 7, 31, 76, 41, 29, 45, 36, 33, 12, 80, 83, 66, 49, 92, 58, 83, 11, 43, 72, 31, 44, 35, 84, 43, 14, 99, 4, 67, 29, 49, 18, 35, 79, 93, 76, 9, 39, 13, 41, 50, 92, 24, 17, 41, 17, 0, 74, 25, 27, 18, 97, 58, 61, 33, 42, 5, 46, 42, 8, 14, 70, 56, 31, 6, 36, 25, 81, 44, 63, 93, 84, 14, 86, 9, },
+    { 30, 28, 25, 5, 53, 52, 22, 50, 11, 83, 83, 53, 88, 30, 94, 95, 43, 64, 52, 74, 69, 87, 99, 51, 31, 62, 45, 16, 76, 32, 24, 7, 60, 49, 12, 13, 2, 34, 63, 12, 17, 46, 64, 5, 75, 59, 1, 19, 23, 52, 92, 92, 40, 91, 44, 71, 54, 89, 86, 31, 21, 11, 37, 80, 60, 49, 93, 62, 82, 56, 74, 98, 0, 3, 38, 4, 78, 97, 5, 96, 21, 57, 88, 14, 96, 80, 57, 68, 34, 47, 55, 64, 67, 65, 2, 48, 26, 50, 41, 87, },
+    { 33, 97, 61, 32, 99, 99, 35, 77, 97, 39, 73, 18, 95, 62, 31, 92, 42, 87, 60, 75, 34, 15, 40, 2, 80, 41, 50, 6, 91, 91, 93, 24, 88, 55, 55, 87, 55, 90, 65, 52, 30, 38, 69, 25, 99, 99, 18, 42, 87, 77, 17, 22, 92, 57, 24, 72, 98, 73, 78, 89, 64, 72, 14, 53, 27, 68, 40, 82, 59, 5, 34, 88, 43, 0, 4, 14, 43, 4, 31, 84, 90, 9, 2, 13, 1, 58, 37, 72, 56, 10, 50, 46, 74, 22, 59, 27, 49, 28, 67, 31, },
+    { 86, 72, 65, 74, 16, 68, 87, 58, 71, 19, 43, 62, 27, 44, 75, 27, 3, 12, 98, 58, 22, 49, 5, 96, 71, 63, 24, 21, 90, 90, 51, 77, 63, 16, 51, 78, 84, 39, 36, 55, 58, 78, 18, 84, 23, 92, 11, 25, 5, 10, 83, 26, 59, 87, 22, 31, 50, 46, 51, 41, 36, 2, 18, 98, 18, 69, 77, 2, 9, 13, 57, 66, 91, 74, 0, 51, 15, 67, 61, 39, 71, 71, 23, 97, 31, 10, 20, 61, 60, 65, 12, 2, 2, 13, 20, 1, 31, 89, 77, 33, },
+    { 98, 90, 89, 64, 82, 64, 16, 96, 31, 77, 36, 3, 48, 58, 1, 78, 68, 20, 40, 28, 84, 51, 30, 85, 64, 49, 85, 94, 38, 62, 27, 36, 53, 17, 1, 35, 80, 16, 31, 12, 92, 67, 15, 41, 25, 15, 20, 93, 34, 59, 22, 19, 10, 51, 4, 74, 99, 89, 68, 38, 52, 95, 73, 5, 12, 74, 40, 92, 89, 70, 5, 82, 37, 19, 23, 0, 62, 33, 43, 55, 66, 2, 76, 85, 12, 28, 89, 85, 27, 78, 54, 65, 31, 49, 39, 36, 61, 13, 75, 54, },
+    { 3, 46, 58, 85, 82, 76, 9, 45, 10, 51, 99, 76, 52, 76, 61, 63, 4, 50, 49, 31, 29, 3, 96, 59, 52, 35, 95, 14, 48, 70, 67, 50, 16, 26, 35, 98, 3, 44, 43, 12, 94, 43, 87, 46, 20, 49, 10, 24, 98, 58, 55, 28, 61, 51, 86, 13, 86, 82, 26, 34, 52, 93, 83, 68, 19, 19, 67, 21, 62, 10, 32, 56, 53, 20, 3, 73, 0, 68, 13, 96, 67, 70, 52, 94, 32, 3, 81, 44, 88, 63, 70, 22, 16, 63, 6, 84, 81, 25, 51, 3, },
+    { 87, 61, 35, 44, 14, 54, 46, 87, 23, 59, 83, 90, 30, 35, 84, 61, 38, 66, 5, 27, 30, 74, 48, 45, 38, 54, 30, 19, 78, 80, 22, 65, 41, 56, 10, 55, 11, 55, 42, 33, 15, 26, 23, 44, 61, 8, 5, 98, 73, 10, 26, 4, 83, 73, 48, 22, 28, 77, 41, 7, 58, 62, 72, 99, 18, 81, 55, 28, 37, 97, 61, 51, 23, 84, 94, 84, 91, 0, 98, 83, 65, 8, 9, 68, 91, 82, 17, 13, 10, 94, 54, 16, 52, 16, 87, 52, 33, 69, 7, 61, },
+    { 6, 4, 22, 56, 27, 7, 50, 12, 97, 49, 94, 63, 57, 3, 31, 49, 85, 47, 62, 94, 42, 16, 11, 94, 31, 98, 46, 64, 67, 53, 26, 72, 57, 48, 29, 84, 54, 79, 95, 51, 28, 89, 15, 85, 92, 45, 34, 78, 92, 95, 72, 34, 12, 83, 29, 42, 81, 74, 7, 49, 27, 32, 22, 83, 79, 50, 67, 34, 29, 63, 84, 57, 53, 99, 43, 45, 44, 76, 0, 23, 37, 72, 95, 71, 83, 78, 99, 26, 60, 73, 32, 9, 1, 64, 30, 84, 43, 80, 52, 76, },
+    { 10, 15, 61, 67, 67, 60, 10, 13, 5, 86, 36, 41, 59, 32, 12, 42, 11, 12, 68, 71, 85, 99, 79, 85, 63, 10, 70, 7, 89, 22, 83, 99, 37, 45, 66, 5, 5, 75, 18, 10, 62, 54, 51, 21, 85, 63, 63, 96, 74, 31, 67, 59, 31, 46, 45, 93, 56, 15, 1, 46, 37, 83, 45, 73, 28, 11, 77, 33, 86, 95, 42, 48, 49, 92, 68, 34, 55, 31, 30, 0, 30, 61, 97, 88, 91, 43, 33, 85, 99, 47, 86, 45, 83, 69, 89, 57, 97, 1, 35, 31, },
+    { 86, 30, 73, 34, 78, 66, 3, 13, 22, 34, 43, 51, 94, 40, 39, 86, 83, 72, 72, 83, 19, 58, 28, 3, 28, 18, 60, 25, 18, 94, 56, 5, 25, 29, 39, 4, 94, 41, 17, 16, 74, 59, 66, 69, 99, 6, 56, 83, 77, 29, 66, 96, 86, 94, 99, 14, 12, 59, 39, 30, 54, 95, 34, 78, 24, 72, 81, 18, 14, 97, 34, 88, 57, 99, 58, 57, 6, 14, 40, 82, 0, 43, 7, 79, 29, 1, 78, 43, 13, 38, 82, 42, 91, 77, 76, 69, 1, 49, 51, 19, },
+    { 62, 49, 52, 51, 7, 52, 9, 63, 57, 23, 4, 40, 65, 10, 19, 94, 10, 97, 37, 22, 35, 20, 64, 26, 96, 40, 95, 97, 88, 47, 17, 51, 96, 68, 3, 3, 21, 12, 66, 77, 34, 69, 18, 99, 78, 37, 94, 88, 34, 32, 11, 69, 51, 74, 95, 48, 14, 91, 46, 3, 39, 62, 54, 35, 30, 56, 38, 50, 67, 4, 28, 2, 72, 46, 2, 51, 82, 95, 39, 17, 27, 0, 49, 85, 77, 23, 81, 26, 37, 72, 71, 40, 11, 33, 93, 45, 63, 50, 83, 14, },
+    { 17, 86, 42, 19, 59, 87, 20, 10, 69, 15, 48, 86, 42, 97, 72, 19, 21, 53, 45, 57, 25, 16, 97, 36, 49, 90, 81, 12, 41, 64, 25, 57, 50, 66, 76, 10, 53, 95, 19, 23, 11, 67, 10, 52, 64, 81, 71, 85, 34, 16, 43, 58, 32, 40, 93, 80, 31, 74, 91, 71, 39, 17, 29, 88, 82, 5, 97, 36, 99, 17, 59, 11, 83, 68, 62, 48, 49, 33, 33, 82, 48, 75, 0, 41, 80, 15, 35, 60, 46, 10, 51, 17, 48, 68, 45, 37, 50, 50, 35, 86, },
+    { 50, 51, 46, 60, 35, 14, 22, 83, 63, 55, 16, 46, 3, 91, 87, 82, 7, 22, 43, 52, 32, 94, 68, 80, 62, 14, 17, 13, 64, 52, 99, 14, 4, 45, 74, 38, 58, 95, 21, 22, 51, 37, 67, 54, 29, 55, 37, 35, 76, 79, 86, 9, 73, 55, 88, 36, 69, 6, 48, 33, 57, 47, 47, 60, 91, 21, 98, 50, 17, 20, 72, 67, 57, 39, 21, 85, 93, 57, 20, 70, 37, 7, 79, 0, 10, 61, 68, 45, 31, 73, 93, 64, 30, 40, 11, 90, 32, 32, 89, 82, },
+    { 49, 9, 54, 17, 66, 93, 38, 51, 87, 95, 71, 58, 32, 77, 37, 42, 39, 5, 86, 69, 78, 80, 34, 9, 21, 44, 99, 53, 76, 88, 35, 26, 97, 89, 42, 63, 82, 79, 14, 70, 74, 85, 28, 6, 62, 65, 47, 1, 70, 34, 70, 49, 14, 4, 57, 35, 48, 56, 87, 25, 44, 22, 50, 41, 12, 91, 5, 93, 71, 19, 64, 46, 4, 92, 52, 66, 57, 98, 67, 28, 33, 37, 76, 47, 0, 41, 33, 81, 89, 89, 69, 14, 33, 90, 64, 74, 2, 56, 79, 95, },
+    { 27, 97, 60, 72, 2, 52, 24, 67, 9, 23, 34, 37, 56, 71, 14, 3, 13, 46, 84, 2, 36, 53, 16, 69, 44, 79, 43, 46, 35, 23, 42, 62, 21, 2, 35, 22, 53, 59, 88, 62, 82, 23, 98, 38, 94, 12, 41, 7, 58, 26, 8, 93, 78, 24, 62, 23, 3, 6, 68, 38, 29, 10, 1, 49, 12, 35, 70, 64, 94, 59, 26, 76, 81, 25, 14, 75, 37, 55, 82, 94, 80, 90, 88, 58, 14, 0, 51, 81, 16, 56, 49, 54, 84, 59, 54, 33, 70, 89, 4, 35, },
+    { 83, 63, 60, 59, 44, 84, 73, 20, 21, 28, 3, 16, 8, 92, 4, 66, 6, 54, 47, 22, 11, 95, 75, 95, 55, 30, 29, 26, 19, 32, 60, 2, 94, 20, 61, 39, 5, 34, 59, 26, 61, 61, 42, 68, 54, 45, 34, 59, 99, 81, 80, 11, 77, 56, 6, 32, 85, 34, 57, 5, 66, 17, 7, 61, 37, 67, 1, 42, 2, 60, 68, 63, 22, 10, 32, 75, 55, 66, 34, 54, 47, 15, 64, 24, 71, 70, 0, 55, 57, 5, 13, 61, 71, 30, 68, 32, 67, 36, 33, 9, },
+    { 37, 92, 77, 99, 14, 86, 32, 88, 41, 97, 23, 95, 44, 38, 60, 67, 9, 30, 23, 66, 35, 35, 27, 6, 65, 94, 37, 32, 31, 69, 41, 67, 62, 18, 67, 75, 5, 98, 64, 45, 95, 87, 40, 40, 26, 1, 7, 35, 31, 30, 1, 65, 65, 27, 70, 30, 22, 7, 62, 52, 76, 3, 20, 38, 21, 87, 14, 25, 86, 77, 70, 82, 65, 11, 22, 90, 11, 29, 25, 41, 58, 25, 6, 23, 52, 76, 52, 0, 74, 82, 15, 27, 59, 17, 47, 97, 38, 34, 11, 63, },
+    { 20, 88, 34, 3, 54, 44, 24, 44, 55, 52, 69, 96, 11, 94, 3, 33, 47, 78, 85, 21, 61, 99, 47, 21, 17, 93, 18, 55, 28, 29, 18, 48, 17, 52, 50, 70, 96, 74, 15, 51, 27, 84, 48, 37, 78, 51, 70, 25, 29, 55, 45, 90, 54, 92, 12, 71, 86, 29, 26, 15, 58, 44, 62, 74, 95, 13, 45, 91, 86, 60, 43, 13, 44, 90, 50, 22, 41, 20, 47, 70, 74, 92, 61, 29, 84, 72, 1, 71, 0, 2, 26, 85, 59, 69, 48, 34, 65, 60, 79, 56, },
+    { 47, 39, 99, 60, 82, 90, 11, 5, 31, 30, 51, 2, 5, 43, 63, 34, 28, 36, 34, 99, 38, 59, 85, 97, 29, 33, 32, 94, 93, 11, 51, 41, 50, 50, 2, 32, 40, 12, 37, 71, 41, 88, 73, 45, 32, 36, 78, 59, 72, 12, 59, 10, 71, 44, 8, 1, 77, 39, 94, 70, 49, 45, 12, 98, 94, 13, 31, 34, 24, 68, 6, 65, 56, 78, 11, 87, 15, 88, 47, 86, 1, 6, 96, 72, 49, 4, 72, 26, 42, 0, 67, 96, 91, 12, 8, 90, 7, 20, 21, 41, },
+    { 44, 89, 46, 9, 45, 24, 19, 33, 39, 8, 79, 25, 9, 84, 22, 80, 34, 26, 53, 59, 68, 20, 55, 59, 32, 63, 50, 38, 83, 71, 78, 27, 60, 25, 36, 6, 48, 55, 38, 86, 63, 17, 12, 71, 1, 34, 52, 34, 59, 6, 93, 27, 25, 49, 86, 57, 12, 36, 95, 95, 7, 73, 23, 67, 98, 58, 72, 47, 14, 10, 34, 76, 26, 45, 47, 27, 79, 99, 61, 38, 5, 55, 65, 30, 4, 51, 86, 16, 87, 81, 0, 11, 94, 55, 33, 61, 54, 91, 33, 1, },
+    { 5, 42, 34, 80, 68, 79, 28, 94, 58, 27, 56, 96, 32, 11, 61, 61, 14, 12, 48, 29, 99, 30, 40, 93, 85, 72, 54, 39, 63, 86, 39, 68, 29, 73, 48, 96, 52, 76, 90, 10, 4, 46, 6, 35, 57, 67, 96, 70, 79, 44, 99, 78, 73, 39, 71, 58, 12, 26, 97, 75, 12, 36, 43, 40, 10, 91, 37, 61, 67, 27, 71, 70, 73, 77, 6, 30, 44, 2, 1, 23, 46, 1, 2, 19, 40, 72, 77, 51, 98, 75, 27, 0, 10, 12, 69, 50, 21, 60, 87, 81, },
+    { 28, 14, 53, 98, 87, 30, 4, 18, 74, 6, 19, 96, 51, 19, 97, 70, 59, 70, 47, 11, 68, 23, 37, 78, 34, 6, 29, 54, 66, 16, 35, 93, 30, 88, 91, 17, 18, 95, 35, 91, 1, 53, 88, 52, 72, 86, 22, 31, 56, 69, 41, 25, 91, 77, 3, 25, 83, 32, 78, 49, 47, 14, 43, 77, 2, 35, 94, 20, 30, 29, 11, 31, 82, 99, 82, 54, 85, 5, 85, 41, 73, 27, 66, 65, 5, 68, 89, 87, 1, 68, 37, 48, 0, 82, 80, 25, 84, 15, 20, 4, },
+    { 45, 49, 15, 75, 31, 14, 58, 85, 98, 63, 70, 40, 36, 96, 6, 1, 2, 74, 90, 88, 75, 59, 26, 23, 41, 6, 48, 25, 20, 67, 29, 65, 16, 43, 40, 47, 57, 98, 32, 56, 61, 3, 95, 97, 99, 2, 98, 1, 76, 88, 88, 52, 48, 15, 74, 88, 20, 23, 14, 40, 90, 42, 5, 6, 85, 45, 52, 42, 44, 84, 97, 5, 86, 93, 2, 85, 94, 99, 85, 71, 88, 74, 23, 36, 89, 97, 25, 9, 21, 39, 49, 11, 80, 0, 54, 16, 65, 99, 68, 7, },
+    { 43, 53, 5, 47, 39, 97, 49, 25, 92, 49, 11, 63, 38, 85, 86, 74, 74, 84, 98, 83, 5, 37, 32, 15, 18, 86, 31, 83, 85, 99, 90, 28, 52, 94, 75, 91, 91, 25, 17, 83, 73, 27, 47, 12, 12, 34, 85, 85, 18, 83, 68, 22, 21, 1, 37, 38, 86, 68, 22, 72, 67, 12, 1, 20, 6, 76, 12, 97, 1, 28, 80, 74, 55, 28, 85, 66, 61, 70, 52, 78, 54, 21, 1, 75, 21, 38, 14, 8, 6, 35, 80, 72, 46, 80, 0, 92, 52, 56, 4, 49, },
+    { 57, 31, 29, 32, 86, 56, 17, 52, 18, 87, 5, 95, 42, 25, 96, 18, 45, 34, 31, 53, 39, 66, 33, 12, 12, 14, 4, 64, 70, 8, 13, 27, 39, 42, 58, 25, 98, 75, 77, 16, 63, 81, 11, 6, 6, 8, 23, 51, 41, 53, 4, 80, 19, 37, 91, 31, 50, 95, 94, 20, 3, 7, 47, 42, 49, 6, 66, 47, 80, 43, 62, 44, 25, 73, 49, 30, 80, 72, 81, 22, 26, 85, 2, 44, 22, 92, 75, 72, 88, 70, 92, 91, 77, 39, 33, 0, 26, 44, 99, 72, },
+    { 25, 43, 34, 68, 67, 8, 18, 97, 87, 89, 78, 9, 15, 63, 11, 59, 85, 3, 35, 57, 91, 5, 49, 82, 81, 88, 16, 7, 32, 15, 79, 57, 58, 14, 26, 25, 21, 43, 22, 9, 33, 99, 17, 48, 63, 27, 8, 48, 30, 42, 6, 22, 47, 55, 5, 28, 43, 20, 35, 75, 35, 14, 33, 92, 27, 58, 18, 47, 2, 39, 55, 34, 39, 72, 82, 2, 99, 90, 50, 30, 32, 56, 51, 79, 12, 56, 8, 55, 75, 42, 30, 11, 56, 62, 3, 82, 0, 21, 20, 30, },
+    { 22, 59, 85, 56, 97, 58, 38, 99, 58, 29, 50, 88, 60, 7, 40, 40, 18, 95, 47, 72, 70, 88, 2, 81, 44, 64, 84, 27, 85, 5, 57, 7, 63, 43, 63, 61, 2, 2, 61, 59, 30, 11, 47, 90, 17, 86, 30, 34, 82, 76, 6, 52, 65, 8, 34, 10, 72, 18, 36, 58, 22, 93, 64, 84, 37, 27, 46, 38, 28, 7, 96, 57, 18, 44, 47, 35, 31, 77, 69, 13, 53, 75, 65, 18, 83, 98, 27, 56, 16, 63, 14, 38, 57, 78, 23, 93, 5, 0, 68, 31, },
+    { 33, 75, 28, 90, 92, 72, 38, 28, 3, 15, 96, 16, 68, 71, 80, 86, 55, 78, 14, 11, 94, 76, 24, 32, 34, 2, 55, 28, 7, 23, 59, 40, 98, 87, 30, 90, 59, 68, 19, 62, 82, 15, 77, 51, 86, 57, 37, 41, 36, 50, 52, 31, 27, 75, 63, 60, 77, 18, 87, 84, 40, 47, 24, 38, 34, 53, 29, 92, 21, 47, 54, 4, 62, 31, 54, 49, 88, 90, 90, 24, 40, 42, 54, 66, 18, 17, 27, 95, 34, 15, 79, 74, 61, 3, 13, 94, 56, 42, 0, 86, },
+    { 77, 89, 41, 80, 52, 72, 35, 1, 60, 25, 91, 84, 65, 34, 39, 32, 51, 56, 58, 47, 90, 73, 26, 65, 34, 29, 77, 28, 84, 20, 15, 61, 10, 56, 42, 61, 28, 76, 62, 88, 2, 54, 73, 67, 87, 13, 98, 39, 68, 57, 85, 58, 30, 12, 23, 64, 40, 1, 91, 25, 21, 7, 85, 30, 62, 28, 91, 90, 5, 54, 79, 6, 8, 52, 73, 94, 64, 72, 33, 33, 29, 19, 90, 59, 30, 14, 23, 69, 14, 15, 94, 35, 22, 79, 64, 83, 8, 56, 74, 0, },
+};
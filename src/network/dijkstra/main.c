@@ -0,0 +1,352 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines NUM_NODES, ADJ_NONE and adj[][], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// Shortest paths to find, from node i to node NUM_NODES / 2 + i
+// (MiBench: 20 small, 100 large)
+#ifndef NUM_QUERIES
+#define NUM_QUERIES 20
+#endif
+
+// Slots in the node array (a power of 2, at least NUM_NODES)
+#if NUM_NODES <= 32
+#define NODE_SLOTS 32
+#elif NUM_NODES <= 64
+#define NODE_SLOTS 64
+#elif NUM_NODES <= 128
+#define NODE_SLOTS 128
+#else
+#error NUM_NODES is larger than 128
+#endif
+
+// Edges relaxed per execution: each may update a node, and a task execution
+// can update at most MAX_DIRTY_SELF_FIELDS self-channel fields, one of which
+// is the progress. Unrolled (see relax_block), so that check_graph.sh can
+// count the updates.
+#define RELAX_BLOCK 6
+
+#define NONE 9999
+#define NO_PREV 0xff
+#define NO_QUERY 0xff
+
+/** @brief Entry of a node in the priority queue
+ *  @details The queue is the array of tentative distances of all nodes, and
+ *           extracting the minimum is a scan over the nodes not yet settled,
+ *           as befits a dense graph. Each entry is tagged with the query that
+ *           wrote it: an entry of an earlier query reads as unreached, so
+ *           the array need not be reset between queries.
+ */
+typedef struct {
+    uint16_t dist;
+    uint8_t prev;
+    uint8_t query;
+    uint8_t settled;
+} node_t;
+
+typedef enum {
+    DIJKSTRA_START = 0, // put the start node in the queue
+    DIJKSTRA_EXTRACT,   // take the closest node that is not settled
+    DIJKSTRA_RELAX,     // update the neighbours of that node
+    DIJKSTRA_CHECK,     // check the distances of the finished query
+    DIJKSTRA_PATH,      // print the path and move to the next query
+} dijkstra_phase_t;
+
+typedef struct {
+    uint16_t phase;     // dijkstra_phase_t
+    uint16_t query;
+    uint16_t node;      // node being relaxed or checked
+    uint16_t dist;      // distance of the node being relaxed
+    uint16_t i;         // next neighbour to relax
+    uint32_t total;     // sum of the costs of the paths found so far
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_dijkstra)
+TASK(3, bench_fail)
+TASK(4, bench_success)
+
+struct dijkstra_args {
+    CHAN_FIELD_ARRAY(node_t, node, NODE_SLOTS);
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct dijkstra_state {
+    SELF_CHAN_FIELD_ARRAY(node_t, node, NODE_SLOTS);
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_dijkstra_state {\
+    SELF_FIELD_ARRAY_INITIALIZER(NODE_SLOTS),\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_dijkstra, dijkstra_args);
+SELF_CHANNEL(task_dijkstra, dijkstra_state);
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+static unsigned query_start(unsigned query) {
+    return query % NUM_NODES;
+}
+
+static unsigned query_end(unsigned query) {
+    return (NUM_NODES / 2 + query) % NUM_NODES;
+}
+
+static node_t node_in(unsigned k, unsigned query) {
+    node_t n = *CHAN_IN2(node_t, node[k], CH(task_init, task_dijkstra),
+                         SELF_IN_CH(task_dijkstra));
+
+    if (n.query != query) {
+        n.dist = NONE;
+        n.prev = NO_PREV;
+        n.query = query;
+        n.settled = 0;
+    }
+    return n;
+}
+
+static void node_out(unsigned k, node_t n) {
+    CHAN_OUT1(node_t, node[k], n, SELF_OUT_CH(task_dijkstra));
+}
+
+/** @brief Relax the edge to the next neighbour of the node being relaxed */
+static void relax_next(progress_t *prog) {
+    node_t n;
+    unsigned w;
+
+    if (prog->i == NUM_NODES)
+        return;
+
+    w = adj[prog->node][prog->i];
+    if (w != ADJ_NONE) {
+        n = node_in(prog->i, prog->query);
+        if (!n.settled && n.dist > prog->dist + w) {
+            n.dist = prog->dist + w;
+            n.prev = prog->node;
+            node_out(prog->i, n);
+        }
+    }
+    prog->i++;
+}
+
+/** @brief Relax the edges to the next RELAX_BLOCK neighbours */
+static void relax_block(progress_t *prog) {
+#if RELAX_BLOCK != 6
+#error relax_block is unrolled for a RELAX_BLOCK of 6
+#endif
+    relax_next(prog);
+    relax_next(prog);
+    relax_next(prog);
+    relax_next(prog);
+    relax_next(prog);
+    relax_next(prog);
+}
+
+static void fail(unsigned query, unsigned node) {
+    LOG("Wrong distance for query %u at node %u\r\n", query, node);
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    CHAIN_REPORT();
+    TRANSITION_TO(bench_fail);
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit\r\n");
+
+    unsigned k;
+    node_t n = { .dist = NONE, .prev = NO_PREV, .query = NO_QUERY };
+    progress_t prog = { .phase = DIJKSTRA_START, .query = 0 };
+
+    for (k = 0; k < NUM_NODES; ++k)
+        CHAN_OUT1(node_t, node[k], n, CH(task_init, task_dijkstra));
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_dijkstra));
+    TRANSITION_TO(task_dijkstra);
+}
+
+void task_dijkstra() {
+    task_prologue();
+
+    progress_t prog;
+    node_t n, m;
+    unsigned k, best, w;
+
+    prog = *CHAN_IN2(progress_t, prog,
+            CH(task_init, task_dijkstra), SELF_IN_CH(task_dijkstra));
+
+    switch (prog.phase) {
+        case DIJKSTRA_START:
+            LOG("dijkstra: %u -> %u\r\n",
+                query_start(prog.query), query_end(prog.query));
+            n = node_in(query_start(prog.query), prog.query);
+            n.dist = 0;
+            node_out(query_start(prog.query), n);
+            prog.phase = DIJKSTRA_EXTRACT;
+            break;
+
+        case DIJKSTRA_EXTRACT:
+            best = NUM_NODES;
+            prog.dist = NONE;
+            for (k = 0; k < NUM_NODES; ++k) {
+                n = node_in(k, prog.query);
+                if (!n.settled && n.dist < prog.dist) {
+                    best = k;
+                    prog.dist = n.dist;
+                }
+            }
+
+            if (best == NUM_NODES) {
+                // The queue is empty: all reachable nodes are settled
+                prog.phase = DIJKSTRA_CHECK;
+                prog.node = 0;
+                break;
+            }
+
+            n = node_in(best, prog.query);
+            n.settled = 1;
+            node_out(best, n);
+            prog.phase = DIJKSTRA_RELAX;
+            prog.node = best;
+            prog.i = 0;
+            break;
+
+        case DIJKSTRA_RELAX:
+            relax_block(&prog);
+            if (prog.i == NUM_NODES)
+                prog.phase = DIJKSTRA_EXTRACT;
+            break;
+
+        case DIJKSTRA_CHECK:
+            // No edge from the node can shorten a path, and the distance of
+            // the node is that of its predecessor plus the edge between them
+            n = node_in(prog.node, prog.query);
+            if (n.dist != NONE) {
+                for (k = 0; k < NUM_NODES; ++k) {
+                    w = adj[prog.node][k];
+                    if (w == ADJ_NONE)
+                        continue;
+                    m = node_in(k, prog.query);
+                    if (m.dist > n.dist + w)
+                        fail(prog.query, k);
+                }
+                if (prog.node != query_start(prog.query)) {
+                    if (n.prev == NO_PREV) {
+                        fail(prog.query, prog.node);
+                    } else {
+                        m = node_in(n.prev, prog.query);
+                        if (n.dist != m.dist + adj[n.prev][prog.node])
+                            fail(prog.query, prog.node);
+                    }
+                }
+            }
+
+            if (++prog.node == NUM_NODES)
+                prog.phase = DIJKSTRA_PATH;
+            break;
+
+        case DIJKSTRA_PATH: {
+            uint8_t path[NUM_NODES];
+            unsigned len = 0;
+
+            k = query_end(prog.query);
+            n = node_in(k, prog.query);
+            prog.total += n.dist;
+
+            PRINTF("Shortest path is %u in cost. Path is:", n.dist);
+            while (len < NUM_NODES) {
+                path[len++] = k;
+                if (k == query_start(prog.query))
+                    break;
+                k = node_in(k, prog.query).prev;
+            }
+            // Not in the PRINTF arguments, which may not be evaluated
+            while (len > 0) {
+                --len;
+                PRINTF(" %u", path[len]);
+            }
+            PRINTF("\r\n");
+
+            if (++prog.query < NUM_QUERIES) {
+                prog.phase = DIJKSTRA_START;
+                break;
+            }
+
+            LOG("success\r\n");
+            PRINTF("cycles: %n\r\n", msp_cycles());
+            PRINTF("Found %u shortest paths, total cost %n.\r\n",
+                   NUM_QUERIES, prog.total);
+            CHAIN_REPORT();
+            TRANSITION_TO(bench_success);
+        }
+    }
+
+    CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_dijkstra));
+    TRANSITION_TO(task_dijkstra);
+}
+
+// Blink LED1 on failure
+void bench_fail() {
+    task_prologue();
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_1, OUT) &= ~BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_fail);
+}
+
+// Blink LED2 on success
+void bench_success() {
+    task_prologue();
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_success);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): nodes of the
+# graph, at most 100
+SIZE_small = 25
+SIZE_medium = 50
+SIZE_large = 100
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
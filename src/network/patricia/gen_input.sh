@@ -0,0 +1,37 @@
+#! /bin/bash
+#
+# Generate input.h from a MiBench patricia packet trace
+#
+# Each line of the trace is a time stamp and an address as a decimal
+# integer; only the addresses are kept.
+#
+# Usage: ./gen_input.sh [lookups] [small.udp] > input.h
+
+LOOKUPS=${1:-2048}
+INPUT=${2:-../../../mibench-src/network/patricia/small.udp}
+
+awk -v lookups=$LOOKUPS '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench patricia small.udp */"
+        print ""
+    }
+    n < lookups {
+        if (n % 4 == 0)
+            line = "   "
+        line = line sprintf(" 0x%08xUL,", $2)
+        if (n % 4 == 3) {
+            body = body line "\n"
+            line = ""
+        }
+        ++n
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define NUM_ADDRS " n
+        print ""
+        print "__ro_nv static const uint32_t addrs[NUM_ADDRS] = {"
+        printf "%s", body
+        print "};"
+    }
+' $INPUT
@@ -0,0 +1,518 @@
+/* Generated by gen_input.sh from MiBench patricia small.udp */
+
+#define NUM_ADDRS 2048
+
+__ro_nv static const uint32_t addrs[NUM_ADDRS] = {
+    0x2d5037aaUL, 0x320bbd3fUL, 0x79200950UL, 0x13ef9244UL,
+    0x2abfafc6UL, 0x71e3c09fUL, 0x798556f2UL, 0x76651c07UL,
+    0x7d16bcffUL, 0x2e44bcb6UL, 0x426e1746UL, 0x7f87e7e2UL,
+    0x13ef9244UL, 0x2f585f9eUL, 0x062e5061UL, 0x3602d9d2UL,
+    0x7c484350UL, 0x1288799aUL, 0x24b9c3f8UL, 0x77781811UL,
+    0x75f62a6cUL, 0x119a03e9UL, 0x63058b49UL, 0x25646addUL,
+    0x6dd71033UL, 0x71e3c09fUL, 0x75f62a6cUL, 0x0fb782b2UL,
+    0x6254113dUL, 0x50078241UL, 0x0c2d5a2fUL, 0x447d2546UL,
+    0x5cbeec51UL, 0x119a03e9UL, 0x7d16bcffUL, 0x2baaa18aUL,
+    0x68c361c9UL, 0x55f03595UL, 0x5af76562UL, 0x4218498aUL,
+    0x6f32e578UL, 0x3d8536a4UL, 0x745fb25cUL, 0x373f2a9bUL,
+    0x4cfb5c89UL, 0x7b7bccc1UL, 0x555d6d60UL, 0x684f8532UL,
+    0x70494e1dUL, 0x7219eba8UL, 0x1e70beaeUL, 0x2e44bcb6UL,
+    0x0ca86f59UL, 0x6d62c616UL, 0x696420e7UL, 0x4c5e4332UL,
+    0x4de964cbUL, 0x164c188fUL, 0x2118ccddUL, 0x1ca8445dUL,
+    0x3c74c9e0UL, 0x18a164d0UL, 0x72ec7121UL, 0x1c68d895UL,
+    0x53de5c24UL, 0x3cdc14b2UL, 0x64dd9ae1UL, 0x3748e2f2UL,
+    0x4978dc4bUL, 0x45d803a9UL, 0x2027eb51UL, 0x2d63c699UL,
+    0x4b19214fUL, 0x0fdba50dUL, 0x05ce5351UL, 0x30eb1e29UL,
+    0x5f22316dUL, 0x76651c07UL, 0x3cca7d24UL, 0x5a0e332eUL,
+    0x02078f11UL, 0x26131c38UL, 0x76e233eeUL, 0x61d24563UL,
+    0x49d3b362UL, 0x2f585f9eUL, 0x7d7aed7eUL, 0x554b899aUL,
+    0x0f1f10ccUL, 0x4a99f904UL, 0x1c68d895UL, 0x64dd9ae1UL,
+    0x524cb84bUL, 0x6bd7c35fUL, 0x6d139a60UL, 0x58ff35a7UL,
+    0x5facd096UL, 0x02634728UL, 0x5a0e332eUL, 0x7dec3a0cUL,
+    0x3329461cUL, 0x78e88dc7UL, 0x14e21f75UL, 0x68cd842aUL,
+    0x58288e7eUL, 0x2118ccddUL, 0x729864a9UL, 0x4536402bUL,
+    0x3748e2f2UL, 0x076b7aecUL, 0x2334f478UL, 0x22775f19UL,
+    0x0b5da644UL, 0x2581dd63UL, 0x4b8b1e4cUL, 0x6a6be553UL,
+    0x2a7106aaUL, 0x2f55d717UL, 0x3ec9d12aUL, 0x22775f19UL,
+    0x55f03595UL, 0x37648987UL, 0x2b5d2814UL, 0x65644adcUL,
+    0x0c77d346UL, 0x76e233eeUL, 0x2baaa18aUL, 0x7219eba8UL,
+    0x012670f9UL, 0x67a3797fUL, 0x54e73461UL, 0x2992c2a5UL,
+    0x179db2eaUL, 0x493bb82fUL, 0x7b9a5d1bUL, 0x5cbeec51UL,
+    0x1483c26aUL, 0x6b68347eUL, 0x26131c38UL, 0x6b8c2682UL,
+    0x4ee7e881UL, 0x0fb782b2UL, 0x6f838e66UL, 0x77f2f5f8UL,
+    0x5ca9c35fUL, 0x322bd2c2UL, 0x66d963b9UL, 0x76744841UL,
+    0x35ccf5b8UL, 0x7c880ca4UL, 0x2d208eddUL, 0x7e67e972UL,
+    0x55f03595UL, 0x5dee6776UL, 0x298a0c4dUL, 0x63ed6df4UL,
+    0x0ca86f59UL, 0x290788c5UL, 0x0496b65cUL, 0x6624f27bUL,
+    0x538ff1aeUL, 0x08dc322dUL, 0x11f793d0UL, 0x1192ac6bUL,
+    0x7a9325bbUL, 0x76e233eeUL, 0x08dc322dUL, 0x786e8c06UL,
+    0x02078f11UL, 0x7af6b2e9UL, 0x5320536cUL, 0x70678ae1UL,
+    0x298a0c4dUL, 0x2875e067UL, 0x05bf4c97UL, 0x013532aeUL,
+    0x36cae829UL, 0x233d7edaUL, 0x0b249e3eUL, 0x3329461cUL,
+    0x02634728UL, 0x339a50edUL, 0x2118ccddUL, 0x7b7bccc1UL,
+    0x5dee6776UL, 0x17d5a80dUL, 0x784ea879UL, 0x6eb05e99UL,
+    0x36cae829UL, 0x30eb1e29UL, 0x0698e5d1UL, 0x2a362d5aUL,
+    0x290788c5UL, 0x26131c38UL, 0x55260245UL, 0x076b7aecUL,
+    0x290788c5UL, 0x67c6db73UL, 0x1ca8445dUL, 0x42af9feeUL,
+    0x41f4b1daUL, 0x1d1acda7UL, 0x125f0301UL, 0x695bfab9UL,
+    0x1ebe632eUL, 0x194b43fdUL, 0x74c17e3fUL, 0x46a7526bUL,
+    0x4a99f904UL, 0x7e82c2d5UL, 0x692789f7UL, 0x76744841UL,
+    0x294e907eUL, 0x322bd2c2UL, 0x29f2294dUL, 0x191420e3UL,
+    0x24169438UL, 0x2a4175ebUL, 0x34194342UL, 0x5f8c6734UL,
+    0x2334f478UL, 0x6aac6e7fUL, 0x649b077fUL, 0x2992c2a5UL,
+    0x3602d9d2UL, 0x4f8d31e2UL, 0x1be6f96aUL, 0x012670f9UL,
+    0x2ba6d4d2UL, 0x4cfb5c89UL, 0x39c8425cUL, 0x74c17e3fUL,
+    0x1df07f38UL, 0x410b7779UL, 0x2a14cbe0UL, 0x2e0e3f8bUL,
+    0x6a029a98UL, 0x78e88dc7UL, 0x209831f0UL, 0x0fdba50dUL,
+    0x013532aeUL, 0x04ef31cfUL, 0x2a362d5aUL, 0x2d63c699UL,
+    0x1192ac6bUL, 0x125f0301UL, 0x7b7bccc1UL, 0x557a51b3UL,
+    0x0b156693UL, 0x3217f1a9UL, 0x2f585f9eUL, 0x568c7d5cUL,
+    0x13ef9244UL, 0x2abfafc6UL, 0x554b899aUL, 0x214375afUL,
+    0x4bf2e767UL, 0x2baaa18aUL, 0x7a9325bbUL, 0x18a164d0UL,
+    0x7fdd7486UL, 0x4f2eb119UL, 0x42cd24bbUL, 0x798556f2UL,
+    0x354f479cUL, 0x04ef31cfUL, 0x54537b01UL, 0x610cd850UL,
+    0x125f0301UL, 0x50078241UL, 0x49d3b362UL, 0x339a50edUL,
+    0x4536402bUL, 0x538ff1aeUL, 0x6a6be553UL, 0x414c9800UL,
+    0x7e67e972UL, 0x10d0841dUL, 0x5e8f682fUL, 0x5831e0b9UL,
+    0x339a50edUL, 0x36cae829UL, 0x2d5c0e6eUL, 0x19f816ecUL,
+    0x410b7779UL, 0x43371722UL, 0x6d15a31dUL, 0x45d803a9UL,
+    0x7aeea724UL, 0x18ee97b8UL, 0x2d5c0e6eUL, 0x67a3797fUL,
+    0x6f5d95b5UL, 0x125f0301UL, 0x37648987UL, 0x493bb82fUL,
+    0x7a9325bbUL, 0x2e9ed57dUL, 0x77781811UL, 0x42cd24bbUL,
+    0x3a1a6cd2UL, 0x4738c814UL, 0x42cd24bbUL, 0x6a6be553UL,
+    0x3b4f7efcUL, 0x0fdba50dUL, 0x5f7c381dUL, 0x2e0e3f8bUL,
+    0x70678ae1UL, 0x2334f478UL, 0x4d3b0447UL, 0x70678ae1UL,
+    0x2a14cbe0UL, 0x5725c88aUL, 0x0b4481caUL, 0x4b2430eaUL,
+    0x5831e0b9UL, 0x0496b65cUL, 0x2875e067UL, 0x74e6e5beUL,
+    0x3c74c9e0UL, 0x36a547d1UL, 0x042c35efUL, 0x11b1bc70UL,
+    0x0af44d2dUL, 0x67c6db73UL, 0x7cb7c094UL, 0x4a1616f3UL,
+    0x47bfed6fUL, 0x0fdba50dUL, 0x5599a4a7UL, 0x28b7770cUL,
+    0x26131c38UL, 0x470651e4UL, 0x26216e2fUL, 0x32f8c540UL,
+    0x0f8ca14fUL, 0x1f69828eUL, 0x0c04d571UL, 0x7f57abfbUL,
+    0x17a1bf9bUL, 0x6f32e578UL, 0x5fdfe5f4UL, 0x7d6c688bUL,
+    0x5d1e8a16UL, 0x650b40b1UL, 0x54537b01UL, 0x450f63daUL,
+    0x22f19b97UL, 0x3b4f7efcUL, 0x0af44d2dUL, 0x6a6be553UL,
+    0x6aac6e7fUL, 0x18773379UL, 0x53de4d47UL, 0x0496b65cUL,
+    0x1df07f38UL, 0x426e1746UL, 0x6ede2597UL, 0x28b7770cUL,
+    0x44ebc2edUL, 0x6cdc8c7aUL, 0x4a99f904UL, 0x76ba01ccUL,
+    0x11b1bc70UL, 0x3a1a6cd2UL, 0x1e70beaeUL, 0x0ca86f59UL,
+    0x232b9d10UL, 0x70a19087UL, 0x0247aa17UL, 0x3abc8ffcUL,
+    0x47bfed6fUL, 0x05bf4c97UL, 0x3cdc14b2UL, 0x4fcd0a42UL,
+    0x2d63c699UL, 0x762bbab6UL, 0x7a9325bbUL, 0x5e8f682fUL,
+    0x08dc322dUL, 0x4a1616f3UL, 0x6beb9b46UL, 0x706f1101UL,
+    0x771b2119UL, 0x6dd71033UL, 0x07ce142fUL, 0x54f2af7cUL,
+    0x2d5c0e6eUL, 0x0b156693UL, 0x4f2eb119UL, 0x25646addUL,
+    0x18773379UL, 0x70678ae1UL, 0x70494e1dUL, 0x70bd347fUL,
+    0x74c17e3fUL, 0x43371722UL, 0x4b8ca24fUL, 0x5725c88aUL,
+    0x4a1616f3UL, 0x15034a6dUL, 0x55260245UL, 0x212529d5UL,
+    0x3aed7844UL, 0x49f5cfa3UL, 0x725fcee0UL, 0x1e70beaeUL,
+    0x6a985631UL, 0x1f69828eUL, 0x532f6812UL, 0x2daf6069UL,
+    0x64ad4d29UL, 0x555d6d60UL, 0x2c9550d5UL, 0x173bf7feUL,
+    0x23b01543UL, 0x79b32a67UL, 0x5654b90cUL, 0x14e21f75UL,
+    0x48fd1d09UL, 0x482600f4UL, 0x23b01543UL, 0x49021340UL,
+    0x684f8532UL, 0x7d7aed7eUL, 0x610cd850UL, 0x28be1c6dUL,
+    0x0fb3d31dUL, 0x29f2294dUL, 0x5166cbe2UL, 0x679e10caUL,
+    0x6bd7c35fUL, 0x447d2546UL, 0x0762e1e2UL, 0x5f7c381dUL,
+    0x3329461cUL, 0x15689749UL, 0x77f2f5f8UL, 0x087f482dUL,
+    0x68cd842aUL, 0x46a7526bUL, 0x75f62a6cUL, 0x282444adUL,
+    0x2c9550d5UL, 0x2ba6d4d2UL, 0x455f82a7UL, 0x5831e0b9UL,
+    0x4ee7e881UL, 0x677217b7UL, 0x28ab5f0eUL, 0x6941956dUL,
+    0x7ef05d64UL, 0x37583dedUL, 0x4d3b0447UL, 0x18ee97b8UL,
+    0x766d5d41UL, 0x7f57abfbUL, 0x43371722UL, 0x478757a5UL,
+    0x2f832ba3UL, 0x5dd856e2UL, 0x7b00a99dUL, 0x75d8e60aUL,
+    0x4d271dc5UL, 0x2d208eddUL, 0x19f816ecUL, 0x557a51b3UL,
+    0x34194342UL, 0x3dc1113aUL, 0x76e233eeUL, 0x2334f478UL,
+    0x4218498aUL, 0x6c883fd9UL, 0x4a1616f3UL, 0x2a14cbe0UL,
+    0x34754fb6UL, 0x39e72685UL, 0x3c74c9e0UL, 0x62421401UL,
+    0x2399cacaUL, 0x0880fb42UL, 0x04fc4a30UL, 0x1fc3135cUL,
+    0x5aae7a8eUL, 0x6eb05e99UL, 0x4a9a18a8UL, 0x0becd5cfUL,
+    0x25e8a814UL, 0x322bd2c2UL, 0x24b9c3f8UL, 0x3fb00070UL,
+    0x5f8c6734UL, 0x5ca32434UL, 0x50391bb3UL, 0x53a8b162UL,
+    0x22f19b97UL, 0x4b19214fUL, 0x79b32a67UL, 0x2875e067UL,
+    0x58d15e17UL, 0x70494e1dUL, 0x4b2430eaUL, 0x3329461cUL,
+    0x2d63c699UL, 0x2581dd63UL, 0x4413c031UL, 0x214375afUL,
+    0x125f0301UL, 0x42cd24bbUL, 0x043f93ffUL, 0x07eb74bcUL,
+    0x786bed4aUL, 0x290788c5UL, 0x7f87e7e2UL, 0x15689749UL,
+    0x04ef31cfUL, 0x47bfed6fUL, 0x43371722UL, 0x684f8532UL,
+    0x390e4abbUL, 0x320bbd3fUL, 0x3329461cUL, 0x5b085331UL,
+    0x32828a95UL, 0x6eb05e99UL, 0x2d5037aaUL, 0x26131c38UL,
+    0x58288e7eUL, 0x7b5877cbUL, 0x05bf4c97UL, 0x2a6b7a22UL,
+    0x79200950UL, 0x78e88dc7UL, 0x6a985631UL, 0x13ef9244UL,
+    0x6b3f069eUL, 0x4fcd0a42UL, 0x6d15a31dUL, 0x36cae829UL,
+    0x7cb7c094UL, 0x2f79dad9UL, 0x3f84b215UL, 0x0ca86f59UL,
+    0x3dc1113aUL, 0x7dec3a0cUL, 0x2f79dad9UL, 0x4b2430eaUL,
+    0x02078f11UL, 0x231f51a5UL, 0x232b9d10UL, 0x05ce5351UL,
+    0x233d7edaUL, 0x54537b01UL, 0x6d2a0a3bUL, 0x6d2a0a3bUL,
+    0x0e4b719cUL, 0x639f61d0UL, 0x447d2546UL, 0x3aed7844UL,
+    0x554b899aUL, 0x354f479cUL, 0x762bbab6UL, 0x2ddf2f89UL,
+    0x725bd675UL, 0x062e5061UL, 0x6435350cUL, 0x29f2294dUL,
+    0x1c68d895UL, 0x7aeea724UL, 0x3b4f7efcUL, 0x3b4f7efcUL,
+    0x71e3c09fUL, 0x11e49575UL, 0x725fcee0UL, 0x3a1a6cd2UL,
+    0x53a8b162UL, 0x6ba7f8cdUL, 0x381901ffUL, 0x582f5174UL,
+    0x4536402bUL, 0x7b9a5d1bUL, 0x2f832ba3UL, 0x7219eba8UL,
+    0x4fed1bb5UL, 0x11e49575UL, 0x57c013c5UL, 0x54f2af7cUL,
+    0x4d6d8dc7UL, 0x7d7aed7eUL, 0x450f63daUL, 0x3f84b215UL,
+    0x7c35dc4cUL, 0x0f8ca14fUL, 0x0c04d571UL, 0x5af76562UL,
+    0x7219eba8UL, 0x32e049d7UL, 0x78e88dc7UL, 0x31bcab16UL,
+    0x639f61d0UL, 0x75d8e60aUL, 0x11b1bc70UL, 0x53de5c24UL,
+    0x6b8c2682UL, 0x2dd8fcd6UL, 0x742bfcfdUL, 0x55740106UL,
+    0x70bd347fUL, 0x179db2eaUL, 0x3cdc14b2UL, 0x48fd1d09UL,
+    0x7a9325bbUL, 0x68cd842aUL, 0x214375afUL, 0x6d2a0a3bUL,
+    0x02f433f3UL, 0x529f2fd0UL, 0x1192ac6bUL, 0x7f57abfbUL,
+    0x097ab960UL, 0x764d653cUL, 0x26c5817dUL, 0x3ce94ac5UL,
+    0x54f2af7cUL, 0x0ec2252bUL, 0x39ee1922UL, 0x59b997faUL,
+    0x2b5d2814UL, 0x764ad1c7UL, 0x7d16bcffUL, 0x18ee97b8UL,
+    0x43f30183UL, 0x22543a8dUL, 0x569b2518UL, 0x3f84b215UL,
+    0x62421401UL, 0x76ba01ccUL, 0x3329461cUL, 0x695bfab9UL,
+    0x0b249e3eUL, 0x2e44bcb6UL, 0x7f57abfbUL, 0x0f75999aUL,
+    0x4dc46b46UL, 0x3c24ed53UL, 0x54e73461UL, 0x282444adUL,
+    0x69bbc145UL, 0x742bfcfdUL, 0x4738c814UL, 0x684f8532UL,
+    0x2d09d4caUL, 0x0b156693UL, 0x7c484350UL, 0x65644adcUL,
+    0x2027eb51UL, 0x39c7074bUL, 0x6ba7f8cdUL, 0x70a19087UL,
+    0x67b83a8cUL, 0x23b01543UL, 0x290b0d77UL, 0x43371722UL,
+    0x29f2294dUL, 0x764d653cUL, 0x47bfed6fUL, 0x39ee1922UL,
+    0x5dee6776UL, 0x6435350cUL, 0x11e49575UL, 0x2b5d2814UL,
+    0x77781811UL, 0x4ee7e881UL, 0x679e10caUL, 0x76651c07UL,
+    0x1ebe632eUL, 0x2c0c50c8UL, 0x64dd9ae1UL, 0x5f7c381dUL,
+    0x351280fcUL, 0x2f832ba3UL, 0x4dc46b46UL, 0x0ec2252bUL,
+    0x41ac43f9UL, 0x7d16bcffUL, 0x0b4481caUL, 0x2b007f71UL,
+    0x3329461cUL, 0x2e76a8a3UL, 0x75fa8204UL, 0x6b8c2682UL,
+    0x3d8536a4UL, 0x2daf6069UL, 0x786bed4aUL, 0x7aeea724UL,
+    0x45d803a9UL, 0x78e88dc7UL, 0x076b7aecUL, 0x320bbd3fUL,
+    0x59b997faUL, 0x48fd1d09UL, 0x5f650edbUL, 0x677217b7UL,
+    0x373f2a9bUL, 0x2e0e3f8bUL, 0x6a029a98UL, 0x3217f1a9UL,
+    0x70494e1dUL, 0x4b2430eaUL, 0x53de5c24UL, 0x2027eb51UL,
+    0x4c5e4332UL, 0x298a0c4dUL, 0x77781811UL, 0x1d5d4b53UL,
+    0x1322da61UL, 0x2daf6069UL, 0x74e6e5beUL, 0x31f7bfdfUL,
+    0x5dd856e2UL, 0x39ee1922UL, 0x77f2f5f8UL, 0x55740106UL,
+    0x71e3c09fUL, 0x6c883fd9UL, 0x2baaa18aUL, 0x373f2a9bUL,
+    0x5fdfe5f4UL, 0x43e7e837UL, 0x745fb25cUL, 0x7e67e972UL,
+    0x11f793d0UL, 0x2d5c0e6eUL, 0x30eb1e29UL, 0x290788c5UL,
+    0x55740106UL, 0x764d653cUL, 0x69dc46e3UL, 0x4a1616f3UL,
+    0x493bb82fUL, 0x798556f2UL, 0x764d653cUL, 0x77f2f5f8UL,
+    0x569b2518UL, 0x447d2546UL, 0x6254113dUL, 0x00b2d2afUL,
+    0x6dd25e40UL, 0x72ec7121UL, 0x3602d9d2UL, 0x6ede2597UL,
+    0x3ec9d12aUL, 0x587503a3UL, 0x1e75f849UL, 0x5dd856e2UL,
+    0x2581dd63UL, 0x45e912daUL, 0x58288e7eUL, 0x4b329f29UL,
+    0x4413c031UL, 0x6aac6e7fUL, 0x706f1101UL, 0x643426e6UL,
+    0x63058b49UL, 0x7c35dc4cUL, 0x649b077fUL, 0x2dd8fcd6UL,
+    0x194b43fdUL, 0x76e233eeUL, 0x7dec3a0cUL, 0x69dc46e3UL,
+    0x31bcab16UL, 0x15689749UL, 0x191420e3UL, 0x17a1bf9bUL,
+    0x4413c031UL, 0x5f8c6734UL, 0x503e53b5UL, 0x1d523ffeUL,
+    0x4f8d31e2UL, 0x2d5037aaUL, 0x298a0c4dUL, 0x7af6b2e9UL,
+    0x354f479cUL, 0x40c09e5fUL, 0x75fa8204UL, 0x478757a5UL,
+    0x0f1f10ccUL, 0x766d5d41UL, 0x6624f27bUL, 0x4912cfedUL,
+    0x706f1101UL, 0x74e6e5beUL, 0x53de4d47UL, 0x2a71d2c8UL,
+    0x20b1da3aUL, 0x20b1da3aUL, 0x75f7c8e9UL, 0x786bed4aUL,
+    0x639f61d0UL, 0x20b1da3aUL, 0x3cca7d24UL, 0x2118ccddUL,
+    0x7f57abfbUL, 0x0698e5d1UL, 0x2ba6d4d2UL, 0x6dd25e40UL,
+    0x043f93ffUL, 0x3fe32d68UL, 0x6a985631UL, 0x0d2e0ef8UL,
+    0x624c5a87UL, 0x22775f19UL, 0x11b1bc70UL, 0x39e72685UL,
+    0x231f51a5UL, 0x649b077fUL, 0x554b899aUL, 0x67b83a8cUL,
+    0x39e72685UL, 0x414c9800UL, 0x22d84b83UL, 0x3217f1a9UL,
+    0x6ede2597UL, 0x50f2c0f7UL, 0x5cbeec51UL, 0x79200950UL,
+    0x482600f4UL, 0x0becd5cfUL, 0x0fb782b2UL, 0x4d3b0447UL,
+    0x0b156693UL, 0x43e7e837UL, 0x2992c2a5UL, 0x61b96c2aUL,
+    0x4fed1bb5UL, 0x64ad4d29UL, 0x569b2518UL, 0x50f2c0f7UL,
+    0x0c77d346UL, 0x41f4b1daUL, 0x7c484350UL, 0x2e9ed57dUL,
+    0x233d7edaUL, 0x2d208eddUL, 0x2d09d4caUL, 0x4dc46b46UL,
+    0x4f2eb119UL, 0x351280fcUL, 0x46826adbUL, 0x0979dabbUL,
+    0x59b997faUL, 0x650b40b1UL, 0x2334f478UL, 0x6ede2597UL,
+    0x591fd4a1UL, 0x2e76a8a3UL, 0x24b9c3f8UL, 0x0eac09ddUL,
+    0x4f8d31e2UL, 0x08ea7cc5UL, 0x6a985631UL, 0x351280fcUL,
+    0x298a0c4dUL, 0x764ad1c7UL, 0x2e76a8a3UL, 0x24a2f025UL,
+    0x4d3b0447UL, 0x7b9a5d1bUL, 0x2a71d2c8UL, 0x7d16bcffUL,
+    0x786bed4aUL, 0x46826adbUL, 0x4dc46b46UL, 0x7b9a5d1bUL,
+    0x1192ac6bUL, 0x282444adUL, 0x5a0e332eUL, 0x7fc76a36UL,
+    0x34754fb6UL, 0x32e049d7UL, 0x68da9b7eUL, 0x6aac6e7fUL,
+    0x3217f1a9UL, 0x24b9c3f8UL, 0x2ed3f52eUL, 0x0762e1e2UL,
+    0x4bf2e767UL, 0x4d3b0447UL, 0x2baaa18aUL, 0x17a1bf9bUL,
+    0x557a51b3UL, 0x7c484350UL, 0x2118ccddUL, 0x09b981fdUL,
+    0x7aeea724UL, 0x042c35efUL, 0x554b899aUL, 0x0e4b719cUL,
+    0x792b1d53UL, 0x0ec2252bUL, 0x01db302aUL, 0x0b156693UL,
+    0x4a1616f3UL, 0x582f5174UL, 0x05ce5351UL, 0x643426e6UL,
+    0x39e72685UL, 0x2dd8fcd6UL, 0x7c484350UL, 0x076b7aecUL,
+    0x1e75f849UL, 0x6555b2feUL, 0x5de27d3fUL, 0x55d3a516UL,
+    0x36cae829UL, 0x764d653cUL, 0x0311fdeeUL, 0x555d6d60UL,
+    0x4978dc4bUL, 0x2573a28fUL, 0x7d16bcffUL, 0x4738c814UL,
+    0x29f2294dUL, 0x231f51a5UL, 0x7af6b2e9UL, 0x7b00a99dUL,
+    0x373f2a9bUL, 0x2399cacaUL, 0x233d7edaUL, 0x2a4175ebUL,
+    0x08dc322dUL, 0x0becd5cfUL, 0x7fc76a36UL, 0x22775f19UL,
+    0x2b007f71UL, 0x5599a4a7UL, 0x79b32a67UL, 0x745fb25cUL,
+    0x179db2eaUL, 0x33c7373fUL, 0x66e7a6f2UL, 0x2d208eddUL,
+    0x22bb294dUL, 0x290788c5UL, 0x2dd8fcd6UL, 0x5cbeec51UL,
+    0x0f8ca14fUL, 0x5c385a56UL, 0x798556f2UL, 0x1ca8445dUL,
+    0x591fd4a1UL, 0x55f03595UL, 0x194b43fdUL, 0x2abfafc6UL,
+    0x073c805cUL, 0x0b156693UL, 0x614ac005UL, 0x2f9acc2dUL,
+    0x5dd856e2UL, 0x2b007f71UL, 0x0c2d5a2fUL, 0x2f832ba3UL,
+    0x2a362d5aUL, 0x04ef31cfUL, 0x62421401UL, 0x4f2eb119UL,
+    0x22f19b97UL, 0x0ca86f59UL, 0x695bfab9UL, 0x6b8c2682UL,
+    0x2a2df274UL, 0x6d139a60UL, 0x70494e1dUL, 0x55260245UL,
+    0x233d7edaUL, 0x6254113dUL, 0x569b2518UL, 0x6c883fd9UL,
+    0x3d8536a4UL, 0x5cbeec51UL, 0x4eafdf9bUL, 0x4cfb5c89UL,
+    0x4a613771UL, 0x5166cbe2UL, 0x1e75f849UL, 0x1192ac6bUL,
+    0x4de964cbUL, 0x532f6812UL, 0x5f650edbUL, 0x2ed3f52eUL,
+    0x729864a9UL, 0x0d2e0ef8UL, 0x43371722UL, 0x179db2eaUL,
+    0x5f650edbUL, 0x373f2a9bUL, 0x2dd8fcd6UL, 0x695bfab9UL,
+    0x08ea7cc5UL, 0x0bb83c14UL, 0x08ea7cc5UL, 0x0496b65cUL,
+    0x36cae829UL, 0x0c04d571UL, 0x1be6f96aUL, 0x1ca8445dUL,
+    0x11f793d0UL, 0x69bbc145UL, 0x4eafdf9bUL, 0x322bd2c2UL,
+    0x02634728UL, 0x5166cbe2UL, 0x173bf7feUL, 0x538ff1aeUL,
+    0x2a2df274UL, 0x31bcab16UL, 0x762bbab6UL, 0x788e281aUL,
+    0x24b9c3f8UL, 0x117f5f15UL, 0x634241a6UL, 0x47bfed6fUL,
+    0x043f93ffUL, 0x11b1bc70UL, 0x79723adaUL, 0x4b329f29UL,
+    0x7ecc1696UL, 0x2992c2a5UL, 0x6f5d95b5UL, 0x32e049d7UL,
+    0x4d6d8dc7UL, 0x07eb74bcUL, 0x72228fc1UL, 0x798556f2UL,
+    0x15514740UL, 0x522002bbUL, 0x6254113dUL, 0x28b7770cUL,
+    0x4dc46b46UL, 0x522002bbUL, 0x294e907eUL, 0x52d5718fUL,
+    0x478757a5UL, 0x5305ec5aUL, 0x7a56b46dUL, 0x524cb84bUL,
+    0x75fa8204UL, 0x788e281aUL, 0x2581dd63UL, 0x729864a9UL,
+    0x5facd096UL, 0x6456ab09UL, 0x0b249e3eUL, 0x1ebe632eUL,
+    0x25646addUL, 0x57c013c5UL, 0x1322da61UL, 0x4b2430eaUL,
+    0x639f61d0UL, 0x0b156693UL, 0x75f7c8e9UL, 0x2baaa18aUL,
+    0x0b5da644UL, 0x679e10caUL, 0x233d7edaUL, 0x7f87e7e2UL,
+    0x1483c26aUL, 0x28b7770cUL, 0x212529d5UL, 0x1ca8445dUL,
+    0x63ed6df4UL, 0x54f2af7cUL, 0x01db302aUL, 0x1e70beaeUL,
+    0x4d3b0447UL, 0x55d3a516UL, 0x2f585f9eUL, 0x079ef651UL,
+    0x7aeea724UL, 0x2a7106aaUL, 0x7dec3a0cUL, 0x4738c814UL,
+    0x233d7edaUL, 0x7c880ca4UL, 0x35ccf5b8UL, 0x2a7106aaUL,
+    0x2d09d4caUL, 0x71634fc4UL, 0x6f5d95b5UL, 0x2f79dad9UL,
+    0x39c8425cUL, 0x28b7770cUL, 0x7e67e972UL, 0x11f793d0UL,
+    0x66e7a6f2UL, 0x7e658dacUL, 0x1322da61UL, 0x2a4175ebUL,
+    0x39e72685UL, 0x4f8d31e2UL, 0x290788c5UL, 0x4536402bUL,
+    0x3c24ed53UL, 0x655dbb39UL, 0x2c9550d5UL, 0x041e75afUL,
+    0x35bc871bUL, 0x655dbb39UL, 0x373f2a9bUL, 0x496b18b5UL,
+    0x57564c8aUL, 0x4536402bUL, 0x1ebe632eUL, 0x11e49575UL,
+    0x09b981fdUL, 0x488c1862UL, 0x2992c2a5UL, 0x6d139a60UL,
+    0x24a2f025UL, 0x2b5d2814UL, 0x610cd850UL, 0x7ef05d64UL,
+    0x4536402bUL, 0x679e10caUL, 0x53de5c24UL, 0x6f32e578UL,
+    0x75f7c8e9UL, 0x14a68807UL, 0x68cd842aUL, 0x02078f11UL,
+    0x5cbeec51UL, 0x4536402bUL, 0x4eafdf9bUL, 0x55d3a516UL,
+    0x233d7edaUL, 0x624c5a87UL, 0x66d963b9UL, 0x6115a974UL,
+    0x5dd2ccaaUL, 0x426e1746UL, 0x7b00a99dUL, 0x339a50edUL,
+    0x74c17e3fUL, 0x2e44bcb6UL, 0x79200950UL, 0x34194342UL,
+    0x4a99f904UL, 0x2ba6d4d2UL, 0x24b9c3f8UL, 0x66d963b9UL,
+    0x6f32e578UL, 0x339a50edUL, 0x1d53b4e3UL, 0x5b038e65UL,
+    0x2ed3f52eUL, 0x05bf4c97UL, 0x7d16bcffUL, 0x2f79dad9UL,
+    0x2a7106aaUL, 0x555d6d60UL, 0x2334f478UL, 0x7fc76a36UL,
+    0x5cbeec51UL, 0x14a68807UL, 0x410b7779UL, 0x79200950UL,
+    0x79b32a67UL, 0x290b0d77UL, 0x43f30183UL, 0x7c880ca4UL,
+    0x390e4abbUL, 0x1d1acda7UL, 0x13d52792UL, 0x0c77d346UL,
+    0x2b007f71UL, 0x26216e2fUL, 0x0f1f10ccUL, 0x410b7779UL,
+    0x36cae829UL, 0x09b981fdUL, 0x290b0d77UL, 0x013532aeUL,
+    0x11e49575UL, 0x67c6db73UL, 0x784ea879UL, 0x1322da61UL,
+    0x7c880ca4UL, 0x6a985631UL, 0x3217f1a9UL, 0x07eb74bcUL,
+    0x42af9feeUL, 0x46826adbUL, 0x0f1f10ccUL, 0x31f7bfdfUL,
+    0x5a0e332eUL, 0x05ce5351UL, 0x25e8a814UL, 0x5dd856e2UL,
+    0x63058b49UL, 0x70494e1dUL, 0x073c805cUL, 0x1192ac6bUL,
+    0x17d5a80dUL, 0x677217b7UL, 0x71f0f34aUL, 0x5b085331UL,
+    0x2d09d4caUL, 0x4a9a18a8UL, 0x5166cbe2UL, 0x69dc46e3UL,
+    0x72ec7121UL, 0x39c7074bUL, 0x2ddf2f89UL, 0x282444adUL,
+    0x4a99f904UL, 0x537c82f2UL, 0x6555b2feUL, 0x30eb1e29UL,
+    0x50f2c0f7UL, 0x290b0d77UL, 0x725bd675UL, 0x28ab5f0eUL,
+    0x7af6b2e9UL, 0x0698e5d1UL, 0x4f2eb119UL, 0x6d15a31dUL,
+    0x54537b01UL, 0x5ea54a3fUL, 0x232b9d10UL, 0x679e10caUL,
+    0x771b2119UL, 0x4cfb5c89UL, 0x684f8532UL, 0x78e88dc7UL,
+    0x67494b0dUL, 0x073c805cUL, 0x2118ccddUL, 0x798556f2UL,
+    0x2d208eddUL, 0x49f5cfa3UL, 0x624c5a87UL, 0x798dc87dUL,
+    0x140b513bUL, 0x58288e7eUL, 0x76651c07UL, 0x7a9325bbUL,
+    0x08dc322dUL, 0x47ea03adUL, 0x692789f7UL, 0x7e3353f1UL,
+    0x4218498aUL, 0x4b8b1e4cUL, 0x2dd8fcd6UL, 0x098c87b0UL,
+    0x59b997faUL, 0x7fc76a36UL, 0x3602d9d2UL, 0x2fe15b53UL,
+    0x7af6b2e9UL, 0x1d5d4b53UL, 0x2399cacaUL, 0x117f5f15UL,
+    0x43e7e837UL, 0x455f82a7UL, 0x46826adbUL, 0x537c82f2UL,
+    0x729864a9UL, 0x5831e0b9UL, 0x2e44bcb6UL, 0x351280fcUL,
+    0x450f63daUL, 0x34754fb6UL, 0x1c68d895UL, 0x0310ffc8UL,
+    0x7c880ca4UL, 0x2fe15b53UL, 0x410b7779UL, 0x4eafdf9bUL,
+    0x614ac005UL, 0x0698e5d1UL, 0x5cba8e51UL, 0x2dd8fcd6UL,
+    0x59b997faUL, 0x231f51a5UL, 0x788e281aUL, 0x59b997faUL,
+    0x40c09e5fUL, 0x5cbeec51UL, 0x2fe15b53UL, 0x493bb82fUL,
+    0x76651c07UL, 0x45e912daUL, 0x4218498aUL, 0x2a14cbe0UL,
+    0x2c9550d5UL, 0x02634728UL, 0x373f2a9bUL, 0x43f30183UL,
+    0x3fb00070UL, 0x2f79dad9UL, 0x6254113dUL, 0x125f0301UL,
+    0x41ac43f9UL, 0x194b43fdUL, 0x67c6db73UL, 0x65644adcUL,
+    0x4f2eb119UL, 0x119a03e9UL, 0x2ed3f52eUL, 0x140b513bUL,
+    0x7d6c688bUL, 0x6ab10818UL, 0x692789f7UL, 0x7d6c688bUL,
+    0x23b01543UL, 0x2ed3f52eUL, 0x7d6c688bUL, 0x35ccf5b8UL,
+    0x53a8b162UL, 0x4dc46b46UL, 0x2f55d717UL, 0x1df07f38UL,
+    0x7cb7c094UL, 0x32828a95UL, 0x39ee1922UL, 0x24169438UL,
+    0x4a9a18a8UL, 0x4a1616f3UL, 0x7cb7c094UL, 0x02634728UL,
+    0x587503a3UL, 0x63058b49UL, 0x26216e2fUL, 0x2a2df274UL,
+    0x643426e6UL, 0x6ba7f8cdUL, 0x7c880ca4UL, 0x639f61d0UL,
+    0x764d653cUL, 0x79723adaUL, 0x2b007f71UL, 0x4738c814UL,
+    0x7e8a12adUL, 0x5f650edbUL, 0x696420e7UL, 0x0310ffc8UL,
+    0x28be1c6dUL, 0x7a56b46dUL, 0x65644adcUL, 0x63ed6df4UL,
+    0x5cbeec51UL, 0x3c74c9e0UL, 0x18ee97b8UL, 0x792b1d53UL,
+    0x49d3b362UL, 0x3ddb9e56UL, 0x4b8b1e4cUL, 0x29f2294dUL,
+    0x75f62a6cUL, 0x39c7074bUL, 0x55d3a516UL, 0x0fb3d31dUL,
+    0x32828f7aUL, 0x4b8b1e4cUL, 0x455f82a7UL, 0x496b18b5UL,
+    0x745fb25cUL, 0x2daf6069UL, 0x69bbc145UL, 0x677217b7UL,
+    0x6a6be553UL, 0x0f1f10ccUL, 0x4eafdf9bUL, 0x679e10caUL,
+    0x6eb05e99UL, 0x07ce142fUL, 0x0ca86f59UL, 0x64dd9ae1UL,
+    0x75f62a6cUL, 0x39e72685UL, 0x0eac09ddUL, 0x5b085331UL,
+    0x478757a5UL, 0x24a2f025UL, 0x5beb574eUL, 0x75f7c8e9UL,
+    0x11b1bc70UL, 0x624c5a87UL, 0x35ccf5b8UL, 0x529f2fd0UL,
+    0x0c77d346UL, 0x0fb3d31dUL, 0x6c9f9b88UL, 0x532f6812UL,
+    0x4f8d31e2UL, 0x37583dedUL, 0x71f0f34aUL, 0x0f1f10ccUL,
+    0x17d5a80dUL, 0x706f1101UL, 0x012670f9UL, 0x764d653cUL,
+    0x2ddf2f89UL, 0x59b12c7eUL, 0x173bf7feUL, 0x0d2e0ef8UL,
+    0x4d3b0447UL, 0x5f7c381dUL, 0x0ca86f59UL, 0x0b5da644UL,
+    0x14e21f75UL, 0x2d09d4caUL, 0x2e0e3f8bUL, 0x7d6c688bUL,
+    0x32828a95UL, 0x0c2d5a2fUL, 0x0f1f10ccUL, 0x2399cacaUL,
+    0x6a6be553UL, 0x69bbc145UL, 0x013532aeUL, 0x75f7c8e9UL,
+    0x478757a5UL, 0x565f9b3cUL, 0x39c8425cUL, 0x05ce5351UL,
+    0x771b2119UL, 0x2ddf2f89UL, 0x6dd25e40UL, 0x78e88dc7UL,
+    0x39e72685UL, 0x29f2294dUL, 0x2ddf2f89UL, 0x53de4d47UL,
+    0x2f55d717UL, 0x6beb9b46UL, 0x2399cacaUL, 0x496b18b5UL,
+    0x2d09d4caUL, 0x7ef05d64UL, 0x610cd850UL, 0x079ef651UL,
+    0x5dd2ccaaUL, 0x31f7bfdfUL, 0x655dbb39UL, 0x3aed7844UL,
+    0x76744841UL, 0x59b12c7eUL, 0x322bd2c2UL, 0x079ef651UL,
+    0x5599a4a7UL, 0x67c6db73UL, 0x4a9a18a8UL, 0x2f832ba3UL,
+    0x695bfab9UL, 0x45e912daUL, 0x1d1acda7UL, 0x2d5037aaUL,
+    0x49f5cfa3UL, 0x6dd71033UL, 0x15689749UL, 0x18a164d0UL,
+    0x493bb82fUL, 0x48d71a06UL, 0x6eb05e99UL, 0x2e0e3f8bUL,
+    0x66d963b9UL, 0x290b0d77UL, 0x26c5817dUL, 0x2f9acc2dUL,
+    0x14e21f75UL, 0x65644adcUL, 0x5decb872UL, 0x48d71a06UL,
+    0x532f6812UL, 0x0b156693UL, 0x493bb82fUL, 0x4fed1bb5UL,
+    0x34194342UL, 0x339a50edUL, 0x5725c88aUL, 0x7c35dc4cUL,
+    0x1f69828eUL, 0x390e4abbUL, 0x2daf6069UL, 0x0d2e0ef8UL,
+    0x15689749UL, 0x25da18c3UL, 0x012670f9UL, 0x2c9550d5UL,
+    0x692789f7UL, 0x72ec7121UL, 0x13d52792UL, 0x18ee97b8UL,
+    0x11b1bc70UL, 0x2e76a8a3UL, 0x79200950UL, 0x46a7526bUL,
+    0x35bc871bUL, 0x041e75afUL, 0x6beb9b46UL, 0x522002bbUL,
+    0x5599a4a7UL, 0x4b19214fUL, 0x0b249e3eUL, 0x7ef05d64UL,
+    0x48ec55a2UL, 0x70bd347fUL, 0x706f1101UL, 0x290788c5UL,
+    0x70bd347fUL, 0x2abfafc6UL, 0x54f2af7cUL, 0x36a547d1UL,
+    0x67494b0dUL, 0x18773379UL, 0x52d5718fUL, 0x381901ffUL,
+    0x426e1746UL, 0x7e3353f1UL, 0x3c24ed53UL, 0x482600f4UL,
+    0x53de4d47UL, 0x0fdba50dUL, 0x2118ccddUL, 0x5dee6776UL,
+    0x2f55d717UL, 0x28be1c6dUL, 0x5a0e332eUL, 0x2c9550d5UL,
+    0x2d09d4caUL, 0x140b513bUL, 0x6a029a98UL, 0x45d803a9UL,
+    0x232b9d10UL, 0x79200950UL, 0x55d3a516UL, 0x75fa8204UL,
+    0x1ca8445dUL, 0x087f482dUL, 0x57f104d5UL, 0x2d09d4caUL,
+    0x6624f27bUL, 0x290b0d77UL, 0x7b00a99dUL, 0x6ba7f8cdUL,
+    0x31bcab16UL, 0x31f7bfdfUL, 0x20b1da3aUL, 0x5831e0b9UL,
+    0x6a6be553UL, 0x2e76a8a3UL, 0x5d1e8a16UL, 0x725fcee0UL,
+    0x0762e1e2UL, 0x42cd24bbUL, 0x48fd1d09UL, 0x764ad1c7UL,
+    0x2875e067UL, 0x23b01543UL, 0x7d6c688bUL, 0x15f87992UL,
+    0x7d16bcffUL, 0x59933a00UL, 0x49021340UL, 0x373f2a9bUL,
+    0x6aac6e7fUL, 0x0ec2252bUL, 0x209831f0UL, 0x2f585f9eUL,
+    0x71634fc4UL, 0x00effd26UL, 0x5e8f682fUL, 0x1483c26aUL,
+    0x31f7bfdfUL, 0x4536402bUL, 0x07ce142fUL, 0x09b981fdUL,
+    0x76744841UL, 0x5166cbe2UL, 0x3f84b215UL, 0x72ec7121UL,
+    0x1ebe632eUL, 0x1192ac6bUL, 0x32828a95UL, 0x4d271dc5UL,
+    0x1ca8445dUL, 0x2b5d2814UL, 0x05bf4c97UL, 0x45e912daUL,
+    0x6115a974UL, 0x7a9325bbUL, 0x28ab5f0eUL, 0x6ab10818UL,
+    0x792b1d53UL, 0x35ccf5b8UL, 0x49021340UL, 0x68cd842aUL,
+    0x15f87992UL, 0x42cd24bbUL, 0x649b077fUL, 0x582f5174UL,
+    0x2fe15b53UL, 0x320bbd3fUL, 0x6d15a31dUL, 0x0af44d2dUL,
+    0x7a9325bbUL, 0x214375afUL, 0x634241a6UL, 0x3ec9d12aUL,
+    0x3f84b215UL, 0x565f9b3cUL, 0x79723adaUL, 0x74e6e5beUL,
+    0x76744841UL, 0x53de5c24UL, 0x125f0301UL, 0x6555b2feUL,
+    0x414c9800UL, 0x194b43fdUL, 0x76e233eeUL, 0x55f03595UL,
+    0x4413c031UL, 0x798556f2UL, 0x22543a8dUL, 0x65644adcUL,
+    0x50078241UL, 0x2e9ed57dUL, 0x538ff1aeUL, 0x4f2eb119UL,
+    0x76ba01ccUL, 0x30eb1e29UL, 0x649b077fUL, 0x199f0ba0UL,
+    0x4b8b1e4cUL, 0x15034a6dUL, 0x71f0f34aUL, 0x0eac09ddUL,
+    0x25646addUL, 0x7b7bccc1UL, 0x4f2eb119UL, 0x64dd9ae1UL,
+    0x496b18b5UL, 0x5cbeec51UL, 0x76744841UL, 0x53de4d47UL,
+    0x6f838e66UL, 0x3a1a6cd2UL, 0x6ab10818UL, 0x290788c5UL,
+    0x191420e3UL, 0x470651e4UL, 0x55d3a516UL, 0x043f93ffUL,
+    0x36cae829UL, 0x70a19087UL, 0x49021340UL, 0x34754fb6UL,
+    0x05ce5351UL, 0x49f5cfa3UL, 0x6dd25e40UL, 0x4f2eb119UL,
+    0x26131c38UL, 0x1483c26aUL, 0x67a3797fUL, 0x11f793d0UL,
+    0x798556f2UL, 0x194b43fdUL, 0x5654b90cUL, 0x062e5061UL,
+    0x6a985631UL, 0x482600f4UL, 0x7dec3a0cUL, 0x3ec9d12aUL,
+    0x529f2fd0UL, 0x4dc46b46UL, 0x39c8425cUL, 0x194b43fdUL,
+    0x57564c8aUL, 0x3329461cUL, 0x5a0e332eUL, 0x45d84772UL,
+    0x7a9325bbUL, 0x71e3c09fUL, 0x2a6b7a22UL, 0x643426e6UL,
+    0x488c1862UL, 0x7aeea724UL, 0x410b7779UL, 0x2b007f71UL,
+    0x6254113dUL, 0x6b3f069eUL, 0x7aeea724UL, 0x59b12c7eUL,
+    0x71f0f34aUL, 0x1288799aUL, 0x5dd2ccaaUL, 0x28b7770cUL,
+    0x57f104d5UL, 0x5166cbe2UL, 0x7c880ca4UL, 0x54537b01UL,
+    0x37648987UL, 0x4f2eb119UL, 0x0d2e0ef8UL, 0x6d139a60UL,
+    0x5de27d3fUL, 0x2992c2a5UL, 0x7d16bcffUL, 0x02078f11UL,
+    0x2dd8fcd6UL, 0x4b19214fUL, 0x50391bb3UL, 0x4b329f29UL,
+    0x3b4f7efcUL, 0x70494e1dUL, 0x322bd2c2UL, 0x568c7d5cUL,
+    0x2118ccddUL, 0x67a3797fUL, 0x042c35efUL, 0x15689749UL,
+    0x70bd347fUL, 0x53de4d47UL, 0x28b7770cUL, 0x0c6c2ef9UL,
+    0x2a14cbe0UL, 0x2abfafc6UL, 0x7aeea724UL, 0x684f8532UL,
+    0x57c013c5UL, 0x5725c88aUL, 0x529f2fd0UL, 0x32f8c540UL,
+    0x6f838e66UL, 0x7d6c688bUL, 0x1d1acda7UL, 0x1ca8445dUL,
+    0x538ff1aeUL, 0x4f8d31e2UL, 0x0b4481caUL, 0x554b899aUL,
+    0x0fb782b2UL, 0x455f82a7UL, 0x3c74c9e0UL, 0x5654b90cUL,
+    0x684f8532UL, 0x2d63c699UL, 0x49f5cfa3UL, 0x199f0ba0UL,
+    0x40c09e5fUL, 0x05ce5351UL, 0x6f838e66UL, 0x5fdfe5f4UL,
+    0x14a68807UL, 0x643426e6UL, 0x4738c814UL, 0x77781811UL,
+    0x7e67e972UL, 0x117f5f15UL, 0x7cb7c094UL, 0x624c5a87UL,
+    0x529f2fd0UL, 0x6bd7c35fUL, 0x14a68807UL, 0x2a6b7a22UL,
+    0x3aed7844UL, 0x05ce5351UL, 0x53de5c24UL, 0x15514740UL,
+    0x6c883fd9UL, 0x04ef31cfUL, 0x77f2f5f8UL, 0x2ddf2f89UL,
+    0x478757a5UL, 0x634241a6UL, 0x79b32a67UL, 0x2ddf2f89UL,
+    0x554b899aUL, 0x447d2546UL, 0x15034a6dUL, 0x26131c38UL,
+    0x2d208eddUL, 0x64dd9ae1UL, 0x3ce94ac5UL, 0x7e67e972UL,
+    0x76651c07UL, 0x4fcd0a42UL, 0x30eb1e29UL, 0x0b4481caUL,
+    0x30eb1e29UL, 0x50391bb3UL, 0x684f8532UL, 0x63058b49UL,
+    0x5166cbe2UL, 0x6b68347eUL, 0x098c87b0UL, 0x0e4b719cUL,
+    0x1e75f849UL, 0x0ca86f59UL, 0x34194342UL, 0x298a0c4dUL,
+    0x2d63c699UL, 0x2e76a8a3UL, 0x3cdc14b2UL, 0x78e88dc7UL,
+    0x692789f7UL, 0x69bbc145UL, 0x0c77d346UL, 0x3b4f7efcUL,
+    0x02f433f3UL, 0x5dee6776UL, 0x32f8c540UL, 0x2c0c50c8UL,
+    0x18ee97b8UL, 0x01db302aUL, 0x48ec55a2UL, 0x3abc8ffcUL,
+    0x48fd1d09UL, 0x2ddf2f89UL, 0x1d5d4b53UL, 0x45e912daUL,
+    0x14e21f75UL, 0x55d3a516UL, 0x49021340UL, 0x1ca8445dUL,
+    0x496b18b5UL, 0x43f30183UL, 0x764d653cUL, 0x4bf2e767UL,
+    0x44ebc2edUL, 0x39ee1922UL, 0x762bbab6UL, 0x53de4d47UL,
+    0x58288e7eUL, 0x31f7bfdfUL, 0x01db302aUL, 0x72228fc1UL,
+    0x214375afUL, 0x0af44d2dUL, 0x119a03e9UL, 0x1df07f38UL,
+    0x3329461cUL, 0x76651c07UL, 0x6b8c2682UL, 0x55d3a516UL,
+    0x450f63daUL, 0x742bfcfdUL, 0x36cae829UL, 0x15034a6dUL,
+    0x568c7d5cUL, 0x2d208eddUL, 0x0fb782b2UL, 0x6ede2597UL,
+    0x71634fc4UL, 0x71f0f34aUL, 0x7dec3a0cUL, 0x649b077fUL,
+    0x076b7aecUL, 0x15689749UL, 0x4dc46b46UL, 0x3cdc14b2UL,
+    0x2baaa18aUL, 0x582f5174UL, 0x614ac005UL, 0x17d5a80dUL,
+    0x1e75f849UL, 0x097ab960UL, 0x45d84772UL, 0x455f82a7UL,
+    0x69bbc145UL, 0x5cba8e51UL, 0x78e88dc7UL, 0x762bbab6UL,
+    0x7c880ca4UL, 0x0fb3d31dUL, 0x493bb82fUL, 0x3217f1a9UL,
+    0x77f2f5f8UL, 0x2875e067UL, 0x1288799aUL, 0x53a8b162UL,
+    0x4cfb5c89UL, 0x2d5037aaUL, 0x02634728UL, 0x5fdfe5f4UL,
+    0x1fc3135cUL, 0x79723adaUL, 0x7f87e7e2UL, 0x66e7a6f2UL,
+    0x11f793d0UL, 0x587503a3UL, 0x24a2f025UL, 0x5decb872UL,
+    0x294e907eUL, 0x4d271dc5UL, 0x57f104d5UL, 0x5b085331UL,
+    0x2d208eddUL, 0x117f5f15UL, 0x24b9c3f8UL, 0x52d5718fUL,
+    0x339a50edUL, 0x5facd096UL, 0x55f03595UL, 0x13d52792UL,
+    0x798dc87dUL, 0x02078f11UL, 0x26c5817dUL, 0x2daf6069UL,
+    0x32e049d7UL, 0x07ce142fUL, 0x2875e067UL, 0x0311fdeeUL,
+    0x48d71a06UL, 0x19f816ecUL, 0x470651e4UL, 0x194b43fdUL,
+    0x5e8f682fUL, 0x45e912daUL, 0x173bf7feUL, 0x20b1da3aUL,
+    0x2a7106aaUL, 0x59b997faUL, 0x25646addUL, 0x26131c38UL,
+    0x4d271dc5UL, 0x44ebc2edUL, 0x532f6812UL, 0x63058b49UL,
+    0x5dd856e2UL, 0x05bf4c97UL, 0x1df07f38UL, 0x7c484350UL,
+    0x35bc871bUL, 0x231f51a5UL, 0x6beb9b46UL, 0x5ca32434UL,
+    0x65644adcUL, 0x233d7edaUL, 0x762bbab6UL, 0x3ddb9e56UL,
+    0x2992c2a5UL, 0x3dc1113aUL, 0x35ccf5b8UL, 0x07eb74bcUL,
+    0x0762e1e2UL, 0x24169438UL, 0x6f838e66UL, 0x6eb2b149UL,
+    0x25da18c3UL, 0x4c5e4332UL, 0x3cdc14b2UL, 0x02078f11UL,
+    0x4c5e4332UL, 0x7e3353f1UL, 0x24169438UL, 0x05ce5351UL,
+    0x36a547d1UL, 0x2f79dad9UL, 0x5f22316dUL, 0x54f2af7cUL,
+    0x6f838e66UL, 0x23b01543UL, 0x4978dc4bUL, 0x6f5d95b5UL,
+    0x67b83a8cUL, 0x5ca32434UL, 0x1ebe632eUL, 0x37648987UL,
+    0x042c35efUL, 0x5decb872UL, 0x210de025UL, 0x6115a974UL,
+    0x7af6b2e9UL, 0x650b40b1UL, 0x587503a3UL, 0x5320536cUL,
+    0x0c6c2ef9UL, 0x786bed4aUL, 0x5aec5d47UL, 0x6aac6e7fUL,
+    0x762bbab6UL, 0x75f62a6cUL, 0x59b997faUL, 0x0b4481caUL,
+    0x591fd4a1UL, 0x24169438UL, 0x370364a9UL, 0x0fb782b2UL,
+    0x0fb782b2UL, 0x26c5817dUL, 0x4218498aUL, 0x5c385a56UL,
+    0x798556f2UL, 0x25e8a814UL, 0x11e49575UL, 0x2baaa18aUL,
+    0x58ff35a7UL, 0x6a029a98UL, 0x6c883fd9UL, 0x7e3353f1UL,
+    0x47ea03adUL, 0x7343ea78UL, 0x22bb294dUL, 0x02634728UL,
+    0x75d8e60aUL, 0x788e281aUL, 0x23b01543UL, 0x18773379UL,
+    0x04fc4a30UL, 0x3d8536a4UL, 0x42cd24bbUL, 0x0b5da644UL,
+    0x53de4d47UL, 0x42cd24bbUL, 0x2992c2a5UL, 0x6941956dUL,
+    0x7b7bccc1UL, 0x62421401UL, 0x5fdfe5f4UL, 0x50391bb3UL,
+    0x65f8c1ccUL, 0x0f1f10ccUL, 0x482600f4UL, 0x68c361c9UL,
+    0x771b2119UL, 0x5320536cUL, 0x3abc8ffcUL, 0x1f69828eUL,
+    0x6eb2b149UL, 0x7e82c2d5UL, 0x4413c031UL, 0x58288e7eUL,
+    0x3aed7844UL, 0x26216e2fUL, 0x2ba6d4d2UL, 0x7e82c2d5UL,
+    0x4b8b1e4cUL, 0x4b19214fUL, 0x14a68807UL, 0x11e49575UL,
+    0x2d5037aaUL, 0x5166cbe2UL, 0x076b7aecUL, 0x6f838e66UL,
+};
@@ -0,0 +1,325 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines NUM_ADDRS and addrs[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// Nodes in the persistent pool, including the head (the default route)
+#ifndef POOL_SIZE
+#define POOL_SIZE 1024
+#endif
+
+// Lookups per task execution. A batch ends early at the first lookup that
+// misses, since the miss inserts a node.
+#ifndef BATCH_SIZE
+#define BATCH_SIZE 16
+#endif
+
+#define HEAD 0
+#define NO_LINK 0xffff
+
+// The mask of the routes inserted by patricia_test.c
+#define HOST_MASK 0xffffffffUL
+
+/** @brief Node of the trie, allocated from the persistent pool
+ *  @details The node of patricia.h with a single mask, since the benchmark
+ *           inserts host routes only, and pool indices in place of pointers.
+ *           A node has no payload: the lookup result is the node itself.
+ */
+typedef struct {
+    uint32_t key;
+    uint32_t mask;
+    uint16_t left;
+    uint16_t right;
+    int8_t b;           // bit to check
+} pnode_t;
+
+/** @brief Pointer of an existing node to set to a new node
+ *  @details Inserting a node writes the node into the first free slot of the
+ *           pool, where nothing refers to it yet, and then changes exactly one
+ *           pointer of the trie. The insert commits by writing this link to
+ *           the self channel together with the new pool size; the next
+ *           execution sets the pointer before anything reads the trie. Both
+ *           writes set fixed values, so repeating them after a power failure
+ *           is harmless, and the trie is never seen half-linked.
+ */
+typedef struct {
+    uint16_t node;      // node whose pointer to set, NO_LINK if none
+    uint16_t child;     // new value of the pointer
+    uint16_t right;     // set the right pointer, else the left one
+} link_t;
+
+typedef enum {
+    PATRICIA_INSERT = 0,    // look up each address, insert it if missing
+    PATRICIA_VERIFY,        // look up each address again, all must be found
+} patricia_phase_t;
+
+typedef struct {
+    uint16_t phase;     // patricia_phase_t
+    uint16_t next;      // next address to look up
+    uint16_t nodes;     // nodes allocated from the pool
+    uint16_t found;
+    uint16_t inserted;
+    link_t link;
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_patricia)
+TASK(3, bench_fail)
+TASK(4, bench_success)
+
+struct patricia_args {
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct patricia_state {
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_patricia_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_patricia, patricia_args);
+SELF_CHANNEL(task_patricia, patricia_state);
+
+/* Nodes at or above the committed pool size are unreachable, so only a task
+ * about to commit an insert writes them (see link_t). */
+__nv static pnode_t pool[POOL_SIZE];
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+static uint32_t bit(int i, uint32_t key) {
+    return key & (1UL << (31 - i));
+}
+
+static uint16_t child(const pnode_t *t, uint32_t key) {
+    return bit(t->b, key) ? t->right : t->left;
+}
+
+/** @brief Longest-prefix match of a key (pat_search)
+ *  @return Index of the node of the longest matching prefix
+ */
+static uint16_t pat_search(uint32_t key) {
+    uint16_t p = HEAD, t = HEAD;
+    int i;
+
+    do {
+        if (pool[t].key == (key & pool[t].mask))
+            p = t;
+        i = pool[t].b;
+        t = child(&pool[t], key);
+    } while (i < pool[t].b);
+
+    return (pool[t].key == (key & pool[t].mask)) ? t : p;
+}
+
+/** @brief Prepare the insert of a key into free slot n (pat_insert)
+ *  @details Fills in the new node and returns the link that attaches it, the
+ *           iterative form of insertR: going down from the head, the new node
+ *           goes in between the first node that tests a later bit than the
+ *           first differing one, or that points back up, and its parent.
+ *  @return  The link, or node NO_LINK if the key is already in the trie
+ */
+static link_t pat_insert(uint32_t key, uint16_t n) {
+    link_t link = { .node = NO_LINK };
+    uint16_t h, p;
+    int i, d;
+
+    key &= HOST_MASK;
+
+    // Find closest matching leaf node
+    h = HEAD;
+    do {
+        i = pool[h].b;
+        h = child(&pool[h], key);
+    } while (i < pool[h].b);
+
+    if (pool[h].key == key)
+        return link;
+
+    // Find the first bit that differs
+    for (d = 1; d < 32 && bit(d, key) == bit(d, pool[h].key); d++);
+
+    p = HEAD;
+    h = child(&pool[p], key);
+    while (pool[h].b < d && pool[h].b > pool[p].b) {
+        p = h;
+        h = child(&pool[p], key);
+    }
+
+    pool[n].key = key;
+    pool[n].mask = HOST_MASK;
+    pool[n].b = d;
+    pool[n].left = bit(d, key) ? h : n;
+    pool[n].right = bit(d, key) ? n : h;
+
+    link.node = p;
+    link.child = n;
+    link.right = bit(pool[p].b, key) ? 1 : 0;
+    return link;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit\r\n");
+
+    progress_t prog = { .phase = PATRICIA_INSERT, .nodes = 1,
+                        .link = { .node = NO_LINK } };
+
+    // The head is the default route: key 0.0.0.0, mask 0, pointing to itself
+    pool[HEAD].key = 0;
+    pool[HEAD].mask = 0;
+    pool[HEAD].b = 0;
+    pool[HEAD].left = HEAD;
+    pool[HEAD].right = HEAD;
+
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_patricia));
+    TRANSITION_TO(task_patricia);
+}
+
+/* Looks up a batch of addresses per execution, in the order of the trace */
+void task_patricia() {
+    task_prologue();
+
+    progress_t prog;
+    uint32_t key;
+    uint16_t t, end;
+    link_t link;
+
+    prog = *CHAN_IN2(progress_t, prog,
+            CH(task_init, task_patricia), SELF_IN_CH(task_patricia));
+
+    // Finish the insert committed by the previous execution
+    if (prog.link.node != NO_LINK) {
+        if (prog.link.right)
+            pool[prog.link.node].right = prog.link.child;
+        else
+            pool[prog.link.node].left = prog.link.child;
+        prog.link.node = NO_LINK;
+    }
+
+    end = prog.next + BATCH_SIZE;
+    if (end > NUM_ADDRS)
+        end = NUM_ADDRS;
+
+    switch (prog.phase) {
+        case PATRICIA_INSERT:
+            while (prog.next < end) {
+                key = addrs[prog.next++];
+                t = pat_search(key);
+                if (pool[t].key == key) {
+                    LOG("%04x%04x: Found.\r\n", (unsigned)(key >> 16),
+                        (unsigned)key);
+                    prog.found++;
+                    continue;
+                }
+
+                if (prog.nodes == POOL_SIZE) {
+                    PRINTF("Node pool full after %u lookups\r\n", prog.next);
+                    TRANSITION_TO(bench_fail);
+                }
+                link = pat_insert(key, prog.nodes);
+                if (link.node == NO_LINK)
+                    continue;
+                prog.link = link;
+                prog.nodes++;
+                prog.inserted++;
+                break;
+            }
+
+            if (prog.next == NUM_ADDRS) {
+                prog.phase = PATRICIA_VERIFY;
+                prog.next = 0;
+            }
+            break;
+
+        case PATRICIA_VERIFY:
+            for ( ; prog.next < end; ++prog.next) {
+                key = addrs[prog.next];
+                if (pool[pat_search(key)].key != key) {
+                    PRINTF("Lost address %u: %04x%04x\r\n", prog.next,
+                           (unsigned)(key >> 16), (unsigned)key);
+                    TRANSITION_TO(bench_fail);
+                }
+            }
+            if (prog.next < NUM_ADDRS)
+                break;
+
+            LOG("success\r\n");
+            PRINTF("cycles: %n\r\n", msp_cycles());
+            PRINTF("Looked up %u addresses: %u found, %u inserted.\r\n",
+                   NUM_ADDRS, prog.found, prog.inserted);
+            PRINTF("Pool: %u of %u nodes.\r\n", prog.nodes, POOL_SIZE);
+            CHAIN_REPORT();
+            TRANSITION_TO(bench_success);
+    }
+
+    CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_patricia));
+    TRANSITION_TO(task_patricia);
+}
+
+// Blink LED1 on failure
+void bench_fail() {
+    task_prologue();
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_1, OUT) &= ~BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_fail);
+}
+
+// Blink LED2 on success
+void bench_success() {
+    task_prologue();
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_success);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): addresses looked
+# up, at most 2048 (the whole trace)
+SIZE_small = 512
+SIZE_medium = 1024
+SIZE_large = 2048
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
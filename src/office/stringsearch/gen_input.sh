@@ -0,0 +1,61 @@
+#! /bin/bash
+#
+# Generate input.h: the first bytes of the MiBench sha input text, the
+# patterns to search for in it, and the number of times each occurs (counted
+# by grep, without overlaps, as the benchmark counts them)
+#
+# Usage: ./gen_input.sh [bytes] [input_small.asc] > input.h
+
+BYTES=${1:-4096}
+INPUT=${2:-../../../mibench-src/security/sha/input_small.asc}
+
+# As in mibench-src/office/stringsearch/runme_small.sh. A pattern has no
+# newline, so no match spans two lines, and no more than 255 characters.
+PATTERNS=("sensor" "battery voltage" "error" "packet was" "tag reader" "ok."
+          "the" "a" "node" "temperature" "timeout" "reading of" "humidity"
+          "sample" "log reader" "voltage 1")
+
+TEXT=$(mktemp)
+trap "rm -f $TEXT" EXIT
+head -c $BYTES $INPUT > $TEXT
+
+echo "/* Generated by gen_input.sh from MiBench sha input_small.asc */"
+echo ""
+echo "#define NUM_PATTERNS ${#PATTERNS[@]}"
+echo ""
+echo "__ro_nv static const char * const patterns[NUM_PATTERNS] = {"
+for p in "${PATTERNS[@]}"; do
+    echo "    \"$p\","
+done
+echo "};"
+echo ""
+echo "__ro_nv static const uint16_t expected[NUM_PATTERNS] = {"
+for p in "${PATTERNS[@]}"; do
+    echo "    $(grep -o -F -- "$p" $TEXT | wc -l),"
+done
+echo "};"
+echo ""
+
+od -An -v -tu1 $TEXT | awk '
+    {
+        for (f = 1; f <= NF; ++f) {
+            if (n % 12 == 0)
+                line = "   "
+            line = line sprintf(" 0x%02x,", $f)
+            if (n % 12 == 11) {
+                body = body line "\n"
+                line = ""
+            }
+            ++n
+        }
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define TEXT_BYTES " n "U"
+        print ""
+        print "__ro_nv static const uint8_t text[TEXT_BYTES] = {"
+        printf "%s", body
+        print "};"
+    }
+'
@@ -0,0 +1,297 @@
+#include <msp430.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines NUM_PATTERNS, patterns[], expected[], TEXT_BYTES and text[], see
+// gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Positions of the text tried as the start of a match per task execution
+#ifndef SCAN_BYTES
+#define SCAN_BYTES 256
+#endif
+
+#define NO_MATCH 0xffff
+#define NO_PATTERN 0xff
+
+typedef enum {
+    SEARCH_TABLES = 0,  // build the skip table of each pattern
+    SEARCH_SCAN,        // count the matches of each pattern in the text
+} search_phase_t;
+
+typedef struct {
+    uint16_t phase;     // search_phase_t
+    uint16_t pattern;
+    uint16_t pos;       // first position of the text not searched yet
+    uint16_t matches;   // of the pattern, before pos
+    uint16_t rebuilds;  // skip tables built during the scan
+    uint32_t cycles;    // cycles of the executions that committed
+    uint32_t table_cycles;
+    uint16_t count[NUM_PATTERNS];
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_search)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct search_args {
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct search_state {
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_search_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_search, search_args);
+SELF_CHANNEL(task_search, search_state);
+CHANNEL(task_search, task_done, search_args);
+
+#ifdef STRINGSEARCH_TABLES_BOOT
+/* Skip table of the current pattern in SRAM, as bmh_init() keeps it. SRAM is
+ * lost on a power failure, so the table is built again on each boot, and on
+ * each change of pattern. */
+__sram static uint8_t skip_sram[256];
+__sram static uint8_t skip_pattern;
+#else
+/* Skip tables of all patterns, built once in FRAM and kept across power
+ * failures. A table depends only on its pattern, so a restarted execution
+ * writes the same values. */
+__nv static uint8_t skip[NUM_PATTERNS][256];
+#endif
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/** @brief Build the skip table of a pattern (bmh_init)
+ *  @details The shift of the window when its last character is c: the
+ *           distance from the last occurrence of c in the pattern, not
+ *           counting its last character, to the end of the pattern. The
+ *           shift after a mismatch at the last character of the pattern is
+ *           the fixed second shift of bmh_init (skip2), so one table of
+ *           bytes does for both.
+ */
+static void bmh_init(uint8_t *table, const char *pattern) {
+    const uint8_t *pat = (const uint8_t *)pattern;
+    unsigned len = strlen(pattern), i;
+
+    for (i = 0; i < 256; ++i)
+        table[i] = len;
+    for (i = 0; i + 1 < len; ++i)
+        table[pat[i]] = len - 1 - i;
+}
+
+/** @brief First match of a pattern that starts in [from, to - len]
+ *  @return Position of the match, NO_MATCH if none
+ */
+static uint16_t bmh_search(const uint8_t *table, const char *pattern,
+                           uint16_t from, uint16_t to) {
+    const uint8_t *pat = (const uint8_t *)pattern;
+    unsigned len = strlen(pattern), last = len - 1;
+    uint16_t i = from;
+    int j;
+
+    while (i + len <= to) {
+        if (text[i + last] == pat[last]) {
+            for (j = last - 1; j >= 0 && text[i + j] == pat[j]; --j)
+                ;
+            if (j < 0)
+                return i;
+        }
+        i += table[text[i + last]];
+    }
+    return NO_MATCH;
+}
+
+static const uint8_t *skip_table(progress_t *prog) {
+#ifdef STRINGSEARCH_TABLES_BOOT
+    if (skip_pattern != prog->pattern) {
+        bmh_init(skip_sram, patterns[prog->pattern]);
+        skip_pattern = prog->pattern;
+        prog->rebuilds++;
+    }
+    return skip_sram;
+#else
+    return skip[prog->pattern];
+#endif
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+#ifdef STRINGSEARCH_TABLES_BOOT
+    skip_pattern = NO_PATTERN;
+#endif
+    ++boots;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u patterns, %u bytes\r\n", NUM_PATTERNS, TEXT_BYTES);
+
+#ifdef STRINGSEARCH_TABLES_BOOT
+    progress_t prog = { .phase = SEARCH_SCAN };
+#else
+    progress_t prog = { .phase = SEARCH_TABLES };
+#endif
+
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_search));
+    TRANSITION_TO(task_search);
+}
+
+/* Builds one skip table, or searches one window of the text for a pattern */
+void task_search() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    progress_t prog;
+    const uint8_t *table;
+    uint16_t len, end, match;
+
+    prog = *CHAN_IN2(progress_t, prog, CH(task_init, task_search),
+                     SELF_IN_CH(task_search));
+
+    switch (prog.phase) {
+#ifndef STRINGSEARCH_TABLES_BOOT
+        case SEARCH_TABLES:
+            bmh_init(skip[prog.pattern], patterns[prog.pattern]);
+            prog.table_cycles += msp_cycles() - start;
+            if (++prog.pattern == NUM_PATTERNS) {
+                prog.phase = SEARCH_SCAN;
+                prog.pattern = 0;
+            }
+            break;
+#endif
+
+        case SEARCH_SCAN:
+            // The window holds the matches that start in the next SCAN_BYTES
+            // positions, so the next window starts len - 1 bytes before its
+            // end, unless a match covers them
+            table = skip_table(&prog);
+            len = strlen(patterns[prog.pattern]);
+            end = TEXT_BYTES;
+            if (TEXT_BYTES - prog.pos > SCAN_BYTES + len - 1)
+                end = prog.pos + SCAN_BYTES + len - 1;
+
+            while ((match = bmh_search(table, patterns[prog.pattern],
+                                       prog.pos, end)) != NO_MATCH) {
+                prog.matches++;
+                prog.pos = match + len;
+            }
+            if (end < TEXT_BYTES && prog.pos < end - (len - 1))
+                prog.pos = end - (len - 1);
+            prog.cycles += msp_cycles() - start;
+
+            if (end < TEXT_BYTES)
+                break;
+
+            LOG("\"%s\" found %u times\r\n", patterns[prog.pattern],
+                prog.matches);
+            prog.count[prog.pattern] = prog.matches;
+            prog.matches = 0;
+            prog.pos = 0;
+            if (++prog.pattern == NUM_PATTERNS) {
+                CHAN_OUT1(progress_t, prog, prog, CH(task_search, task_done));
+                TRANSITION_TO(task_done);
+            }
+            break;
+    }
+
+    CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_search));
+    TRANSITION_TO(task_search);
+}
+
+/* Prints the count of each pattern, and the scan throughput over the cycles
+ * of the task executions that committed, which excludes the work lost to
+ * power failures */
+void task_done() {
+    task_prologue();
+
+    progress_t prog = *CHAN_IN1(progress_t, prog, CH(task_search, task_done));
+    unsigned i, ok = 1;
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    for (i = 0; i < NUM_PATTERNS; ++i) {
+        PRINTF("\"%s\" found %u times\r\n", patterns[i], prog.count[i]);
+        if (prog.count[i] != expected[i])
+            ok = 0;
+    }
+
+#ifdef STRINGSEARCH_TABLES_BOOT
+    PRINTF("tables: in SRAM, %u built\r\n", prog.rebuilds);
+#else
+    PRINTF("tables: in FRAM, Cycles %n\r\n",
+           (unsigned long)prog.table_cycles);
+#endif
+    PRINTF("scan: %u bytes per task, Cycles %n\r\n", SCAN_BYTES,
+           (unsigned long)prog.cycles);
+    PRINTF("bytes/s: %n at %n Hz, over %u boots\r\n",
+           (unsigned long)((uint64_t)NUM_PATTERNS * TEXT_BYTES * CPU_FREQ /
+                           prog.cycles),
+           (unsigned long)CPU_FREQ, boots);
+    PRINTF("%s\r\n", ok ? "Counts ok" : "COUNT MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): bytes of the text
+# searched
+SIZE_small = 1024
+SIZE_medium = 4096
+SIZE_large = 16384
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,466 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+#define BF_ROUNDS 16
+#define BF_BLOCK 8
+#define BF_P_WORDS (BF_ROUNDS + 2)
+#define BF_KEY_WORDS (BF_P_WORDS + 4 * 256)
+
+// Defines bf_init[], see bf_pi.h
+#include "bf_pi.h"
+
+// Defines INPUT_BYTES and input[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+#if INPUT_BYTES % BF_BLOCK != 0
+#error The input must be whole blocks
+#endif
+
+#define NUM_BLOCKS ((unsigned)(INPUT_BYTES / BF_BLOCK))
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Encryptions of the key schedule per task execution: the schedule takes
+// BF_KEY_WORDS / 2 = 521 of them
+#ifndef KEY_BLOCK
+#define KEY_BLOCK 8
+#endif
+
+// Blocks encrypted or decrypted per task execution
+#ifndef BLOCKS_PER_TASK
+#define BLOCKS_PER_TASK 4
+#endif
+
+// The key of MiBench's runme scripts, of which bf.c uses the first 8 bytes
+#define KEY_BYTES 8
+__ro_nv static const uint8_t key[KEY_BYTES] = {
+    0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef,
+};
+
+#ifdef BLOWFISH_ECB
+#define MODE_NAME "ECB"
+#else
+#define MODE_NAME "CBC"
+#endif
+
+/** @brief Progress of the key schedule
+ *  @details The schedule encrypts a chained block and stores each result into
+ *           the next two words of the P-array and S-boxes, over the words the
+ *           encryption reads. See ks_word for how that is made restartable.
+ */
+typedef struct {
+    uint32_t block[2];
+    uint32_t cycles;    // cycles of the executions that committed
+    uint16_t done;      // words of the key table written
+} key_state_t;
+
+/** @brief Progress of encryption or decryption of the input */
+typedef struct {
+    uint32_t iv[2];     // chaining value, unused in ECB mode
+    uint32_t cycles;    // cycles of the executions that committed
+    uint16_t block;     // next block
+} crypt_state_t;
+
+TASK(1, task_init)
+TASK(2, task_key)
+TASK(3, task_encrypt)
+TASK(4, task_decrypt)
+TASK(5, task_done)
+TASK(6, bench_fail)
+TASK(7, bench_success)
+
+struct key_args {
+    CHAN_FIELD(key_state_t, key);
+};
+
+struct key_state {
+    SELF_CHAN_FIELD(key_state_t, key);
+};
+
+#define FIELD_INIT_key_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct crypt_args {
+    CHAN_FIELD(crypt_state_t, crypt);
+};
+
+struct crypt_state {
+    SELF_CHAN_FIELD(crypt_state_t, crypt);
+};
+
+#define FIELD_INIT_crypt_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+struct done_args {
+    CHAN_FIELD(uint32_t, cycles);
+};
+
+CHANNEL(task_init, task_key, key_args);
+SELF_CHANNEL(task_key, key_state);
+CHANNEL(task_key, task_done, done_args);
+CHANNEL(task_init, task_encrypt, crypt_args);
+SELF_CHANNEL(task_encrypt, crypt_state);
+CHANNEL(task_encrypt, task_done, done_args);
+CHANNEL(task_init, task_decrypt, crypt_args);
+SELF_CHANNEL(task_decrypt, crypt_state);
+CHANNEL(task_decrypt, task_done, done_args);
+
+/* The keyed P-array, followed by the four S-boxes */
+__nv static uint32_t bf_key[BF_KEY_WORDS];
+
+#define bf_P bf_key
+#define bf_S (bf_key + BF_P_WORDS)
+
+/* Ciphertext: each block is written once from the input and the chaining
+ * value in the channel, so a restarted execution writes the same values. */
+__nv static uint8_t output[INPUT_BYTES];
+
+#ifdef BLOWFISH_SBOX_SRAM
+/* Copy of the first S-box in SRAM, the only one that fits with the stack.
+ * SRAM is lost on a power failure, so it is copied again on each boot. */
+__sram static uint32_t sbox0_sram[256];
+__sram static uint8_t sbox0_cached;
+
+#define S0 sbox0_sram
+#else
+#define S0 bf_S
+#endif
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+#define BF_F(s0, s1, s2, s3, x) \
+    ((((s0)[(x) >> 24] + (s1)[((x) >> 16) & 0xff]) ^ \
+      (s2)[((x) >> 8) & 0xff]) + (s3)[(x) & 0xff])
+
+/* Word i of the key, taken cyclically */
+static uint32_t key_word(unsigned i) {
+    uint32_t w = 0;
+    unsigned j;
+
+    for (j = 0; j < 4; ++j)
+        w = (w << 8) | key[(4 * i + j) % KEY_BYTES];
+    return w;
+}
+
+/** @brief Word of the key table during the key schedule
+ *  @details The words below done hold their final values. The words above
+ *           still hold, in BF_set_key, the initial values, XORed with the key
+ *           for the P-array: those are recomputed from bf_init instead of read
+ *           back, so a restarted execution does not see the words written by
+ *           the execution that was cut short.
+ */
+static uint32_t ks_word(unsigned i, unsigned done) {
+    if (i < done)
+        return bf_key[i];
+    if (i < BF_P_WORDS)
+        return bf_init[i] ^ key_word(i);
+    return bf_init[i];
+}
+
+static uint32_t ks_F(uint32_t x, unsigned done) {
+    return ((ks_word(BF_P_WORDS + (x >> 24), done) +
+             ks_word(BF_P_WORDS + 0x100 + ((x >> 16) & 0xff), done)) ^
+             ks_word(BF_P_WORDS + 0x200 + ((x >> 8) & 0xff), done)) +
+             ks_word(BF_P_WORDS + 0x300 + (x & 0xff), done);
+}
+
+/* Encryption of the key schedule, with the table as of done words */
+static void ks_encrypt(uint32_t *data, unsigned done) {
+    uint32_t l = data[0], r = data[1], t;
+    unsigned i;
+
+    for (i = 0; i < BF_ROUNDS; ++i) {
+        l ^= ks_word(i, done);
+        r ^= ks_F(l, done);
+        t = l; l = r; r = t;
+    }
+    t = l; l = r; r = t;
+    r ^= ks_word(BF_ROUNDS, done);
+    l ^= ks_word(BF_ROUNDS + 1, done);
+
+    data[0] = l;
+    data[1] = r;
+}
+
+/** @brief Encrypt or decrypt one block with the keyed table (BF_encrypt) */
+static void bf_encrypt(uint32_t *data, int encrypt) {
+    const uint32_t *s1 = bf_S + 0x100, *s2 = bf_S + 0x200, *s3 = bf_S + 0x300;
+    uint32_t l = data[0], r = data[1], t;
+    unsigned i;
+
+    for (i = 0; i < BF_ROUNDS; ++i) {
+        l ^= bf_P[encrypt ? i : BF_ROUNDS + 1 - i];
+        r ^= BF_F(S0, s1, s2, s3, l);
+        t = l; l = r; r = t;
+    }
+    t = l; l = r; r = t;
+    r ^= bf_P[encrypt ? BF_ROUNDS : 1];
+    l ^= bf_P[encrypt ? BF_ROUNDS + 1 : 0];
+
+    data[0] = l;
+    data[1] = r;
+}
+
+static uint32_t load_be(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void store_be(uint8_t *p, uint32_t w) {
+    p[0] = w >> 24;
+    p[1] = w >> 16;
+    p[2] = w >> 8;
+    p[3] = w;
+}
+
+static void cache_sbox() {
+#ifdef BLOWFISH_SBOX_SRAM
+    unsigned i;
+
+    if (sbox0_cached)
+        return;
+    for (i = 0; i < 256; ++i)
+        sbox0_sram[i] = bf_S[i];
+    sbox0_cached = 1;
+#endif
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+#ifdef BLOWFISH_SBOX_SRAM
+    sbox0_cached = 0;
+#endif
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u blocks, " MODE_NAME "\r\n", NUM_BLOCKS);
+
+    key_state_t k = { .done = 0 };
+    crypt_state_t c = { .block = 0 };
+
+    CHAN_OUT1(key_state_t, key, k, CH(task_init, task_key));
+    CHAN_OUT1(crypt_state_t, crypt, c, CH(task_init, task_encrypt));
+    CHAN_OUT1(crypt_state_t, crypt, c, CH(task_init, task_decrypt));
+    TRANSITION_TO(task_key);
+}
+
+/* Runs KEY_BLOCK encryptions of the key schedule (BF_set_key) */
+void task_key() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    key_state_t k;
+    unsigned n;
+
+    k = *CHAN_IN2(key_state_t, key, CH(task_init, task_key),
+                  SELF_IN_CH(task_key));
+
+    for (n = 0; n < KEY_BLOCK && k.done < BF_KEY_WORDS; ++n) {
+        ks_encrypt(k.block, k.done);
+        bf_key[k.done] = k.block[0];
+        bf_key[k.done + 1] = k.block[1];
+        k.done += 2;
+    }
+
+    k.cycles += msp_cycles() - start;
+
+    if (k.done < BF_KEY_WORDS) {
+        CHAN_OUT1(key_state_t, key, k, SELF_OUT_CH(task_key));
+        TRANSITION_TO(task_key);
+    }
+    CHAN_OUT1(uint32_t, cycles, k.cycles, CH(task_key, task_done));
+    TRANSITION_TO(task_encrypt);
+}
+
+/* Encrypts BLOCKS_PER_TASK blocks of the input into the output */
+void task_encrypt() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    crypt_state_t c;
+    uint32_t d[2];
+    unsigned n;
+
+    c = *CHAN_IN2(crypt_state_t, crypt, CH(task_init, task_encrypt),
+                  SELF_IN_CH(task_encrypt));
+
+    cache_sbox();
+
+    for (n = 0; n < BLOCKS_PER_TASK && c.block < NUM_BLOCKS; ++n, ++c.block) {
+        d[0] = load_be(input + c.block * BF_BLOCK);
+        d[1] = load_be(input + c.block * BF_BLOCK + 4);
+#ifndef BLOWFISH_ECB
+        d[0] ^= c.iv[0];
+        d[1] ^= c.iv[1];
+#endif
+        bf_encrypt(d, 1);
+        store_be(output + c.block * BF_BLOCK, d[0]);
+        store_be(output + c.block * BF_BLOCK + 4, d[1]);
+        c.iv[0] = d[0];
+        c.iv[1] = d[1];
+    }
+
+    c.cycles += msp_cycles() - start;
+
+    if (c.block < NUM_BLOCKS) {
+        CHAN_OUT1(crypt_state_t, crypt, c, SELF_OUT_CH(task_encrypt));
+        TRANSITION_TO(task_encrypt);
+    }
+    CHAN_OUT1(uint32_t, cycles, c.cycles, CH(task_encrypt, task_done));
+    TRANSITION_TO(task_decrypt);
+}
+
+/* Decrypts BLOCKS_PER_TASK blocks of the output and checks them against
+ * the input */
+void task_decrypt() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    crypt_state_t c;
+    uint32_t d[2];
+    unsigned n;
+
+    c = *CHAN_IN2(crypt_state_t, crypt, CH(task_init, task_decrypt),
+                  SELF_IN_CH(task_decrypt));
+
+    cache_sbox();
+
+    for (n = 0; n < BLOCKS_PER_TASK && c.block < NUM_BLOCKS; ++n, ++c.block) {
+        d[0] = load_be(output + c.block * BF_BLOCK);
+        d[1] = load_be(output + c.block * BF_BLOCK + 4);
+        bf_encrypt(d, 0);
+#ifndef BLOWFISH_ECB
+        d[0] ^= c.iv[0];
+        d[1] ^= c.iv[1];
+        c.iv[0] = load_be(output + c.block * BF_BLOCK);
+        c.iv[1] = load_be(output + c.block * BF_BLOCK + 4);
+#endif
+        if (d[0] != load_be(input + c.block * BF_BLOCK) ||
+            d[1] != load_be(input + c.block * BF_BLOCK + 4)) {
+            PRINTF("Decryption differs at block %u\r\n", c.block);
+            TRANSITION_TO(bench_fail);
+        }
+    }
+
+    c.cycles += msp_cycles() - start;
+
+    if (c.block < NUM_BLOCKS) {
+        CHAN_OUT1(crypt_state_t, crypt, c, SELF_OUT_CH(task_decrypt));
+        TRANSITION_TO(task_decrypt);
+    }
+    CHAN_OUT1(uint32_t, cycles, c.cycles, CH(task_decrypt, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints a checksum of the ciphertext, to compare with the output of
+ * MiBench's bf on the same input, and the throughput over the cycles of the
+ * task executions that committed */
+void task_done() {
+    task_prologue();
+
+    uint32_t key_cycles, enc_cycles, dec_cycles;
+    uint32_t sum = 0, weighted = 0;
+    unsigned i;
+
+    key_cycles = *CHAN_IN1(uint32_t, cycles, CH(task_key, task_done));
+    enc_cycles = *CHAN_IN1(uint32_t, cycles, CH(task_encrypt, task_done));
+    dec_cycles = *CHAN_IN1(uint32_t, cycles, CH(task_decrypt, task_done));
+
+    for (i = 0; i < INPUT_BYTES; ++i) {
+        sum += output[i];
+        weighted += (uint32_t)(i + 1) * output[i];
+    }
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF(MODE_NAME " checksum: %n %n\r\n",
+           (unsigned long)sum, (unsigned long)weighted);
+    PRINTF("last block:");
+    for (i = INPUT_BYTES - BF_BLOCK; i < INPUT_BYTES; ++i)
+        PRINTF(" %02x", output[i]);
+    PRINTF("\r\n");
+
+#ifdef BLOWFISH_SBOX_SRAM
+    PRINTF("S-boxes: first in SRAM, others in FRAM\r\n");
+#else
+    PRINTF("S-boxes: FRAM\r\n");
+#endif
+    PRINTF("key schedule: Cycles %n\r\n", (unsigned long)key_cycles);
+    PRINTF("encrypt %n bytes: Cycles %n, bytes/s %n\r\n",
+           (unsigned long)INPUT_BYTES, (unsigned long)enc_cycles,
+           (unsigned long)((uint64_t)INPUT_BYTES * CPU_FREQ / enc_cycles));
+    PRINTF("decrypt %n bytes: Cycles %n, bytes/s %n\r\n",
+           (unsigned long)INPUT_BYTES, (unsigned long)dec_cycles,
+           (unsigned long)((uint64_t)INPUT_BYTES * CPU_FREQ / dec_cycles));
+
+    CHAIN_REPORT();
+    TRANSITION_TO(bench_success);
+}
+
+// Blink LED1 on failure
+void bench_fail() {
+    task_prologue();
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_1, OUT) &= ~BIT(PIN_LED_1);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_fail);
+}
+
+// Blink LED2 on success
+void bench_success() {
+    task_prologue();
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(bench_success);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
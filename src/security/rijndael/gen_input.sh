@@ -0,0 +1,39 @@
+#! /bin/bash
+#
+# Generate input.h from the first bytes of a MiBench rijndael input file
+#
+# The input of the MiBench security benchmarks is the same text file, and
+# AES encrypts whole 16-byte blocks, so bytes must be a multiple of 16.
+#
+# Usage: ./gen_input.sh [bytes] [input_small.asc] > input.h
+
+BYTES=${1:-4096}
+INPUT=${2:-../../../mibench-src/security/sha/input_small.asc}
+
+head -c $BYTES $INPUT | od -An -v -tu1 | awk '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench rijndael input_small.asc */"
+        print ""
+    }
+    {
+        for (f = 1; f <= NF; ++f) {
+            if (n % 12 == 0)
+                line = "   "
+            line = line sprintf(" 0x%02x,", $f)
+            if (n % 12 == 11) {
+                body = body line "\n"
+                line = ""
+            }
+            ++n
+        }
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define INPUT_BYTES " n "UL"
+        print ""
+        print "__ro_nv static const uint8_t input[INPUT_BYTES] = {"
+        printf "%s", body
+        print "};"
+    }
+'
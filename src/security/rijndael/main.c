@@ -0,0 +1,358 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines sbox[] and, with RIJNDAEL_TTABLE, Te0[] to Te3[], see aes_tab.h
+#include "aes_tab.h"
+
+// Defines INPUT_BYTES and input[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+#define AES_BLOCK 16
+#define AES_KEY_WORDS 8                         // AES-256
+#define AES_ROUNDS 14
+#define AES_RK_WORDS (4 * (AES_ROUNDS + 1))
+
+#if INPUT_BYTES % AES_BLOCK != 0
+#error The input must be whole blocks
+#endif
+
+#define NUM_BLOCKS ((unsigned)(INPUT_BYTES / AES_BLOCK))
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+#ifdef RIJNDAEL_TTABLE
+#define IMPL_NAME "T-table"
+#define TABLE_BYTES (sizeof(sbox) + sizeof(Te0) + sizeof(Te1) + \
+                     sizeof(Te2) + sizeof(Te3))
+#else
+#define IMPL_NAME "byte-oriented"
+#define TABLE_BYTES (sizeof(sbox))
+#endif
+
+// The 256-bit key of MiBench's runme scripts
+__ro_nv static const uint8_t key[4 * AES_KEY_WORDS] = {
+    0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef,
+    0xfe, 0xdc, 0xba, 0x09, 0x87, 0x65, 0x43, 0x21,
+    0x12, 0x34, 0x56, 0x78, 0x90, 0xab, 0xcd, 0xef,
+    0xfe, 0xdc, 0xba, 0x09, 0x87, 0x65, 0x43, 0x21,
+};
+
+/** @brief Progress of CBC encryption of the input */
+typedef struct {
+    uint32_t iv[4];     // chaining value: the last ciphertext block
+    uint32_t cycles;    // cycles of the executions that committed
+    uint16_t block;     // next block
+} cbc_state_t;
+
+TASK(1, task_init)
+TASK(2, task_encrypt)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct cbc_args {
+    CHAN_FIELD(cbc_state_t, cbc);
+};
+
+struct cbc_state {
+    SELF_CHAN_FIELD(cbc_state_t, cbc);
+};
+
+#define FIELD_INIT_cbc_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_encrypt, cbc_args);
+SELF_CHANNEL(task_encrypt, cbc_state);
+CHANNEL(task_encrypt, task_done, cbc_args);
+
+/* Round keys and ciphertext are only written from constants and channel
+ * values, so a restarted execution writes the same values. */
+__nv static uint32_t rk[AES_RK_WORDS];
+__nv static uint8_t output[INPUT_BYTES];
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+static uint32_t load_be(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void store_be(uint8_t *p, uint32_t w) {
+    p[0] = w >> 24;
+    p[1] = w >> 16;
+    p[2] = w >> 8;
+    p[3] = w;
+}
+
+static uint32_t sub_word(uint32_t w) {
+    return ((uint32_t)sbox[w >> 24] << 24) |
+           ((uint32_t)sbox[(w >> 16) & 0xff] << 16) |
+           ((uint32_t)sbox[(w >> 8) & 0xff] << 8) |
+           sbox[w & 0xff];
+}
+
+/* Key expansion of AES-256 (FIPS-197 5.2) */
+static void expand_key() {
+    uint32_t t, rcon = 0x01000000UL;
+    unsigned i;
+
+    for (i = 0; i < AES_KEY_WORDS; ++i)
+        rk[i] = load_be(key + 4 * i);
+
+    for (i = AES_KEY_WORDS; i < AES_RK_WORDS; ++i) {
+        t = rk[i - 1];
+        if (i % AES_KEY_WORDS == 0) {
+            t = sub_word((t << 8) | (t >> 24)) ^ rcon;
+            rcon <<= 1;
+        } else if (i % AES_KEY_WORDS == 4) {
+            t = sub_word(t);
+        }
+        rk[i] = rk[i - AES_KEY_WORDS] ^ t;
+    }
+}
+
+#ifdef RIJNDAEL_TTABLE
+
+/** @brief Encrypt one block with the T-tables
+ *  @details Each round is 16 table lookups: SubBytes, ShiftRows and
+ *           MixColumns of a column folded into four words. The last round
+ *           has no MixColumns and uses the S-box.
+ */
+static void aes_encrypt(uint32_t *s) {
+    const uint32_t *k = rk;
+    uint32_t s0 = s[0] ^ k[0], s1 = s[1] ^ k[1],
+             s2 = s[2] ^ k[2], s3 = s[3] ^ k[3];
+    uint32_t t0, t1, t2, t3;
+    unsigned r;
+
+    for (r = 1; r < AES_ROUNDS; ++r) {
+        k += 4;
+        t0 = Te0[s0 >> 24] ^ Te1[(s1 >> 16) & 0xff] ^
+             Te2[(s2 >> 8) & 0xff] ^ Te3[s3 & 0xff] ^ k[0];
+        t1 = Te0[s1 >> 24] ^ Te1[(s2 >> 16) & 0xff] ^
+             Te2[(s3 >> 8) & 0xff] ^ Te3[s0 & 0xff] ^ k[1];
+        t2 = Te0[s2 >> 24] ^ Te1[(s3 >> 16) & 0xff] ^
+             Te2[(s0 >> 8) & 0xff] ^ Te3[s1 & 0xff] ^ k[2];
+        t3 = Te0[s3 >> 24] ^ Te1[(s0 >> 16) & 0xff] ^
+             Te2[(s1 >> 8) & 0xff] ^ Te3[s2 & 0xff] ^ k[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    k += 4;
+    s[0] = (((uint32_t)sbox[s0 >> 24] << 24) |
+            ((uint32_t)sbox[(s1 >> 16) & 0xff] << 16) |
+            ((uint32_t)sbox[(s2 >> 8) & 0xff] << 8) |
+            sbox[s3 & 0xff]) ^ k[0];
+    s[1] = (((uint32_t)sbox[s1 >> 24] << 24) |
+            ((uint32_t)sbox[(s2 >> 16) & 0xff] << 16) |
+            ((uint32_t)sbox[(s3 >> 8) & 0xff] << 8) |
+            sbox[s0 & 0xff]) ^ k[1];
+    s[2] = (((uint32_t)sbox[s2 >> 24] << 24) |
+            ((uint32_t)sbox[(s3 >> 16) & 0xff] << 16) |
+            ((uint32_t)sbox[(s0 >> 8) & 0xff] << 8) |
+            sbox[s1 & 0xff]) ^ k[2];
+    s[3] = (((uint32_t)sbox[s3 >> 24] << 24) |
+            ((uint32_t)sbox[(s0 >> 16) & 0xff] << 16) |
+            ((uint32_t)sbox[(s1 >> 8) & 0xff] << 8) |
+            sbox[s2 & 0xff]) ^ k[3];
+}
+
+#else // !RIJNDAEL_TTABLE
+
+static uint8_t xtime(uint8_t x) {
+    return (x << 1) ^ ((x & 0x80) ? 0x1b : 0);
+}
+
+static void add_round_key(uint8_t *b, const uint32_t *k) {
+    unsigned c;
+
+    for (c = 0; c < 4; ++c) {
+        b[4 * c]     ^= k[c] >> 24;
+        b[4 * c + 1] ^= k[c] >> 16;
+        b[4 * c + 2] ^= k[c] >> 8;
+        b[4 * c + 3] ^= k[c];
+    }
+}
+
+/** @brief Encrypt one block a byte at a time
+ *  @details The state is in column order, as in FIPS-197. The only table is
+ *           the S-box: MixColumns multiplies by 2 with xtime().
+ */
+static void aes_encrypt(uint32_t *s) {
+    uint8_t b[AES_BLOCK], t[AES_BLOCK];
+    uint8_t a0, a1, a2, a3, all;
+    unsigned r, c, i;
+
+    for (c = 0; c < 4; ++c)
+        store_be(b + 4 * c, s[c]);
+    add_round_key(b, rk);
+
+    for (r = 1; r <= AES_ROUNDS; ++r) {
+        // SubBytes and ShiftRows: row i moves i columns left
+        for (c = 0; c < 4; ++c)
+            for (i = 0; i < 4; ++i)
+                t[4 * c + i] = sbox[b[4 * ((c + i) & 3) + i]];
+
+        if (r < AES_ROUNDS) {
+            // MixColumns
+            for (c = 0; c < 4; ++c) {
+                a0 = t[4 * c];
+                a1 = t[4 * c + 1];
+                a2 = t[4 * c + 2];
+                a3 = t[4 * c + 3];
+                all = a0 ^ a1 ^ a2 ^ a3;
+                t[4 * c]     = a0 ^ all ^ xtime(a0 ^ a1);
+                t[4 * c + 1] = a1 ^ all ^ xtime(a1 ^ a2);
+                t[4 * c + 2] = a2 ^ all ^ xtime(a2 ^ a3);
+                t[4 * c + 3] = a3 ^ all ^ xtime(a3 ^ a0);
+            }
+        }
+
+        for (i = 0; i < AES_BLOCK; ++i)
+            b[i] = t[i];
+        add_round_key(b, rk + 4 * r);
+    }
+
+    for (c = 0; c < 4; ++c)
+        s[c] = load_be(b + 4 * c);
+}
+
+#endif // !RIJNDAEL_TTABLE
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u blocks, " IMPL_NAME "\r\n", NUM_BLOCKS);
+
+    // The IV is zero
+    cbc_state_t c = { .block = 0 };
+
+    expand_key();
+
+    CHAN_OUT1(cbc_state_t, cbc, c, CH(task_init, task_encrypt));
+    TRANSITION_TO(task_encrypt);
+}
+
+/* Encrypts one block per execution in CBC mode */
+void task_encrypt() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    const uint8_t *in;
+    cbc_state_t c;
+    unsigned i;
+
+    c = *CHAN_IN2(cbc_state_t, cbc, CH(task_init, task_encrypt),
+                  SELF_IN_CH(task_encrypt));
+
+    in = input + c.block * AES_BLOCK;
+    for (i = 0; i < 4; ++i)
+        c.iv[i] ^= load_be(in + 4 * i);
+
+    aes_encrypt(c.iv);
+
+    for (i = 0; i < 4; ++i)
+        store_be(output + c.block * AES_BLOCK + 4 * i, c.iv[i]);
+    c.block++;
+
+    c.cycles += msp_cycles() - start;
+
+    if (c.block < NUM_BLOCKS) {
+        CHAN_OUT1(cbc_state_t, cbc, c, SELF_OUT_CH(task_encrypt));
+        TRANSITION_TO(task_encrypt);
+    }
+    CHAN_OUT1(cbc_state_t, cbc, c, CH(task_encrypt, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints a checksum of the ciphertext, and the cycles per byte over the task
+ * executions that committed against the FRAM taken by the tables */
+void task_done() {
+    task_prologue();
+
+    cbc_state_t c = *CHAN_IN1(cbc_state_t, cbc, CH(task_encrypt, task_done));
+    uint32_t sum = 0, weighted = 0, per_byte;
+    unsigned i;
+
+    for (i = 0; i < INPUT_BYTES; ++i) {
+        sum += output[i];
+        weighted += (uint32_t)(i + 1) * output[i];
+    }
+    per_byte = c.cycles * 100 / INPUT_BYTES;
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("checksum: %n %n\r\n",
+           (unsigned long)sum, (unsigned long)weighted);
+    PRINTF("last block:");
+    for (i = INPUT_BYTES - AES_BLOCK; i < INPUT_BYTES; ++i)
+        PRINTF(" %02x", output[i]);
+    PRINTF("\r\n");
+
+    PRINTF(IMPL_NAME ": tables %u bytes\r\n", (unsigned)TABLE_BYTES);
+    // libmspprintf does not pad %u: the hundredths are printed a digit each
+    PRINTF("encrypt %n bytes: Cycles %n, cycles/byte %n.%u%u, "
+           "bytes/s %n\r\n",
+           (unsigned long)INPUT_BYTES, (unsigned long)c.cycles,
+           (unsigned long)(per_byte / 100), (unsigned)(per_byte / 10 % 10),
+           (unsigned)(per_byte % 10),
+           (unsigned long)((uint64_t)INPUT_BYTES * CPU_FREQ / c.cycles));
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): bytes encrypted,
+# a multiple of 16. The ciphertext takes as much FRAM as the input.
+SIZE_small = 1024
+SIZE_medium = 4096
+SIZE_large = 8192
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,348 @@
+/* Generated by gen_input.sh from MiBench sha input_small.asc */
+
+#define INPUT_BYTES 4096UL
+
+__ro_nv static const uint8_t input[INPUT_BYTES] = {
+    0x6f, 0x66, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6c, 0x6f, 0x67,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x34,
+    0x36, 0x30, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f,
+    0x6b, 0x20, 0x74, 0x68, 0x65, 0x2e, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x33, 0x36, 0x36, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x69,
+    0x73, 0x2e, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x76, 0x6f,
+    0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x31, 0x36, 0x33, 0x20, 0x6f, 0x66,
+    0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x2e, 0x0a, 0x6f, 0x66,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64,
+    0x20, 0x38, 0x38, 0x33, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+    0x33, 0x32, 0x37, 0x2e, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61,
+    0x6e, 0x64, 0x20, 0x61, 0x74, 0x20, 0x39, 0x31, 0x20, 0x70, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x20, 0x38, 0x36, 0x31, 0x2e, 0x0a, 0x6c, 0x6f, 0x67,
+    0x20, 0x34, 0x35, 0x32, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6f, 0x66, 0x20,
+    0x77, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x2e, 0x0a, 0x73, 0x61, 0x6d,
+    0x70, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x69,
+    0x6d, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x6f, 0x6b,
+    0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72,
+    0x79, 0x2e, 0x0a, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+    0x20, 0x38, 0x33, 0x35, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x74, 0x65, 0x6d,
+    0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x6b, 0x20,
+    0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x6f, 0x66, 0x20,
+    0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20,
+    0x31, 0x30, 0x32, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73,
+    0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x33, 0x31, 0x34, 0x2e, 0x0a, 0x74,
+    0x61, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x39, 0x35, 0x34, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72,
+    0x79, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x61, 0x74, 0x20, 0x37,
+    0x32, 0x30, 0x2e, 0x0a, 0x74, 0x61, 0x67, 0x20, 0x61, 0x20, 0x69, 0x6e,
+    0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x67, 0x20, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x61, 0x20, 0x61, 0x74, 0x20, 0x74, 0x65,
+    0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6e,
+    0x64, 0x20, 0x38, 0x38, 0x37, 0x2e, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x39, 0x32, 0x30, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x37, 0x35, 0x30, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x36, 0x38, 0x32, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20,
+    0x32, 0x31, 0x30, 0x20, 0x69, 0x73, 0x20, 0x38, 0x36, 0x36, 0x2e, 0x0a,
+    0x74, 0x69, 0x6d, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x62,
+    0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x35, 0x33, 0x35, 0x20, 0x6f,
+    0x6b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x0a, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x20, 0x34, 0x30, 0x32, 0x20, 0x69, 0x6e, 0x20, 0x34, 0x34, 0x37,
+    0x2e, 0x0a, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x79, 0x20, 0x32, 0x31, 0x31, 0x20, 0x61, 0x20, 0x39, 0x33, 0x33,
+    0x20, 0x74, 0x61, 0x67, 0x20, 0x61, 0x74, 0x20, 0x74, 0x61, 0x67, 0x20,
+    0x6c, 0x6f, 0x67, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x77,
+    0x61, 0x73, 0x20, 0x35, 0x38, 0x32, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x79, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20,
+    0x61, 0x74, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x6f,
+    0x66, 0x20, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20,
+    0x74, 0x61, 0x67, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x6b, 0x2e, 0x0a, 0x68,
+    0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x33, 0x39, 0x38, 0x20,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x36,
+    0x31, 0x33, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x61,
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74,
+    0x79, 0x20, 0x38, 0x30, 0x37, 0x2e, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x20, 0x74, 0x61, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+    0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20,
+    0x74, 0x61, 0x67, 0x2e, 0x0a, 0x77, 0x61, 0x73, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x37, 0x33, 0x39, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69,
+    0x6e, 0x67, 0x20, 0x39, 0x36, 0x32, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x79, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20,
+    0x61, 0x6e, 0x64, 0x2e, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x32,
+    0x30, 0x34, 0x20, 0x74, 0x61, 0x67, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79,
+    0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x65,
+    0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72,
+    0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x32, 0x32, 0x34, 0x20, 0x61, 0x20,
+    0x6f, 0x6b, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x36, 0x34, 0x39, 0x20, 0x69, 0x73, 0x2e, 0x0a, 0x73,
+    0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67,
+    0x65, 0x20, 0x38, 0x36, 0x30, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x35, 0x36, 0x31, 0x20, 0x61, 0x74,
+    0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x39, 0x32, 0x35, 0x2e, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x36, 0x30, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x20, 0x35, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x74, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79,
+    0x20, 0x35, 0x31, 0x36, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20,
+    0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x61, 0x67, 0x20, 0x62, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x62, 0x61,
+    0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x74, 0x61, 0x67, 0x20, 0x65, 0x72,
+    0x72, 0x6f, 0x72, 0x2e, 0x0a, 0x77, 0x61, 0x73, 0x20, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x34, 0x38, 0x32, 0x20, 0x61,
+    0x6e, 0x64, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x69, 0x6e, 0x20,
+    0x61, 0x6e, 0x64, 0x2e, 0x0a, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61,
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74,
+    0x79, 0x20, 0x34, 0x33, 0x37, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72,
+    0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72,
+    0x61, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x0a, 0x61, 0x20, 0x73, 0x65, 0x6e,
+    0x73, 0x6f, 0x72, 0x20, 0x38, 0x32, 0x35, 0x20, 0x6c, 0x6f, 0x67, 0x20,
+    0x33, 0x30, 0x37, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20,
+    0x6f, 0x66, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x31, 0x38, 0x38, 0x20,
+    0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x32, 0x31, 0x34, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x0a, 0x74, 0x65, 0x6d, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x76,
+    0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x34, 0x33, 0x37, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x61, 0x73, 0x2e, 0x0a, 0x6f, 0x66,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x36, 0x31, 0x31, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x72,
+    0x72, 0x6f, 0x72, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20,
+    0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x20, 0x74, 0x61, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x76, 0x6f, 0x6c,
+    0x74, 0x61, 0x67, 0x65, 0x20, 0x37, 0x32, 0x34, 0x2e, 0x0a, 0x65, 0x72,
+    0x72, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+    0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x76, 0x6f, 0x6c, 0x74,
+    0x61, 0x67, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x2e, 0x0a, 0x69, 0x6e, 0x20,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x32, 0x39, 0x20, 0x68, 0x75,
+    0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x74,
+    0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x37, 0x39, 0x32, 0x20, 0x77, 0x61,
+    0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x32, 0x34, 0x31, 0x20,
+    0x74, 0x68, 0x65, 0x2e, 0x0a, 0x74, 0x61, 0x67, 0x20, 0x32, 0x30, 0x32,
+    0x20, 0x74, 0x61, 0x67, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+    0x38, 0x37, 0x31, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x32,
+    0x37, 0x34, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20,
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x33, 0x38, 0x33, 0x20, 0x76, 0x61,
+    0x6c, 0x75, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62,
+    0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x32, 0x33, 0x30, 0x20, 0x74,
+    0x61, 0x67, 0x2e, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x6f, 0x66,
+    0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x37, 0x34, 0x30,
+    0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x20, 0x61, 0x2e, 0x0a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6e,
+    0x6f, 0x64, 0x65, 0x20, 0x74, 0x61, 0x67, 0x20, 0x6f, 0x6b, 0x20, 0x74,
+    0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x38,
+    0x33, 0x31, 0x20, 0x61, 0x20, 0x36, 0x32, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x20, 0x33, 0x33, 0x34, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x20, 0x69, 0x73, 0x20, 0x69, 0x73, 0x2e, 0x0a, 0x70, 0x61, 0x63,
+    0x6b, 0x65, 0x74, 0x20, 0x38, 0x38, 0x38, 0x20, 0x61, 0x20, 0x33, 0x30,
+    0x36, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x67,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6e, 0x6f,
+    0x64, 0x65, 0x2e, 0x0a, 0x6c, 0x6f, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
+    0x65, 0x20, 0x35, 0x35, 0x32, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e,
+    0x67, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69,
+    0x74, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x20, 0x6f, 0x6b, 0x20, 0x35, 0x32, 0x30, 0x20, 0x74, 0x61,
+    0x67, 0x2e, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20,
+    0x33, 0x30, 0x36, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x20,
+    0x39, 0x39, 0x35, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x6e,
+    0x6f, 0x64, 0x65, 0x20, 0x39, 0x33, 0x30, 0x20, 0x77, 0x61, 0x73, 0x20,
+    0x61, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
+    0x65, 0x2e, 0x0a, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f,
+    0x6b, 0x20, 0x38, 0x31, 0x35, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x39, 0x39, 0x36, 0x20, 0x73,
+    0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x6d, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x36, 0x31, 0x37, 0x20,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20,
+    0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x6b, 0x20, 0x61, 0x6e,
+    0x64, 0x20, 0x33, 0x34, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x20, 0x32, 0x32, 0x38, 0x20, 0x61, 0x74, 0x20, 0x32, 0x32,
+    0x34, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x33, 0x32,
+    0x37, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x6f,
+    0x6b, 0x2e, 0x0a, 0x69, 0x73, 0x20, 0x61, 0x74, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x6f, 0x6b,
+    0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x37,
+    0x35, 0x32, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x39, 0x38,
+    0x30, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
+    0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x77,
+    0x61, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x76,
+    0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x34, 0x35, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6b, 0x2e, 0x0a, 0x73, 0x61, 0x6d,
+    0x70, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x39, 0x30, 0x32,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x39, 0x30, 0x33,
+    0x20, 0x74, 0x61, 0x67, 0x2e, 0x0a, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69,
+    0x74, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x20, 0x31, 0x31, 0x38, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x31,
+    0x32, 0x36, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20,
+    0x32, 0x35, 0x38, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x36, 0x31, 0x34, 0x20, 0x69,
+    0x73, 0x20, 0x36, 0x35, 0x2e, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6b,
+    0x20, 0x32, 0x37, 0x39, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x38, 0x39, 0x30, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65,
+    0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x34, 0x38, 0x2e, 0x0a,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x6e,
+    0x6f, 0x64, 0x65, 0x20, 0x61, 0x20, 0x77, 0x61, 0x73, 0x20, 0x34, 0x38,
+    0x30, 0x2e, 0x0a, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20,
+    0x6f, 0x6b, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e,
+    0x64, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2e, 0x0a, 0x6c, 0x6f,
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6b, 0x20, 0x6f, 0x66, 0x20,
+    0x77, 0x61, 0x73, 0x20, 0x38, 0x39, 0x35, 0x20, 0x69, 0x6e, 0x20, 0x76,
+    0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x39, 0x36, 0x34,
+    0x20, 0x61, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x0a, 0x61,
+    0x6e, 0x64, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x68, 0x75,
+    0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x37, 0x30, 0x38, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61,
+    0x67, 0x65, 0x20, 0x35, 0x35, 0x32, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f,
+    0x67, 0x20, 0x34, 0x38, 0x38, 0x2e, 0x0a, 0x6c, 0x6f, 0x67, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64,
+    0x69, 0x74, 0x79, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79,
+    0x2e, 0x0a, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x73, 0x61,
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x67,
+    0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2e, 0x0a, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x20, 0x61, 0x74, 0x20, 0x38, 0x31, 0x39, 0x20,
+    0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x6e, 0x6f, 0x64,
+    0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
+    0x65, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x73, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74,
+    0x79, 0x20, 0x38, 0x39, 0x39, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x2e, 0x0a, 0x69, 0x73, 0x20, 0x36, 0x32, 0x39, 0x20, 0x61, 0x6e, 0x64,
+    0x20, 0x74, 0x61, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x64, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x6e,
+    0x6f, 0x64, 0x65, 0x20, 0x37, 0x34, 0x32, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x37,
+    0x37, 0x34, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x36,
+    0x34, 0x32, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69,
+    0x6e, 0x67, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x76, 0x6f, 0x6c, 0x74,
+    0x61, 0x67, 0x65, 0x20, 0x36, 0x34, 0x39, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x6c,
+    0x6f, 0x67, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x61,
+    0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x2e,
+    0x0a, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x74, 0x65, 0x6d,
+    0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x34, 0x33, 0x36,
+    0x2e, 0x0a, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x61, 0x20,
+    0x38, 0x32, 0x39, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x74, 0x20, 0x74, 0x65,
+    0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x66,
+    0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x74, 0x65, 0x6d,
+    0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x33, 0x38, 0x37,
+    0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x38, 0x32, 0x33,
+    0x2e, 0x0a, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61,
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x61, 0x67, 0x2e, 0x0a, 0x72, 0x65,
+    0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x74, 0x20, 0x74, 0x69, 0x6d,
+    0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x36, 0x37, 0x39, 0x2e, 0x0a, 0x61,
+    0x6e, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+    0x65, 0x20, 0x74, 0x61, 0x67, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73,
+    0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x6f, 0x6b, 0x20, 0x69, 0x6e,
+    0x2e, 0x0a, 0x74, 0x61, 0x67, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20,
+    0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x61, 0x67, 0x20,
+    0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x39, 0x34, 0x30, 0x20,
+    0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x37, 0x32, 0x31, 0x2e,
+    0x0a, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x32, 0x34, 0x37,
+    0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+    0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x35, 0x39, 0x20, 0x65, 0x72, 0x72,
+    0x6f, 0x72, 0x2e, 0x0a, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x32,
+    0x33, 0x39, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x6f, 0x6b, 0x20, 0x34, 0x30, 0x30, 0x20, 0x74, 0x69,
+    0x6d, 0x65, 0x2e, 0x0a, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x70, 0x61,
+    0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x31,
+    0x35, 0x31, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20,
+    0x31, 0x32, 0x38, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x69, 0x6d, 0x65, 0x20, 0x74, 0x61, 0x67, 0x2e, 0x0a, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20,
+    0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x33, 0x39, 0x20, 0x62, 0x61,
+    0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x67,
+    0x20, 0x69, 0x6e, 0x20, 0x69, 0x73, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x63, 0x6b,
+    0x65, 0x74, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 0x65,
+    0x6e, 0x73, 0x6f, 0x72, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x6c, 0x6f,
+    0x67, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69,
+    0x6e, 0x67, 0x20, 0x37, 0x38, 0x36, 0x20, 0x6f, 0x66, 0x2e, 0x0a, 0x70,
+    0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+    0x20, 0x61, 0x74, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20,
+    0x31, 0x31, 0x34, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6c,
+    0x6f, 0x67, 0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x33, 0x34, 0x34, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x20, 0x77, 0x61, 0x73, 0x20, 0x34, 0x34, 0x34, 0x20, 0x62, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x79, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65,
+    0x20, 0x36, 0x33, 0x35, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6b, 0x2e, 0x0a,
+    0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x79, 0x20, 0x33, 0x31, 0x34, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+    0x61, 0x20, 0x39, 0x39, 0x2e, 0x0a, 0x69, 0x73, 0x20, 0x38, 0x34, 0x34,
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x34, 0x35,
+    0x39, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x73, 0x65, 0x6e, 0x73,
+    0x6f, 0x72, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x36, 0x36, 0x33, 0x20,
+    0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x32, 0x33, 0x37, 0x2e, 0x0a,
+    0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x74, 0x20, 0x73, 0x61, 0x6d,
+    0x70, 0x6c, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x72,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x32, 0x35, 0x39, 0x20, 0x6e, 0x6f,
+    0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x2e, 0x0a, 0x62, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+    0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x69, 0x73, 0x20, 0x6c, 0x6f,
+    0x67, 0x20, 0x39, 0x37, 0x38, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x75, 0x6d, 0x69,
+    0x64, 0x69, 0x74, 0x79, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65,
+    0x20, 0x35, 0x30, 0x20, 0x69, 0x73, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61,
+    0x67, 0x65, 0x2e, 0x0a, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20,
+    0x34, 0x37, 0x35, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x65,
+    0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x73, 0x61,
+    0x6d, 0x70, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2e,
+    0x0a, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67, 0x65, 0x20, 0x73, 0x61, 0x6d,
+    0x70, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x33,
+    0x37, 0x30, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
+    0x72, 0x65, 0x2e, 0x0a, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x74, 0x20, 0x35,
+    0x35, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x61, 0x20, 0x6f, 0x6b, 0x20,
+    0x34, 0x32, 0x33, 0x2e, 0x0a, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20,
+    0x34, 0x32, 0x36, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67,
+    0x20, 0x69, 0x6e, 0x20, 0x74, 0x61, 0x67, 0x20, 0x74, 0x65, 0x6d, 0x70,
+    0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x31, 0x35, 0x38, 0x20,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x74, 0x61, 0x67,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x61, 0x74, 0x20, 0x73,
+    0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x61, 0x74, 0x20, 0x32, 0x37, 0x31,
+    0x20, 0x74, 0x61, 0x67, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74,
+    0x79, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x61,
+    0x64, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x34, 0x33, 0x30,
+    0x2e, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x62, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x79, 0x20, 0x33, 0x37, 0x38, 0x20, 0x73, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x73, 0x65, 0x6e, 0x73, 0x6f,
+    0x72, 0x20, 0x35, 0x37, 0x32, 0x20, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69,
+    0x74, 0x79, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x0a, 0x69,
+    0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70,
+    0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x61, 0x67, 0x20, 0x65,
+    0x72, 0x72, 0x6f, 0x72, 0x20, 0x38, 0x32, 0x35, 0x20, 0x74, 0x65, 0x6d,
+    0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x34, 0x35, 0x20,
+    0x61, 0x20, 0x34, 0x32, 0x33, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x2e,
+    0x0a, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65,
+    0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x6f, 0x6c, 0x74, 0x61, 0x67,
+    0x65, 0x20, 0x69, 0x73,
+};
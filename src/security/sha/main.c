@@ -0,0 +1,280 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines INPUT_BYTES and input[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Rounds of the compression function per task execution: 80 compresses
+// one whole block, fewer split a block across executions (a divisor of 80)
+#ifndef ROUNDS_PER_TASK
+#define ROUNDS_PER_TASK 80
+#endif
+
+#if 80 % ROUNDS_PER_TASK != 0
+#error ROUNDS_PER_TASK must divide 80
+#endif
+
+#define SHA_BLOCKSIZE 64
+#define SHA_ROUNDS 80
+
+// Blocks of the padded message: the input, the 0x80 byte and the 64-bit
+// length in bits
+#define NUM_BLOCKS ((unsigned)((INPUT_BYTES + 8) / SHA_BLOCKSIZE + 1))
+
+/** @brief State of the hash between task executions
+ *  @details The digest is updated once per block. Within a block the
+ *           working variables and the last 16 words of the message schedule
+ *           carry the compression from one execution to the next.
+ */
+typedef struct {
+    uint32_t digest[5];
+    uint32_t work[5];   // A, B, C, D, E
+    uint32_t w[16];     // message schedule, W[t] is w[t % 16]
+    uint32_t cycles;    // cycles of the executions that committed
+    uint16_t block;     // block being compressed
+    uint16_t round;     // next round of the block
+} sha_state_t;
+
+TASK(1, task_init)
+TASK(2, task_compress)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct sha_args {
+    CHAN_FIELD(sha_state_t, sha);
+};
+
+struct sha_state {
+    SELF_CHAN_FIELD(sha_state_t, sha);
+};
+
+#define FIELD_INIT_sha_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_compress, sha_args);
+SELF_CHANNEL(task_compress, sha_state);
+CHANNEL(task_compress, task_done, sha_args);
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+#define ROT32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/* Byte of the padded message */
+static uint8_t msg_byte(uint32_t pos) {
+    uint32_t end = (uint32_t)NUM_BLOCKS * SHA_BLOCKSIZE;
+
+    if (pos < INPUT_BYTES)
+        return input[pos];
+    if (pos == INPUT_BYTES)
+        return 0x80;
+    // The length in bits is below 2^32, so only the last 4 bytes are set
+    if (pos >= end - 4)
+        return (INPUT_BYTES << 3) >> ((end - 1 - pos) << 3);
+    return 0;
+}
+
+/* Big-endian word i of a block of the padded message */
+static uint32_t msg_word(uint16_t block, unsigned i) {
+    uint32_t pos = (uint32_t)block * SHA_BLOCKSIZE + 4 * i;
+
+    if (pos + 4 <= INPUT_BYTES)
+        return ((uint32_t)input[pos] << 24) | ((uint32_t)input[pos + 1] << 16) |
+               ((uint32_t)input[pos + 2] << 8) | input[pos + 3];
+
+    return ((uint32_t)msg_byte(pos) << 24) | ((uint32_t)msg_byte(pos + 1) << 16) |
+           ((uint32_t)msg_byte(pos + 2) << 8) | msg_byte(pos + 3);
+}
+
+/** @brief Rounds [first, last) of the compression of a block (sha_transform)
+ *  @details The schedule is computed in place over a window of 16 words, so
+ *           the state to carry over is the same at every round. Built with
+ *           SHA0, the schedule is not rotated, as in MiBench's default build.
+ */
+static void sha_rounds(sha_state_t *s, unsigned first, unsigned last) {
+    uint32_t A = s->work[0], B = s->work[1], C = s->work[2],
+             D = s->work[3], E = s->work[4];
+    uint32_t temp, f, k, w;
+    unsigned t;
+
+    for (t = first; t < last; ++t) {
+        if (t >= 16) {
+            w = s->w[(t - 3) & 15] ^ s->w[(t - 8) & 15] ^
+                s->w[(t - 14) & 15] ^ s->w[t & 15];
+#ifndef SHA0
+            w = ROT32(w, 1);
+#endif
+            s->w[t & 15] = w;
+        }
+
+        if (t < 20) {
+            f = (B & C) | (~B & D);
+            k = 0x5a827999UL;
+        } else if (t < 40) {
+            f = B ^ C ^ D;
+            k = 0x6ed9eba1UL;
+        } else if (t < 60) {
+            f = (B & C) | (B & D) | (C & D);
+            k = 0x8f1bbcdcUL;
+        } else {
+            f = B ^ C ^ D;
+            k = 0xca62c1d6UL;
+        }
+
+        temp = ROT32(A, 5) + f + E + s->w[t & 15] + k;
+        E = D;
+        D = C;
+        C = ROT32(B, 30);
+        B = A;
+        A = temp;
+    }
+
+    s->work[0] = A;
+    s->work[1] = B;
+    s->work[2] = C;
+    s->work[3] = D;
+    s->work[4] = E;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+    ++boots;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %n bytes, %u blocks\r\n", INPUT_BYTES, NUM_BLOCKS);
+
+    sha_state_t s = {
+        .digest = { 0x67452301UL, 0xefcdab89UL, 0x98badcfeUL,
+                    0x10325476UL, 0xc3d2e1f0UL },
+    };
+
+    CHAN_OUT1(sha_state_t, sha, s, CH(task_init, task_compress));
+    TRANSITION_TO(task_compress);
+}
+
+/* Runs ROUNDS_PER_TASK rounds of the compression of one block */
+void task_compress() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    sha_state_t s;
+    unsigned i;
+
+    s = *CHAN_IN2(sha_state_t, sha, CH(task_init, task_compress),
+                  SELF_IN_CH(task_compress));
+
+    if (s.round == 0) {
+        for (i = 0; i < 16; ++i)
+            s.w[i] = msg_word(s.block, i);
+        for (i = 0; i < 5; ++i)
+            s.work[i] = s.digest[i];
+    }
+
+    sha_rounds(&s, s.round, s.round + ROUNDS_PER_TASK);
+    s.round += ROUNDS_PER_TASK;
+
+    if (s.round == SHA_ROUNDS) {
+        for (i = 0; i < 5; ++i)
+            s.digest[i] += s.work[i];
+        s.block++;
+        s.round = 0;
+    }
+
+    s.cycles += msp_cycles() - start;
+
+    if (s.block < NUM_BLOCKS) {
+        CHAN_OUT1(sha_state_t, sha, s, SELF_OUT_CH(task_compress));
+        TRANSITION_TO(task_compress);
+    }
+    CHAN_OUT1(sha_state_t, sha, s, CH(task_compress, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the digest, and the throughput over the cycles of the task
+ * executions that committed, which excludes the work lost to power failures */
+void task_done() {
+    task_prologue();
+
+    sha_state_t s = *CHAN_IN1(sha_state_t, sha, CH(task_compress, task_done));
+    unsigned i;
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    // libmspprintf has no 32-bit hex: each word is printed as two halves
+    for (i = 0; i < 5; ++i) {
+        PRINTF("%s%04x%04x", i ? " " : "", (unsigned)(s.digest[i] >> 16),
+               (unsigned)s.digest[i]);
+    }
+    PRINTF("\r\n");
+    PRINTF("%n bytes, %u blocks of %u rounds per task: Cycles %n\r\n",
+           (unsigned long)INPUT_BYTES, NUM_BLOCKS, ROUNDS_PER_TASK,
+           (unsigned long)s.cycles);
+    PRINTF("bytes/s: %n at %n Hz\r\n",
+           (unsigned long)((uint64_t)INPUT_BYTES * CPU_FREQ / s.cycles),
+           (unsigned long)CPU_FREQ);
+    PRINTF("bytes/power cycle: %n over %u boots\r\n",
+           (unsigned long)(INPUT_BYTES / boots), boots);
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,44 @@
+#! /bin/bash
+#
+# Generate input.h from the first samples of the MiBench adpcm speech clip,
+# with the CRC-32 of the first bytes of the coded clip (the gzip trailer), as
+# rawcaudio wrote them to data/small.adpcm, to check the result
+#
+# The coder packs two samples per byte, so samples must be even.
+#
+# Usage: ./gen_input.sh [samples] [adpcm data dir] > input.h
+
+SAMPLES=${1:-8192}
+DATA=${2:-../../../mibench-src/telecomm/adpcm/data}
+
+CRC=$(head -c $((SAMPLES / 2)) $DATA/small.adpcm | gzip -c | tail -c 8 |
+      head -c 4 | od -An -tx1 | awk '{ print $4 $3 $2 $1 }')
+
+head -c $((SAMPLES * 2)) $DATA/small.pcm | od -An -v -td2 | awk -v crc=$CRC '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench adpcm small.pcm */"
+        print ""
+    }
+    {
+        for (f = 1; f <= NF; ++f) {
+            if (n % 8 == 0)
+                line = "   "
+            line = line sprintf(" %6d,", $f)
+            if (n % 8 == 7) {
+                body = body line "\n"
+                line = ""
+            }
+            ++n
+        }
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define INPUT_SAMPLES " n "U"
+        print "#define ADPCM_CRC32 0x" crc "UL"
+        print ""
+        print "__ro_nv static const int16_t input[INPUT_SAMPLES] = {"
+        printf "%s", body
+        print "};"
+    }
+'
@@ -0,0 +1,1031 @@
+/* Generated by gen_input.sh from MiBench adpcm small.pcm */
+
+#define INPUT_SAMPLES 8192U
+#define ADPCM_CRC32 0xbd45812fUL
+
+__ro_nv static const int16_t input[INPUT_SAMPLES] = {
+       166,   1317,   2237,   2392,   2024,   1814,   2069,   2864,
+      3382,   3551,   2893,   1367,    141,   -701,   -794,   -886,
+      -782,  -1693,  -2542,  -3893,  -4294,  -3873,  -2533,  -1317,
+      -889,   -837,  -1034,   -658,     85,   1699,   3214,   3724,
+      3837,   2798,   2208,   1772,   2214,   2769,   2541,   1543,
+      -228,  -1839,  -2592,  -2707,  -2273,  -2030,  -2492,  -3038,
+     -3714,  -3766,  -2994,  -1360,    214,    961,   1356,    962,
+      1168,   1585,   3149,   4304,   4648,   4150,   2632,   1469,
+       866,    671,    786,    478,   -422,  -2119,  -3345,  -4227,
+     -4166,  -3174,  -2363,  -2120,  -2316,  -2577,  -2297,  -1111,
+       369,   2116,   3354,   3195,   2884,   2450,   2546,   3207,
+      4044,   3971,   2950,   1275,   -497,  -1474,  -1932,  -1599,
+     -1592,  -2120,  -3307,  -4378,  -4759,  -4148,  -2707,  -1359,
+      -446,      7,   -393,    -91,    925,   2383,   4099,   4973,
+      4482,   3379,   2169,   1704,   1814,   2316,   2034,    927,
+     -1230,  -2704,  -4013,  -3937,  -3229,  -2738,  -2580,  -3148,
+     -3744,  -3848,  -2584,   -670,   1321,   2157,   2616,   2016,
+      1880,   2444,   3769,   4809,   4872,   3914,   2317,    680,
+      -419,   -625,   -341,   -646,  -1443,  -3343,  -4847,  -5529,
+     -4902,  -3426,  -2067,  -1252,  -1258,  -1687,  -1199,    116,
+      2044,   3744,   4741,   4624,   3643,   2676,   2665,   3028,
+      3394,   3123,   1699,   -250,  -2310,  -3437,  -3303,  -2894,
+     -2512,  -2915,  -4074,  -4693,  -4620,  -3636,  -1455,    238,
+      1316,   1713,   1320,   1736,   2589,   4069,   5357,   5662,
+      4621,   2901,   1224,    458,    228,    579,    322,  -1186,
+     -2931,  -4664,  -5503,  -5262,  -3908,  -2520,  -1958,  -2449,
+     -2612,  -2340,   -881,   1525,   3617,   4835,   4643,   3766,
+      3009,   3225,   3773,   4262,   4142,   2480,    425,  -1725,
+     -3139,  -3053,  -2857,  -2617,  -3246,  -4609,  -5386,  -5618,
+     -4051,  -2151,   -190,    929,   1082,    906,   1260,   2518,
+      4150,   5725,   6050,   5042,   3492,   1661,   1060,   1150,
+      1286,    494,  -1049,  -3102,  -5106,  -5730,  -5501,  -4092,
+     -2940,  -2683,  -2803,  -3104,  -2809,  -1012,   1242,   3501,
+      4513,   4568,   3820,   3127,   3562,   4152,   4793,   4510,
+      3052,    475,  -1791,  -3028,  -3050,  -2436,  -2719,  -3500,
+     -5000,  -6044,  -5830,  -4580,  -2471,    -99,    986,   1014,
+       662,   1255,   2536,   4473,   5962,   6489,   5515,   3463,
+      2136,   1062,   1169,   1445,    664,  -1033,  -3583,  -5530,
+     -5997,  -5596,  -4201,  -3090,  -2809,  -3090,  -3356,  -2779,
+      -669,   1743,   4131,   4860,   4748,   3992,   3412,   3668,
+      4480,   5389,   4808,   2740,    162,  -2132,  -3297,  -3320,
+     -2750,  -2687,  -3878,  -5363,  -6300,  -6139,  -4463,  -2024,
+       235,   1374,   1438,    979,   1621,   3101,   5115,   6599,
+      6591,   5451,   3436,   1619,    691,    747,   1126,    141,
+     -1847,  -4044,  -5980,  -6602,  -5878,  -4299,  -3118,  -2412,
+     -3087,  -3198,  -2375,    -55,   2671,   4858,   5549,   5207,
+      4166,   3697,   3784,   4380,   5011,   4072,   2068,   -719,
+     -3038,  -4305,  -3773,  -3306,  -3439,  -4034,  -5717,  -6432,
+     -5766,  -3710,   -983,   1219,   2335,   2309,   2023,   2228,
+      3725,   5909,   7115,   6965,   5138,   2920,    755,   -219,
+       142,    181,  -1011,  -2828,  -5342,  -6828,  -6882,  -5730,
+     -3809,  -2219,  -1997,  -2015,  -2032,  -1139,   1062,   3905,
+      5826,   6357,   5583,   4128,   3574,   3243,   3916,   4060,
+      3254,    446,  -2441,  -4521,  -5174,  -4896,  -3979,  -3585,
+     -4414,  -5374,  -5989,  -4924,  -2620,    265,   2890,   3745,
+      3231,   2920,   3350,   4680,   6193,   7082,   6147,   4173,
+      1490,   -757,  -1486,  -1425,  -1470,  -2444,  -3884,  -6200,
+     -7608,  -7234,  -5047,  -2681,  -1100,   -470,   -475,   -327,
+       540,   3148,   5407,   7066,   6990,   5640,   3693,   2407,
+      2338,   2726,   2653,    972,  -1468,  -4479,  -6126,  -6711,
+     -5611,  -4210,  -3348,  -3626,  -4406,  -4259,  -3063,   -244,
+      2513,   4759,   5479,   4829,   4117,   3847,   4680,   5977,
+      5983,   4781,   1944,   -973,  -2928,  -3881,  -3490,  -3176,
+     -3428,  -5115,  -6623,  -7232,  -6170,  -3739,   -795,   1282,
+      1978,   1722,   1821,   2712,   4718,   6612,   7572,   6995,
+      4815,   2468,    531,    110,    182,     43,  -1483,  -3810,
+     -6437,  -7653,  -7077,  -5302,  -3410,  -2329,  -2165,  -2291,
+     -1927,   -189,   2675,   5441,   7098,   6886,   5635,   4176,
+      3227,   3634,   4045,   3885,   2069,   -970,  -3995,  -5886,
+     -6091,  -5094,  -4117,  -4056,  -4615,  -5546,  -5314,  -3875,
+      -871,   2377,   4388,   4713,   3843,   3498,   4034,   5438,
+      6844,   6682,   5116,   2435,   -459,  -2590,  -2865,  -2425,
+     -2586,  -3524,  -5467,  -7324,  -7725,  -6088,  -3708,  -1056,
+       545,   1162,    982,   1141,   2788,   5158,   7124,   8035,
+      6846,   4559,   2397,   1044,    885,   1157,    572,  -1512,
+     -4343,  -6729,  -7825,  -6805,  -5184,  -3247,  -2339,  -2806,
+     -2784,  -2094,   -107,   3139,   5697,   7057,   6512,   5317,
+      3914,   3393,   3899,   4328,   3865,   1510,  -1453,  -4596,
+     -5836,  -5820,  -4772,  -4147,  -4323,  -5206,  -5834,  -5296,
+     -2949,    236,   2947,   4396,   4626,   3895,   3607,   4378,
+      6081,   6926,   6365,   4396,   1216,  -1444,  -2992,  -3013,
+     -2771,  -3048,  -4182,  -6328,  -7485,  -7384,  -5640,  -2752,
+         9,   1249,   1357,   1113,   1710,   3477,   6029,   7867,
+      7621,   6075,   3579,   1579,    480,    377,    174,   -506,
+     -2868,  -5537,  -7612,  -7960,  -6532,  -4491,  -2516,  -1777,
+     -2047,  -2073,   -766,   1343,   4634,   6967,   7356,   6515,
+      4756,   3535,   3283,   3625,   3771,   2399,   -154,  -3199,
+     -5737,  -6506,  -5906,  -4737,  -3900,  -3996,  -4624,  -5011,
+     -3660,   -915,   2190,   4561,   5497,   5128,   4127,   4057,
+      4772,   5958,   6273,   5068,   2549,  -1007,  -3410,  -4326,
+     -3955,  -3723,  -3871,  -4822,  -6354,  -6910,  -5968,  -3566,
+      -322,   1892,   3002,   2698,   2443,   3313,   4963,   6901,
+      7710,   6782,   4358,   1762,   -437,  -1478,  -1341,  -1411,
+     -2530,  -4577,  -6860,  -7987,  -7341,  -5214,  -2501,   -855,
+       -62,     61,    306,   1329,   4003,   6452,   7796,   7469,
+      5421,   3262,   2000,   1328,   1767,   1278,   -501,  -2978,
+     -5971,  -7432,  -7216,  -5566,  -3757,  -2899,  -2713,  -3121,
+     -2569,   -790,   1997,   5110,   6893,   6990,   5726,   4040,
+      3611,   3853,   4154,   3887,   1954,   -867,  -4109,  -5841,
+     -6205,  -5232,  -3951,  -3995,  -4351,  -5385,  -4736,  -3218,
+        17,   3032,   5049,   5134,   4576,   3775,   4045,   4956,
+      6151,   5902,   4140,   1027,  -1919,  -3690,  -4031,  -3695,
+     -3382,  -4167,  -5581,  -6807,  -6699,  -4784,  -1804,    903,
+      2805,   3130,   2841,   2959,   4006,   5690,   7219,   7102,
+      5383,   2869,    194,  -1324,  -2016,  -1846,  -1865,  -3362,
+     -5458,  -7105,  -7550,  -6063,  -3429,  -1188,    446,    460,
+       508,    979,   2823,   5323,   7219,   7420,   6115,   3992,
+      2007,    898,    576,    705,   -183,  -2273,  -4947,  -6763,
+     -7578,  -6151,  -4214,  -2623,  -1476,  -1643,  -1521,   -635,
+      1454,   4152,   6667,   7319,   6121,   4555,   2826,   2562,
+      2812,   2663,   1554,   -762,  -3643,  -5953,  -6899,  -5959,
+     -4510,  -3366,  -3285,  -3792,  -3503,  -2514,    117,   2799,
+      5271,   6171,   5440,   4318,   3490,   3630,   4242,   4572,
+      3272,    630,  -2220,  -4526,  -5322,  -4958,  -4175,  -3666,
+     -4012,  -5025,  -5077,  -4098,  -1719,   1682,   3940,   4631,
+      4334,   3553,   3629,   4432,   5618,   5820,   4719,   2034,
+      -967,  -2843,  -3796,  -3709,  -3388,  -3391,  -4465,  -5958,
+     -6215,  -5266,  -2567,    117,   2346,   2854,   2670,   2772,
+      3314,   4465,   6032,   6749,   5422,   3084,    387,  -1385,
+     -2199,  -1983,  -1849,  -3105,  -4777,  -6233,  -7012,  -6083,
+     -3667,   -995,    563,   1248,   1215,   1262,   2649,   4344,
+      6253,   7071,   6202,   3887,   1771,    217,   -575,   -365,
+      -576,  -2139,  -4282,  -6364,  -6938,  -6149,  -4120,  -1885,
+      -858,   -303,   -211,    -33,   1511,   3755,   5847,   6857,
+      6226,   4225,   2566,   1190,   1056,   1200,    518,  -1021,
+     -3622,  -5798,  -6710,  -6014,  -4380,  -2645,  -1965,  -1792,
+     -1596,  -1120,    705,   3290,   5613,   6560,   5747,   4468,
+      2877,   2142,   2145,   2462,   1540,   -472,  -3069,  -5302,
+     -6062,  -5702,  -4256,  -2833,  -2492,  -2702,  -2800,  -2184,
+      -144,   2490,   4893,   5781,   5384,   4217,   2955,   3107,
+      3273,   3469,   2531,    328,  -2252,  -4288,  -5464,  -4744,
+     -3692,  -3350,  -3259,  -3880,  -4062,  -2944,   -897,   1925,
+      4066,   4942,   4589,   3691,   3253,   3540,   4315,   4135,
+      3530,   1248,  -1405,  -3433,  -4359,  -3985,  -3333,  -2998,
+     -3752,  -4604,  -4824,  -3578,  -1297,   1028,   3167,   4074,
+      3571,   3328,   2919,   3737,   4690,   4840,   3686,   1552,
+     -1068,  -2681,  -3387,  -3201,  -2905,  -2930,  -3789,  -4889,
+     -5089,  -4037,  -1922,    489,   2341,   2886,   2715,   2635,
+      2793,   3812,   4881,   5415,   4064,   2058,   -302,  -2092,
+     -2625,  -2403,  -2231,  -3024,  -4190,  -4980,  -5425,  -4421,
+     -2077,     11,   1839,   2070,   2269,   2113,   2780,   4019,
+      5024,   5566,   4367,   2177,    209,  -1298,  -1666,  -1535,
+     -1698,  -2829,  -3884,  -5404,  -5359,  -4295,  -2289,   -323,
+       993,   1382,   1331,   1538,   2433,   4112,   5218,   5549,
+      4437,   2215,    537,   -702,  -1005,  -1102,  -1515,  -2346,
+     -4107,  -5099,  -5499,  -4373,  -2298,   -650,    429,    785,
+       688,   1061,   2434,   4192,   5286,   5146,   4067,   2503,
+       566,   -289,   -611,   -532,  -1167,  -2289,  -4071,  -5346,
+     -5088,  -4216,  -2172,   -665,    144,     65,    303,   1094,
+      2469,   4056,   4968,   5145,   4137,   2199,    611,    -43,
+       -29,    -78,   -972,  -2418,  -3889,  -5122,  -5199,  -3674,
+     -2071,   -977,   -294,   -372,     91,    821,   2096,   4016,
+      5137,   4676,   3693,   2177,    766,    605,    389,     13,
+      -592,  -2172,  -3862,  -4854,  -4557,  -3561,  -2009,  -1041,
+      -726,   -437,   -341,    708,   2058,   3845,   4856,   4770,
+      3527,   1870,    852,    742,    839,    303,   -641,  -2105,
+     -3931,  -4554,  -4485,  -3354,  -1836,   -920,   -857,   -824,
+      -490,    759,   2045,   3753,   4556,   4345,   3218,   1878,
+      1071,    743,    784,    540,   -572,  -2103,  -3746,  -4526,
+     -4275,  -2907,  -1977,   -907,   -774,   -974,   -408,    541,
+      2216,   3592,   4366,   3741,   2980,   1831,   1065,    922,
+      1061,    465,   -657,  -2508,  -3874,  -4292,  -3699,  -2600,
+     -1585,   -909,  -1111,  -1102,   -302,    958,   2457,   3880,
+      4163,   3648,   2655,   1523,    884,   1075,   1045,    304,
+      -831,  -2614,  -3763,  -4004,  -3246,  -2259,  -1299,   -980,
+     -1158,   -937,   -189,    942,   2715,   3648,   3724,   3283,
+      2176,   1300,   1131,    937,    807,    171,  -1226,  -2473,
+     -3824,  -3971,  -3191,  -2251,  -1238,   -822,  -1073,   -956,
+      -293,   1266,   2761,   3393,   3617,   2991,   1995,   1241,
+       828,    960,    584,   -134,  -1140,  -2868,  -3453,  -3574,
+     -2786,  -1774,  -1048,   -824,   -753,   -566,    115,   1601,
+      2872,   3578,   3556,   2543,   1676,    908,    878,    904,
+       741,   -308,  -1494,  -2859,  -3608,  -3297,  -2220,  -1568,
+      -764,   -949,   -768,   -331,    259,   1562,   2696,   3383,
+      3175,   2347,   1214,    837,    694,    720,    319,   -629,
+     -1854,  -2887,  -3202,  -2750,  -1979,  -1247,   -640,   -531,
+      -452,   -264,    910,   2036,   2937,   3398,   2625,   1879,
+       838,    620,    406,    287,    162,   -887,  -1941,  -2873,
+     -3226,  -2470,  -1852,   -789,   -473,   -341,   -493,    237,
+       828,   2204,   2984,   3104,   2288,   1480,    700,    512,
+       363,    164,   -151,  -1198,  -2194,  -2685,  -2732,  -2279,
+     -1327,   -727,   -215,   -244,    -48,    264,   1397,   2309,
+      2993,   2908,   2038,   1118,    446,    115,    -35,     -8,
+      -603,  -1551,  -2282,  -2732,  -2579,  -1704,   -965,   -381,
+       -57,    -52,    210,    750,   1315,   2218,   2488,   2437,
+      1626,    778,    250,   -354,    -89,   -236,   -703,  -1468,
+     -2200,  -2662,  -2340,  -1515,   -427,     60,    453,    161,
+       470,    854,   1685,   2065,   2312,   1854,   1085,    329,
+      -316,   -316,   -560,   -619,  -1175,  -1778,  -2031,  -2265,
+     -1684,   -840,   -108,    409,    556,    461,    591,    994,
+      1721,   2149,   2143,   1539,    549,    -78,   -529,   -618,
+      -511,   -900,  -1120,  -1502,  -2171,  -1842,  -1394,   -532,
+       252,    700,    873,    757,    956,   1303,   1546,   2006,
+      1814,   1254,    195,   -547,   -938,   -803,   -802,   -799,
+     -1377,  -1436,  -1992,  -1732,   -950,    -69,    642,    765,
+       963,    714,    763,   1344,   1349,   1690,   1281,    687,
+      -256,   -879,  -1126,  -1149,   -686,   -968,  -1097,  -1428,
+     -1624,   -955,   -345,    241,    878,    938,   1181,    902,
+       751,    920,   1394,   1303,    915,    128,   -447,  -1124,
+     -1125,   -888,  -1047,   -861,  -1085,  -1250,  -1283,   -647,
+        13,    573,   1132,   1148,   1049,    745,    620,   1056,
+       933,   1008,    279,   -117,   -657,  -1354,  -1258,  -1168,
+      -968,   -563,   -829,   -863,   -817,   -378,    477,   1034,
+      1397,   1270,    832,    654,    507,    646,    898,    585,
+        88,   -521,  -1168,  -1339,   -986,   -990,   -423,   -722,
+      -417,   -736,   -225,    239,    492,    898,   1329,    887,
+       948,    433,    478,    318,    377,    105,    -93,   -789,
+     -1245,  -1271,   -836,   -718,   -354,   -187,    -89,   -351,
+       -67,    265,    803,    966,   1016,    811,    393,    132,
+       133,    321,    258,   -155,   -328,   -789,  -1056,   -836,
+      -915,   -504,   -270,    -29,     18,    -94,    453,    696,
+       853,   1147,    742,    794,    280,   -153,   -206,     58,
+      -270,   -315,   -826,   -879,   -758,   -905,   -393,   -161,
+       -45,    223,    336,     76,    342,    616,    644,    796,
+       700,    192,    148,   -318,   -334,   -110,   -496,   -340,
+      -552,   -918,   -630,   -594,   -291,    302,    166,    307,
+       318,    200,    603,    574,    610,    618,    494,     19,
+      -380,   -300,   -374,   -353,   -491,   -391,   -380,   -456,
+      -349,   -103,   -102,    184,    507,    237,    510,    283,
+       243,    502,    514,    271,    104,    -75,   -293,   -653,
+      -248,   -281,   -305,   -414,   -486,   -412,   -115,    -36,
+        86,    349,    610,    278,    454,    341,    446,    339,
+       241,    -99,      5,   -451,   -633,   -383,   -343,   -378,
+      -272,   -306,   -170,     -4,    182,    100,    505,    608,
+       596,    256,     70,    -15,    186,    272,     52,     26,
+      -347,   -430,   -251,   -537,   -422,     26,     34,     -8,
+       128,     31,    229,    433,    244,    307,    163,    188,
+        72,     71,    -80,    -34,    119,   -270,   -304,   -165,
+      -295,   -209,   -292,    -99,     52,     90,   -127,    185,
+       331,    417,    403,    452,    298,     60,    -24,     -8,
+      -277,   -169,    -53,   -256,   -161,   -117,    -82,   -240,
+        -3,    -58,    180,    100,     47,    -69,     94,    348,
+       225,    102,    -80,   -206,     76,   -262,      0,     47,
+      -259,    -81,      5,     44,   -228,    -33,    139,      1,
+       232,     40,     75,     36,    -64,     -5,     97,     70,
+       -82,   -221,   -310,    -35,   -212,   -108,     -1,     71,
+        72,     89,    172,    176,    -96,    215,    182,    -73,
+       -13,     53,   -147,     16,    198,     60,      0,    -10,
+      -293,   -238,   -218,   -175,    -70,     43,     82,    100,
+       158,    166,     61,   -109,    -72,   -128,    151,   -203,
+       163,    106,    105,    140,    -39,    -62,   -231,    114,
+      -194,   -149,    -47,   -179,    142,   -179,    117,    174,
+      -112,    157,    204,    -11,    -37,     56,   -136,   -114,
+       -38,     40,   -112,     21,     84,   -149,     53,     87,
+       187,    -15,     60,     -3,    182,     86,    -51,    195,
+       117,     66,    182,     34,     65,     74,    -26,    113,
+        -1,    -38,    -94,    182,   -154,     -5,   -113,     22,
+      -146,     -4,   -132,    155,     51,    112,     25,     19,
+      -119,   -126,   -194,   -147,    146,    -58,   -159,     64,
+      -183,   -164,    -89,     90,    116,     90,     10,    -78,
+      -143,    118,    -99,   -104,    -94,    -19,    113,    -43,
+       174,    179,    -89,     24,     93,    137,   -152,    178,
+      -185,   -144,   -168,    159,     -5,   -131,     21,      8,
+       -97,    129,   -104,   -185,     19,    110,    -55,     86,
+        37,     49,    183,    143,   -166,    101,    -96,    205,
+        70,     -5,      8,    -52,    -73,     57,    -71,    -60,
+       107,    -42,    -92,    -74,     60,    163,    155,    166,
+        86,   -156,    179,    -92,    150,    -96,    153,    -64,
+       107,    113,   -118,    159,     34,     -5,    168,    -83,
+      -174,     38,    135,      6,    -85,   -155,    105,    184,
+       -20,   -200,   -114,   -214,     81,   -243,     97,    -34,
+      -152,    148,    136,   -163,   -122,    126,     41,    281,
+       129,    164,    211,   -126,   -152,     88,    -64,   -159,
+      -115,   -205,    -52,    -81,   -174,    -71,     47,    163,
+        48,    195,    177,    -34,    221,    163,    186,   -162,
+       -23,    -80,   -328,    -83,   -209,    -93,    -13,     74,
+      -188,    -16,   -163,     59,    133,    206,    236,    242,
+       161,    -52,    -36,    204,     39,     60,    -95,    -17,
+      -187,   -222,   -215,    -53,   -156,    224,     15,    108,
+       146,    195,    148,    356,    341,    204,     22,   -231,
+      -123,    -16,    -96,    -25,   -334,   -366,   -140,     90,
+        31,    -57,    359,     29,    300,    198,     45,    215,
+       424,     87,    166,   -318,   -317,   -345,   -184,    -50,
+       -50,    -25,   -132,    -61,     50,     31,    425,    242,
+       167,    270,     29,     50,    205,    227,    -26,   -173,
+      -109,   -489,   -501,   -328,   -139,   -144,   -202,    104,
+       123,    255,    323,    191,    385,    472,    557,     26,
+       -40,    -46,     10,   -281,     -5,   -185,   -472,   -298,
+      -547,   -284,   -124,    353,    182,    320,    146,    109,
+       468,    449,    544,    389,    316,    -25,   -410,   -338,
+      -305,   -458,   -150,   -492,   -281,   -187,   -297,    -73,
+       375,    388,    496,    483,    487,    302,    208,     56,
+        -5,     65,   -485,   -625,   -781,   -763,   -499,   -406,
+        19,   -165,     81,    184,    450,    354,    749,    891,
+       571,    341,    211,   -314,   -272,   -390,   -418,   -288,
+      -771,   -806,   -802,   -291,   -311,    329,    252,    318,
+       441,    284,    518,    784,    652,    743,    424,   -307,
+      -682,   -615,   -478,   -701,   -332,   -445,   -353,   -620,
+      -471,    212,    416,    784,   1066,    729,    433,    168,
+       398,    287,     -3,     74,   -507,   -989,   -871,   -867,
+      -839,   -396,    -23,     74,     27,    222,    506,    733,
+       978,   1245,   1002,    411,     14,   -226,   -435,   -445,
+      -491,   -553,   -741,  -1135,  -1196,   -870,   -232,    484,
+       708,    688,    734,    772,    636,    832,    956,    754,
+        69,   -354,   -926,  -1112,  -1199,   -987,   -431,   -549,
+      -406,   -463,   -179,    132,    697,   1083,   1422,   1187,
+       852,    392,    386,    280,     70,   -316,   -630,  -1346,
+     -1447,  -1503,   -812,   -259,    131,    310,    340,    491,
+       413,   1088,   1195,   1280,   1311,    433,    -52,   -487,
+      -682,   -850,   -914,  -1001,  -1051,  -1116,  -1057,   -793,
+       -82,    785,   1009,   1378,   1239,    937,    915,    799,
+      1009,    729,      9,   -613,  -1386,  -1501,  -1577,  -1186,
+      -662,   -448,   -403,   -320,     38,    353,   1106,   1702,
+      1768,   1372,    832,    380,   -292,   -345,   -456,   -609,
+      -847,  -1631,  -1951,  -1525,   -866,    -22,    360,    961,
+       983,    857,    903,   1032,   1442,   1650,   1091,    505,
+      -677,  -1141,  -1565,  -1230,  -1000,   -969,  -1129,  -1259,
+      -827,   -271,    309,   1150,   1746,   1827,   1471,    836,
+       674,    554,    629,    207,   -366,  -1371,  -2021,  -2309,
+     -1885,  -1159,   -555,    208,    213,    385,    668,   1093,
+      1645,   1990,   2091,   1373,    606,   -270,   -983,  -1070,
+      -991,  -1088,  -1342,  -1627,  -1772,  -1370,   -539,    369,
+      1361,   1906,   1885,   1266,   1358,   1071,   1257,   1213,
+       802,   -252,  -1446,  -2285,  -2439,  -2088,  -1187,   -737,
+      -655,   -577,   -133,    503,   1065,   2039,   2611,   2481,
+      1729,    500,    -72,   -390,   -703,   -738,   -971,  -1815,
+     -2565,  -2378,  -1841,   -986,    553,    969,   1456,   1506,
+      1386,   1678,   1695,   2278,   1663,   1070,   -326,  -1595,
+     -2340,  -2245,  -1897,  -1536,  -1206,  -1198,  -1103,   -794,
+       420,   1474,   2688,   2984,   2517,   1765,    826,    562,
+       341,    -76,   -288,  -1314,  -2549,  -3029,  -2873,  -1892,
+      -860,    226,    850,    895,    947,   1249,   2104,   2617,
+      2844,   2017,   1016,   -560,  -1401,  -1959,  -1817,  -1564,
+     -1475,  -1852,  -2073,  -1829,   -977,    665,   1851,   2573,
+      2635,   2206,   1698,   1045,   1169,    872,    707,   -634,
+     -1723,  -2898,  -3361,  -3099,  -1740,   -862,    -31,    247,
+       344,    697,   1763,   2552,   3444,   3213,   2033,    857,
+      -743,  -1350,  -1658,  -1511,  -1600,  -1973,  -2570,  -2726,
+     -2349,   -869,    973,   2309,   2784,   2682,   2246,   1634,
+      1641,   1773,   1505,    553,   -718,  -2213,  -3287,  -3615,
+     -2874,  -1659,   -900,   -690,   -482,     22,   1030,   2128,
+      3228,   3702,   3464,   2096,    283,   -566,  -1093,  -1339,
+     -1561,  -2005,  -2593,  -3344,  -3398,  -1977,   -240,   1268,
+      2268,   2474,   2357,   1837,   1939,   2340,   2326,   1747,
+       188,  -1389,  -3033,  -3760,  -3458,  -2571,  -1575,  -1210,
+     -1063,   -770,    -98,   1417,   2876,   4131,   4099,   2948,
+      1393,    283,   -341,   -852,   -942,  -1435,  -2521,  -3474,
+     -4154,  -3349,  -1516,    113,   1801,   2192,   2341,   2236,
+      2333,   2848,   2854,   2978,   1437,   -314,  -2339,  -3460,
+     -3817,  -3004,  -2363,  -1742,  -1634,  -1373,   -799,    508,
+      2293,   3907,   4575,   4091,   2493,   1041,    213,   -330,
+      -421,  -1001,  -2121,  -3509,  -4262,  -4314,  -2952,   -866,
+       781,   1904,   2264,   2056,   2367,   2891,   3527,   3698,
+      2622,    591,  -1460,  -2995,  -3712,  -3687,  -2777,  -2231,
+     -1902,  -2127,  -1723,   -580,   1526,   3646,   4620,   4481,
+      3486,   1720,    758,     14,   -289,   -444,  -1514,  -3239,
+     -4580,  -4847,  -3835,  -1750,     24,   1580,   2390,   2282,
+      2192,   2627,   3480,   3813,   3425,   2018,   -503,  -2804,
+     -4014,  -3853,  -3378,  -2447,  -2165,  -2226,  -1930,  -1252,
+       745,   2939,   4615,   5190,   4257,   2665,   1056,    423,
+       128,   -274,  -1145,  -2912,  -4480,  -5075,  -4564,  -2940,
+      -473,   1117,   2246,   2310,   2186,   2455,   3363,   4003,
+      4102,   2740,    578,  -2129,  -3924,  -4144,  -3720,  -2783,
+     -2407,  -2474,  -2259,  -1845,     44,   2392,   4462,   5350,
+      4906,   3410,   1713,    510,   -180,   -417,   -789,  -2504,
+     -4056,  -5218,  -5249,  -3718,  -1368,    980,   2388,   2593,
+      2537,   2769,   3325,   4077,   4326,   3235,   1132,  -1673,
+     -3714,  -4427,  -4501,  -3559,  -2450,  -2163,  -2268,  -1954,
+      -585,   1941,   4177,   5485,   5408,   4237,   2187,    676,
+      -305,   -394,  -1084,  -1920,  -3647,  -5336,  -5661,  -4575,
+     -1939,    659,   2444,   3108,   2906,   2702,   3186,   3884,
+      4110,   3712,   1796,   -852,  -3600,  -5143,  -5127,  -3891,
+     -2949,  -2002,  -1775,  -1773,   -632,   1330,   3980,   5748,
+      5907,   4712,   2808,    856,   -644,   -851,  -1498,  -2191,
+     -3310,  -4868,  -5568,  -5007,  -2466,    143,   2652,   3510,
+      3512,   3255,   3334,   3512,   3987,   3446,   1829,   -624,
+     -3354,  -5542,  -5475,  -4664,  -3128,  -1788,  -1575,  -1132,
+      -197,   1414,   3607,   5566,   6491,   5428,   3197,    795,
+     -1118,  -1887,  -1844,  -2446,  -3269,  -4606,  -5556,  -4892,
+     -3062,      4,   2704,   4495,   4558,   3842,   3236,   3093,
+      3328,   3127,   1950,   -510,  -3637,  -5569,  -6369,  -5401,
+     -3347,  -1535,   -661,   -302,    191,   1340,   3383,   5633,
+      6468,   5571,   3285,    460,  -1595,  -2854,  -2830,  -3162,
+     -3213,  -4405,  -4936,  -4778,  -2853,      9,   3282,   4953,
+      5591,   4661,   3552,   2822,   2419,   2125,   1104,   -676,
+     -3481,  -5948,  -6878,  -5949,  -3590,  -1296,    489,   1190,
+      1321,   2267,   3420,   5228,   6307,   5575,   3385,    268,
+     -2557,  -4200,  -4119,  -3581,  -3517,  -3706,  -4021,  -4162,
+     -2541,    558,   3801,   5894,   6610,   5200,   3573,   2173,
+      1303,   1041,     20,  -1567,  -3945,  -5910,  -7180,  -6014,
+     -3478,   -815,   1706,   2483,   2670,   2811,   3744,   4938,
+      5654,   5229,   3109,   -110,  -3522,  -5238,  -5397,  -4699,
+     -3562,  -2856,  -2797,  -2730,  -1252,   1028,   3995,   6455,
+      6981,   5776,   3582,   1154,   -417,   -770,  -1452,  -2085,
+     -3850,  -6085,  -6850,  -5944,  -3328,    305,   3067,   4333,
+      4337,   3877,   3649,   4163,   4423,   3986,   1926,   -968,
+     -4462,  -6265,  -6838,  -5515,  -3498,  -1993,  -1193,   -842,
+        87,   1847,   4672,   6743,   7449,   6065,   3134,    181,
+     -1934,  -2803,  -3211,  -3384,  -3927,  -5442,  -5726,  -4978,
+     -2284,   1088,   4153,   6079,   5825,   4469,   3432,   2900,
+      2910,   2274,    715,  -2191,  -4973,  -7297,  -7236,  -5601,
+     -2915,   -421,   1190,   1388,   1868,   3020,   4918,   6221,
+      6705,   5053,   2068,  -1483,  -4215,  -5241,  -4715,  -3971,
+     -3785,  -3860,  -4093,  -3078,   -723,   2312,   5610,   7366,
+      6903,   4811,   2498,   1039,    212,    -93,  -1051,  -3091,
+     -5650,  -7047,  -6960,  -4986,  -1714,   1624,   3564,   4177,
+      3975,   3606,   4219,   4937,   5071,   3809,    670,  -3014,
+     -5816,  -6995,  -6099,  -4329,  -2821,  -1721,  -1613,   -627,
+       845,   3672,   6359,   7702,   6823,   4371,   1103,  -1375,
+     -2707,  -3097,  -2929,  -3804,  -5053,  -6110,  -5734,  -3404,
+       150,   3708,   5941,   6014,   5287,   3895,   3155,   2849,
+      2693,   1107,  -1191,  -4331,  -6872,  -7941,  -6234,  -3842,
+      -933,    828,   1663,   2044,   2922,   4532,   6377,   7127,
+      5950,   3082,   -745,  -3866,  -5390,  -5412,  -4471,  -3833,
+     -3922,  -3999,  -3286,  -1061,   2191,   5250,   7331,   7432,
+      5418,   3176,    891,   -372,   -886,  -1498,  -3189,  -5269,
+     -6952,  -7129,  -5492,  -1976,   1595,   3868,   4795,   4415,
+      3848,   3951,   4795,   4759,   3377,    521,  -3265,  -6155,
+     -7386,  -6681,  -4685,  -2486,  -1049,   -471,    -90,   1605,
+      3835,   6329,   7868,   7119,   4265,    799,  -2242,  -3653,
+     -4277,  -3888,  -4047,  -4678,  -5370,  -4905,  -2775,    616,
+      4399,   6821,   7052,   5761,   3773,   2292,   1729,    924,
+       -96,  -2107,  -4848,  -7128,  -7704,  -6318,  -3253,     65,
+      2290,   3367,   3313,   3480,   4446,   5438,   5771,   4906,
+      2043,  -1940,  -5277,  -6830,  -6555,  -5009,  -3468,  -2529,
+     -2190,  -1409,    322,   3048,   6209,   7828,   7520,   5431,
+      2110,   -666,  -2378,  -2834,  -3079,  -3909,  -5200,  -6115,
+     -5987,  -4089,   -326,   3216,   5950,   6718,   5427,   4119,
+      2982,   2583,   2484,   1182,  -1238,  -4235,  -7006,  -7943,
+     -6744,  -3976,   -967,   1323,   2415,   2615,   3086,   4408,
+      5897,   6427,   5488,   2501,  -1265,  -4497,  -6054,  -5840,
+     -4662,  -3525,  -3153,  -2891,  -2204,   -468,   2438,   5986,
+      7808,   7758,   5447,   2271,    -68,  -1813,  -2087,  -2694,
+     -3668,  -5113,  -6529,  -6661,  -4544,   -747,   2886,   5507,
+      6288,   5507,   4267,   3251,   3158,   2987,   1537,  -1010,
+     -4286,  -6991,  -7781,  -6857,  -3837,   -908,    744,   1780,
+      2293,   2921,   4417,   6103,   6855,   5637,   2913,   -854,
+     -4465,  -5919,  -5910,  -4702,  -3721,  -3216,  -3358,  -2595,
+      -467,   2805,   5803,   7504,   7500,   5358,   2265,     75,
+     -1622,  -2113,  -2642,  -3456,  -5116,  -6802,  -6515,  -4186,
+      -702,   3096,   5306,   5800,   5005,   3880,   3184,   3091,
+      2939,   1394,  -1135,  -4280,  -6911,  -7724,  -6507,  -3646,
+      -751,   1150,   1851,   2132,   2955,   4600,   5967,   6610,
+      5493,   2190,  -1571,  -4439,  -6029,  -5568,  -4414,  -3325,
+     -3078,  -2740,  -1916,     48,   2952,   5928,   7833,   7254,
+      4695,   1761,   -521,  -2006,  -2443,  -2561,  -3805,  -5288,
+     -6377,  -5740,  -3397,    227,   3676,   5577,   5952,   5032,
+      3671,   3019,   2681,   2334,    700,  -2078,  -4980,  -7102,
+     -7348,  -5795,  -2852,   -138,   1820,   2395,   2887,   3496,
+      4719,   5921,   6214,   4546,   1222,  -2517,  -5301,  -6442,
+     -5632,  -4212,  -2758,  -2551,  -2087,  -1198,   1055,   4021,
+      6673,   7412,   6541,   3740,    565,  -1824,  -2917,  -3138,
+     -3208,  -4022,  -5279,  -5925,  -4723,  -2358,   1570,   4685,
+      6471,   6306,   4681,   3056,   2032,   1797,   1024,   -363,
+     -3057,  -5649,  -7126,  -6897,  -4631,  -1494,   1351,   3059,
+      3480,   3190,   3836,   4586,   5023,   5048,   3034,   -377,
+     -3899,  -6356,  -6533,  -5442,  -3559,  -1884,   -971,   -805,
+       337,   2183,   4712,   6821,   6915,   5537,   2315,   -979,
+     -3216,  -3988,  -3991,  -3786,  -3727,  -4456,  -4397,  -3113,
+      -326,   3141,   5781,   6906,   6019,   3843,   1797,    441,
+       -74,   -475,  -1992,  -3939,  -5974,  -6902,  -5685,  -2806,
+       430,   2986,   4543,   4481,   4011,   3440,   3537,   3727,
+      3059,    640,  -2420,  -5278,  -6818,  -6640,  -4627,  -2189,
+      -121,    768,   1353,   1900,   3526,   4983,   6208,   5597,
+      3630,    206,  -2945,  -4871,  -4859,  -4336,  -3455,  -3003,
+     -2986,  -2617,   -978,   1747,   4664,   6568,   6795,   4820,
+      2309,    132,  -1432,  -2203,  -2534,  -3002,  -4506,  -5385,
+     -5455,  -3807,   -722,   2625,   4897,   5625,   4733,   3303,
+      2338,   2177,   1595,    430,  -1594,  -3989,  -6115,  -6652,
+     -5182,  -2480,     -4,   2046,   2808,   3069,   3068,   3830,
+      4649,   4903,   3546,    892,  -2341,  -4884,  -6086,  -5522,
+     -3910,  -2068,  -1145,   -702,    291,   1539,   3478,   5442,
+      6406,   5486,   2825,    -73,  -2643,  -3952,  -3793,  -3447,
+     -3117,  -3616,  -3693,  -3037,   -912,   2367,   5045,   6415,
+      5991,   4038,   1900,    332,   -565,  -1190,  -1653,  -3204,
+     -4798,  -5878,  -5082,  -2898,    284,   3124,   4597,   4512,
+      3849,   2872,   2537,   2412,   1906,    510,  -2036,  -4731,
+     -6328,  -6175,  -4286,  -1810,    266,   1574,   1973,   2552,
+      3146,   4195,   4945,   4468,   2874,   -149,  -2981,  -4985,
+     -5140,  -4254,  -3042,  -1801,  -1340,   -736,    312,   1813,
+      4384,   5590,   5708,   4121,   1661,   -980,  -2752,  -3115,
+     -3027,  -2936,  -3532,  -3708,  -3428,  -2329,    367,   3230,
+      5384,   5617,   4838,   2931,   1258,    202,   -503,   -927,
+     -2188,  -3776,  -5185,  -5200,  -4084,  -1525,   1588,   3371,
+      4091,   3627,   3055,   2801,   2587,   2432,   1412,   -732,
+     -3146,  -5072,  -5632,  -4874,  -2567,   -462,   1286,   1884,
+      2138,   2618,   3323,   4292,   4566,   3557,   1034,  -1878,
+     -4065,  -4825,  -4617,  -3138,  -1820,  -1116,   -752,   -379,
+      1275,   2929,   4615,   5495,   4429,   2561,      9,  -2115,
+     -3048,  -2968,  -2694,  -2941,  -3289,  -3145,  -2249,   -362,
+      2077,   4271,   5330,   4765,   3186,   1200,    125,   -461,
+      -884,  -1610,  -2894,  -4077,  -4707,  -4121,  -1877,    641,
+      2911,   4181,   3745,   3174,   2451,   2149,   1629,   1065,
+      -140,  -2068,  -4242,  -5114,  -4715,  -3070,   -707,    951,
+      2161,   2160,   2399,   2637,   3256,   3609,   2977,   1217,
+     -1265,  -3303,  -4472,  -4381,  -3089,  -1769,   -894,   -209,
+       252,    941,   2237,   3791,   4590,   4197,   2570,    300,
+     -2112,  -3010,  -3271,  -2739,  -2509,  -2392,  -2071,  -1948,
+      -467,   1621,   3583,   4931,   4424,   3286,   1096,   -482,
+     -1281,  -1417,  -1678,  -2421,  -3160,  -3886,  -3152,  -1917,
+       451,   2555,   4032,   4121,   3160,   1884,   1203,    815,
+       171,   -629,  -1902,  -3506,  -4449,  -4219,  -2760,   -415,
+      1254,   2743,   2944,   2434,   2387,   2521,   2429,   1953,
+      1015,  -1118,  -2996,  -4287,  -4281,  -3064,  -1351,    154,
+       940,   1112,   1532,   2053,   3028,   3499,   3175,   2073,
+      -136,  -2157,  -3632,  -3467,  -3102,  -1957,  -1152,  -1044,
+      -560,    307,   1567,   2994,   4146,   3763,   2699,    800,
+     -1100,  -2279,  -2578,  -2100,  -1985,  -2078,  -2260,  -2019,
+     -1062,    794,   2878,   4018,   4001,   2753,   1478,     16,
+      -531,   -860,  -1436,  -1796,  -2847,  -3184,  -2961,  -1819,
+        35,   1875,   3298,   3167,   2621,   1828,   1351,   1011,
+       643,     19,  -1348,  -2808,  -3594,  -3670,  -2647,   -902,
+      1063,   1758,   2351,   2044,   1768,   2017,   2228,   1997,
+       733,   -665,  -2440,  -3569,  -3514,  -2653,  -1431,   -228,
+       732,    733,   1133,   1620,   2513,   2879,   2579,   1562,
+      -224,  -1760,  -2772,  -2805,  -2595,  -1482,   -817,   -574,
+      -259,    410,   1291,   2368,   3306,   3043,   2264,    550,
+      -864,  -1933,  -1883,  -1917,  -1583,  -1907,  -1779,  -1455,
+      -723,   1034,   2487,   3349,   3065,   2441,    823,   -157,
+      -723,   -863,  -1252,  -1589,  -2152,  -2636,  -2357,  -1272,
+       216,   1941,   2716,   2814,   2264,   1249,    620,    456,
+       185,   -552,  -1534,  -2360,  -3023,  -2680,  -1819,   -181,
+      1208,   1749,   1952,   1880,   1671,   1357,   1253,   1066,
+       112,   -995,  -2425,  -2822,  -2621,  -1869,   -707,    272,
+       872,   1261,   1369,   1333,   1728,   1929,   1872,    904,
+      -688,  -1781,  -2676,  -2437,  -1820,   -973,   -463,   -160,
+       269,    682,   1553,   2144,   2666,   2035,    972,   -379,
+     -1329,  -2161,  -1821,  -1565,  -1173,  -1124,   -783,   -426,
+       344,   1201,   2316,   2438,   2355,   1418,    320,   -601,
+     -1259,  -1451,  -1236,  -1161,  -1459,  -1462,  -1376,   -409,
+       811,   2127,   2499,   2012,   1610,    604,   -251,   -373,
+      -507,  -1084,  -1479,  -1915,  -2132,  -1421,   -752,    467,
+      1573,   1822,   1713,   1143,    880,    316,    497,   -134,
+      -667,  -1305,  -1785,  -2092,  -1881,  -1018,    456,   1086,
+      1609,   1425,   1185,   1209,    950,   1021,    578,   -397,
+     -1096,  -1835,  -2218,  -1609,   -866,    -59,    357,    654,
+       880,    849,   1049,   1286,   1287,    758,    -68,  -1031,
+     -1696,  -2037,  -1738,   -853,   -491,   -177,     82,    241,
+       836,   1371,   1866,   1844,   1116,    257,   -531,  -1532,
+     -1628,  -1386,   -761,   -485,   -386,   -167,   -199,    500,
+      1121,   1596,   1712,   1153,    262,   -374,   -872,   -987,
+      -860,   -782,   -893,  -1105,   -643,   -231,    267,   1176,
+      1645,   1497,   1144,    635,    -59,   -527,   -427,   -507,
+      -757,   -904,  -1069,  -1066,   -378,    418,   1134,   1654,
+      1237,    933,    493,     61,     97,     18,   -226,   -703,
+     -1059,  -1398,  -1122,   -593,     -2,    937,    992,   1184,
+      1068,    622,    446,    391,    329,   -208,   -691,  -1163,
+     -1469,  -1261,   -847,   -108,    454,    940,    698,    628,
+       473,    691,    641,    571,    -23,   -667,  -1135,  -1417,
+      -993,   -773,     35,    472,    659,    689,    607,    879,
+       827,    683,    604,     -4,   -543,  -1193,  -1014,   -844,
+      -636,    -71,   -180,    197,    332,    332,    888,   1033,
+      1044,    605,    142,   -554,   -733,  -1131,   -805,   -520,
+      -472,   -301,   -119,    -84,    261,    571,    813,   1035,
+       522,    200,   -135,   -565,   -644,   -486,   -521,   -642,
+      -348,   -350,    -24,    253,    758,    957,    731,    542,
+       338,   -153,   -382,   -406,   -414,   -271,   -663,   -463,
+      -537,    -83,    417,    658,    962,    977,    403,    379,
+       -29,   -330,   -220,   -454,   -272,   -787,   -775,   -463,
+      -210,    343,    756,    545,    584,    265,    197,    -30,
+        49,     97,    -94,   -550,   -438,   -461,   -330,   -297,
+       253,    591,    660,    490,    496,    437,    159,     86,
+      -138,     18,   -408,   -798,   -440,   -393,   -122,     99,
+       331,    446,    370,    448,    356,    455,     61,     13,
+        11,   -237,   -562,   -437,   -246,   -177,   -108,    241,
+       170,    379,     94,    155,    441,    273,    107,      9,
+      -385,   -299,   -336,   -366,    -74,      1,    232,      1,
+        12,    184,    529,    466,    205,    -56,   -292,   -454,
+      -228,   -359,    -79,     -2,    148,    205,     11,     30,
+       352,    310,    303,    297,    269,     30,   -303,   -376,
+      -161,   -320,    -35,   -106,     10,     26,    142,    322,
+       478,    371,    243,    -45,    -14,   -168,   -297,   -161,
+      -327,   -231,   -156,   -275,   -128,    209,    130,    103,
+       186,    264,    103,   -184,   -128,     41,   -132,   -215,
+      -268,   -239,    -14,    103,    207,    128,    282,    320,
+       337,   -103,    136,    -18,    -19,   -201,   -219,    -36,
+      -146,    -47,     93,    170,    145,     42,    290,    206,
+       164,    -43,    139,   -121,   -114,   -122,    -88,   -108,
+       -12,    -78,     27,    137,    229,    -71,    -10,    117,
+      -128,   -120,    -83,     77,   -111,    -81,    -79,    104,
+      -113,      8,    168,    185,     89,     57,     24,    -39,
+       180,    -46,     20,   -152,     48,   -180,     97,     21,
+        85,    -25,    -98,    -11,    -34,    -11,   -151,      3,
+        34,    -74,   -143,   -251,    135,    117,    195,    -83,
+       -58,    109,    212,    145,    -93,     -2,   -130,   -155,
+       108,     75,    -74,     41,   -194,    -78,    -84,     89,
+        53,    -38,   -170,    183,    118,   -158,    -55,    -77,
+       -34,     39,    -60,    -22,     14,    -40,     84,    128,
+      -161,     71,     51,    -81,   -163,     89,    -53,    153,
+        -1,    119,     40,     33,   -151,    148,    -91,     86,
+      -104,    -78,     48,    191,    -54,    189,    -74,    135,
+        56,     87,    -76,   -127,   -157,   -197,    193,   -128,
+        61,     31,    -21,     91,    -76,    134,     58,    134,
+        62,    -98,    -31,    109,   -152,     72,     -7,    -62,
+       188,   -163,    -72,    -65,   -171,     56,   -127,     87,
+       -54,     -2,    160,    -11,      1,    156,     61,   -138,
+       -16,   -166,    146,    102,    167,      5,     38,     30,
+       109,   -188,    -50,    169,     94,    145,    -98,     68,
+       164,     14,   -204,   -208,   -127,   -130,     80,     23,
+        81,     65,   -161,    -99,     20,     78,    -71,    172,
+        92,   -131,     76,     60,     73,    -81,    -91,     18,
+       -23,     98,      3,   -146,     -2,     50,     78,    -59,
+      -140,     73,    -71,    -70,    156,   -149,    221,    113,
+       166,   -138,    164,    -91,     64,   -156,   -138,    -49,
+       -95,    125,   -188,   -185,    -72,     32,    135,    151,
+       -96,   -150,     93,     10,     48,    -49,    135,     83,
+      -195,   -121,   -107,    -97,     91,     33,    242,    -15,
+       -40,     69,     -4,   -226,     82,     18,   -122,   -233,
+        -4,     35,     -6,    -73,    -16,    312,    149,    -89,
+      -191,    -54,     65,      3,     22,    -67,   -115,   -257,
+      -153,    263,     75,    224,     19,    -70,    201,     21,
+       101,    -78,   -102,   -132,   -335,   -378,     45,    197,
+       206,     68,    356,    241,    -57,     82,    196,   -156,
+       109,    -95,   -109,   -123,   -227,    -88,    262,    208,
+       168,     90,     10,    115,     -2,   -142,   -203,   -287,
+      -247,   -280,   -213,   -118,     20,    166,    270,    150,
+       295,    143,    305,    223,   -143,     99,     -9,   -523,
+      -351,   -197,    -14,    243,    104,    395,    275,    243,
+       362,    204,    -53,    -55,    -37,   -434,   -466,   -564,
+      -223,   -256,    262,    195,    369,    241,    239,    127,
+       314,    111,   -149,    -54,   -457,   -664,   -310,    -98,
+       152,    300,    494,    192,    288,    213,    304,    184,
+       -75,     20,   -232,   -432,   -426,   -613,    -39,    128,
+       173,    465,    513,    437,    130,    236,     71,    240,
+       -46,   -561,   -516,   -734,   -461,    -18,     56,    279,
+       369,    193,    299,    486,    292,     34,    -98,   -354,
+      -500,   -921,   -745,   -245,   -110,    139,    344,    367,
+       519,    253,    246,    500,    180,   -257,   -386,   -806,
+      -786,   -509,   -139,    329,    337,    590,    325,    527,
+       574,    463,    368,    -45,   -297,   -549,   -806,   -828,
+      -278,    133,    159,    329,    318,    450,    462,    632,
+       495,    294,    -30,   -711,   -768,   -952,   -714,   -355,
+        27,    326,    464,    569,    328,    530,    478,    578,
+       -62,   -178,   -967,  -1005,   -851,   -473,   -271,    449,
+       668,    494,    755,    706,    674,    537,    414,   -180,
+      -822,  -1099,  -1209,   -781,   -241,    -91,    390,    518,
+       530,    639,    751,    557,    351,     27,   -519,  -1094,
+     -1441,  -1306,   -681,    -25,    178,    777,    802,    840,
+       510,    780,    763,    539,   -218,   -733,  -1396,  -1535,
+     -1007,   -562,    292,    662,    740,    662,    903,    804,
+       870,    715,    406,   -251,   -906,  -1630,  -1241,   -785,
+      -329,    455,    868,    800,    808,    770,    692,    786,
+       362,   -259,   -820,  -1454,  -1634,  -1342,   -672,    -11,
+       826,    887,   1090,    767,    877,    961,    466,    233,
+      -392,  -1002,  -1719,  -1627,   -880,   -365,    426,    837,
+      1198,    798,    913,    800,    818,    648,   -293,   -756,
+     -1394,  -1843,  -1629,   -783,    312,    877,   1139,   1188,
+      1154,    845,    629,    708,    131,   -726,  -1491,  -1669,
+     -2015,  -1202,   -259,    839,   1252,   1394,   1022,    988,
+      1010,    885,    232,   -186,   -921,  -1935,  -2064,  -1544,
+      -740,    315,    910,   1344,   1171,   1110,    703,    595,
+       357,    -94,   -600,  -1595,  -2218,  -1832,  -1317,   -301,
+       815,   1592,   1406,   1135,   1039,    734,    682,    279,
+      -470,  -1140,  -2132,  -2373,  -1609,   -697,    628,   1327,
+      1554,   1725,   1247,    693,    581,    428,   -248,   -933,
+     -1641,  -2073,  -1986,  -1087,    158,   1043,   1657,   1762,
+      1661,    855,    544,    392,     21,   -430,  -1614,  -2033,
+     -2243,  -1869,   -395,    816,   1874,   2204,   1968,   1330,
+       725,    329,    167,   -250,  -1304,  -2130,  -2428,  -1971,
+      -930,    173,   1707,   2412,   2142,   1746,    717,    258,
+       183,   -432,   -799,  -1672,  -2364,  -2185,  -1712,   -476,
+      1056,   2146,   2548,   2173,   1370,    382,    -81,   -446,
+      -696,  -1513,  -2142,  -2229,  -2092,   -767,    831,   1995,
+      2908,   2559,   1515,    564,   -123,   -662,   -838,  -1320,
+     -1857,  -2375,  -2072,  -1251,     16,   1586,   2889,   2845,
+      2136,    974,   -154,   -762,   -918,  -1225,  -1611,  -2133,
+     -2115,  -1527,   -487,   1075,   2696,   3050,   2694,   1609,
+       369,   -697,  -1052,  -1507,  -1515,  -1974,  -2113,  -2021,
+      -839,    638,   2445,   3400,   3224,   2239,    553,   -454,
+     -1591,  -1724,  -1808,  -1717,  -1807,  -1756,  -1355,    224,
+      1910,   3110,   3621,   2728,   1296,   -487,  -1691,  -1990,
+     -1825,  -1636,  -1723,  -1744,  -1403,   -377,   1338,   2964,
+      3637,   3253,   1970,    -73,  -1595,  -2089,  -2461,  -2107,
+     -1803,  -1592,  -1063,   -630,    682,   2573,   3591,   3708,
+      2464,    653,  -1343,  -2629,  -2639,  -2445,  -1785,  -1319,
+     -1114,   -616,    734,   1906,   3111,   3712,   2918,   1411,
+     -1009,  -2267,  -2950,  -2978,  -1896,  -1432,   -760,   -406,
+       413,   1483,   2694,   3571,   3215,   2054,   -358,  -2225,
+     -3444,  -3421,  -2470,  -1536,   -418,    -84,    670,   1550,
+      2315,   3364,   3340,   2348,    223,  -1853,  -3589,  -4034,
+     -3109,  -1871,   -520,    392,    841,   1509,   2172,   3003,
+      3459,   2724,    765,  -1487,  -3293,  -4301,  -3643,  -2088,
+      -506,    642,   1228,   1672,   2058,   2709,   2885,   2720,
+      1307,   -737,  -3134,  -4304,  -4409,  -3001,   -897,    863,
+      1821,   2344,   2055,   2455,   2606,   2467,   1459,   -264,
+     -2556,  -4197,  -4526,  -3405,  -1407,    657,   2324,   2702,
+      2736,   2523,   2308,   1913,   1493,   -150,  -1808,  -3961,
+     -4612,  -3874,  -2039,    490,   2264,   3229,   3203,   2666,
+      1852,   1551,   1008,    172,  -1705,  -3217,  -4555,  -4371,
+     -2785,   -295,   2229,   3540,   3894,   2917,   1915,   1022,
+       325,   -354,  -1355,  -2736,  -4209,  -4370,  -3316,   -891,
+      2001,   4061,   4659,   3794,   2041,    773,   -137,   -834,
+     -1704,  -2361,  -3762,  -4240,  -3184,  -1160,   1612,   3783,
+      5071,   4180,   2564,    713,   -804,  -1417,  -1812,  -2510,
+     -3017,  -3680,  -3299,  -1656,   1200,   3570,   5066,   4934,
+      3149,    861,  -1176,  -2307,  -2494,  -2552,  -2771,  -2940,
+     -2693,  -1444,    785,   3222,   5056,   5381,   4023,   1308,
+     -1137,  -2650,  -3273,  -2990,  -2646,  -2431,  -2251,  -1275,
+       575,   2683,   4792,   5541,   4505,   2099,  -1180,  -3116,
+     -4265,  -3870,  -3004,  -1799,  -1515,   -553,    600,   2446,
+      4219,   5206,   4545,   2591,   -893,  -3611,  -4890,  -4555,
+     -3478,  -1935,   -614,    265,   1021,   2230,   3501,   4632,
+      4675,   2793,   -474,  -3260,  -5136,  -5478,  -3889,  -1628,
+        20,   1230,   1928,   2392,   3177,   3986,   3914,   2837,
+       216,  -3025,  -5188,  -5736,  -4565,  -2258,    369,   2075,
+      2614,   3032,   2882,   3330,   3194,   2199,    370,  -2737,
+     -4957,  -5962,  -4981,  -2525,    669,   2722,   3776,   3658,
+      3324,   2587,   2476,   1523,    119,  -2466,  -4823,  -5970,
+     -5399,  -2832,    253,   3404,   4894,   4707,   3507,   2107,
+      1354,    602,   -429,  -2033,  -4052,  -5486,  -5505,  -3255,
+       -22,   3469,   5185,   5432,   3986,   2159,    563,   -755,
+     -1262,  -2307,  -3676,  -4764,  -4747,  -3235,    -42,   3063,
+      5624,   6115,   4641,   2231,   -366,  -1760,  -2545,  -2859,
+     -3491,  -4045,  -3983,  -2676,   -255,   2888,   5557,   6754,
+      5261,   2559,   -620,  -2855,  -3585,  -3901,  -3311,  -2961,
+     -2746,  -1772,   -171,   2577,   5240,   6389,   5652,   3061,
+      -643,  -3522,  -5032,  -4717,  -3731,  -2343,  -1741,   -825,
+       677,   2511,   4557,   6003,   5701,   3093,   -593,  -4118,
+     -5661,  -5641,  -4106,  -1884,   -303,    884,   1598,   2614,
+      4302,   5343,   5034,   2941,   -218,  -4196,  -6435,  -6508,
+     -4630,  -1916,    788,   2265,   2675,   3349,   3470,   4316,
+      3915,   2302,   -512,  -3978,  -6362,  -6845,  -5271,  -1974,
+      1235,   3562,   4132,   4107,   3458,   3193,   2477,   1477,
+      -639,  -3480,  -5889,  -6761,  -5246,  -2233,   1572,   4481,
+      5534,   4683,   3254,   2077,   1211,    -79,  -1359,  -3481,
+     -5505,  -6131,  -5159,  -1971,   1853,   5217,   6427,   5878,
+      3542,   1218,   -483,  -1414,  -2432,  -3264,  -4609,  -5392,
+     -4360,  -1894,   1994,   5313,   7068,   6626,   4026,    849,
+     -1772,  -3149,  -3633,  -3513,  -3583,  -4015,  -3298,  -1293,
+      2096,   5229,   7309,   6675,   4023,    225,  -2797,  -4849,
+     -4970,  -4079,  -3125,  -2118,  -1502,     54,   2377,   5020,
+      6461,   6558,   4046,    177,  -3682,  -6189,  -6302,  -4791,
+     -2407,   -633,    299,   1572,   2843,   4246,   5472,   5689,
+      3742,    162,  -3839,  -6530,  -7312,  -5151,  -2311,    591,
+      2339,   3255,   3477,   4067,   4420,   4171,   2787,   -330,
+     -4228,  -6953,  -7636,  -5614,  -2172,   1550,   4203,   4769,
+      4351,   3441,   2847,   2212,   1065,  -1187,  -3848,  -6606,
+     -7333,  -5452,  -2079,   2137,   5360,   6349,   5534,   3301,
+      1556,    230,   -570,  -1890,  -3768,  -5494,  -6192,  -4738,
+     -1314,   2768,   6025,   7303,   6073,   3334,    506,  -1721,
+     -2898,  -3196,  -3810,  -4485,  -4490,  -3619,   -774,   2786,
+      6111,   7799,   6504,   3418,   -610,  -3623,  -4738,  -4696,
+     -4006,  -3288,  -2790,  -1898,    171,   3324,   6125,   7279,
+      6422,   2985,  -1130,  -4660,  -6474,  -6067,  -4261,  -2096,
+      -435,    582,   1543,   3585,   5131,   6381,   5668,   2374,
+     -1764,  -5632,  -7375,  -6871,  -4363,  -1183,   1577,   2862,
+      3489,   3680,   4441,   4476,   3729,   1504,  -2244,  -5676,
+     -7677,  -7032,  -4255,   -432,   2972,   4992,   5092,   4419,
+      3289,   2718,   1875,     -1,  -2704,  -5377,  -7212,  -6671,
+     -3988,    404,   4302,   6563,   6510,   4452,   2163,    464,
+      -832,  -1703,  -3246,  -4958,  -6090,  -5413,  -3086,    963,
+      5253,   7594,   7176,   4930,   1318,  -1430,  -3141,  -3715,
+     -3907,  -4070,  -4367,  -3431,  -1546,   1950,   5458,   7703,
+      7305,   4808,    382,  -3090,  -5236,  -5747,  -4617,  -3327,
+     -1935,  -1003,    362,   2512,   5232,   7033,   6638,   3949,
+      -285,  -4410,  -7100,  -6895,  -5058,  -2144,     17,   1679,
+      2403,   3427,   4706,   5608,   5003,   2726,  -1078,  -5075,
+     -7749,  -7587,  -5126,  -1494,   2141,   4154,   4459,   4262,
+      3815,   3603,   2909,    847,  -1912,  -5289,  -7410,  -7515,
+     -4484,   -368,   3751,   6010,   6267,   4670,   2708,   1304,
+        27,  -1052,  -2840,  -4723,  -6410,  -6224,  -3587,    546,
+      4813,   7525,   7450,   5071,   1911,   -889,  -2615,  -3614,
+     -3709,  -4070,  -4559,  -4022,  -2028,   1698,   5194,   7513,
+      7591,   4736,    786,  -2815,  -5379,  -5511,  -4464,  -3206,
+     -2264,  -1314,    277,   2628,   5163,   6809,   6622,   3901,
+      -411,  -4273,  -6946,  -6879,  -4829,  -2213,    349,   1703,
+      2485,   3402,   4772,   5363,   4764,   2459,  -1236,  -5133,
+     -7714,  -7660,  -4733,   -980,   2505,   4410,   4657,   4085,
+      3788,   3249,   2397,    445,  -2534,  -5545,  -7296,  -7124,
+     -4262,     56,   4382,   6680,   6451,   4768,   2410,    658,
+      -917,  -1834,  -3324,  -4982,  -5790,  -5537,  -2837,   1330,
+      5266,   7431,   7409,   4732,   1031,  -2148,  -3484,  -4097,
+     -4159,  -3754,  -3557,  -3047,   -969,   2483,   5639,   7466,
+      7053,   3732,   -533,  -4231,  -5912,  -5780,  -4456,  -2302,
+     -1118,    125,   1366,   3196,   5366,   6404,   5611,   2729,
+     -1675,  -5552,  -7384,  -6969,  -4055,   -761,   1797,   3258,
+      3662,   3894,   4341,   4263,   3098,    634,  -2646,  -5930,
+     -7777,  -6497,  -3511,    647,   4249,   5646,   5207,   3781,
+      2696,   1349,    157,  -1282,  -3344,  -5550,  -6630,  -5426,
+     -2144,   2138,   5888,   7152,   6094,   3499,    764,  -1581,
+     -2650,  -3196,  -3942,  -4583,  -4619,  -3353,   -182,   3281,
+      6330,   7540,   6201,   2804,  -1286,  -4219,  -5286,  -4885,
+     -3815,  -2665,  -1640,   -495,   1662,   3999,   6087,   6546,
+      5143,   1215,  -3009,  -5973,  -7076,  -5760,  -2931,   -280,
+      1529,   2777,   3211,   3826,   4733,   4379,   2850,   -119,
+     -4025,  -7019,  -7326,  -5582,  -1660,   2033,   4581,   5343,
+      4535,   3485,   2514,   1381,     98,  -1939,  -4372,  -6337,
+     -6280,  -4373,   -341,   3716,   6385,   6914,   5001,   2194,
+      -199,  -1677,  -2623,  -3273,  -4122,  -4676,  -4073,  -1931,
+      1226,   4827,   6972,   6872,   4672,    808,  -2955,  -4729,
+     -4923,  -4275,  -3147,  -2124,   -980,    523,   2679,   4966,
+      6513,   5657,   3205,  -1094,  -4517,  -6719,  -6234,  -4018,
+     -1365,    866,   2170,   3001,   3529,   4318,   4455,   3304,
+      1041,  -2275,  -5750,  -7232,  -6234,  -3330,    758,   3551,
+      4975,   4581,   3644,   2268,   1579,    284,  -1173,  -3338,
+     -5524,  -6287,  -4868,  -1868,   2374,   5461,   6843,   5422,
+      3094,    142,  -1594,  -2808,  -3321,  -3619,  -4104,  -3867,
+     -2639,    173,   3728,   6367,   7035,   5366,   1611,  -2080,
+     -4313,  -5166,  -4571,  -2985,  -1662,   -666,    265,   2189,
+      4180,   5666,   5402,   3660,    -68,  -3583,  -6189,  -6402,
+     -4479,  -1844,   1068,   2364,   3292,   3250,   3558,   3782,
+      3075,   1251,  -1469,  -4659,  -6571,  -6096,  -3760,   -171,
+      3311,   5254,   5324,   3737,   2124,    631,   -391,  -1447,
+     -2705,  -4589,  -5156,  -4373,  -1831,   1604,   5021,   6700,
+      5942,   3400,    451,  -2156,  -3223,  -3543,  -3359,  -3141,
+     -2994,  -1895,    375,   2888,   5241,   6303,   5144,   2052,
+     -1865,  -4554,  -5439,  -4764,  -2878,   -835,    471,   1299,
+      2106,   3478,   4409,   4340,   2885,    -17,  -3139,  -5734,
+     -6279,  -4569,  -1771,   1414,   3331,   4078,   3443,   2899,
+      2541,   1827,    468,  -1798,  -4006,  -5626,  -5378,  -3359,
+       239,   3549,   5357,   5566,   3965,   1757,   -566,  -1507,
+     -2289,  -2904,  -3421,  -3842,  -3203,  -1165,   1674,   4557,
+      6176,   5593,   3192,   -106,  -3103,  -4181,  -4280,  -3253,
+     -1870,  -1283,   -190,   1069,   2855,   4429,   4940,   4065,
+      1155,  -2245,  -5031,  -5763,  -4992,  -2588,    113,   1983,
+      2835,   2909,   2907,   2950,   2548,   1574,   -620,  -3255,
+     -5448,  -5698,  -3999,   -912,   2275,   4570,   4991,   3762,
+      2347,    636,   -269,  -1263,  -2181,  -3325,  -4049,  -3808,
+     -1917,    687,   3862,   5436,   5308,   3207,    596,  -1798,
+     -3357,  -3343,  -3165,  -2467,  -1919,  -1028,    108,   2341,
+      4101,   5209,   4265,   1966,  -1336,  -4196,  -5374,  -4541,
+     -2644,   -430,   1182,   1787,   2416,   2988,   3065,   3220,
+      1921,    -20,  -2707,  -4993,  -5389,  -4152,  -1465,   1422,
+      3480,   4070,   3459,   2326,    968,    294,   -695,  -1930,
+     -3359,  -4205,  -3915,  -2329,    479,   3458,   4895,   4861,
+      3362,   1008,  -1412,  -2697,  -2762,  -2749,  -2310,  -1998,
+     -1658,    -71,   1806,   4000,   5040,   4169,   2069,   -815,
+     -3463,  -4718,  -4025,  -2445,   -649,    768,   1554,   2126,
+      2572,   3240,   3177,   2006,    118,  -2472,  -4625,  -5122,
+     -3744,  -1225,   1396,   3133,   3476,   3082,   2069,   1076,
+       265,   -388,  -1480,  -2877,  -3822,  -3768,  -2063,    432,
+      3184,   4613,   4375,   2930,    656,  -1413,  -2353,  -2448,
+     -2368,  -2147,  -1884,  -1461,    -72,   1717,   3716,   4699,
+      3883,   1506,  -1122,  -3172,  -4125,  -3500,  -1976,   -528,
+       523,   1423,   1816,   2287,   2848,   2761,   1913,   -282,
+     -2388,  -4070,  -4448,  -3362,   -727,   1305,   3186,   3371,
+      2895,   1951,   1146,    197,   -346,  -1625,  -2924,  -3495,
+     -3181,  -1575,    778,   2998,   4292,   3966,   2550,    427,
+     -1489,  -2321,  -2609,  -2143,  -1885,  -1547,   -828,    276,
+      2021,   3468,   4011,   3086,   1033,  -1438,  -3458,  -3872,
+     -3154,  -1821,    -32,    853,   1503,   1676,   2066,   2395,
+      2373,   1261,   -578,  -2689,  -4055,  -3861,  -2600,   -249,
+      2042,   2906,   2934,   2383,   1471,    633,   -381,   -907,
+     -1787,  -2581,  -2853,  -2287,  -1023,   1094,   3131,   3958,
+      3137,   1508,   -159,  -1742,  -2494,  -2475,  -1699,  -1591,
+      -884,   -264,    783,   2311,   3027,   3320,   2151,     38,
+     -1838,  -3333,  -3377,  -2416,   -936,    643,   1248,   1907,
+      1834,   1741,   2016,   1481,    225,  -1252,  -2836,  -3619,
+     -3055,  -1650,    717,   2452,   2966,   2884,   1935,    798,
+      -316,   -878,  -1145,  -1808,  -2057,  -2346,  -1452,    109,
+      1930,   3114,   3382,   2357,    590,  -1072,  -2378,  -2404,
+     -1976,  -1498,   -730,     -9,    445,   1318,   1964,   2451,
+      2459,   1296,   -548,  -2195,  -3144,  -2784,  -1460,   -192,
+      1139,   2006,   1938,   1504,   1166,    881,    615,   -314,
+     -1585,  -2657,  -2963,  -1897,   -265,   1318,   2693,   2953,
+      2166,   1136,   -289,   -894,  -1350,  -1505,  -1414,  -1618,
+     -1275,   -313,    790,   2012,   2910,   2532,   1291,   -203,
+     -1960,  -2368,  -2512,  -1596,   -686,    405,    571,   1168,
+      1375,   1714,   1839,   1100,     77,  -1563,  -2433,  -2969,
+     -2168,   -699,   1095,   2002,   2202,   1855,    918,    329,
+        41,   -486,  -1142,  -1816,  -1952,  -1778,  -1025,    785,
+      1970,   2477,   2251,   1347,   -251,  -1208,  -1714,  -1692,
+     -1233,   -762,   -594,   -235,    367,   1276,   1984,   2076,
+      1516,    140,  -1411,  -2324,  -2508,  -1841,   -648,    555,
+      1159,   1403,   1078,   1155,    969,    545,     48,   -694,
+     -1896,  -2174,  -1933,  -1028,    680,   1796,   2149,   1936,
+      1200,    -19,   -322,   -698,  -1112,  -1233,  -1359,   -989,
+      -568,    178,   1158,   2200,   2119,   1432,    265,  -1144,
+     -1828,  -1724,  -1259,   -561,     93,    222,    695,   1146,
+      1341,   1573,    903,    357,   -631,  -1685,  -2169,  -1655,
+      -715,    301,   1287,   1719,   1388,   1006,    511,    -66,
+      -460,   -531,  -1277,  -1395,  -1377,   -641,    346,   1367,
+      1889,   1798,   1093,     39,   -754,  -1051,  -1366,  -1114,
+      -494,   -472,     58,    450,    998,   1193,   1452,   1059,
+       196,   -588,  -1657,  -1592,  -1234,   -330,    166,    989,
+      1184,    868,    767,    552,    228,    -98,   -707,  -1086,
+     -1391,  -1294,   -470,    202,   1172,   1434,   1369,    777,
+        43,   -583,   -878,   -929,   -840,   -687,   -570,   -211,
+       267,   1003,   1397,   1329,   1053,    204,   -902,  -1234,
+     -1522,   -901,   -542,     34,    639,    503,    831,    790,
+       831,    630,    185,   -675,   -976,  -1469,  -1014,   -476,
+       399,   1181,   1240,   1142,    561,    -43,   -201,   -581,
+      -768,   -815,   -798,   -548,   -504,    336,    898,   1070,
+      1051,    657,   -193,   -871,   -939,  -1143,   -569,   -297,
+       140,    230,    481,    674,    840,    698,    695,   -146,
+      -719,  -1030,  -1295,   -642,    -53,    516,   1000,    982,
+       838,    359,    182,    108,   -422,   -606,   -871,   -830,
+      -519,   -278,    363,    830,    950,    680,    478,   -391,
+      -570,   -742,   -559,   -525,   -100,     19,    102,    176,
+       489,    742,    831,    159,   -275,   -492,   -762,   -960,
+      -515,     30,    268,    585,    662,    316,    419,    127,
+       -24,   -299,   -311,   -559,   -707,   -355,     97,    644,
+       629,    758,    411,    311,   -396,   -390,   -671,   -459,
+      -428,    -14,    -98,     78,    493,    485,    675,    385,
+       281,   -180,   -514,   -664,   -352,   -185,    -67,    302,
+       552,    540,    163,    132,    178,    142,   -345,   -341,
+      -628,   -517,   -126,    130,    306,    720,    658,    190,
+        91,   -307,   -227,   -261,   -227,   -289,      0,    -41,
+        -5,    410,    325,    306,    166,   -179,   -329,   -660,
+      -649,   -226,   -112,    209,    271,    294,    220,    377,
+       371,    -51,   -130,   -420,   -218,   -542,   -332,     49,
+       229,    251,    365,    147,     94,   -160,   -120,   -162,
+       -27,    -90,    -71,   -221,    185,     83,    239,    556,
+       453,    150,    -83,   -312,   -463,   -442,   -167,    -87,
+        19,    258,     89,     35,    315,    174,    168,   -151,
+      -122,   -399,   -235,   -195,     97,    112,    458,    247,
+       317,     71,      2,     31,     39,   -321,     27,     53,
+        47,     84,    126,    408,    264,    219,   -179,    -29,
+      -237,   -240,     78,    -70,   -113,    247,    220,    254,
+       -44,     17,   -100,     33,   -108,   -350,   -303,   -103,
+       104,    278,    140,    248,    293,    -42,      4,     -1,
+        63,    107,    -40,    -77,     55,    108,      6,     13,
+        -4,     18,     45,   -185,   -250,   -185,   -260,   -110,
+        90,    -63,    249,    -54,    -24,    -82,    122,   -185,
+      -217,   -229,      1,   -253,    -29,    -16,    175,     29,
+         3,    -38,    120,   -203,   -214,   -186,   -127,   -151,
+       -43,    143,     -2,    108,    -47,     48,    190,    133,
+        28,     98,   -209,    174,   -171,    149,   -157,   -114,
+       213,    138,   -106,    -19,   -156,    137,     75,    -38,
+      -109,     57,     54,    -31,    133,    152,     16,   -127,
+        66,    170,    121,    156,    -26,    105,    130,   -121,
+        86,    179,   -133,     86,     76,   -144,    132,     70,
+       189,   -169,   -136,   -144,    202,    176,     46,    -98,
+        16,   -137,     27,    -82,   -196,   -147,     12,     95,
+      -157,    -53,     58,     18,   -150,    -19,     80,    117,
+       -56,    140,      8,   -165,   -186,    -43,    112,   -198,
+       -18,    167,   -149,    -22,    140,     93,     78,    -40,
+       161,    -87,     83,    168,    -35,   -108,     58,      1,
+        34,    -82,   -176,     89,    101,    105,      5,   -157,
+        41,   -188,   -124,     54,    -31,    189,     60,    155,
+       163,    115,    -66,     98,     -4,   -202,   -153,    -44,
+       -80,    147,    -57,     95,   -158,    196,   -110,     67,
+       -97,   -101,    -60,   -208,   -198,    160,   -133,     82,
+       201,    -51,    -83,    -69,   -104,    146,   -124,   -133,
+        78,     29,    188,    -96,     60,   -136,     66,    151,
+       148,    131,    -13,   -227,    163,    149,    120,    -75,
+      -131,   -151,   -115,   -166,    168,    -97,     60,    122,
+        36,   -181,    -47,    259,    268,     61,   -127,     28,
+      -242,   -237,     96,     39,   -119,     26,     56,    -99,
+        35,    -89,   -106,    -60,    116,     28,    -91,   -268,
+       153,    169,    -31,    272,    -74,    188,    101,     57,
+       110,   -239,     21,     99,      0,    174,    119,    209,
+       349,     92,    -55,   -217,     29,    -15,   -190,    -67,
+      -156,     67,    211,    276,      0,      0,    220,   -155,
+      -272,   -329,   -355,   -245,   -201,    278,    403,    402,
+       332,    117,     74,   -111,   -102,   -142,   -199,    -14,
+       161,     86,    260,    372,    197,    -15,    -77,   -186,
+      -253,   -444,   -222,    107,     86,    148,     14,    164,
+        88,   -124,     61,    -97,     14,   -165,   -261,     28,
+       -15,    144,    345,    149,    327,    108,   -125,   -191,
+      -345,   -220,    -33,    116,     94,    325,    104,    100,
+        65,    190,    114,   -287,   -214,   -225,    -50,      6,
+        68,    445,    537,     30,      5,   -109,     24,   -106,
+      -159,   -286,   -125,   -104,    -14,    294,    372,    468,
+       386,     90,   -414,   -526,   -302,   -228,    -23,    314,
+       132,    253,    217,    127,    137,    -25,   -104,   -433,
+      -339,   -444,   -278,     50,    643,    535,    347,    348,
+        76,   -141,   -493,   -567,   -400,   -230,    -94,   -124,
+       176,    597,    562,    363,    179,   -398,   -725,   -656,
+      -616,   -284,    260,    541,    620,    442,    180,    224,
+      -183,   -117,   -514,   -674,   -393,   -617,    -39,    382,
+       840,    993,    724,     91,   -285,   -684,   -770,   -432,
+      -422,     88,    351,    337,    531,    329,    414,    264,
+        32,   -583,   -960,   -990,   -643,   -263,    574,    800,
+       958,    787,    261,    -46,   -551,   -536,   -524,   -306,
+      -509,   -378,    -48,    600,    815,    874,    604,     69,
+      -691,   -984,  -1111,   -838,   -118,    303,    497,    452,
+       545,    329,    159,    238,   -268,   -753,   -868,   -963,
+      -670,    -42,    555,   1000,   1066,    594,   -185,   -495,
+      -835,   -931,   -609,    -97,     23,    364,    466,    836,
+       802,    858,    497,   -136,  -1078,  -1440,   -974,   -504,
+       174,    723,   1162,   1111,    477,    -59,   -410,   -511,
+      -723,   -870,   -710,   -487,   -107,    568,   1057,   1198,
+      1268,    547,   -632,  -1133,  -1251,   -997,   -487,     49,
+       579,    692,    591,    691,    467,    451,   -293,   -616,
+     -1344,  -1231,   -950,   -224,    895,   1501,   1671,    918,
+       390,   -575,   -890,  -1134,  -1033,   -635,   -200,    -92,
+       313,    921,   1202,   1343,    657,     87,  -1202,  -1554,
+     -1736,  -1138,    -87,    960,   1227,   1287,    774,    122,
+      -379,   -426,   -781,   -785,  -1054,   -975,   -571,    347,
+      1346,   1886,   1659,    885,   -528,  -1456,  -1636,  -1598,
+      -598,     55,    594,    903,    998,    841,    942,    521,
+       -98,   -876,  -1534,  -1746,  -1359,   -455,    773,   1775,
+      1906,   1705,    510,   -495,  -1381,  -1439,  -1014,   -593,
+      -372,    149,    611,   1009,   1580,   1502,   1101,    127,
+      -985,  -1838,  -2290,  -1416,   -221,    920,   1635,   1846,
+      1097,    319,   -456,   -616,   -902,  -1148,  -1291,   -888,
+      -485,    619,   1536,   2217,   1950,   1053,   -341,  -1572,
+     -2392,  -2056,  -1148,    -67,   1111,   1546,   1500,   1251,
+       988,    608,   -266,  -1069,  -1490,  -2113,  -1533,   -656,
+       955,   2276,   2722,   1844,    592,   -830,  -1833,  -1787,
+     -1658,   -746,   -169,    371,    732,   1130,   1544,   1627,
+      1046,    -87,  -1434,  -2525,  -2573,  -1672,   -223,   1424,
+      2316,   2242,   1472,    264,   -588,  -1276,  -1381,  -1534,
+     -1437,   -971,   -327,    728,   1947,   2514,   2192,    890,
+      -676,  -2001,  -2817,  -2341,  -1297,    558,   1415,   1989,
+      1721,   1313,    760,    188,   -710,  -1102,  -2055,  -2157,
+     -1725,   -267,   1454,   2806,   3192,   2105,    297,  -1466,
+     -2308,  -2603,  -1826,   -675,    106,   1138,   1418,   1544,
+      1786,   1340,    568,   -353,  -2054,  -2935,  -2824,  -1588,
+       529,   2056,   3038,   2670,   1404,   -103,  -1360,  -2030,
+     -2087,  -1568,  -1091,   -589,    404,   1162,   2006,   2591,
+      2199,    767,  -1375,  -2774,  -3405,  -2534,  -1007,   1078,
+      2295,   2682,   2042,    878,    -44,   -762,  -1298,  -1740,
+     -1825,  -1681,  -1055,    135,   1941,   3047,   3227,   2013,
+       -93,  -2121,  -3332,  -3278,  -1675,    -30,   1437,   2127,
+      2059,   1924,   1230,    852,    -88,  -1265,  -2455,  -2887,
+     -2432,   -952,   1319,   2970,   3687,   2992,   1180,  -1264,
+     -2706,  -3130,  -2568,  -1156,   -114,    789,   1290,   1694,
+      2134,   2285,   1240,   -347,  -2093,  -3677,  -3463,  -2105,
+       228,   2289,   3850,   3585,   2238,     85,  -1459,  -2200,
+     -2197,  -2097,  -1331,   -605,    159,   1357,   2418,   3414,
+      2884,    927,  -1275,  -3511,  -4124,  -3188,  -1319,   1382,
+      2990,   3346,   2508,   1256,     92,  -1044,  -1656,  -2064,
+     -2450,  -2430,  -1500,    244,   2329,   3857,   4057,   2283,
+       -72,  -2646,  -4240,  -3948,  -2416,   -249,   1497,   2638,
+      2447,   2166,   1638,    852,   -302,  -1741,  -2746,  -3593,
+     -2817,   -784,   1612,   3684,   4394,   3606,   1212,  -1537,
+     -3180,  -3536,  -2702,  -1356,    186,   1259,   1861,   2186,
+      2390,   2286,   1170,   -766,  -2671,  -4164,  -3918,  -2175,
+       372,   3346,   4672,   4194,   2012,   -206,  -1976,  -2904,
+     -2810,  -2145,  -1072,   -272,    610,   2073,   3015,   3427,
+      2823,    424,  -2112,  -4390,  -4814,  -3298,   -767,   2255,
+      3979,   4279,   3069,    872,   -763,  -1631,  -2488,  -2496,
+     -2325,  -1800,   -819,   1342,   3197,   4324,   4128,   1796,
+     -1030,  -3795,  -4938,  -4046,  -1900,    709,   2774,   3470,
+      2931,   2036,    730,   -238,  -1311,  -2294,  -3304,  -3541,
+     -2199,      3,   2715,   4596,   4922,   3126,     75,  -3148,
+     -4796,  -4342,  -2880,   -256,   1420,   2731,   3003,   2746,
+      2101,   1378,     79,  -1720,  -3547,  -4290,  -3858,  -1101,
+      2059,   4614,   5437,   3949,   1069,  -1754,  -4001,  -4110,
+     -3296,  -1478,    248,   1313,   2327,   2798,   3269,   2726,
+      1333,   -857,  -3744,  -5153,  -4743,  -2253,    965,   3938,
+      5507,   4473,   2360,   -720,  -2921,  -3369,  -3398,  -2301,
+};
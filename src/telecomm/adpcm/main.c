@@ -0,0 +1,453 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libwispbase/crc.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines INPUT_SAMPLES, ADPCM_CRC32 and input[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Samples coded (or decoded) per task execution, an even number, since the
+// coder packs two samples per byte. By default the clip goes through once
+// per chunk size of the sweep, to compare how often the state commits.
+#ifdef SAMPLES_PER_TASK
+#if SAMPLES_PER_TASK % 2 != 0
+#error SAMPLES_PER_TASK must be even
+#endif
+static const uint16_t chunk_samples[] = { SAMPLES_PER_TASK };
+#else
+static const uint16_t chunk_samples[] = { 16, 64, 256, 1024 };
+#endif
+
+#define NUM_PASSES (sizeof(chunk_samples) / sizeof(chunk_samples[0]))
+
+// Bytes of coded output fed to the CRC per task execution
+#define CHECK_BYTES 256
+
+// Samples decoded at a time into a buffer on the stack
+#define DECODE_BLOCK 16
+
+/** @brief State of the predictor (struct adpcm_state)
+ *  @details The whole state of a stream between two samples, for the coder
+ *           and the decoder alike.
+ */
+typedef struct {
+    int16_t valprev;    // previous output value
+    uint8_t index;      // index into stepsize table
+} adpcm_state_t;
+
+typedef enum {
+    ADPCM_ENCODE = 0,   // code the clip (rawcaudio)
+    ADPCM_CHECK,        // CRC the coded clip
+    ADPCM_DECODE,       // decode the coded clip (rawdaudio)
+} adpcm_phase_t;
+
+typedef struct {
+    uint32_t enc_cycles;
+    uint32_t dec_cycles;
+    uint32_t crc;           // of the coded clip
+    int32_t sum;            // of the decoded samples
+    adpcm_state_t enc;      // final state of the coder
+    adpcm_state_t dec;      // final state of the decoder
+} adpcm_result_t;
+
+/** @brief Progress of the passes between task executions
+ *  @details The predictor is the only state the coder carries from one
+ *           sample to the next, so a chunk commits three bytes of it along
+ *           with the position. The results of the passes done so far travel
+ *           with them, so that the whole state commits as one self-channel
+ *           field.
+ */
+typedef struct {
+    adpcm_state_t coder;    // predictor of the running coder or decoder
+    uint16_t phase;         // adpcm_phase_t
+    uint16_t pass;          // chunk size being measured
+    uint16_t pos;           // next sample, or byte when checking
+    uint32_t cycles;        // cycles of the executions that committed
+    adpcm_result_t cur;
+    adpcm_result_t result[NUM_PASSES];
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_adpcm)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct adpcm_args {
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct adpcm_self {
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_adpcm_self {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_adpcm, adpcm_args);
+SELF_CHANNEL(task_adpcm, adpcm_self);
+CHANNEL(task_adpcm, task_done, adpcm_args);
+
+/* The coded clip. A chunk writes only the bytes of its own samples, from
+ * the committed predictor, so restarting it writes the same bytes. */
+__nv static uint8_t code[INPUT_SAMPLES / 2];
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/* Intel ADPCM step variation table */
+static const int8_t indexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+static const int16_t stepsizeTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/** @brief Code an even number of samples into len / 2 bytes (adpcm_coder)
+ *  @details As in MiBench, but the difference and the predicted value take
+ *           32 bits: they reach 17 bits before the clamp, more than an int
+ *           holds on this target.
+ */
+static void adpcm_coder(const int16_t *inp, uint8_t *outp, uint16_t len,
+                        adpcm_state_t *state) {
+    int32_t diff;       // difference between val and valprev
+    int32_t valpred;    // predicted output value
+    int32_t vpdiff;     // current change to valpred
+    int16_t step;       // stepsize
+    int index;          // current step change index
+    unsigned delta;     // current adpcm output value
+    unsigned sign;      // current adpcm sign bit
+    uint8_t outputbuffer = 0;   // place to keep previous 4-bit value
+    int bufferstep = 1;         // toggle between outputbuffer/output
+
+    valpred = state->valprev;
+    index = state->index;
+    step = stepsizeTable[index];
+
+    for ( ; len > 0; len--) {
+        // Step 1 - compute difference with previous value
+        diff = *inp++ - valpred;
+        sign = (diff < 0) ? 8 : 0;
+        if (sign)
+            diff = -diff;
+
+        // Step 2 - Divide and clamp
+        delta = 0;
+        vpdiff = step >> 3;
+        if (diff >= step) {
+            delta = 4;
+            diff -= step;
+            vpdiff += step;
+        }
+        step >>= 1;
+        if (diff >= step) {
+            delta |= 2;
+            diff -= step;
+            vpdiff += step;
+        }
+        step >>= 1;
+        if (diff >= step) {
+            delta |= 1;
+            vpdiff += step;
+        }
+
+        // Step 3 - Update previous value
+        if (sign)
+            valpred -= vpdiff;
+        else
+            valpred += vpdiff;
+
+        // Step 4 - Clamp previous value to 16 bits
+        if (valpred > 32767)
+            valpred = 32767;
+        else if (valpred < -32768)
+            valpred = -32768;
+
+        // Step 5 - Assemble value, update index and step values
+        delta |= sign;
+        index += indexTable[delta];
+        if (index < 0)
+            index = 0;
+        if (index > 88)
+            index = 88;
+        step = stepsizeTable[index];
+
+        // Step 6 - Output value
+        if (bufferstep)
+            outputbuffer = (delta << 4) & 0xf0;
+        else
+            *outp++ = (delta & 0x0f) | outputbuffer;
+        bufferstep = !bufferstep;
+    }
+
+    state->valprev = valpred;
+    state->index = index;
+}
+
+/* Decode len samples (an even number) from len / 2 bytes (adpcm_decoder) */
+static void adpcm_decoder(const uint8_t *inp, int16_t *outp, uint16_t len,
+                          adpcm_state_t *state) {
+    int32_t valpred;    // predicted value
+    int32_t vpdiff;     // current change to valpred
+    int16_t step;       // stepsize
+    int index;          // current step change index
+    unsigned delta;     // current adpcm output value
+    uint8_t inputbuffer = 0;    // place to keep next 4-bit value
+    int bufferstep = 0;         // toggle between inputbuffer/input
+
+    valpred = state->valprev;
+    index = state->index;
+    step = stepsizeTable[index];
+
+    for ( ; len > 0; len--) {
+        // Step 1 - get the delta value
+        if (bufferstep) {
+            delta = inputbuffer & 0xf;
+        } else {
+            inputbuffer = *inp++;
+            delta = (inputbuffer >> 4) & 0xf;
+        }
+        bufferstep = !bufferstep;
+
+        // Step 2 - Find new index value (for later)
+        index += indexTable[delta];
+        if (index < 0)
+            index = 0;
+        if (index > 88)
+            index = 88;
+
+        // Step 3, 4 - Compute difference and new predicted value
+        vpdiff = step >> 3;
+        if (delta & 4)
+            vpdiff += step;
+        if (delta & 2)
+            vpdiff += step >> 1;
+        if (delta & 1)
+            vpdiff += step >> 2;
+
+        if (delta & 8)
+            valpred -= vpdiff;
+        else
+            valpred += vpdiff;
+
+        // Step 5 - clamp output value
+        if (valpred > 32767)
+            valpred = 32767;
+        else if (valpred < -32768)
+            valpred = -32768;
+
+        // Step 6 - Update step value
+        step = stepsizeTable[index];
+
+        // Step 7 - Output value
+        *outp++ = valpred;
+    }
+
+    state->valprev = valpred;
+    state->index = index;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u samples, %u chunk sizes\r\n", INPUT_SAMPLES,
+        (unsigned)NUM_PASSES);
+
+    progress_t prog = { .phase = ADPCM_ENCODE };
+
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_adpcm));
+    TRANSITION_TO(task_adpcm);
+}
+
+/* Codes, checks or decodes one chunk of the clip */
+void task_adpcm() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    progress_t prog;
+    int16_t samples[DECODE_BLOCK];
+    uint16_t len, i, n;
+
+    prog = *CHAN_IN2(progress_t, prog, CH(task_init, task_adpcm),
+                     SELF_IN_CH(task_adpcm));
+
+    switch (prog.phase) {
+        case ADPCM_ENCODE:
+            len = chunk_samples[prog.pass];
+            if (len > INPUT_SAMPLES - prog.pos)
+                len = INPUT_SAMPLES - prog.pos;
+
+            adpcm_coder(&input[prog.pos], &code[prog.pos / 2], len,
+                        &prog.coder);
+            prog.pos += len;
+            prog.cycles += msp_cycles() - start;
+
+            if (prog.pos == INPUT_SAMPLES) {
+                prog.cur.enc_cycles = prog.cycles;
+                prog.cur.enc = prog.coder;
+                prog.cur.crc = crc_init(&crc32_model);
+                prog.phase = ADPCM_CHECK;
+                prog.pos = 0;
+            }
+            break;
+
+        case ADPCM_CHECK:
+            len = CHECK_BYTES;
+            if (len > INPUT_SAMPLES / 2 - prog.pos)
+                len = INPUT_SAMPLES / 2 - prog.pos;
+
+            prog.cur.crc = crc_update(&crc32_model, prog.cur.crc,
+                                      &code[prog.pos], len);
+            prog.pos += len;
+
+            if (prog.pos == INPUT_SAMPLES / 2) {
+                prog.cur.crc = crc_final(&crc32_model, prog.cur.crc);
+                prog.cur.sum = 0;
+                prog.coder.valprev = 0;
+                prog.coder.index = 0;
+                prog.phase = ADPCM_DECODE;
+                prog.pos = 0;
+                prog.cycles = 0;
+            }
+            break;
+
+        case ADPCM_DECODE:
+            len = chunk_samples[prog.pass];
+            if (len > INPUT_SAMPLES - prog.pos)
+                len = INPUT_SAMPLES - prog.pos;
+
+            for ( ; len > 0; len -= n) {
+                n = (len < DECODE_BLOCK) ? len : DECODE_BLOCK;
+                adpcm_decoder(&code[prog.pos / 2], samples, n, &prog.coder);
+                for (i = 0; i < n; ++i)
+                    prog.cur.sum += samples[i];
+                prog.pos += n;
+            }
+            prog.cycles += msp_cycles() - start;
+
+            if (prog.pos < INPUT_SAMPLES)
+                break;
+
+            prog.cur.dec_cycles = prog.cycles;
+            prog.cur.dec = prog.coder;
+            prog.result[prog.pass] = prog.cur;
+
+            prog.coder.valprev = 0;
+            prog.coder.index = 0;
+            prog.phase = ADPCM_ENCODE;
+            prog.pos = 0;
+            prog.cycles = 0;
+            if (++prog.pass == NUM_PASSES) {
+                CHAN_OUT1(progress_t, prog, prog, CH(task_adpcm, task_done));
+                TRANSITION_TO(task_done);
+            }
+            break;
+    }
+
+    CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_adpcm));
+    TRANSITION_TO(task_adpcm);
+}
+
+/* Prints the final predictor as rawcaudio does, and the throughput of each
+ * chunk size over the cycles of the task executions that committed, which
+ * excludes the work lost to power failures. The coded clip must be that of
+ * the reference, and the decoder must end in the state of the coder. */
+void task_done() {
+    task_prologue();
+
+    progress_t prog = *CHAN_IN1(progress_t, prog, CH(task_adpcm, task_done));
+    const adpcm_result_t *r;
+    unsigned pass, ok = 1;
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("Final valprev=%i, index=%u\r\n", prog.result[0].enc.valprev,
+           prog.result[0].enc.index);
+
+    for (pass = 0; pass < NUM_PASSES; ++pass) {
+        r = &prog.result[pass];
+        PRINTF("chunk %u: crc %04x%04x, sum %l, "
+               "encode Cycles %n samples/s %n, "
+               "decode Cycles %n samples/s %n\r\n",
+               chunk_samples[pass], (unsigned)(r->crc >> 16),
+               (unsigned)r->crc, (long)r->sum,
+               (unsigned long)r->enc_cycles,
+               (unsigned long)((uint64_t)INPUT_SAMPLES * CPU_FREQ /
+                               r->enc_cycles),
+               (unsigned long)r->dec_cycles,
+               (unsigned long)((uint64_t)INPUT_SAMPLES * CPU_FREQ /
+                               r->dec_cycles));
+        if (r->crc != ADPCM_CRC32 || r->sum != prog.result[0].sum ||
+            r->dec.valprev != r->enc.valprev || r->dec.index != r->enc.index)
+            ok = 0;
+    }
+    PRINTF("%s\r\n", ok ? "ADPCM ok" : "ADPCM MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
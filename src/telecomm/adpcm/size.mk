@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): samples coded,
+# an even number
+SIZE_small = 2048
+SIZE_medium = 4096
+SIZE_large = 8192
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
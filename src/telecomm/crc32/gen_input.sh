@@ -0,0 +1,41 @@
+#! /bin/bash
+#
+# Generate input.h from the first bytes of the MiBench adpcm speech clip,
+# with the CRC-32 of those bytes (the gzip trailer) to check the result
+#
+# Usage: ./gen_input.sh [bytes] [small.pcm] > input.h
+
+BYTES=${1:-16384}
+INPUT=${2:-../../../mibench-src/telecomm/adpcm/data/small.pcm}
+
+CRC=$(head -c $BYTES $INPUT | gzip -c | tail -c 8 | head -c 4 | od -An -tx1 |
+      awk '{ print $4 $3 $2 $1 }')
+
+head -c $BYTES $INPUT | od -An -v -tu1 | awk -v crc=$CRC '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench adpcm small.pcm */"
+        print ""
+    }
+    {
+        for (f = 1; f <= NF; ++f) {
+            if (n % 12 == 0)
+                line = "   "
+            line = line sprintf(" 0x%02x,", $f)
+            if (n % 12 == 11) {
+                body = body line "\n"
+                line = ""
+            }
+            ++n
+        }
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define INPUT_BYTES " n "UL"
+        print "#define INPUT_CRC32 0x" crc "UL"
+        print ""
+        print "__ro_nv static const uint8_t input[INPUT_BYTES] = {"
+        printf "%s", body
+        print "};"
+    }
+'
@@ -0,0 +1,224 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libwispbase/crc.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines INPUT_BYTES, INPUT_CRC32 and input[], see gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+// Bytes fed to the CRC per task execution. By default the buffer goes
+// through once per chunk size of the sweep, to compare the sizes.
+#ifdef CHUNK_BYTES
+static const uint16_t chunk_bytes[] = { CHUNK_BYTES };
+#else
+static const uint16_t chunk_bytes[] = { 16, 64, 256, 1024 };
+#endif
+
+#define NUM_PASSES (sizeof(chunk_bytes) / sizeof(chunk_bytes[0]))
+
+/** @brief State of the CRC between task executions
+ *  @details The running CRC register and the position in the buffer carry a
+ *           pass from one execution to the next. The results of the passes
+ *           done so far travel with them, so that the whole state commits as
+ *           one self-channel field.
+ *
+ *           An execution is timed from its entry to the entry of the next
+ *           task: the mark taken where its body ends lets the next one add
+ *           the channel write, the transition and the prologue in between.
+ */
+typedef struct {
+    uint32_t crc;                   // register, before the final XOR
+    uint32_t pos;                   // next byte of the buffer
+    uint32_t cycles;                // cycles of the executions that committed
+    uint32_t mark;                  // cycles when the last one left its body,
+    uint16_t mark_boot;             // and in which boot
+    uint16_t pass;                  // chunk size being measured
+    uint32_t result[NUM_PASSES];    // CRC of each pass
+    uint32_t pass_cycles[NUM_PASSES];
+} crc_state_t;
+
+TASK(1, task_init)
+TASK(2, task_crc)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct crc_args {
+    CHAN_FIELD(crc_state_t, crc);
+};
+
+struct crc_state {
+    SELF_CHAN_FIELD(crc_state_t, crc);
+};
+
+#define FIELD_INIT_crc_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_crc, crc_args);
+SELF_CHANNEL(task_crc, crc_state);
+CHANNEL(task_crc, task_done, crc_args);
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+    ++boots;
+}
+
+/** @brief Cycles from the end of the body of the last execution that
+ *         committed to the entry of this one, or 0 if a reboot came in
+ *         between, which restarts the cycle counter
+ */
+static uint32_t transition_cycles(const crc_state_t *s, uint32_t entry) {
+    return s->mark_boot == boots ? entry - s->mark : 0;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %n bytes, %u chunk sizes\r\n", INPUT_BYTES,
+        (unsigned)NUM_PASSES);
+
+    crc_state_t s = { .crc = crc_init(&crc32_model) };
+
+    CHAN_OUT1(crc_state_t, crc, s, CH(task_init, task_crc));
+    TRANSITION_TO(task_crc);
+}
+
+/* Feeds one chunk of the buffer to the CRC */
+void task_crc() {
+    uint32_t entry = msp_cycles(); // before the prologue commits the last one
+
+    task_prologue();
+
+    crc_state_t s;
+    uint16_t len;
+
+    s = *CHAN_IN2(crc_state_t, crc, CH(task_init, task_crc),
+                  SELF_IN_CH(task_crc));
+
+    // The transition into the first chunk of a pass ends the previous pass
+    if (s.pos == 0 && s.pass > 0)
+        s.pass_cycles[s.pass - 1] += transition_cycles(&s, entry);
+    else
+        s.cycles += transition_cycles(&s, entry);
+
+    len = chunk_bytes[s.pass];
+    if (len > INPUT_BYTES - s.pos)
+        len = INPUT_BYTES - s.pos;
+
+    s.crc = crc_update(&crc32_model, s.crc, &input[s.pos], len);
+    s.pos += len;
+
+    s.mark = msp_cycles();
+    s.mark_boot = boots;
+    s.cycles += s.mark - entry;
+
+    if (s.pos == INPUT_BYTES) {
+        s.result[s.pass] = crc_final(&crc32_model, s.crc);
+        s.pass_cycles[s.pass] = s.cycles;
+        s.pass++;
+        s.crc = crc_init(&crc32_model);
+        s.pos = 0;
+        s.cycles = 0;
+    }
+
+    if (s.pass < NUM_PASSES) {
+        CHAN_OUT1(crc_state_t, crc, s, SELF_OUT_CH(task_crc));
+        TRANSITION_TO(task_crc);
+    }
+    CHAN_OUT1(crc_state_t, crc, s, CH(task_crc, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the CRC, and the throughput of each chunk size over the cycles of
+ * the task executions that committed, which excludes the work lost to power
+ * failures */
+void task_done() {
+    uint32_t entry = msp_cycles();
+
+    task_prologue();
+
+    crc_state_t s = *CHAN_IN1(crc_state_t, crc, CH(task_crc, task_done));
+    unsigned pass, ok = 1;
+
+    s.pass_cycles[NUM_PASSES - 1] += transition_cycles(&s, entry);
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("%04x%04x %n\r\n", (unsigned)(s.result[0] >> 16),
+           (unsigned)s.result[0], (unsigned long)INPUT_BYTES);
+
+    for (pass = 0; pass < NUM_PASSES; ++pass) {
+        PRINTF("chunk %u: crc %04x%04x, Cycles %n, bytes/kcycle %n, "
+               "bytes/s %n\r\n", chunk_bytes[pass],
+               (unsigned)(s.result[pass] >> 16), (unsigned)s.result[pass],
+               (unsigned long)s.pass_cycles[pass],
+               (unsigned long)((uint64_t)INPUT_BYTES * 1000 /
+                               s.pass_cycles[pass]),
+               (unsigned long)((uint64_t)INPUT_BYTES * CPU_FREQ /
+                               s.pass_cycles[pass]));
+        if (s.result[pass] != INPUT_CRC32)
+            ok = 0;
+    }
+    PRINTF("%s\r\n", ok ? "CRC ok" : "CRC MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
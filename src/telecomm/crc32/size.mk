@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): bytes of the
+# speech clip checked, at most 32768 (all of it)
+SIZE_small = 4096
+SIZE_medium = 16384
+SIZE_large = 32768
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,41 @@
+#! /bin/bash
+#
+# Generate input.h: samples of a vibration signal in Q15
+#
+# The signal is that of a rotating machine sampled at 1024 Hz: the shaft
+# frequency (64 Hz) and its second harmonic, a weaker bearing tone at 200 Hz,
+# and noise. The shaft frequency falls on bin N/16 of an FFT of the first N
+# samples, for any N from 64 to 1024, which the benchmark checks.
+#
+# Usage: ./gen_input.sh [samples] [seed] > input.h
+
+SAMPLES=${1:-1024}
+SEED=${2:-5}
+
+awk -v n=$SAMPLES -v seed=$SEED '
+    BEGIN {
+        srand(seed)
+        pi = 3.14159265358979
+        print "/* Generated by gen_input.sh */"
+        print ""
+        print "#define INPUT_SAMPLES " n
+        print "#define INPUT_RATE 1024 // Hz"
+        print "#define INPUT_PEAK_HZ 64"
+        print ""
+        print "__ro_nv static const int16_t input[INPUT_SAMPLES] = {"
+        for (i = 0; i < n; i++) {
+            t = i / 1024
+            x = 0.45 * cos(2 * pi * 64 * t) + 0.2 * sin(2 * pi * 128 * t + 0.3)
+            x += 0.1 * sin(2 * pi * 200 * t) + (rand() - 0.5) * 0.1
+            v = int(x * 32768 + (x < 0 ? -0.5 : 0.5))
+            line = line sprintf(" %6d,", v)
+            if (i % 8 == 7) {
+                print "   " line
+                line = ""
+            }
+        }
+        if (line != "")
+            print "   " line
+        print "};"
+    }
+'
@@ -0,0 +1,136 @@
+/* Generated by gen_input.sh */
+
+#define INPUT_SAMPLES 1024
+#define INPUT_RATE 1024 // Hz
+#define INPUT_PEAK_HZ 64
+
+__ro_nv static const int16_t input[INPUT_SAMPLES] = {
+     15944,  21019,  20381,   5640,  -6305, -13298, -14517, -14422,
+    -14069,  -9808,  -6704,   -692,   2333,  -1863,    631,   8365,
+     18552,  21634,  16091,   4723,  -4403,  -9614, -13712, -17223,
+    -17224,  -8973,  -1097,    301,  -1712,  -1425,   1559,  12156,
+     18374,  20426,  14903,   4788,  -1134,  -9807, -14775, -20362,
+    -14516,  -7246,  -1611,    594,  -2613,  -2549,   2634,  12586,
+     17397,  18171,  13325,   7294,   -825,  -7431, -17314, -21316,
+    -13270,  -5187,  -1355,  -4326,  -5039,   -353,   7109,  13816,
+     16431,  16309,  15311,  11935,   1281, -11527, -21147, -19423,
+    -10066,  -5066,  -3940,  -4222,  -6028,    345,   5842,  10636,
+     15858,  16410,  16707,  13397,   -426, -15007, -21306, -17997,
+     -9547,  -5550,  -6488,  -7118,  -2653,   1106,   7210,  10772,
+     13467,  17891,  20443,   9938,  -1931, -13389, -18481, -13984,
+    -10640,  -7323,  -7448,  -5124,  -1388,   2932,   4208,   6186,
+     15863,  21878,  18411,   9046,  -3581, -15454, -15704, -13731,
+    -11223,  -9361,  -7033,  -3488,   2258,    427,   3652,   6884,
+     16792,  23654,  18236,   6132,  -4348, -11061, -12547, -12671,
+    -14177, -11634,  -5761,    299,   1799,   -234,   1377,  10035,
+     19134,  22955,  15148,   5098,  -2928,  -9035, -12661, -16997,
+    -16129, -10751,  -2843,   -294,  -1487,  -3259,   1725,  13228,
+     19175,  21724,  13192,   4269,   -876,  -9549, -13543, -20213,
+    -16083,  -8348,   -471,  -1507,  -5363,  -3939,   5480,  13695,
+     20604,  16797,  14809,   8699,   1656,  -8173, -18959, -21016,
+    -12513,  -5303,  -1651,  -3344,  -3711,   -483,   5887,  12667,
+     17599,  16652,  13643,  10085,   1883, -11963, -19571, -20388,
+    -11603,  -5627,  -3729,  -5233,  -4703,    124,   5940,  11891,
+     14263,  17991,  16090,  11007,    414, -13993, -20119, -16401,
+     -8648,  -4658,  -7186,  -4893,  -1891,   2462,   8288,   9425,
+     11890,  17301,  20522,  12239,  -2957, -15011, -17145, -13271,
+     -9546,  -9054,  -7746,  -5982,    -62,   2732,   4604,   9193,
+     13967,  21658,  19028,   7990,  -6064, -13649, -15163, -12039,
+    -11804,  -9519,  -6391,  -3307,    180,   2146,   2486,   6505,
+     17921,  22567,  20158,   6236,  -3780, -11080, -15007, -14286,
+    -12651, -11115,  -4957,   -126,   2118,  -2310,    684,   8458,
+     20114,  22879,  15792,   6872,  -4476,  -7851, -12471, -15849,
+    -15102,  -9921,  -1515,   1931,  -2214,  -3097,    294,  10353,
+     21527,  18938,  13696,   7190,   -405,  -8227, -15514, -18215,
+    -14242,  -6238,  -2174,    652,  -5329,  -3059,   2785,  14709,
+     18132,  18023,  14320,   7956,    790,  -8472, -18554, -20856,
+    -15260,  -6846,  -2542,  -3541,  -5092,  -2804,   6091,  13639,
+     15769,  17361,  14259,  12003,    637, -10042, -18931, -19793,
+    -10849,  -3413,  -4252,  -4444,  -4886,    184,   7743,  12513,
+     15549,  16028,  15969,  11427,   1428, -13709, -19540, -18132,
+     -9908,  -4970,  -5838,  -4256,  -1247,   4015,   6619,   8239,
+     14152,  19524,  17978,   9979,  -2089, -13639, -18811, -14925,
+     -9237,  -7965,  -8612,  -5856,   1086,   3669,   5353,   8351,
+     12941,  22285,  18605,   7979,  -5152, -13493, -16906, -12387,
+    -11958,  -9913,  -6102,  -2817,   1338,    767,   1790,   6649,
+     15488,  22604,  18042,   7947,  -5648, -11585, -14950, -15845,
+    -15343, -11924,  -6390,   1607,   2246,    282,   1574,   7560,
+     20057,  23346,  14883,   4451,  -3852, -10503, -11964, -15380,
+    -14872,  -9124,  -3832,     43,  -2796,  -2834,   1827,  10615,
+     18550,  21632,  15670,   5621,  -1492,  -9473, -15366, -18718,
+    -16298,  -7523,   -945,  -1275,  -4021,  -4216,   3236,  12684,
+     17442,  17565,  13150,   7890,    958,  -9134, -18151, -20458,
+    -15124,  -5484,   -754,  -3988,  -6744,  -2760,   5906,  12286,
+     15230,  15873,  14614,  10377,   1179,  -9538, -21061, -18030,
+    -11630,  -4314,  -4416,  -3917,  -3667,    471,   6245,  13042,
+     15379,  16637,  16431,  11424,   1375, -12843, -19144, -18050,
+    -10957,  -6064,  -6203,  -6957,  -2297,   3464,   5842,   9926,
+     12113,  19103,  18038,  11759,  -2007, -15708, -18544, -15625,
+     -8931,  -7863,  -8784,  -4330,   1475,   1998,   4131,   8570,
+     15157,  21526,  18821,  10141,  -5046, -12881, -14662, -13329,
+    -12441, -11311,  -6469,  -1074,   2666,   2900,   1944,   5938,
+     17200,  22818,  19110,   6464,  -4226, -13527, -13856, -14116,
+    -13906, -11003,  -6411,    157,   1496,   -962,    343,   9026,
+     18055,  22331,  15234,   5831,  -4256,  -7908, -14803, -16267,
+    -16952,  -9053,  -2975,   -709,   -593,  -1823,    364,  11253,
+     19776,  21238,  14824,   4993,   -552,  -9226, -14265, -19617,
+    -15129,  -6443,    -18,   -855,  -4185,  -4520,   5123,  13794,
+     19399,  16526,  12363,   9443,   -764,  -9484, -17485, -20983,
+    -15404,  -3960,  -2032,  -2064,  -4209,  -2224,   5192,  12770,
+     15372,  17590,  14469,  11459,   -134, -11858, -20878, -18174,
+    -12871,  -3203,  -4140,  -5322,  -6137,   -643,   5949,  12529,
+     13225,  15555,  17471,  10825,    -57, -14413, -20268, -16485,
+    -11004,  -5188,  -5990,  -4469,  -4163,   2963,   5537,   8203,
+     13328,  18653,  20674,  11662,  -1500, -16166, -18785, -13082,
+     -8278,  -7827,  -7646,  -6148,    397,   2841,   5077,   8614,
+     14917,  20235,  21544,   8469,  -4631, -14560, -14769, -12961,
+     -9967, -11205,  -6890,  -3742,   2271,   2174,    829,   6759,
+     16024,  21062,  19834,   5796,  -6440, -13044, -15258, -15677,
+    -13388, -11266,  -6514,   -404,   2076,   -119,   -174,   9365,
+     17606,  21260,  17177,   5797,  -3729,  -9348, -14468, -16542,
+    -15009,  -9139,  -2642,    839,  -1405,  -2604,   2732,  12542,
+     20515,  21052,  15446,   6795,   -255,  -6729, -14024, -18802,
+    -16172,  -6306,    237,  -1320,  -3204,  -4782,   4997,  14325,
+     18066,  18344,  12861,   8638,   -386,  -8651, -18566, -18662,
+    -14657,  -4708,  -1440,  -2129,  -5738,  -2541,   6416,  15257,
+     18147,  16158,  15482,  11254,    932, -10605, -20268, -18151,
+    -11479,  -5616,  -4582,  -6227,  -5535,   2066,   8853,  11798,
+     14475,  15680,  15935,  12454,    901, -13754, -19595, -18057,
+    -11092,  -7200,  -4350,  -6086,  -3215,   2550,   6408,   8649,
+     14761,  17260,  17638,  10883,  -1640, -15316, -19542, -15108,
+     -9840,  -9026,  -7300,  -3831,  -1370,   2814,   3386,   8098,
+     15015,  20284,  19380,   9525,  -3922, -12774, -15285, -12341,
+    -10194, -10081,  -7886,  -3020,   -294,   2048,   1997,   8903,
+     17781,  22471,  17922,   7412,  -4181, -12435, -12391, -14981,
+    -13978, -11330,  -3500,    517,   1985,  -2073,    231,   9373,
+     18977,  22778,  14965,   4601,  -3703,  -8799, -15044, -16743,
+    -16612, -10712,  -2121,    -53,    173,  -4193,    708,  12600,
+     20335,  20393,  13843,   5597,   -305,  -8741, -14525, -19442,
+    -14971,  -7070,    518,   -209,  -2646,  -4096,   2839,  12978,
+     20270,  17249,  13594,   7591,   2345,  -8494, -16536, -20811,
+    -12796,  -5435,  -1204,  -1967,  -4776,  -1053,   6636,  12762,
+     15699,  14776,  15065,   8756,    814, -11523, -20129, -20345,
+    -13162,  -5196,  -2388,  -4075,  -4429,   2102,   6381,  11831,
+     13417,  17218,  18198,  10850,   -681, -12738, -20072, -17777,
+    -10803,  -4164,  -7185,  -4835,  -1967,   3212,   5163,  10725,
+     14041,  18875,  20494,  10045,   -942, -15598, -19296, -16092,
+     -9702,  -6586,  -6132,  -5864,   1106,   1510,   4663,   6238,
+     15249,  20548,  19192,   8178,  -5919, -13438, -16352, -14048,
+    -11097, -10707,  -8343,  -2676,   -259,    346,   1141,   8218,
+     17696,  21194,  19676,   8025,  -5740, -10436, -12762, -13125,
+    -12815, -10533,  -3677,    878,   1478,   -972,   2009,   9100,
+     20343,  21092,  16622,   3970,  -2775,  -8210, -14106, -16718,
+    -16650, -10230,  -1753,    -55,  -1047,  -1403,     21,  11295,
+     18570,  21460,  13151,   5550,   -515,  -9805, -15993, -18490,
+    -15238,  -8715,  -1446,   -983,  -3190,  -4282,   5069,  13801,
+     18398,  17860,  13786,   6647,    268,  -7364, -17456, -19648,
+    -14461,  -5986,    -43,  -1575,  -5815,   -579,   5724,  13236,
+     17240,  16448,  15492,  10087,   1423, -12564, -21122, -20003,
+    -12571,  -4876,  -2820,  -4027,  -4294,    622,   7252,  13371,
+     15824,  15004,  15517,  11180,   1512, -13062, -18579, -17250,
+     -8401,  -4787,  -6265,  -6748,  -2116,   3219,   7001,   8841,
+     12443,  17863,  19940,  12333,  -2996, -13868, -16666, -14277,
+    -10929,  -7665,  -7547,  -3679,  -1453,   4243,   5111,   6088,
+     15768,  21591,  19372,  10890,  -5199, -15042, -16390, -14203,
+    -10048,  -9825,  -7135,  -1775,    631,    115,   3434,   7510,
+};
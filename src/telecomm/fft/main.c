@@ -0,0 +1,329 @@
+#include <msp430.h>
+#include <stdint.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines INPUT_SAMPLES, INPUT_RATE, INPUT_PEAK_HZ and input[], see
+// gen_input.sh
+#include "input.h"
+
+// Defines TWIDDLE_BITS, tw_cos[] and tw_sin[]
+#include "twiddle.h"
+
+// Points of the FFT. By default the benchmark transforms the first N
+// samples of the input for each size from 64 to 1024, to compare the sizes.
+#ifdef FFT_SIZE
+#if (FFT_SIZE & (FFT_SIZE - 1)) || FFT_SIZE < 64 || FFT_SIZE > 1024
+#error FFT_SIZE must be a power of 2 from 64 to 1024
+#endif
+static const uint16_t fft_sizes[] = { FFT_SIZE };
+#define FFT_MAX FFT_SIZE
+#else
+static const uint16_t fft_sizes[] = { 64, 128, 256, 512, 1024 };
+#define FFT_MAX 1024
+#endif
+
+#define NUM_SIZES (sizeof(fft_sizes) / sizeof(fft_sizes[0]))
+
+#if FFT_MAX > (1 << TWIDDLE_BITS) || FFT_MAX > INPUT_SAMPLES
+#error FFT_SIZE is larger than the twiddle table or the input
+#endif
+
+// Butterflies per task execution (and samples copied, or bins checked,
+// twice as many). N / 2 does one whole stage of an N-point FFT.
+#ifndef BUTTERFLIES_PER_TASK
+#define BUTTERFLIES_PER_TASK 16
+#endif
+
+typedef enum {
+    FFT_BITREV = 0,     // copy the input into bit-reversed order
+    FFT_STAGE,          // butterflies of one stage
+    FFT_CHECK,          // find the peak of the spectrum, sum the output
+} fft_phase_t;
+
+typedef struct {
+    uint32_t cycles;    // of the bit reversal and the stages
+    int32_t checksum;   // sum of the real and imaginary parts of the output
+    uint16_t peak;      // bin of the largest magnitude, below N / 2
+} fft_result_t;
+
+/** @brief State of the transforms between task executions
+ *  @details The working arrays are outside the channels (see buf_re), so the
+ *           state is only where the transform is. The results of the sizes
+ *           done so far travel with it, so that the whole state commits as
+ *           one self-channel field.
+ */
+typedef struct {
+    uint16_t phase;     // fft_phase_t
+    uint16_t size;      // index into fft_sizes
+    uint16_t stage;
+    uint16_t next;      // next butterfly, sample or bin
+    uint32_t cycles;    // cycles of the executions that committed
+    uint32_t peak_power;
+    fft_result_t cur;
+    fft_result_t result[NUM_SIZES];
+} fft_state_t;
+
+TASK(1, task_init)
+TASK(2, task_fft)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct fft_args {
+    CHAN_FIELD(fft_state_t, fft);
+};
+
+struct fft_state {
+    SELF_CHAN_FIELD(fft_state_t, fft);
+};
+
+#define FIELD_INIT_fft_state {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_fft, fft_args);
+SELF_CHANNEL(task_fft, fft_state);
+CHANNEL(task_fft, task_done, fft_args);
+
+/* Two pairs of working arrays: each stage reads one pair and writes the
+ * other, so an execution cut short by a power failure only rewrites the same
+ * values when it restarts. Stage s reads pair s % 2, the bit reversal
+ * writes pair 0, and the spectrum ends up in pair log2(N) % 2. */
+__nv static int16_t buf_re[2][FFT_MAX];
+__nv static int16_t buf_im[2][FFT_MAX];
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+static unsigned fft_bits(uint16_t n) {
+    unsigned bits = 0;
+
+    while ((1u << bits) < n)
+        ++bits;
+    return bits;
+}
+
+static uint16_t reverse_bits(uint16_t index, unsigned bits) {
+    uint16_t rev = 0;
+
+    while (bits--) {
+        rev = (rev << 1) | (index & 1);
+        index >>= 1;
+    }
+    return rev;
+}
+
+/** @brief Butterflies [first, last) of a stage, in Q15 (fft_float)
+ *  @details Butterfly b of stage s joins x[j] and x[k = j + 2^s] with the
+ *           twiddle W^n of the 2^(s+1)-point block, n = b mod 2^s. Each
+ *           output is halved, so the spectrum comes out scaled by 1 / N and
+ *           the magnitudes never grow: with a real input below 1, no part
+ *           overflows.
+ */
+static void fft_butterflies(unsigned stage, uint16_t first, uint16_t last) {
+    const int16_t *src_re = buf_re[stage & 1], *src_im = buf_im[stage & 1];
+    int16_t *dst_re = buf_re[(stage + 1) & 1], *dst_im = buf_im[(stage + 1) & 1];
+    uint16_t half = 1u << stage;
+    uint16_t b, n, j, k;
+    int32_t c, s, tr, ti;
+
+    for (b = first; b < last; ++b) {
+        n = b & (half - 1);
+        j = ((b >> stage) << (stage + 1)) | n;
+        k = j + half;
+
+        c = tw_cos[n << (TWIDDLE_BITS - 1 - stage)];
+        s = tw_sin[n << (TWIDDLE_BITS - 1 - stage)];
+        tr = (c * src_re[k] + s * src_im[k]) >> 15;
+        ti = (c * src_im[k] - s * src_re[k]) >> 15;
+
+        dst_re[j] = (src_re[j] + tr) >> 1;
+        dst_im[j] = (src_im[j] + ti) >> 1;
+        dst_re[k] = (src_re[j] - tr) >> 1;
+        dst_im[k] = (src_im[j] - ti) >> 1;
+    }
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+    ++boots;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u sizes, up to %u points\r\n", (unsigned)NUM_SIZES,
+        FFT_MAX);
+
+    fft_state_t s = { .phase = FFT_BITREV };
+
+    CHAN_OUT1(fft_state_t, fft, s, CH(task_init, task_fft));
+    TRANSITION_TO(task_fft);
+}
+
+/* Does a bounded part of one phase of the transform of one size */
+void task_fft() {
+    task_prologue();
+
+    uint32_t start = msp_cycles();
+    fft_state_t s;
+    uint16_t n, end, i;
+    unsigned bits;
+    int16_t *out_re, *out_im;
+    uint32_t power;
+
+    s = *CHAN_IN2(fft_state_t, fft, CH(task_init, task_fft),
+                  SELF_IN_CH(task_fft));
+
+    n = fft_sizes[s.size];
+    bits = fft_bits(n);
+
+    switch (s.phase) {
+        case FFT_BITREV:
+            end = s.next + 2 * BUTTERFLIES_PER_TASK;
+            if (end > n)
+                end = n;
+            for (i = s.next; i < end; ++i) {
+                buf_re[0][reverse_bits(i, bits)] = input[i];
+                buf_im[0][reverse_bits(i, bits)] = 0;
+            }
+            s.next = end;
+            if (s.next == n) {
+                s.phase = FFT_STAGE;
+                s.stage = 0;
+                s.next = 0;
+            }
+            s.cycles += msp_cycles() - start;
+            break;
+
+        case FFT_STAGE:
+            end = s.next + BUTTERFLIES_PER_TASK;
+            if (end > n / 2)
+                end = n / 2;
+            fft_butterflies(s.stage, s.next, end);
+            s.next = end;
+            if (s.next == n / 2) {
+                s.next = 0;
+                if (++s.stage == bits) {
+                    s.phase = FFT_CHECK;
+                    s.cur.cycles = s.cycles + (msp_cycles() - start);
+                    s.cur.checksum = 0;
+                    s.cur.peak = 0;
+                    s.peak_power = 0;
+                }
+            }
+            s.cycles += msp_cycles() - start;
+            break;
+
+        case FFT_CHECK:
+            out_re = buf_re[bits & 1];
+            out_im = buf_im[bits & 1];
+            end = s.next + 2 * BUTTERFLIES_PER_TASK;
+            if (end > n)
+                end = n;
+            for (i = s.next; i < end; ++i) {
+                s.cur.checksum += out_re[i] + out_im[i];
+                if (i == 0 || i >= n / 2)
+                    continue;
+                power = (int32_t)out_re[i] * out_re[i] +
+                        (int32_t)out_im[i] * out_im[i];
+                if (power > s.peak_power) {
+                    s.peak_power = power;
+                    s.cur.peak = i;
+                }
+            }
+            s.next = end;
+            if (s.next < n)
+                break;
+
+            LOG("fft %u: %n cycles\r\n", n, (unsigned long)s.cur.cycles);
+            s.result[s.size] = s.cur;
+            s.phase = FFT_BITREV;
+            s.next = 0;
+            s.cycles = 0;
+            if (++s.size == NUM_SIZES) {
+                CHAN_OUT1(fft_state_t, fft, s, CH(task_fft, task_done));
+                TRANSITION_TO(task_done);
+            }
+            break;
+    }
+
+    CHAN_OUT1(fft_state_t, fft, s, SELF_OUT_CH(task_fft));
+    TRANSITION_TO(task_fft);
+}
+
+/* Prints the cycles of each size over the task executions that committed,
+ * which excludes the work lost to power failures, and checks that the peak
+ * of each spectrum is at the shaft frequency of the input */
+void task_done() {
+    task_prologue();
+
+    fft_state_t s = *CHAN_IN1(fft_state_t, fft, CH(task_fft, task_done));
+    unsigned size, n, ok = 1;
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+
+    for (size = 0; size < NUM_SIZES; ++size) {
+        n = fft_sizes[size];
+        PRINTF("fft %u: Cycles %n, cycles/butterfly %n, peak %u Hz, "
+               "checksum %l\r\n", n, (unsigned long)s.result[size].cycles,
+               (unsigned long)(s.result[size].cycles /
+                               ((n / 2) * fft_bits(n))),
+               (unsigned)((uint32_t)s.result[size].peak * INPUT_RATE / n),
+               (long)s.result[size].checksum);
+        if (s.result[size].peak != (uint32_t)INPUT_PEAK_HZ * n / INPUT_RATE)
+            ok = 0;
+    }
+    PRINTF("%u butterflies per task, %u boots\r\n", BUTTERFLIES_PER_TASK,
+           boots);
+    PRINTF("%s\r\n", ok ? "Peaks ok" : "PEAK MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): points of the one
+# FFT done, a power of 2 from 64 to 1024. The input is the committed one.
+SIZE_small = 64
+SIZE_medium = 256
+SIZE_large = 1024
+SIZE_CFLAGS = -DFFT_SIZE=$(SIZE_N)
@@ -0,0 +1,47 @@
+#! /bin/bash
+#
+# Generate input.h from the first frames of the speech clip of the MiBench
+# telecomm suite, with the CRC-32 of the first coded frames (the gzip
+# trailer), as the reference toast wrote them to data/small.gsm, to check
+# the result
+#
+# A frame is 160 samples (20 ms at 8 kHz), coded into 33 bytes.
+#
+# Usage: ./gen_input.sh [frames] [telecomm dir] > input.h
+
+FRAMES=${1:-50}
+TELECOMM=${2:-../../../mibench-src/telecomm}
+
+CRC=$(head -c $((FRAMES * 33)) $TELECOMM/gsm/data/small.gsm | gzip -c |
+      tail -c 8 | head -c 4 | od -An -tx1 | awk '{ print $4 $3 $2 $1 }')
+
+head -c $((FRAMES * 320)) $TELECOMM/adpcm/data/small.pcm | od -An -v -td2 |
+    awk -v crc=$CRC -v frames=$FRAMES '
+    BEGIN {
+        print "/* Generated by gen_input.sh from MiBench adpcm small.pcm */"
+        print ""
+    }
+    {
+        for (f = 1; f <= NF; ++f) {
+            if (n % 8 == 0)
+                line = "   "
+            line = line sprintf(" %6d,", $f)
+            if (n % 8 == 7) {
+                body = body line "\n"
+                line = ""
+            }
+            ++n
+        }
+    }
+    END {
+        if (line != "")
+            body = body line "\n"
+        print "#define INPUT_FRAMES " frames "U"
+        print "#define INPUT_SAMPLES " n "U"
+        print "#define GSM_CRC32 0x" crc "UL"
+        print ""
+        print "__ro_nv static const int16_t input[INPUT_SAMPLES] = {"
+        printf "%s", body
+        print "};"
+    }
+'
@@ -0,0 +1,816 @@
+#include <msp430.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <libwispbase/wisp-base.h>
+#include <libwispbase/crc.h>
+#include <libio/log.h>
+#include <libmsp/mem.h>
+#include <libmsp/cycles.h>
+#include <libchain/chain.h>
+
+#ifdef CONFIG_LIBEDB_PRINTF
+#include <libedb/edb.h>
+#endif
+
+#include "pin_assign.h"
+
+#define WAIT_TICK_DURATION_ITERS 300000
+
+// Defines INPUT_FRAMES, INPUT_SAMPLES, GSM_CRC32 and input[], see
+// gen_input.sh
+#ifdef SIZED_INPUT
+#include SIZED_INPUT  // generated for SIZE, see bld/Makefile
+#else
+#include "input.h"
+#endif
+
+// MCLK, as configured by WISP_init()
+#ifndef CPU_FREQ
+#define CPU_FREQ 8000000UL
+#endif
+
+#define FRAME_SAMPLES 160   // 20 ms at 8 kHz
+#define FRAME_BYTES 33      // 260 bits of parameters and the magic number
+#define FRAME_MS 20
+#define GSM_MAGIC 0xD
+
+#define HISTORY 120         // d' kept for the long-term predictor
+
+#define MIN_WORD (-32767 - 1)
+#define MAX_WORD 32767
+#define MIN_LONGWORD (-2147483647L - 1)
+#define MAX_LONGWORD 2147483647L
+
+#define SASR(x, by) ((x) >> (by))
+
+/** @brief State of the encoder between frames (struct gsm_state)
+ *  @details The part of the libgsm state that the encoder carries from one
+ *           frame to the next. libgsm keeps the reconstructed residual in a
+ *           280-word array whose last 160 words are scratch for the frame;
+ *           only the first 120 outlive it.
+ */
+typedef struct {
+    int16_t dp[HISTORY];    // reconstructed short-term residual d'
+    int16_t z1;             // offset compensation
+    int32_t L_z2;
+    int16_t mp;             // preemphasis
+    int16_t u[8];           // short-term analysis filter
+    int16_t LARpp[2][8];    // decoded LARs of this frame and the last
+    int16_t j;              // which of LARpp is this frame's
+} gsm_state_t;
+
+/** @brief Progress of the encoding between task executions
+ *  @details The encoder state commits once per frame, along with the CRC of
+ *           the frames coded so far, so that the whole state commits as one
+ *           self-channel field.
+ */
+typedef struct {
+    gsm_state_t gsm;
+    uint16_t frame;         // next frame to code
+    uint32_t crc;           // register, before the final XOR
+    uint32_t codec_cycles;  // in the encoder, over the executions that
+    uint32_t overhead;      // committed, and from entry to entry without it
+    uint32_t mark;          // cycles when the last one left its body,
+    uint16_t mark_boot;     // and in which boot
+} progress_t;
+
+TASK(1, task_init)
+TASK(2, task_encode)
+TASK(3, task_done)
+TASK(4, task_end)
+
+struct gsm_args {
+    CHAN_FIELD(progress_t, prog);
+};
+
+struct gsm_self {
+    SELF_CHAN_FIELD(progress_t, prog);
+};
+
+#define FIELD_INIT_gsm_self {\
+    SELF_FIELD_INITIALIZER\
+}
+
+CHANNEL(task_init, task_encode, gsm_args);
+SELF_CHANNEL(task_encode, gsm_self);
+CHANNEL(task_encode, task_done, gsm_args);
+
+/* The coded frames. A frame depends only on the committed encoder state and
+ * the input, so restarting it writes the same bytes. */
+__nv static uint8_t out[INPUT_FRAMES][FRAME_BYTES];
+
+/* Reconstructed residual of the frame, after the 120 words of history of
+ * the committed state (dp0 of libgsm), too large for the stack. Each
+ * execution copies the history in before it writes the rest. */
+__nv static int16_t dp0[HISTORY + FRAME_SAMPLES];
+
+/* Power cycles since the application was loaded */
+__nv static uint16_t boots;
+
+volatile unsigned work_x;
+
+static void burn(uint32_t iters) {
+    uint32_t iter = iters;
+    while (iter--)
+        work_x++;
+}
+
+/* Saturating arithmetic of add.c, with the semantics of the GSM_ macros */
+
+static inline int16_t gsm_add(int16_t a, int16_t b) {
+    int32_t sum = (int32_t)a + b;
+    return sum < MIN_WORD ? MIN_WORD : sum > MAX_WORD ? MAX_WORD : sum;
+}
+
+static inline int16_t gsm_sub(int16_t a, int16_t b) {
+    int32_t diff = (int32_t)a - b;
+    return diff < MIN_WORD ? MIN_WORD : diff > MAX_WORD ? MAX_WORD : diff;
+}
+
+static inline int16_t gsm_mult(int16_t a, int16_t b) {
+    return SASR((int32_t)a * b, 15);
+}
+
+static inline int16_t gsm_mult_r(int16_t a, int16_t b) {
+    return SASR((int32_t)a * b + 16384, 15);
+}
+
+static inline int16_t gsm_abs(int16_t a) {
+    return a < 0 ? (a == MIN_WORD ? MAX_WORD : -a) : a;
+}
+
+static int32_t gsm_L_add(int32_t a, int32_t b) {
+    uint32_t sum;
+
+    if (a < 0) {
+        if (b >= 0)
+            return a + b;
+        sum = (uint32_t)-(a + 1) + (uint32_t)-(b + 1);
+        return sum >= MAX_LONGWORD ? MIN_LONGWORD : -(int32_t)sum - 2;
+    }
+    if (b <= 0)
+        return a + b;
+    sum = (uint32_t)a + (uint32_t)b;
+    return sum >= MAX_LONGWORD ? MAX_LONGWORD : (int32_t)sum;
+}
+
+/** @brief Left shifts that normalize a (gsm_norm)
+ *  @details Into [2^30, 2^31) if positive, [-2^31, -2^30) if negative. a is
+ *           not zero, nor -1.
+ */
+static int16_t gsm_norm(int32_t a) {
+    int16_t shifts = 0;
+
+    if (a < 0) {
+        if (a <= -1073741824L)
+            return 0;
+        a = ~a;
+    }
+    while (a < 0x40000000L) {
+        a <<= 1;
+        ++shifts;
+    }
+    return shifts;
+}
+
+/* num / denum in Q15, with 0 <= num <= denum */
+static int16_t gsm_div(int16_t num, int16_t denum) {
+    int32_t L_num = num, L_denum = denum;
+    int16_t div = 0;
+    int k = 15;
+
+    if (num == 0)
+        return 0;
+    while (k--) {
+        div <<= 1;
+        L_num <<= 1;
+        if (L_num >= L_denum) {
+            L_num -= L_denum;
+            div++;
+        }
+    }
+    return div;
+}
+
+static int16_t gsm_asr(int16_t a, int n) {
+    if (n >= 16)
+        return -(a < 0);
+    if (n <= -16)
+        return 0;
+    if (n < 0)
+        return a << -n;
+    return SASR(a, n);
+}
+
+static int16_t gsm_asl(int16_t a, int n) {
+    if (n >= 16)
+        return 0;
+    if (n <= -16)
+        return -(a < 0);
+    if (n < 0)
+        return gsm_asr(a, -n);
+    return a << n;
+}
+
+/* Tables 4.1 to 4.6 of GSM 06.10 */
+static const int16_t gsm_A[8] =
+    { 20480, 20480, 20480, 20480, 13964, 15360, 8534, 9036 };
+static const int16_t gsm_B[8] =
+    { 0, 0, 2048, -2560, 94, -1792, -341, -1144 };
+static const int16_t gsm_MIC[8] = { -32, -32, -16, -16, -8, -8, -4, -4 };
+static const int16_t gsm_MAC[8] = { 31, 31, 15, 15, 7, 7, 3, 3 };
+static const int16_t gsm_INVA[8] =
+    { 13107, 13107, 13107, 13107, 19223, 17476, 31454, 29708 };
+static const int16_t gsm_DLB[4] = { 6554, 16384, 26214, 32767 };
+static const int16_t gsm_QLB[4] = { 3277, 11469, 21299, 32767 };
+static const int16_t gsm_H[11] =
+    { -134, -374, 0, 2054, 5741, 8192, 5741, 2054, 0, -374, -134 };
+static const int16_t gsm_NRFAC[8] =
+    { 29128, 26215, 23832, 21846, 20165, 18725, 17476, 16384 };
+static const int16_t gsm_FAC[8] =
+    { 18431, 20479, 22527, 24575, 26623, 28671, 30719, 32767 };
+
+/* Bits of LARc[0..7] in a frame */
+static const uint8_t lar_bits[8] = { 6, 6, 5, 5, 4, 4, 3, 3 };
+
+/** @brief Downscaling, offset compensation and preemphasis (4.2.1 - 4.2.3)
+ */
+static void gsm_preprocess(gsm_state_t *S, const int16_t *s, int16_t *so) {
+    int16_t z1 = S->z1, mp = S->mp;
+    int32_t L_z2 = S->L_z2, L_s2, L_temp;
+    int16_t s1, msp, lsp, SO;
+    int k;
+
+    for (k = 0; k < FRAME_SAMPLES; ++k) {
+        SO = SASR(s[k], 3) << 2;
+
+        s1 = SO - z1;
+        z1 = SO;
+
+        L_s2 = (int32_t)s1 << 15;
+        msp = SASR(L_z2, 15);
+        lsp = L_z2 - ((int32_t)msp << 15);
+        L_s2 += gsm_mult_r(lsp, 32735);
+        L_temp = (int32_t)msp * 32735;
+        L_z2 = gsm_L_add(L_temp, L_s2);
+
+        L_temp = gsm_L_add(L_z2, 16384);
+
+        msp = gsm_mult_r(mp, -28180);
+        mp = SASR(L_temp, 15);
+        so[k] = gsm_add(mp, msp);
+    }
+
+    S->z1 = z1;
+    S->L_z2 = L_z2;
+    S->mp = mp;
+}
+
+/** @brief Autocorrelation of the frame (4.2.4)
+ *  @details The frame is scaled down to avoid an overflow, and scaled back
+ *           up after, which drops the low bits as libgsm does.
+ */
+static void autocorrelation(int16_t *s, int32_t *L_ACF) {
+    int16_t smax = 0, temp, scalauto = 0;
+    int k, i;
+
+    for (k = 0; k < FRAME_SAMPLES; ++k) {
+        temp = gsm_abs(s[k]);
+        if (temp > smax)
+            smax = temp;
+    }
+    if (smax != 0)
+        scalauto = 4 - gsm_norm((int32_t)smax << 16);
+
+    if (scalauto > 0)
+        for (k = 0; k < FRAME_SAMPLES; ++k)
+            s[k] = gsm_mult_r(s[k], 16384 >> (scalauto - 1));
+
+    for (k = 0; k <= 8; ++k) {
+        L_ACF[k] = 0;
+        for (i = k; i < FRAME_SAMPLES; ++i)
+            L_ACF[k] += (int32_t)s[i] * s[i - k];
+        L_ACF[k] <<= 1;
+    }
+
+    if (scalauto > 0)
+        for (k = 0; k < FRAME_SAMPLES; ++k)
+            s[k] <<= scalauto;
+}
+
+/** @brief Reflection coefficients by the Schur recursion (4.2.5)
+ */
+static void reflection_coefficients(const int32_t *L_ACF, int16_t *r) {
+    int16_t ACF[9], P[9], K[9], temp;
+    int i, m, n;
+
+    if (L_ACF[0] == 0) {
+        for (i = 0; i < 8; ++i)
+            r[i] = 0;
+        return;
+    }
+
+    temp = gsm_norm(L_ACF[0]);
+    for (i = 0; i <= 8; ++i)
+        ACF[i] = SASR(L_ACF[i] << temp, 16);
+    for (i = 1; i <= 7; ++i)
+        K[i] = ACF[i];
+    for (i = 0; i <= 8; ++i)
+        P[i] = ACF[i];
+
+    for (n = 1; n <= 8; ++n, ++r) {
+        temp = gsm_abs(P[1]);
+        if (P[0] < temp) {
+            for (i = n; i <= 8; ++i)
+                *r++ = 0;
+            return;
+        }
+
+        *r = gsm_div(temp, P[0]);
+        if (P[1] > 0)
+            *r = -*r;
+        if (n == 8)
+            return;
+
+        temp = gsm_mult_r(P[1], *r);
+        P[0] = gsm_add(P[0], temp);
+        for (m = 1; m <= 8 - n; ++m) {
+            temp = gsm_mult_r(K[m], *r);
+            P[m] = gsm_add(P[m + 1], temp);
+            temp = gsm_mult_r(P[m + 1], *r);
+            K[m] = gsm_add(K[m], temp);
+        }
+    }
+}
+
+/** @brief Log-area ratios from the reflection coefficients, quantized and
+ *         coded (4.2.6 - 4.2.7)
+ */
+static void lar_coding(int16_t *LAR) {
+    int16_t temp;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        temp = gsm_abs(LAR[i]);
+        if (temp < 22118)
+            temp >>= 1;
+        else if (temp < 31130)
+            temp -= 11059;
+        else
+            temp = (temp - 26112) << 2;
+        LAR[i] = LAR[i] < 0 ? -temp : temp;
+    }
+
+    for (i = 0; i < 8; ++i) {
+        temp = gsm_mult(gsm_A[i], LAR[i]);
+        temp = gsm_add(temp, gsm_B[i]);
+        temp = gsm_add(temp, 256);
+        temp = SASR(temp, 9);
+        LAR[i] = temp > gsm_MAC[i] ? gsm_MAC[i] - gsm_MIC[i] :
+                 temp < gsm_MIC[i] ? 0 : temp - gsm_MIC[i];
+    }
+}
+
+/* Decoding of the coded log-area ratios (4.2.8) */
+static void lar_decoding(const int16_t *LARc, int16_t *LARpp) {
+    int16_t temp;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        temp = gsm_add(LARc[i], gsm_MIC[i]) << 10;
+        temp = gsm_sub(temp, gsm_B[i] << 1);
+        temp = gsm_mult_r(gsm_INVA[i], temp);
+        LARpp[i] = gsm_add(temp, temp);
+    }
+}
+
+/** @brief Interpolated LARs for a part of the frame, as reflection
+ *         coefficients (4.2.9)
+ *  @details Samples 0-12 take 3/4 of the last frame's LARs, 13-26 half,
+ *           27-39 1/4 and the rest none.
+ */
+static void interpolate_rp(const int16_t *LARpp_j_1, const int16_t *LARpp_j,
+                           int part, int16_t *rp) {
+    int16_t temp;
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        switch (part) {
+            case 0:
+                temp = gsm_add(SASR(LARpp_j_1[i], 2), SASR(LARpp_j[i], 2));
+                temp = gsm_add(temp, SASR(LARpp_j_1[i], 1));
+                break;
+            case 1:
+                temp = gsm_add(SASR(LARpp_j_1[i], 1), SASR(LARpp_j[i], 1));
+                break;
+            case 2:
+                temp = gsm_add(SASR(LARpp_j_1[i], 2), SASR(LARpp_j[i], 2));
+                temp = gsm_add(temp, SASR(LARpp_j[i], 1));
+                break;
+            default:
+                temp = LARpp_j[i];
+                break;
+        }
+
+        // LARp_to_rp
+        if (temp < 0) {
+            temp = temp == MIN_WORD ? MAX_WORD : -temp;
+            rp[i] = -(temp < 11059 ? temp << 1 :
+                      temp < 20070 ? temp + 11059 :
+                      gsm_add(temp >> 2, 26112));
+        } else {
+            rp[i] = temp < 11059 ? temp << 1 :
+                    temp < 20070 ? temp + 11059 :
+                    gsm_add(temp >> 2, 26112);
+        }
+    }
+}
+
+/** @brief Short-term analysis filtering of the frame (4.2.8 - 4.2.10)
+ *  @details Turns the preprocessed signal into the short-term residual d in
+ *           place, through the lattice filter of the interpolated
+ *           coefficients.
+ */
+static void short_term_analysis(gsm_state_t *S, const int16_t *LARc,
+                                int16_t *s) {
+    static const uint8_t part_end[4] = { 13, 27, 40, FRAME_SAMPLES };
+    int16_t *LARpp_j = S->LARpp[S->j];
+    int16_t *LARpp_j_1 = S->LARpp[S->j ^= 1];
+    int16_t rp[8], di, sav, ui, zzz;
+    int part, k = 0, i;
+
+    lar_decoding(LARc, LARpp_j);
+
+    for (part = 0; part < 4; ++part) {
+        interpolate_rp(LARpp_j_1, LARpp_j, part, rp);
+        for (; k < part_end[part]; ++k) {
+            di = sav = s[k];
+            for (i = 0; i < 8; ++i) {
+                ui = S->u[i];
+                S->u[i] = sav;
+                zzz = gsm_mult_r(rp[i], di);
+                sav = gsm_add(ui, zzz);
+                zzz = gsm_mult_r(rp[i], ui);
+                di = gsm_add(di, zzz);
+            }
+            s[k] = di;
+        }
+    }
+}
+
+/** @brief Lag and gain of the long-term predictor of a sub-frame (4.2.11)
+ *  @details The lag is where the cross-correlation of d with the 120 past
+ *           samples of d' peaks, and takes most of the cycles of the
+ *           encoder: 81 lags of 40 products each.
+ */
+static void ltp_parameters(const int16_t *d, const int16_t *dp,
+                           int16_t *bc_out, int16_t *Nc_out) {
+    int16_t wt[40], dmax = 0, temp = 0, scal, Nc = 40, bc, R, S;
+    int32_t L_max = 0, L_power = 0, L_result, L_temp;
+    int k, lambda;
+
+    for (k = 0; k < 40; ++k) {
+        temp = gsm_abs(d[k]);
+        if (temp > dmax)
+            dmax = temp;
+    }
+    temp = 0;
+    if (dmax != 0)
+        temp = gsm_norm((int32_t)dmax << 16);
+    scal = temp > 6 ? 0 : 6 - temp;
+
+    for (k = 0; k < 40; ++k)
+        wt[k] = SASR(d[k], scal);
+
+    for (lambda = 40; lambda <= 120; ++lambda) {
+        L_result = 0;
+        for (k = 0; k < 40; ++k)
+            L_result += (int32_t)wt[k] * dp[k - lambda];
+        if (L_result > L_max) {
+            Nc = lambda;
+            L_max = L_result;
+        }
+    }
+    *Nc_out = Nc;
+
+    L_max <<= 1;
+    L_max = L_max >> (6 - scal);
+
+    for (k = 0; k < 40; ++k) {
+        L_temp = SASR(dp[k - Nc], 3);
+        L_power += L_temp * L_temp;
+    }
+    L_power <<= 1;
+
+    if (L_max <= 0) {
+        *bc_out = 0;
+        return;
+    }
+    if (L_max >= L_power) {
+        *bc_out = 3;
+        return;
+    }
+
+    temp = gsm_norm(L_power);
+    R = SASR(L_max << temp, 16);
+    S = SASR(L_power << temp, 16);
+
+    for (bc = 0; bc <= 2; ++bc)
+        if (R <= gsm_mult(S, gsm_DLB[bc]))
+            break;
+    *bc_out = bc;
+}
+
+/* Exponent and mantissa of a coded maximum amplitude (4.2.15) */
+static void xmaxc_to_exp_mant(int16_t xmaxc, int16_t *exp_out,
+                              int16_t *mant_out) {
+    int16_t exp = 0, mant;
+
+    if (xmaxc > 15)
+        exp = SASR(xmaxc, 3) - 1;
+    mant = xmaxc - (exp << 3);
+
+    if (mant == 0) {
+        exp = -4;
+        mant = 7;
+    } else {
+        while (mant <= 7) {
+            mant = mant << 1 | 1;
+            exp--;
+        }
+        mant -= 8;
+    }
+
+    *exp_out = exp;
+    *mant_out = mant;
+}
+
+/** @brief RPE encoding of a sub-frame's long-term residual (4.2.13 - 4.2.17)
+ *  @details Weights e, picks the grid of 13 samples with the most energy,
+ *           quantizes it in APCM, and leaves in e the decoded grid, which
+ *           the caller adds back into d'. e has 5 zeros on either side.
+ */
+static void rpe_encoding(int16_t *e, int16_t *xmaxc_out, int16_t *Mc_out,
+                         int16_t *xMc) {
+    int16_t x[40], xM[13], xmax = 0, xmaxc, temp, temp1, temp2, temp3;
+    int16_t exp, mant, Mc = 0;
+    int32_t L_result, L_temp, EM = 0;
+    int i, k, m, itest;
+
+    // Weighting filter
+    for (k = 0; k < 40; ++k) {
+        L_result = 8192 >> 1;
+        for (i = 0; i < 11; ++i)
+            L_result += (int32_t)e[k + i - 5] * gsm_H[i];
+        L_result = SASR(L_result, 13);
+        x[k] = L_result < MIN_WORD ? MIN_WORD :
+               L_result > MAX_WORD ? MAX_WORD : L_result;
+    }
+
+    // Grid selection
+    for (m = 0; m < 4; ++m) {
+        L_result = 0;
+        for (i = 0; i < 13; ++i) {
+            L_temp = SASR(x[m + 3 * i], 2);
+            L_result += L_temp * L_temp;
+        }
+        L_result <<= 1;
+        if (m == 0 || L_result > EM) {
+            Mc = m;
+            EM = L_result;
+        }
+    }
+    for (i = 0; i < 13; ++i)
+        xM[i] = x[Mc + 3 * i];
+    *Mc_out = Mc;
+
+    // APCM quantization
+    for (i = 0; i < 13; ++i) {
+        temp = gsm_abs(xM[i]);
+        if (temp > xmax)
+            xmax = temp;
+    }
+    exp = 0;
+    temp = SASR(xmax, 9);
+    itest = 0;
+    for (i = 0; i <= 5; ++i) {
+        itest |= temp <= 0;
+        temp = SASR(temp, 1);
+        if (itest == 0)
+            exp++;
+    }
+    xmaxc = gsm_add(SASR(xmax, exp + 5), exp << 3);
+    *xmaxc_out = xmaxc;
+
+    xmaxc_to_exp_mant(xmaxc, &exp, &mant);
+    temp1 = 6 - exp;
+    temp2 = gsm_NRFAC[mant];
+    for (i = 0; i < 13; ++i) {
+        temp = xM[i] << temp1;
+        temp = gsm_mult(temp, temp2);
+        temp = SASR(temp, 12);
+        xMc[i] = temp + 4;
+    }
+
+    // APCM inverse quantization, and grid positioning back into e
+    temp1 = gsm_FAC[mant];
+    temp2 = gsm_sub(6, exp);
+    temp3 = gsm_asl(1, gsm_sub(temp2, 1));
+    for (k = 0; k < 40; ++k)
+        e[k] = 0;
+    for (i = 0; i < 13; ++i) {
+        temp = (xMc[i] << 1) - 7;
+        temp <<= 12;
+        temp = gsm_mult_r(temp1, temp);
+        temp = gsm_add(temp, temp3);
+        e[Mc + 3 * i] = gsm_asr(temp, temp2);
+    }
+}
+
+static void put_bits(uint8_t *frame, uint16_t *pos, int16_t value,
+                     unsigned bits) {
+    while (bits--) {
+        if (value & (1 << bits))
+            frame[*pos >> 3] |= 0x80 >> (*pos & 7);
+        ++*pos;
+    }
+}
+
+/** @brief Code one frame (gsm_encode)
+ *  @details Gsm_Coder, then the packing of its parameters MSB first. dp
+ *           holds the 120 words of history, and gets the 160 of the frame
+ *           after them.
+ */
+static void gsm_encode(gsm_state_t *S, int16_t *dp, const int16_t *s,
+                       uint8_t *frame) {
+    int16_t so[FRAME_SAMPLES], e[50];
+    int16_t LARc[8], Nc[4], bc[4], Mc[4], xmaxc[4], xMc[4][13];
+    int32_t L_ACF[9];
+    uint16_t pos = 0;
+    int k, i;
+
+    gsm_preprocess(S, s, so);
+    autocorrelation(so, L_ACF);
+    reflection_coefficients(L_ACF, LARc);
+    lar_coding(LARc);
+    short_term_analysis(S, LARc, so);
+
+    memset(e, 0, sizeof(e));
+    for (k = 0; k < 4; ++k) {
+        int16_t *d = so + k * 40, *dpp = dp + HISTORY + k * 40;
+
+        ltp_parameters(d, dpp, &bc[k], &Nc[k]);
+        // Long-term analysis filtering: the estimate goes into dpp, which
+        // becomes the new d' once the residual is added back
+        for (i = 0; i < 40; ++i) {
+            dpp[i] = gsm_mult_r(gsm_QLB[bc[k]], dpp[i - Nc[k]]);
+            e[5 + i] = gsm_sub(d[i], dpp[i]);
+        }
+        rpe_encoding(e + 5, &xmaxc[k], &Mc[k], xMc[k]);
+        for (i = 0; i < 40; ++i)
+            dpp[i] = gsm_add(e[5 + i], dpp[i]);
+    }
+
+    memset(frame, 0, FRAME_BYTES);
+    put_bits(frame, &pos, GSM_MAGIC, 4);
+    for (i = 0; i < 8; ++i)
+        put_bits(frame, &pos, LARc[i], lar_bits[i]);
+    for (k = 0; k < 4; ++k) {
+        put_bits(frame, &pos, Nc[k], 7);
+        put_bits(frame, &pos, bc[k], 2);
+        put_bits(frame, &pos, Mc[k], 2);
+        put_bits(frame, &pos, xmaxc[k], 6);
+        for (i = 0; i < 13; ++i)
+            put_bits(frame, &pos, xMc[k][i], 3);
+    }
+}
+
+void init() {
+    WISP_init();
+
+    /* Turn on LEDS */
+    GPIO(PORT_LED_1, DIR) |= BIT(PIN_LED_1);
+    GPIO(PORT_LED_2, DIR) |= BIT(PIN_LED_2);
+#if defined(PORT_LED_3)
+    GPIO(PORT_LED_3, DIR) |= BIT(PIN_LED_3);
+#endif
+    // Turn on LED1
+    GPIO(PORT_LED_1, OUT) |= BIT(PIN_LED_1);
+
+    INIT_CONSOLE();
+
+    __enable_interrupt();
+    msp_cycles_start();
+
+    ++boots;
+}
+
+/** @brief Cycles from the end of the body of the last execution that
+ *         committed to the entry of this one, or 0 if a reboot came in
+ *         between, which restarts the cycle counter
+ */
+static uint32_t transition_cycles(const progress_t *prog, uint32_t entry) {
+    return prog->mark_boot == boots ? entry - prog->mark : 0;
+}
+
+void task_init() {
+    task_prologue();
+    LOG("\r\ninit: %u frames\r\n", INPUT_FRAMES);
+
+    // gsm_create: all zero
+    progress_t prog = { .crc = crc_init(&crc32_model) };
+
+    CHAN_OUT1(progress_t, prog, prog, CH(task_init, task_encode));
+    TRANSITION_TO(task_encode);
+}
+
+/* Codes one frame. Besides the encoder, the task measures the cycles from
+ * its entry to the entry of the next task: the prologue, reading the channel,
+ * copying the history in and out, writing the channel back and the
+ * transition. The last two come after the body, so the next task adds them
+ * from the mark left in the channel. */
+void task_encode() {
+    uint32_t entry = msp_cycles(); // before the prologue commits the last one
+
+    task_prologue();
+
+    uint32_t codec_start, codec_cycles;
+    progress_t prog;
+
+    prog = *CHAN_IN2(progress_t, prog, CH(task_init, task_encode),
+                     SELF_IN_CH(task_encode));
+    prog.overhead += transition_cycles(&prog, entry);
+
+    memcpy(dp0, prog.gsm.dp, sizeof(prog.gsm.dp));
+
+    codec_start = msp_cycles();
+    gsm_encode(&prog.gsm, dp0, &input[prog.frame * FRAME_SAMPLES],
+               out[prog.frame]);
+    codec_cycles = msp_cycles() - codec_start;
+    prog.codec_cycles += codec_cycles;
+
+    memcpy(prog.gsm.dp, dp0 + FRAME_SAMPLES, sizeof(prog.gsm.dp));
+    prog.crc = crc_update(&crc32_model, prog.crc, out[prog.frame],
+                          FRAME_BYTES);
+
+    prog.mark = msp_cycles();
+    prog.mark_boot = boots;
+    prog.overhead += prog.mark - entry - codec_cycles;
+
+    if (++prog.frame < INPUT_FRAMES) {
+        CHAN_OUT1(progress_t, prog, prog, SELF_OUT_CH(task_encode));
+        TRANSITION_TO(task_encode);
+    }
+    CHAN_OUT1(progress_t, prog, prog, CH(task_encode, task_done));
+    TRANSITION_TO(task_done);
+}
+
+/* Prints the CRC of the coded frames, and the cycles per frame over the
+ * task executions that committed, which excludes the work lost to power
+ * failures */
+void task_done() {
+    uint32_t entry = msp_cycles();
+
+    task_prologue();
+
+    progress_t prog = *CHAN_IN1(progress_t, prog, CH(task_encode, task_done));
+
+    prog.overhead += transition_cycles(&prog, entry);
+
+    prog.crc = crc_final(&crc32_model, prog.crc);
+
+    // The total goes first: suite.sh takes the first "cycles:" line
+    PRINTF("cycles: %n\r\n", msp_cycles());
+    PRINTF("%04x%04x %u frames\r\n", (unsigned)(prog.crc >> 16),
+           (unsigned)prog.crc, INPUT_FRAMES);
+
+    PRINTF("encoder: Cycles %n, cycles/frame %n, us/frame %n "
+           "(%u ms of speech)\r\n", (unsigned long)prog.codec_cycles,
+           (unsigned long)(prog.codec_cycles / INPUT_FRAMES),
+           (unsigned long)((uint64_t)prog.codec_cycles * 1000000 /
+                           CPU_FREQ / INPUT_FRAMES), FRAME_MS);
+    PRINTF("overhead: Cycles %n, cycles/frame %n (%n.%u%% of the "
+           "encoder), %u bytes of state\r\n", (unsigned long)prog.overhead,
+           (unsigned long)(prog.overhead / INPUT_FRAMES),
+           (unsigned long)((uint64_t)prog.overhead * 100 / prog.codec_cycles),
+           (unsigned)((uint64_t)prog.overhead * 1000 /
+                      prog.codec_cycles % 10),
+           (unsigned)sizeof(progress_t));
+    PRINTF("%u boots\r\n", boots);
+    PRINTF("%s\r\n", prog.crc == GSM_CRC32 ? "CRC ok" : "CRC MISMATCH");
+
+    CHAIN_REPORT();
+    TRANSITION_TO(task_end);
+}
+
+void task_end() {
+    GPIO(PORT_LED_2, OUT) |= BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    GPIO(PORT_LED_2, OUT) &= ~BIT(PIN_LED_2);
+    burn(WAIT_TICK_DURATION_ITERS);
+    TRANSITION_TO(task_end);
+}
+
+ENTRY_TASK(task_init)
+INIT_FUNC(init)
@@ -0,0 +1,6 @@
+# Problem sizes of the benchmark (see SIZE in bld/Makefile): frames of 160
+# samples coded
+SIZE_small = 10
+SIZE_medium = 25
+SIZE_large = 50
+SIZE_INPUT = ./gen_input.sh $(SIZE_N)
@@ -0,0 +1,88 @@
+#! /bin/bash
+#
+# Build each benchmark twice: as a Chain app and as the plain C baseline
+# (LIBCHAIN_BASELINE=1), and report the two side by side. With SIZES, each
+# benchmark is built at each of the problem sizes (see SIZE in bld/Makefile),
+# to see how memory and cycles grow with the input.
+#
+# Memory is taken from the section sizes of the executable:
+#   FRAM = code, read-only data, non-volatile vars, and the .data load image
+#   SRAM = .data, .bss, .noinit
+#
+# Cycles are what the benchmark prints on the console ("cycles: N") when it
+# finishes. They are collected only when CONSOLE is set to the serial device
+# of the board; each build is then programmed onto the board and run on
+# continuous power.
+#
+# Usage: ./suite.sh [benchmark_dir ...]      (default: src/*/*)
+#   CONSOLE=/dev/ttyUSB0   serial device to read the cycle counts from
+#   CONSOLE_TIMEOUT=60     seconds to wait for a benchmark to finish
+#   SIZES="small large"    problem sizes to build (default: the committed
+#                          input only)
+#   TOOLCHAIN_ROOT         MSP430 GCC install (default: /opt/ti/msp430-gcc)
+
+TOOLCHAIN_ROOT=${TOOLCHAIN_ROOT:-/opt/ti/msp430-gcc}
+ELF_SIZE=$TOOLCHAIN_ROOT/bin/msp430-elf-size
+BIN=bld/gcc/blinker.out
+CONSOLE_TIMEOUT=${CONSOLE_TIMEOUT:-60}
+
+if [ $# -eq 0 ]; then
+    set -- src/*/*
+fi
+
+# Prints "<fram bytes> <sram bytes>" for the given executable
+mem_usage() {
+    $ELF_SIZE -A $1 | awk '
+        $1 == ".data" || $1 == ".bss" || $1 == ".noinit" { sram += $2 }
+        $1 == ".text" || $1 ~ /rodata/ || $1 == ".nv" || $1 == ".data" ||
+        $1 ~ /^\.upper\./ || $1 ~ /^\.lower\./ { fram += $2 }
+        END { print fram, sram }'
+}
+
+# Prints the cycle count reported by the program running on the board; takes
+# the make variables of the build, so that prog does not rebuild another one
+run_cycles() {
+    local src=$1
+    shift
+    if [ -z "$CONSOLE" ]; then
+        echo "-"
+        return
+    fi
+    stty -F $CONSOLE 115200 raw -echo
+    make bld/gcc/prog SRC=$src "$@" > /dev/null
+    timeout $CONSOLE_TIMEOUT grep -a -m 1 "cycles:" $CONSOLE \
+        | tr -d '\r' | awk '{ print $2 }'
+}
+
+build() {
+    local src=$1
+    shift
+    make bld/gcc/depclean SRC=$src > /dev/null
+    make bld/gcc/all SRC=$src "$@" > /dev/null
+}
+
+printf "%-28s %-7s %-9s %8s %8s %12s\n" \
+    benchmark size variant fram sram cycles
+for src in "$@"; do
+    src=${src%/}
+    name=$(basename $src)
+    for size in ${SIZES:--}; do
+        [ $size = - ] && size=
+        for variant in chain baseline; do
+            args=(SIZE=$size)
+            if [ $variant = baseline ]; then
+                args+=(LIBCHAIN_BASELINE=1)
+            fi
+            build $src "${args[@]}"
+            if [ $? -ne 0 ]; then
+                printf "%-28s %-7s %-9s %8s\n" $name "${size:--}" $variant \
+                    "build failed"
+                continue
+            fi
+            read fram sram <<< "$(mem_usage $BIN)"
+            cycles=$(run_cycles $src "${args[@]}")
+            printf "%-28s %-7s %-9s %8s %8s %12s\n" $name "${size:--}" \
+                $variant $fram $sram "$cycles"
+        done
+    done
+done